@@ -18,6 +18,12 @@
 #include <algorithm>
 #include <cmath>
 
+#if defined(__aarch64__)
+#include <arm_neon.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
 #include "base/utils/utils.h"
 
 namespace OHOS::Ace {
@@ -31,6 +37,63 @@ inline bool IsEqual(const double& left, const double& right)
     return NearEqual(left, right, epsilon);
 }
 
+// Columns of the matrix are stored contiguously, so dst = matrix * vec is the sum of the columns scaled by the
+// components of [vec], which maps to two lanes of doubles on NEON and SSE2. [vec] and [dst] may be the same array.
+inline void MapColumn(const double (&matrix)[Matrix4::DIMENSION][Matrix4::DIMENSION], const double* vec, double* dst)
+{
+#if defined(__aarch64__)
+    float64x2_t low = vmulq_n_f64(vld1q_f64(&matrix[0][0]), vec[0]);
+    float64x2_t high = vmulq_n_f64(vld1q_f64(&matrix[0][2]), vec[0]);
+    for (int32_t i = 1; i < Matrix4::DIMENSION; ++i) {
+        low = vfmaq_n_f64(low, vld1q_f64(&matrix[i][0]), vec[i]);
+        high = vfmaq_n_f64(high, vld1q_f64(&matrix[i][2]), vec[i]);
+    }
+    vst1q_f64(dst, low);
+    vst1q_f64(dst + 2, high);
+#elif defined(__SSE2__)
+    __m128d scale = _mm_set1_pd(vec[0]);
+    __m128d low = _mm_mul_pd(_mm_loadu_pd(&matrix[0][0]), scale);
+    __m128d high = _mm_mul_pd(_mm_loadu_pd(&matrix[0][2]), scale);
+    for (int32_t i = 1; i < Matrix4::DIMENSION; ++i) {
+        scale = _mm_set1_pd(vec[i]);
+        low = _mm_add_pd(low, _mm_mul_pd(_mm_loadu_pd(&matrix[i][0]), scale));
+        high = _mm_add_pd(high, _mm_mul_pd(_mm_loadu_pd(&matrix[i][2]), scale));
+    }
+    _mm_storeu_pd(dst, low);
+    _mm_storeu_pd(dst + 2, high);
+#else
+    double result[Matrix4::DIMENSION] = { 0.0 };
+    for (int32_t i = 0; i < Matrix4::DIMENSION; ++i) {
+        for (int32_t j = 0; j < Matrix4::DIMENSION; ++j) {
+            result[j] += matrix[i][j] * vec[i];
+        }
+    }
+    std::copy_n(result, Matrix4::DIMENSION, dst);
+#endif
+}
+
+// 2D affine part of the matrix, x and y of a point are mapped in the same register.
+inline void MapPoint(const double (&matrix)[Matrix4::DIMENSION][Matrix4::DIMENSION], double x, double y,
+    double& dstX, double& dstY)
+{
+#if defined(__aarch64__)
+    float64x2_t result = vfmaq_n_f64(vld1q_f64(&matrix[3][0]), vld1q_f64(&matrix[0][0]), x);
+    result = vfmaq_n_f64(result, vld1q_f64(&matrix[1][0]), y);
+    dstX = vgetq_lane_f64(result, 0);
+    dstY = vgetq_lane_f64(result, 1);
+#elif defined(__SSE2__)
+    __m128d result = _mm_add_pd(_mm_loadu_pd(&matrix[3][0]), _mm_mul_pd(_mm_loadu_pd(&matrix[0][0]), _mm_set1_pd(x)));
+    result = _mm_add_pd(result, _mm_mul_pd(_mm_loadu_pd(&matrix[1][0]), _mm_set1_pd(y)));
+    double values[2];
+    _mm_storeu_pd(values, result);
+    dstX = values[0];
+    dstY = values[1];
+#else
+    dstX = matrix[0][0] * x + matrix[1][0] * y + matrix[3][0];
+    dstY = matrix[0][1] * x + matrix[1][1] * y + matrix[3][1];
+#endif
+}
+
 } // namespace
 
 Matrix4 Matrix4::CreateIdentity()
@@ -236,7 +299,7 @@ bool Matrix4::operator==(const Matrix4& matrix) const
     return std::equal(&matrix4x4_[0][0], &matrix4x4_[0][0] + MATRIX_LENGTH, &matrix.matrix4x4_[0][0], IsEqual);
 }
 
-Matrix4 Matrix4::operator*(double num)
+Matrix4 Matrix4::operator*(double num) const
 {
     Matrix4 ret(*this);
     auto function = [num](double& v) { v *= num; };
@@ -247,41 +310,14 @@ Matrix4 Matrix4::operator*(double num)
     return ret;
 }
 
-Matrix4 Matrix4::operator*(const Matrix4& matrix)
+Matrix4 Matrix4::operator*(const Matrix4& matrix) const
 {
-    return Matrix4(
-        matrix4x4_[0][0] * matrix(0, 0) + matrix4x4_[1][0] * matrix(0, 1) + matrix4x4_[2][0] * matrix(0, 2) +
-            matrix4x4_[3][0] * matrix(0, 3),
-        matrix4x4_[0][0] * matrix(1, 0) + matrix4x4_[1][0] * matrix(1, 1) + matrix4x4_[2][0] * matrix(1, 2) +
-            matrix4x4_[3][0] * matrix(1, 3),
-        matrix4x4_[0][0] * matrix(2, 0) + matrix4x4_[1][0] * matrix(2, 1) + matrix4x4_[2][0] * matrix(2, 2) +
-            matrix4x4_[3][0] * matrix(2, 3),
-        matrix4x4_[0][0] * matrix(3, 0) + matrix4x4_[1][0] * matrix(3, 1) + matrix4x4_[2][0] * matrix(3, 2) +
-            matrix4x4_[3][0] * matrix(3, 3),
-        matrix4x4_[0][1] * matrix(0, 0) + matrix4x4_[1][1] * matrix(0, 1) + matrix4x4_[2][1] * matrix(0, 2) +
-            matrix4x4_[3][1] * matrix(0, 3),
-        matrix4x4_[0][1] * matrix(1, 0) + matrix4x4_[1][1] * matrix(1, 1) + matrix4x4_[2][1] * matrix(1, 2) +
-            matrix4x4_[3][1] * matrix(1, 3),
-        matrix4x4_[0][1] * matrix(2, 0) + matrix4x4_[1][1] * matrix(2, 1) + matrix4x4_[2][1] * matrix(2, 2) +
-            matrix4x4_[3][1] * matrix(2, 3),
-        matrix4x4_[0][1] * matrix(3, 0) + matrix4x4_[1][1] * matrix(3, 1) + matrix4x4_[2][1] * matrix(3, 2) +
-            matrix4x4_[3][1] * matrix(3, 3),
-        matrix4x4_[0][2] * matrix(0, 0) + matrix4x4_[1][2] * matrix(0, 1) + matrix4x4_[2][2] * matrix(0, 2) +
-            matrix4x4_[3][2] * matrix(0, 3),
-        matrix4x4_[0][2] * matrix(1, 0) + matrix4x4_[1][2] * matrix(1, 1) + matrix4x4_[2][2] * matrix(1, 2) +
-            matrix4x4_[3][2] * matrix(1, 3),
-        matrix4x4_[0][2] * matrix(2, 0) + matrix4x4_[1][2] * matrix(2, 1) + matrix4x4_[2][2] * matrix(2, 2) +
-            matrix4x4_[3][2] * matrix(2, 3),
-        matrix4x4_[0][2] * matrix(3, 0) + matrix4x4_[1][2] * matrix(3, 1) + matrix4x4_[2][2] * matrix(3, 2) +
-            matrix4x4_[3][2] * matrix(3, 3),
-        matrix4x4_[0][3] * matrix(0, 0) + matrix4x4_[1][3] * matrix(0, 1) + matrix4x4_[2][3] * matrix(0, 2) +
-            matrix4x4_[3][3] * matrix(0, 3),
-        matrix4x4_[0][3] * matrix(1, 0) + matrix4x4_[1][3] * matrix(1, 1) + matrix4x4_[2][3] * matrix(1, 2) +
-            matrix4x4_[3][3] * matrix(1, 3),
-        matrix4x4_[0][3] * matrix(2, 0) + matrix4x4_[1][3] * matrix(2, 1) + matrix4x4_[2][3] * matrix(2, 2) +
-            matrix4x4_[3][3] * matrix(2, 3),
-        matrix4x4_[0][3] * matrix(3, 0) + matrix4x4_[1][3] * matrix(3, 1) + matrix4x4_[2][3] * matrix(3, 2) +
-            matrix4x4_[3][3] * matrix(3, 3));
+    // Column i of the product is this matrix mapping column i of [matrix].
+    Matrix4 result;
+    for (int32_t i = 0; i < DIMENSION; ++i) {
+        MapColumn(matrix4x4_, matrix.matrix4x4_[i], result.matrix4x4_[i]);
+    }
+    return result;
 }
 
 Matrix4N Matrix4::operator*(const Matrix4N& matrix) const
@@ -300,12 +336,47 @@ Matrix4N Matrix4::operator*(const Matrix4N& matrix) const
     return matrix4n;
 }
 
-Point Matrix4::operator*(const Point& point)
+Point Matrix4::operator*(const Point& point) const
 {
-    double x = point.GetX();
-    double y = point.GetY();
-    return Point(matrix4x4_[0][0] * x + matrix4x4_[1][0] * y + matrix4x4_[3][0],
-        matrix4x4_[0][1] * x + matrix4x4_[1][1] * y + matrix4x4_[3][1]);
+    double x = 0.0;
+    double y = 0.0;
+    MapPoint(matrix4x4_, point.GetX(), point.GetY(), x, y);
+    return Point(x, y);
+}
+
+void Matrix4::MapPoints(const Point* src, Point* dst, size_t count) const
+{
+    if (!src || !dst) {
+        return;
+    }
+    for (size_t i = 0; i < count; ++i) {
+        double x = 0.0;
+        double y = 0.0;
+        MapPoint(matrix4x4_, src[i].GetX(), src[i].GetY(), x, y);
+        if (src != dst) {
+            dst[i] = src[i];
+        }
+        dst[i].SetX(x);
+        dst[i].SetY(y);
+    }
+}
+
+Rect Matrix4::MapRect(const Rect& rect) const
+{
+    Point corners[] = { Point(rect.Left(), rect.Top()), Point(rect.Right(), rect.Top()),
+        Point(rect.Left(), rect.Bottom()), Point(rect.Right(), rect.Bottom()) };
+    MapPoints(corners, corners, ArraySize(corners));
+    double left = corners[0].GetX();
+    double right = left;
+    double top = corners[0].GetY();
+    double bottom = top;
+    for (const auto& corner : corners) {
+        left = std::min(left, corner.GetX());
+        right = std::max(right, corner.GetX());
+        top = std::min(top, corner.GetY());
+        bottom = std::max(bottom, corner.GetY());
+    }
+    return Rect(left, top, right - left, bottom - top);
 }
 
 Matrix4& Matrix4::operator=(const Matrix4& matrix)
@@ -384,21 +455,7 @@ void Matrix4::Transpose()
 
 void Matrix4::MapScalars(const double src[DIMENSION], double dst[DIMENSION]) const
 {
-    double storage[DIMENSION];
-
-    double* result = (src == dst) ? storage : dst;
-
-    for (int i = 0; i < DIMENSION; i++) {
-        double value = 0;
-        for (int j = 0; j < DIMENSION; j++) {
-            value += matrix4x4_[j][i] * src[j];
-        }
-        result[i] = value;
-    }
-
-    if (storage == result) {
-        std::copy_n(result, DIMENSION, dst);
-    }
+    MapColumn(matrix4x4_, src, dst);
 }
 
 std::string Matrix4::ToString() const
@@ -16,9 +16,11 @@
 #ifndef FOUNDATION_ACE_FRAMEWORKS_BASE_GEOMETRY_MATRIX4_H
 #define FOUNDATION_ACE_FRAMEWORKS_BASE_GEOMETRY_MATRIX4_H
 
+#include <cstddef>
 #include <vector>
 
 #include "base/geometry/point.h"
+#include "base/geometry/rect.h"
 
 namespace OHOS::Ace {
 
@@ -64,13 +66,17 @@ public:
     int32_t Count() const;
 
     bool operator==(const Matrix4& matrix) const;
-    Matrix4 operator*(double num);
-    Matrix4 operator*(const Matrix4& matrix);
+    Matrix4 operator*(double num) const;
+    Matrix4 operator*(const Matrix4& matrix) const;
 
     Matrix4N operator*(const Matrix4N& matrix) const;
 
-    // Transform point by the matrix
-    Point operator*(const Point& point);
+    // Transform point by the matrix, the perspective of the matrix is ignored.
+    Point operator*(const Point& point) const;
+    // Transform [count] points like operator*(const Point&), [src] and [dst] may be the same array.
+    void MapPoints(const Point* src, Point* dst, size_t count) const;
+    // Bounding rect of the four transformed corners of [rect].
+    Rect MapRect(const Rect& rect) const;
     Matrix4& operator=(const Matrix4& matrix);
     double operator[](int32_t index) const;
     inline double Get(int32_t row, int32_t col) const
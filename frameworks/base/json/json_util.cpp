@@ -15,9 +15,962 @@
 
 #include "base/json/json_util.h"
 
-#include "cJSON.h"
+#include <algorithm>
+#include <cfloat>
+#include <climits>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "base/utils/noncopyable.h"
 
 namespace OHOS::Ace {
+namespace {
+
+// children of smaller objects and arrays are searched linearly, which is faster than hashing them.
+constexpr int32_t INDEX_MIN_CHILD_COUNT = 16;
+constexpr size_t MIN_BLOCK_NODE_COUNT = 8;
+constexpr size_t MAX_BLOCK_NODE_COUNT = 1024;
+// same as cJSON
+constexpr int32_t NESTING_LIMIT = 1000;
+constexpr size_t MAX_NUMBER_LENGTH = 63;
+constexpr size_t NUMBER_BUFFER_SIZE = 26;
+constexpr char UTF8_BOM[] = "\xEF\xBB\xBF";
+constexpr size_t UTF8_BOM_LENGTH = sizeof(UTF8_BOM) - 1;
+
+char ToLower(char c)
+{
+    return (c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : c;
+}
+
+// keys are matched case-insensitively like cJSON_GetObjectItem.
+struct KeyHash {
+    size_t operator()(std::string_view key) const
+    {
+        constexpr size_t FNV_OFFSET_BASIS = 14695981039346656037ULL;
+        constexpr size_t FNV_PRIME = 1099511628211ULL;
+        size_t hash = FNV_OFFSET_BASIS;
+        for (auto c : key) {
+            hash = (hash ^ static_cast<unsigned char>(ToLower(c))) * FNV_PRIME;
+        }
+        return hash;
+    }
+};
+
+struct KeyEqual {
+    bool operator()(std::string_view lhs, std::string_view rhs) const
+    {
+        if (lhs.size() != rhs.size()) {
+            return false;
+        }
+        for (size_t i = 0; i < lhs.size(); ++i) {
+            if (ToLower(lhs[i]) != ToLower(rhs[i])) {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+} // namespace
+
+enum class JsonType : uint8_t {
+    NULL_VALUE = 0,
+    FALSE_VALUE,
+    TRUE_VALUE,
+    NUMBER,
+    STRING,
+    ARRAY,
+    OBJECT,
+};
+
+class JsonDocument;
+
+// Node of the DOM, allocated from the arena of its document. Children are linked in document order, large objects
+// and arrays get an index for O(1) lookup when they are built and keep it in sync on every mutation, so lookups only
+// read the tree and a tree may be read from several threads like a cJSON one.
+struct JsonNode {
+    JsonType type = JsonType::NULL_VALUE;
+    // items of objects have keys, which may be empty, items of arrays don't.
+    bool hasKey = false;
+    // some keys are in the object more than once, only the first of them is in the key index.
+    bool hasDuplicateKey = false;
+    int32_t childCount = 0;
+    double number = 0.0;
+    std::string key;
+    std::string value;
+    JsonNode* prev = nullptr;
+    JsonNode* next = nullptr;
+    JsonNode* child = nullptr;
+    JsonNode* lastChild = nullptr;
+    JsonDocument* document = nullptr;
+    // the first child of every key, keys are views of the keys of the children.
+    std::unique_ptr<std::unordered_map<std::string_view, JsonNode*, KeyHash, KeyEqual>> keyIndex;
+    std::unique_ptr<std::vector<JsonNode*>> itemIndex;
+};
+
+// Arena of a parsed or created json tree. Nodes are allocated in growing blocks and all freed with the document,
+// deleted nodes are reused by later ones so mutating a long-lived document doesn't grow it.
+class JsonDocument final {
+public:
+    JsonDocument() = default;
+    ~JsonDocument() = default;
+
+    JsonNode* CreateNode(JsonType type)
+    {
+        JsonNode* node = nullptr;
+        if (!freeNodes_.empty()) {
+            node = freeNodes_.back();
+            freeNodes_.pop_back();
+        } else {
+            if (blocks_.empty() || blockUsed_ == blockSize_) {
+                blockSize_ = blocks_.empty() ? MIN_BLOCK_NODE_COUNT : std::min(blockSize_ * 2, MAX_BLOCK_NODE_COUNT);
+                blocks_.emplace_back(std::make_unique<JsonNode[]>(blockSize_));
+                blockUsed_ = 0;
+            }
+            node = &blocks_.back()[blockUsed_++];
+            node->document = this;
+        }
+        node->type = type;
+        return node;
+    }
+
+    void ReleaseNode(JsonNode* node)
+    {
+        auto child = node->child;
+        while (child) {
+            auto next = child->next;
+            ReleaseNode(child);
+            child = next;
+        }
+        node->type = JsonType::NULL_VALUE;
+        node->hasKey = false;
+        node->hasDuplicateKey = false;
+        node->childCount = 0;
+        node->number = 0.0;
+        node->key.clear();
+        node->value.clear();
+        node->prev = nullptr;
+        node->next = nullptr;
+        node->child = nullptr;
+        node->lastChild = nullptr;
+        node->keyIndex.reset();
+        node->itemIndex.reset();
+        freeNodes_.emplace_back(node);
+    }
+
+private:
+    std::vector<std::unique_ptr<JsonNode[]>> blocks_;
+    size_t blockSize_ = 0;
+    size_t blockUsed_ = 0;
+    std::vector<JsonNode*> freeNodes_;
+
+    ACE_DISALLOW_COPY_AND_MOVE(JsonDocument);
+};
+
+namespace {
+
+void AddToIndex(JsonNode* parent, JsonNode* child)
+{
+    if (parent->itemIndex) {
+        parent->itemIndex->emplace_back(child);
+    }
+    if (parent->keyIndex && child->hasKey && !parent->keyIndex->try_emplace(child->key, child).second) {
+        parent->hasDuplicateKey = true;
+    }
+}
+
+// Indexes the children of a container which has become large, by keys for an object and by positions for an array.
+void BuildIndex(JsonNode* node)
+{
+    if (node->childCount < INDEX_MIN_CHILD_COUNT || node->keyIndex || node->itemIndex) {
+        return;
+    }
+    if (node->type == JsonType::OBJECT) {
+        node->keyIndex = std::make_unique<std::unordered_map<std::string_view, JsonNode*, KeyHash, KeyEqual>>();
+        node->keyIndex->reserve(node->childCount);
+    } else if (node->type == JsonType::ARRAY) {
+        node->itemIndex = std::make_unique<std::vector<JsonNode*>>();
+        node->itemIndex->reserve(node->childCount);
+    } else {
+        return;
+    }
+    for (auto child = node->child; child; child = child->next) {
+        AddToIndex(node, child);
+    }
+}
+
+// Links [child] as the last child of [parent] without indexing it, the builders index the parent once it's complete.
+void LinkChild(JsonNode* parent, JsonNode* child)
+{
+    child->prev = parent->lastChild;
+    child->next = nullptr;
+    if (parent->lastChild) {
+        parent->lastChild->next = child;
+    } else {
+        parent->child = child;
+    }
+    parent->lastChild = child;
+    ++parent->childCount;
+}
+
+void AppendChild(JsonNode* parent, JsonNode* child)
+{
+    LinkChild(parent, child);
+    if (parent->keyIndex || parent->itemIndex) {
+        AddToIndex(parent, child);
+    } else {
+        BuildIndex(parent);
+    }
+}
+
+void AppendChild(JsonNode* parent, const char* key, JsonNode* child)
+{
+    child->hasKey = true;
+    child->key.assign(key);
+    AppendChild(parent, child);
+}
+
+void RemoveFromIndex(JsonNode* parent, JsonNode* child)
+{
+    if (parent->itemIndex) {
+        auto& items = *parent->itemIndex;
+        items.erase(std::find(items.begin(), items.end(), child));
+    }
+    if (!parent->keyIndex || !child->hasKey) {
+        return;
+    }
+    auto iter = parent->keyIndex->find(child->key);
+    if (iter == parent->keyIndex->end() || iter->second != child) {
+        return;
+    }
+    parent->keyIndex->erase(iter);
+    if (!parent->hasDuplicateKey) {
+        return;
+    }
+    // the next child with the same key becomes the first one.
+    for (auto next = child->next; next; next = next->next) {
+        if (next->hasKey && KeyEqual()(next->key, child->key)) {
+            parent->keyIndex->emplace(next->key, next);
+            break;
+        }
+    }
+}
+
+void UnlinkChild(JsonNode* parent, JsonNode* child)
+{
+    RemoveFromIndex(parent, child);
+    if (child->prev) {
+        child->prev->next = child->next;
+    } else {
+        parent->child = child->next;
+    }
+    if (child->next) {
+        child->next->prev = child->prev;
+    } else {
+        parent->lastChild = child->prev;
+    }
+    child->prev = nullptr;
+    child->next = nullptr;
+    --parent->childCount;
+}
+
+// [item] is replaced by [replacement] with [key], and released.
+void ReplaceChild(JsonNode* parent, JsonNode* item, const char* key, JsonNode* replacement)
+{
+    replacement->hasKey = true;
+    replacement->key.assign(key);
+    replacement->prev = item->prev;
+    replacement->next = item->next;
+    if (item->prev) {
+        item->prev->next = replacement;
+    } else {
+        parent->child = replacement;
+    }
+    if (item->next) {
+        item->next->prev = replacement;
+    } else {
+        parent->lastChild = replacement;
+    }
+    if (parent->keyIndex) {
+        // [item] is the first child of both keys, which are equal ignoring case.
+        parent->keyIndex->erase(item->key);
+        parent->keyIndex->emplace(replacement->key, replacement);
+    }
+    if (parent->itemIndex) {
+        auto& items = *parent->itemIndex;
+        *std::find(items.begin(), items.end(), item) = replacement;
+    }
+    item->prev = nullptr;
+    item->next = nullptr;
+    parent->document->ReleaseNode(item);
+}
+
+JsonNode* FindChild(const JsonNode* object, std::string_view key)
+{
+    if (!object) {
+        return nullptr;
+    }
+    if (object->keyIndex) {
+        auto iter = object->keyIndex->find(key);
+        return iter == object->keyIndex->end() ? nullptr : iter->second;
+    }
+    for (auto child = object->child; child; child = child->next) {
+        if (child->hasKey && KeyEqual()(child->key, key)) {
+            return child;
+        }
+    }
+    return nullptr;
+}
+
+JsonNode* GetItem(const JsonNode* array, int32_t index)
+{
+    if (!array || index < 0 || index >= array->childCount) {
+        return nullptr;
+    }
+    if (array->itemIndex) {
+        return (*array->itemIndex)[index];
+    }
+    auto child = array->child;
+    while (child && index > 0) {
+        child = child->next;
+        --index;
+    }
+    return child;
+}
+
+JsonNode* CopyNode(const JsonNode* source, JsonDocument* document)
+{
+    auto node = document->CreateNode(source->type);
+    node->hasKey = source->hasKey;
+    node->key = source->key;
+    node->number = source->number;
+    node->value = source->value;
+    for (auto child = source->child; child; child = child->next) {
+        LinkChild(node, CopyNode(child, document));
+    }
+    BuildIndex(node);
+    return node;
+}
+
+int32_t ToSaturatedInt(double number)
+{
+    if (number >= INT_MAX) {
+        return INT_MAX;
+    }
+    if (number <= static_cast<double>(INT_MIN)) {
+        return INT_MIN;
+    }
+    return static_cast<int32_t>(number);
+}
+
+bool IsNumberChar(char c)
+{
+    return (c >= '0' && c <= '9') || c == '+' || c == '-' || c == 'e' || c == 'E' || c == '.';
+}
+
+uint32_t ParseHex4(const char* data)
+{
+    uint32_t code = 0;
+    for (size_t i = 0; i < 4; ++i) {
+        auto c = data[i];
+        code <<= 4;
+        if (c >= '0' && c <= '9') {
+            code += static_cast<uint32_t>(c - '0');
+        } else if (c >= 'A' && c <= 'F') {
+            code += static_cast<uint32_t>(c - 'A' + 10);
+        } else if (c >= 'a' && c <= 'f') {
+            code += static_cast<uint32_t>(c - 'a' + 10);
+        } else {
+            // same as cJSON, invalid digits make the code 0.
+            return 0;
+        }
+    }
+    return code;
+}
+
+void AppendUtf8(std::string& out, uint32_t codepoint)
+{
+    if (codepoint < 0x80) {
+        out.push_back(static_cast<char>(codepoint));
+    } else if (codepoint < 0x800) {
+        out.push_back(static_cast<char>(0xC0 | (codepoint >> 6)));
+        out.push_back(static_cast<char>(0x80 | (codepoint & 0x3F)));
+    } else if (codepoint < 0x10000) {
+        out.push_back(static_cast<char>(0xE0 | (codepoint >> 12)));
+        out.push_back(static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F)));
+        out.push_back(static_cast<char>(0x80 | (codepoint & 0x3F)));
+    } else {
+        out.push_back(static_cast<char>(0xF0 | (codepoint >> 18)));
+        out.push_back(static_cast<char>(0x80 | ((codepoint >> 12) & 0x3F)));
+        out.push_back(static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F)));
+        out.push_back(static_cast<char>(0x80 | (codepoint & 0x3F)));
+    }
+}
+
+// Streaming reader reporting values to [Handler] in document order without building any tree. The grammar is the
+// same as cJSON: optional utf-8 bom, raw control characters in strings and nesting up to NESTING_LIMIT.
+template<class Handler>
+class JsonReader final {
+public:
+    JsonReader(const char* data, size_t length, Handler& handler) : cur_(data), end_(data + length), handler_(handler)
+    {}
+    ~JsonReader() = default;
+
+    bool Parse()
+    {
+        if (static_cast<size_t>(end_ - cur_) >= UTF8_BOM_LENGTH && memcmp(cur_, UTF8_BOM, UTF8_BOM_LENGTH) == 0) {
+            cur_ += UTF8_BOM_LENGTH;
+        }
+        SkipWhitespace();
+        if (!ParseValue(0)) {
+            return false;
+        }
+        SkipWhitespace();
+        return cur_ == end_;
+    }
+
+    // end of the parsed data, or where the error is.
+    const char* GetPosition() const
+    {
+        return cur_;
+    }
+
+private:
+    void SkipWhitespace()
+    {
+        while (cur_ < end_ && static_cast<unsigned char>(*cur_) <= ' ') {
+            ++cur_;
+        }
+    }
+
+    bool ConsumeLiteral(const char* literal, size_t length)
+    {
+        if (static_cast<size_t>(end_ - cur_) < length || strncmp(cur_, literal, length) != 0) {
+            return false;
+        }
+        cur_ += length;
+        return true;
+    }
+
+    bool ParseValue(int32_t depth)
+    {
+        if (cur_ >= end_) {
+            return false;
+        }
+        switch (*cur_) {
+            case 'n':
+                if (!ConsumeLiteral("null", strlen("null"))) {
+                    return false;
+                }
+                handler_.Null();
+                return true;
+            case 'f':
+                if (!ConsumeLiteral("false", strlen("false"))) {
+                    return false;
+                }
+                handler_.Bool(false);
+                return true;
+            case 't':
+                if (!ConsumeLiteral("true", strlen("true"))) {
+                    return false;
+                }
+                handler_.Bool(true);
+                return true;
+            case '"':
+                return ParseString(false);
+            case '[':
+                return ParseArray(depth);
+            case '{':
+                return ParseObject(depth);
+            default:
+                if (*cur_ == '-' || (*cur_ >= '0' && *cur_ <= '9')) {
+                    return ParseNumber();
+                }
+                return false;
+        }
+    }
+
+    bool ParseNumber()
+    {
+        char buffer[MAX_NUMBER_LENGTH + 1] = { 0 };
+        size_t length = 0;
+        while (length < MAX_NUMBER_LENGTH && cur_ + length < end_ && IsNumberChar(cur_[length])) {
+            buffer[length] = cur_[length];
+            ++length;
+        }
+        char* numberEnd = nullptr;
+        double number = strtod(buffer, &numberEnd);
+        if (numberEnd == buffer) {
+            return false;
+        }
+        cur_ += numberEnd - buffer;
+        handler_.Number(number);
+        return true;
+    }
+
+    // [isKey] strings are the keys of object members.
+    bool ParseString(bool isKey)
+    {
+        if (cur_ >= end_ || *cur_ != '"') {
+            return false;
+        }
+        auto begin = cur_ + 1;
+        auto end = begin;
+        bool hasEscape = false;
+        while (end < end_ && *end != '"') {
+            if (*end == '\\') {
+                if (end + 1 >= end_) {
+                    return false;
+                }
+                hasEscape = true;
+                ++end;
+            }
+            ++end;
+        }
+        if (end >= end_) {
+            return false;
+        }
+        if (!hasEscape) {
+            ReportString(isKey, begin, static_cast<size_t>(end - begin));
+            cur_ = end + 1;
+            return true;
+        }
+        buffer_.clear();
+        auto iter = begin;
+        while (iter < end) {
+            if (*iter != '\\') {
+                auto plainEnd = static_cast<const char*>(memchr(iter, '\\', static_cast<size_t>(end - iter)));
+                plainEnd = plainEnd ? plainEnd : end;
+                buffer_.append(iter, static_cast<size_t>(plainEnd - iter));
+                iter = plainEnd;
+                continue;
+            }
+            auto length = ParseEscape(iter, end);
+            if (length == 0) {
+                cur_ = iter;
+                return false;
+            }
+            iter += length;
+        }
+        ReportString(isKey, buffer_.data(), buffer_.size());
+        cur_ = end + 1;
+        return true;
+    }
+
+    // returns the length of the escape sequence at [iter], or 0 if it's invalid.
+    size_t ParseEscape(const char* iter, const char* end)
+    {
+        constexpr size_t ESCAPE_LENGTH = 2;
+        constexpr size_t UTF16_ESCAPE_LENGTH = 6;
+        switch (iter[1]) {
+            case 'b':
+                buffer_.push_back('\b');
+                return ESCAPE_LENGTH;
+            case 'f':
+                buffer_.push_back('\f');
+                return ESCAPE_LENGTH;
+            case 'n':
+                buffer_.push_back('\n');
+                return ESCAPE_LENGTH;
+            case 'r':
+                buffer_.push_back('\r');
+                return ESCAPE_LENGTH;
+            case 't':
+                buffer_.push_back('\t');
+                return ESCAPE_LENGTH;
+            case '"':
+            case '\\':
+            case '/':
+                buffer_.push_back(iter[1]);
+                return ESCAPE_LENGTH;
+            case 'u':
+                break;
+            default:
+                return 0;
+        }
+        if (end - iter < static_cast<ptrdiff_t>(UTF16_ESCAPE_LENGTH)) {
+            return 0;
+        }
+        auto firstCode = ParseHex4(iter + ESCAPE_LENGTH);
+        if (firstCode >= 0xDC00 && firstCode <= 0xDFFF) {
+            return 0;
+        }
+        if (firstCode < 0xD800 || firstCode > 0xDBFF) {
+            AppendUtf8(buffer_, firstCode);
+            return UTF16_ESCAPE_LENGTH;
+        }
+        auto second = iter + UTF16_ESCAPE_LENGTH;
+        if (end - second < static_cast<ptrdiff_t>(UTF16_ESCAPE_LENGTH) || second[0] != '\\' || second[1] != 'u') {
+            return 0;
+        }
+        auto secondCode = ParseHex4(second + ESCAPE_LENGTH);
+        if (secondCode < 0xDC00 || secondCode > 0xDFFF) {
+            return 0;
+        }
+        AppendUtf8(buffer_, 0x10000 + (((firstCode & 0x3FF) << 10) | (secondCode & 0x3FF)));
+        return UTF16_ESCAPE_LENGTH * 2;
+    }
+
+    void ReportString(bool isKey, const char* data, size_t length)
+    {
+        if (isKey) {
+            handler_.Key(data, length);
+        } else {
+            handler_.String(data, length);
+        }
+    }
+
+    bool ParseArray(int32_t depth)
+    {
+        if (depth >= NESTING_LIMIT) {
+            return false;
+        }
+        ++cur_;
+        handler_.StartArray();
+        SkipWhitespace();
+        if (cur_ < end_ && *cur_ == ']') {
+            ++cur_;
+            handler_.EndArray();
+            return true;
+        }
+        while (true) {
+            SkipWhitespace();
+            if (!ParseValue(depth + 1)) {
+                return false;
+            }
+            SkipWhitespace();
+            if (cur_ >= end_ || *cur_ != ',') {
+                break;
+            }
+            ++cur_;
+        }
+        if (cur_ >= end_ || *cur_ != ']') {
+            return false;
+        }
+        ++cur_;
+        handler_.EndArray();
+        return true;
+    }
+
+    bool ParseObject(int32_t depth)
+    {
+        if (depth >= NESTING_LIMIT) {
+            return false;
+        }
+        ++cur_;
+        handler_.StartObject();
+        SkipWhitespace();
+        if (cur_ < end_ && *cur_ == '}') {
+            ++cur_;
+            handler_.EndObject();
+            return true;
+        }
+        while (true) {
+            SkipWhitespace();
+            if (!ParseString(true)) {
+                return false;
+            }
+            SkipWhitespace();
+            if (cur_ >= end_ || *cur_ != ':') {
+                return false;
+            }
+            ++cur_;
+            SkipWhitespace();
+            if (!ParseValue(depth + 1)) {
+                return false;
+            }
+            SkipWhitespace();
+            if (cur_ >= end_ || *cur_ != ',') {
+                break;
+            }
+            ++cur_;
+        }
+        if (cur_ >= end_ || *cur_ != '}') {
+            return false;
+        }
+        ++cur_;
+        handler_.EndObject();
+        return true;
+    }
+
+    const char* cur_ = nullptr;
+    const char* end_ = nullptr;
+    Handler& handler_;
+    // unescaped string
+    std::string buffer_;
+};
+
+// Builds the DOM from the events of JsonReader.
+class JsonDomBuilder final {
+public:
+    explicit JsonDomBuilder(JsonDocument* document) : document_(document) {}
+    ~JsonDomBuilder() = default;
+
+    void Null()
+    {
+        AddValue(JsonType::NULL_VALUE);
+    }
+
+    void Bool(bool value)
+    {
+        AddValue(value ? JsonType::TRUE_VALUE : JsonType::FALSE_VALUE);
+    }
+
+    void Number(double value)
+    {
+        AddValue(JsonType::NUMBER)->number = value;
+    }
+
+    void String(const char* data, size_t length)
+    {
+        AddValue(JsonType::STRING)->value.assign(data, length);
+    }
+
+    void Key(const char* data, size_t length)
+    {
+        key_.assign(data, length);
+    }
+
+    void StartObject()
+    {
+        containers_.emplace_back(AddValue(JsonType::OBJECT));
+    }
+
+    void EndObject()
+    {
+        BuildIndex(containers_.back());
+        containers_.pop_back();
+    }
+
+    void StartArray()
+    {
+        containers_.emplace_back(AddValue(JsonType::ARRAY));
+    }
+
+    void EndArray()
+    {
+        BuildIndex(containers_.back());
+        containers_.pop_back();
+    }
+
+    JsonNode* GetRoot() const
+    {
+        return root_;
+    }
+
+private:
+    JsonNode* AddValue(JsonType type)
+    {
+        auto node = document_->CreateNode(type);
+        if (containers_.empty()) {
+            root_ = node;
+            return node;
+        }
+        auto parent = containers_.back();
+        if (parent->type == JsonType::OBJECT) {
+            node->hasKey = true;
+            node->key = key_;
+        }
+        LinkChild(parent, node);
+        return node;
+    }
+
+    JsonDocument* document_ = nullptr;
+    JsonNode* root_ = nullptr;
+    std::vector<JsonNode*> containers_;
+    std::string key_;
+};
+
+// Streaming writer of unformatted json, the output is the same as cJSON_PrintUnformatted.
+class JsonWriter final {
+public:
+    explicit JsonWriter(std::string& out) : out_(out) {}
+    ~JsonWriter() = default;
+
+    void Null()
+    {
+        BeginValue();
+        out_.append("null");
+    }
+
+    void Bool(bool value)
+    {
+        BeginValue();
+        out_.append(value ? "true" : "false");
+    }
+
+    void Number(double value)
+    {
+        BeginValue();
+        AppendNumber(value);
+    }
+
+    void String(const char* data, size_t length)
+    {
+        BeginValue();
+        AppendString(data, length);
+    }
+
+    void Key(const char* data, size_t length)
+    {
+        BeginValue();
+        AppendString(data, length);
+        out_.push_back(':');
+        needComma_ = false;
+    }
+
+    void StartObject()
+    {
+        BeginValue();
+        out_.push_back('{');
+        needComma_ = false;
+    }
+
+    void EndObject()
+    {
+        out_.push_back('}');
+        needComma_ = true;
+    }
+
+    void StartArray()
+    {
+        BeginValue();
+        out_.push_back('[');
+        needComma_ = false;
+    }
+
+    void EndArray()
+    {
+        out_.push_back(']');
+        needComma_ = true;
+    }
+
+private:
+    void BeginValue()
+    {
+        if (needComma_) {
+            out_.push_back(',');
+        }
+        needComma_ = true;
+    }
+
+    void AppendNumber(double value)
+    {
+        if (std::isnan(value) || std::isinf(value)) {
+            out_.append("null");
+            return;
+        }
+        char buffer[NUMBER_BUFFER_SIZE] = { 0 };
+        int32_t length = 0;
+        auto intValue = ToSaturatedInt(value);
+        if (value == static_cast<double>(intValue)) {
+            length = snprintf(buffer, sizeof(buffer), "%d", intValue);
+        } else {
+            // the shortest of 15 or 17 digits which reads back the same value.
+            length = snprintf(buffer, sizeof(buffer), "%1.15g", value);
+            auto readBack = strtod(buffer, nullptr);
+            auto maxValue = std::max(std::fabs(readBack), std::fabs(value));
+            if (std::fabs(readBack - value) > maxValue * DBL_EPSILON) {
+                length = snprintf(buffer, sizeof(buffer), "%1.17g", value);
+            }
+        }
+        if (length > 0) {
+            out_.append(buffer, std::min(static_cast<size_t>(length), sizeof(buffer) - 1));
+        }
+    }
+
+    void AppendString(const char* data, size_t length)
+    {
+        constexpr size_t UNICODE_ESCAPE_SIZE = 7;
+        out_.push_back('"');
+        size_t plainBegin = 0;
+        for (size_t i = 0; i < length; ++i) {
+            auto c = static_cast<unsigned char>(data[i]);
+            if (c >= ' ' && c != '"' && c != '\\') {
+                continue;
+            }
+            out_.append(data + plainBegin, i - plainBegin);
+            plainBegin = i + 1;
+            out_.push_back('\\');
+            switch (c) {
+                case '"':
+                case '\\':
+                    out_.push_back(static_cast<char>(c));
+                    break;
+                case '\b':
+                    out_.push_back('b');
+                    break;
+                case '\f':
+                    out_.push_back('f');
+                    break;
+                case '\n':
+                    out_.push_back('n');
+                    break;
+                case '\r':
+                    out_.push_back('r');
+                    break;
+                case '\t':
+                    out_.push_back('t');
+                    break;
+                default: {
+                    char buffer[UNICODE_ESCAPE_SIZE] = { 0 };
+                    if (snprintf(buffer, sizeof(buffer), "u%04x", c) > 0) {
+                        out_.append(buffer);
+                    }
+                    break;
+                }
+            }
+        }
+        out_.append(data + plainBegin, length - plainBegin);
+        out_.push_back('"');
+    }
+
+    std::string& out_;
+    bool needComma_ = false;
+};
+
+void WriteNode(const JsonNode* node, JsonWriter& writer)
+{
+    switch (node->type) {
+        case JsonType::NULL_VALUE:
+            writer.Null();
+            break;
+        case JsonType::FALSE_VALUE:
+        case JsonType::TRUE_VALUE:
+            writer.Bool(node->type == JsonType::TRUE_VALUE);
+            break;
+        case JsonType::NUMBER:
+            writer.Number(node->number);
+            break;
+        case JsonType::STRING:
+            writer.String(node->value.data(), node->value.size());
+            break;
+        case JsonType::ARRAY:
+            writer.StartArray();
+            for (auto child = node->child; child; child = child->next) {
+                WriteNode(child, writer);
+            }
+            writer.EndArray();
+            break;
+        case JsonType::OBJECT:
+            writer.StartObject();
+            for (auto child = node->child; child; child = child->next) {
+                writer.Key(child->key.data(), child->key.size());
+                WriteNode(child, writer);
+            }
+            writer.EndObject();
+            break;
+        default:
+            break;
+    }
+}
+
+} // namespace
 
 JsonValue::JsonValue(JsonObject* object) : object_(object) {}
 
@@ -26,91 +979,92 @@ JsonValue::JsonValue(JsonObject* object, bool isRoot) : object_(object), isRoot_
 JsonValue::~JsonValue()
 {
     if (object_ != nullptr && isRoot_) {
-        cJSON_Delete(object_);
+        delete object_->document;
     }
     object_ = nullptr;
 }
 
 bool JsonValue::IsBool() const
 {
-    return cJSON_IsBool(object_);
+    return object_ && (object_->type == JsonType::TRUE_VALUE || object_->type == JsonType::FALSE_VALUE);
 }
 
 bool JsonValue::IsNumber() const
 {
-    return cJSON_IsNumber(object_);
+    return object_ && object_->type == JsonType::NUMBER;
 }
 
 bool JsonValue::IsString() const
 {
-    return cJSON_IsString(object_);
+    return object_ && object_->type == JsonType::STRING;
 }
 
 bool JsonValue::IsArray() const
 {
-    return cJSON_IsArray(object_);
+    return object_ && object_->type == JsonType::ARRAY;
 }
 
 bool JsonValue::IsObject() const
 {
-    return cJSON_IsObject(object_);
+    return object_ && object_->type == JsonType::OBJECT;
 }
 
 bool JsonValue::IsValid() const
 {
-    return (object_ != nullptr) && !cJSON_IsInvalid(object_);
+    return object_ != nullptr;
 }
 
 bool JsonValue::IsNull() const
 {
-    return (object_ == nullptr) || cJSON_IsNull(object_);
+    return (object_ == nullptr) || object_->type == JsonType::NULL_VALUE;
 }
 
 bool JsonValue::Contains(const std::string& key) const
 {
-    return cJSON_HasObjectItem(object_, key.c_str());
+    return FindChild(object_, key) != nullptr;
 }
 
 bool JsonValue::GetBool() const
 {
-    return cJSON_IsTrue(object_) != 0;
+    return object_ && object_->type == JsonType::TRUE_VALUE;
 }
 
 bool JsonValue::GetBool(const std::string& key, bool defaultValue) const
 {
-    if (Contains(key) && GetValue(key)->IsBool()) {
-        return GetValue(key)->GetBool();
+    auto value = FindChild(object_, key);
+    if (value && (value->type == JsonType::TRUE_VALUE || value->type == JsonType::FALSE_VALUE)) {
+        return value->type == JsonType::TRUE_VALUE;
     }
     return defaultValue;
 }
 
 int32_t JsonValue::GetInt() const
 {
-    return static_cast<int32_t>((object_ == nullptr) ? 0 : object_->valuedouble);
+    return static_cast<int32_t>((object_ == nullptr) ? 0 : object_->number);
 }
 
 uint32_t JsonValue::GetUInt() const
 {
-    return static_cast<uint32_t>((object_ == nullptr) ? 0 : object_->valuedouble);
+    return static_cast<uint32_t>((object_ == nullptr) ? 0 : object_->number);
 }
 
 double JsonValue::GetDouble() const
 {
-    return (object_ == nullptr) ? 0.0 : object_->valuedouble;
+    return (object_ == nullptr) ? 0.0 : object_->number;
 }
 
 double JsonValue::GetDouble(const std::string& key, double defaultVal) const
 {
-    auto value = GetValue(key);
-    if (value && value->IsNumber()) {
-        return value->GetDouble();
+    auto value = FindChild(object_, key);
+    if (value && value->type == JsonType::NUMBER) {
+        return value->number;
     }
     return defaultVal;
 }
 
 std::string JsonValue::GetString() const
 {
-    return ((object_ == nullptr) || (object_->valuestring == nullptr)) ? "" : std::string(object_->valuestring);
+    return ((object_ == nullptr) || (object_->type != JsonType::STRING)) ? "" : object_->value;
 }
 
 std::unique_ptr<JsonValue> JsonValue::GetNext() const
@@ -131,42 +1085,41 @@ std::unique_ptr<JsonValue> JsonValue::GetChild() const
 
 std::string JsonValue::GetKey() const
 {
-    return ((object_ == nullptr) || (object_->string == nullptr)) ? "" : std::string(object_->string);
+    return ((object_ == nullptr) || !object_->hasKey) ? "" : object_->key;
 }
 std::unique_ptr<JsonValue> JsonValue::GetValue(const std::string& key) const
 {
-    return std::make_unique<JsonValue>(cJSON_GetObjectItem(object_, key.c_str()));
+    return std::make_unique<JsonValue>(FindChild(object_, key));
 }
 
 std::unique_ptr<JsonValue> JsonValue::GetObject(const std::string& key) const
 {
-    if (Contains(key) && GetValue(key)->IsObject()) {
-        return GetValue(key);
+    auto value = FindChild(object_, key);
+    if (value && value->type == JsonType::OBJECT) {
+        return std::make_unique<JsonValue>(value);
     }
     return std::make_unique<JsonValue>();
 }
 
 int32_t JsonValue::GetArraySize() const
 {
-    return cJSON_GetArraySize(object_);
+    return (object_ == nullptr) ? 0 : object_->childCount;
 }
 
 std::unique_ptr<JsonValue> JsonValue::GetArrayItem(int32_t index) const
 {
-    return std::make_unique<JsonValue>(cJSON_GetArrayItem(object_, index));
+    return std::make_unique<JsonValue>(GetItem(object_, index));
 }
 
 bool JsonValue::Put(const char* key, const char* value)
 {
-    if (!value || !key) {
+    if (!value || !key || !object_) {
         return false;
     }
 
-    cJSON* child = cJSON_CreateString(value);
-    if (child == nullptr) {
-        return false;
-    }
-    cJSON_AddItemToObject(object_, key, child);
+    auto child = object_->document->CreateNode(JsonType::STRING);
+    child->value.assign(value);
+    AppendChild(object_, key, child);
     return true;
 }
 
@@ -177,59 +1130,33 @@ const JsonObject* JsonValue::GetJsonObject() const
 
 bool JsonValue::Put(const char* key, const std::unique_ptr<JsonValue>& value)
 {
-    if (!value || !key) {
-        return false;
-    }
-    cJSON* jsonObject = cJSON_Duplicate(value->GetJsonObject(), true);
-    if (jsonObject == nullptr) {
+    if (!value || !key || !object_ || !value->object_) {
         return false;
     }
 
-    cJSON_AddItemToObject(object_, key, jsonObject);
+    AppendChild(object_, key, CopyNode(value->object_, object_->document));
     return true;
 }
 
 // add item to array
 bool JsonValue::Put(const std::unique_ptr<JsonValue>& value)
 {
-    if (!value) {
-        return false;
-    }
-    cJSON* jsonObject = cJSON_Duplicate(value->GetJsonObject(), true);
-    if (jsonObject == nullptr) {
+    if (!value || !object_ || !value->object_) {
         return false;
     }
 
-    cJSON_AddItemToArray(object_, jsonObject);
+    AppendChild(object_, CopyNode(value->object_, object_->document));
     return true;
 }
 
 bool JsonValue::Put(const char* key, size_t value)
 {
-    if (key == nullptr) {
-        return false;
-    }
-
-    cJSON* child = cJSON_CreateNumber(static_cast<double>(value));
-    if (child == nullptr) {
-        return false;
-    }
-    cJSON_AddItemToObject(object_, key, child);
-    return true;
+    return Put(key, static_cast<double>(value));
 }
 
 bool JsonValue::Put(const char* key, int32_t value)
 {
-    if (key == nullptr) {
-        return false;
-    }
-
-    cJSON* child = cJSON_CreateNumber(static_cast<double>(value));
-    if (child == nullptr) {
-        return false;
-    }
-    cJSON_AddItemToObject(object_, key, child);
-    return true;
+    return Put(key, static_cast<double>(value));
 }
 
 bool JsonValue::Put(const char* key, int64_t value)
@@ -239,15 +1166,13 @@ bool JsonValue::Put(const char* key, int64_t value)
 
 bool JsonValue::Put(const char* key, double value)
 {
-    if (key == nullptr) {
+    if (key == nullptr || object_ == nullptr) {
         return false;
     }
 
-    cJSON* child = cJSON_CreateNumber(value);
-    if (child == nullptr) {
-        return false;
-    }
-    cJSON_AddItemToObject(object_, key, child);
+    auto child = object_->document->CreateNode(JsonType::NUMBER);
+    child->number = value;
+    AppendChild(object_, key, child);
     return true;
 }
 
@@ -257,28 +1182,23 @@ bool JsonValue::Replace(const char* key, double value)
         return false;
     }
 
-    cJSON* child = cJSON_CreateNumber(value);
-    if (child == nullptr) {
-        return false;
-    }
-    if (!cJSON_ReplaceItemInObject(object_, key, child)) {
-        cJSON_Delete(child);
+    auto item = FindChild(object_, key);
+    if (item == nullptr) {
         return false;
     }
+    auto child = object_->document->CreateNode(JsonType::NUMBER);
+    child->number = value;
+    ReplaceChild(object_, item, key, child);
     return true;
 }
 
 bool JsonValue::Put(const char* key, bool value)
 {
-    if (key == nullptr) {
+    if (key == nullptr || object_ == nullptr) {
         return false;
     }
 
-    cJSON* child = cJSON_CreateBool(value);
-    if (child == nullptr) {
-        return false;
-    }
-    cJSON_AddItemToObject(object_, key, child);
+    AppendChild(object_, key, object_->document->CreateNode(value ? JsonType::TRUE_VALUE : JsonType::FALSE_VALUE));
     return true;
 }
 
@@ -288,14 +1208,12 @@ bool JsonValue::Replace(const char* key, bool value)
         return false;
     }
 
-    cJSON* child = cJSON_CreateBool(value);
-    if (child == nullptr) {
-        return false;
-    }
-    if (!cJSON_ReplaceItemInObject(object_, key, child)) {
-        cJSON_Delete(child);
+    auto item = FindChild(object_, key);
+    if (item == nullptr) {
         return false;
     }
+    ReplaceChild(
+        object_, item, key, object_->document->CreateNode(value ? JsonType::TRUE_VALUE : JsonType::FALSE_VALUE));
     return true;
 }
 
@@ -305,48 +1223,32 @@ bool JsonValue::Replace(const char* key, const char* value)
         return false;
     }
 
-    cJSON* child = cJSON_CreateString(value);
-    if (child == nullptr) {
-        return false;
-    }
-    if (!cJSON_ReplaceItemInObject(object_, key, child)) {
-        cJSON_Delete(child);
+    auto item = FindChild(object_, key);
+    if (item == nullptr) {
         return false;
     }
+    auto child = object_->document->CreateNode(JsonType::STRING);
+    child->value.assign(value);
+    ReplaceChild(object_, item, key, child);
     return true;
 }
 
 bool JsonValue::Replace(const char* key, int32_t value)
 {
-    if (key == nullptr) {
-        return false;
-    }
-
-    cJSON* child = cJSON_CreateNumber(static_cast<double>(value));
-    if (child == nullptr) {
-        return false;
-    }
-    if (!cJSON_ReplaceItemInObject(object_, key, child)) {
-        cJSON_Delete(child);
-        return false;
-    }
-    return true;
+    return Replace(key, static_cast<double>(value));
 }
 
 bool JsonValue::Replace(const char* key, const std::unique_ptr<JsonValue>& value)
 {
-    if ((value == nullptr) || (key == nullptr)) {
-        return false;
-    }
-    cJSON* jsonObject = cJSON_Duplicate(value->GetJsonObject(), true);
-    if (jsonObject == nullptr) {
+    if ((value == nullptr) || (key == nullptr) || (value->object_ == nullptr)) {
         return false;
     }
 
-    if (!cJSON_ReplaceItemInObject(object_, key, jsonObject)) {
-        cJSON_Delete(jsonObject);
+    auto item = FindChild(object_, key);
+    if (item == nullptr) {
         return false;
     }
+    ReplaceChild(object_, item, key, CopyNode(value->object_, object_->document));
     return true;
 }
 
@@ -355,7 +1257,11 @@ bool JsonValue::Delete(const char* key)
     if (key == nullptr) {
         return false;
     }
-    cJSON_DeleteItemFromObject(object_, key);
+    auto item = FindChild(object_, key);
+    if (item != nullptr) {
+        UnlinkChild(object_, item);
+        object_->document->ReleaseNode(item);
+    }
     return true;
 }
 
@@ -366,45 +1272,56 @@ std::string JsonValue::ToString()
         return result;
     }
 
-    // It is null-terminated.
-    char* unformatted = cJSON_PrintUnformatted(object_);
-    if (unformatted != nullptr) {
-        result = unformatted;
-        cJSON_free(unformatted);
-    }
+    JsonWriter writer(result);
+    WriteNode(object_, writer);
     return result;
 }
 
 std::string JsonValue::GetString(const std::string& key, const std::string& defaultVal) const
 {
-    auto value = GetValue(key);
-    if (value && value->IsString()) {
-        return value->GetString();
+    auto value = FindChild(object_, key);
+    if (value && value->type == JsonType::STRING) {
+        return value->value;
     }
     return defaultVal;
 }
 
 int32_t JsonValue::GetInt(const std::string& key, int32_t defaultVal) const
 {
-    auto value = GetValue(key);
-    if (value && value->IsNumber()) {
-        return value->GetInt();
+    auto value = FindChild(object_, key);
+    if (value && value->type == JsonType::NUMBER) {
+        return static_cast<int32_t>(value->number);
     }
     return defaultVal;
 }
 
 uint32_t JsonValue::GetUInt(const std::string& key, uint32_t defaultVal) const
 {
-    auto value = GetValue(key);
-    if (value && value->IsNumber()) {
-        return value->GetUInt();
+    auto value = FindChild(object_, key);
+    if (value && value->type == JsonType::NUMBER) {
+        return static_cast<uint32_t>(value->number);
     }
     return defaultVal;
 }
 
 std::unique_ptr<JsonValue> JsonUtil::ParseJsonData(const char* data, const char** parseEnd)
 {
-    return std::make_unique<JsonValue>(cJSON_ParseWithOpts(data, parseEnd, true), true);
+    if (data == nullptr) {
+        return std::make_unique<JsonValue>(nullptr, true);
+    }
+    // owned by the root value.
+    auto document = new JsonDocument();
+    JsonDomBuilder builder(document);
+    JsonReader<JsonDomBuilder> reader(data, strlen(data), builder);
+    bool success = reader.Parse();
+    if (parseEnd != nullptr) {
+        *parseEnd = reader.GetPosition();
+    }
+    if (!success || builder.GetRoot() == nullptr) {
+        delete document;
+        return std::make_unique<JsonValue>(nullptr, true);
+    }
+    return std::make_unique<JsonValue>(builder.GetRoot(), true);
 }
 
 std::unique_ptr<JsonValue> JsonUtil::ParseJsonString(const std::string& content, const char** parseEnd)
@@ -412,14 +1329,15 @@ std::unique_ptr<JsonValue> JsonUtil::ParseJsonString(const std::string& content,
     return ParseJsonData(content.c_str(), parseEnd);
 }
 
-std::unique_ptr<JsonValue> JsonUtil::Create(bool isRoot)
+// A created value owns its document whether it's a root or not, putting it into another value copies its nodes.
+std::unique_ptr<JsonValue> JsonUtil::Create(bool /* isRoot */)
 {
-    return std::make_unique<JsonValue>(cJSON_CreateObject(), isRoot);
+    return std::make_unique<JsonValue>((new JsonDocument())->CreateNode(JsonType::OBJECT), true);
 }
 
-std::unique_ptr<JsonValue> JsonUtil::CreateArray(bool isRoot)
+std::unique_ptr<JsonValue> JsonUtil::CreateArray(bool /* isRoot */)
 {
-    return std::make_unique<JsonValue>(cJSON_CreateArray(), isRoot);
+    return std::make_unique<JsonValue>((new JsonDocument())->CreateNode(JsonType::ARRAY), true);
 }
 
 } // namespace OHOS::Ace
@@ -21,12 +21,14 @@
 
 #include "base/utils/macros.h"
 
-struct cJSON;
-
 namespace OHOS::Ace {
 
-using JsonObject = cJSON;
+struct JsonNode;
+using JsonObject = JsonNode;
 
+// Value in a json tree, the root value owns the tree, others are views of its nodes which are valid while the root
+// is alive. Values made by JsonUtil::Create and CreateArray are roots, putting them into another value copies them.
+// Nodes are allocated from the arena of the tree, keys of objects are matched ignoring case.
 class ACE_FORCE_EXPORT_WITH_PREVIEW JsonValue final {
 public:
     JsonValue() = default;
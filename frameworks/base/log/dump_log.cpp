@@ -83,6 +83,8 @@ void DumpLog::ShowDumpHelp(std::vector<std::string>& info)
     info.emplace_back(" -render                        |show render tree");
     info.emplace_back(" -inspector                     |show inspector tree");
     info.emplace_back(" -frontend                      |show path and components count of current page");
+    info.emplace_back(" -frametiming                   |dump phase durations and janky frames of the pipeline");
+    info.emplace_back(" -frametrace [path]             |dump recorded frame trace events as chrome trace json");
 }
 
 } // namespace OHOS::Ace
@@ -0,0 +1,244 @@
+/*
+ * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "base/log/frame_timing.h"
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+#include <iterator>
+#include <utility>
+
+#include "base/log/dump_log.h"
+#include "base/log/log.h"
+#include "base/utils/time_util.h"
+
+namespace OHOS::Ace {
+namespace {
+
+// 60hz
+constexpr int64_t DEFAULT_FRAME_BUDGET = 16666667;
+
+std::string ToMilliseconds(int64_t nanoseconds)
+{
+    constexpr double NANOSECONDS_PER_MILLISECOND = 1000000.0;
+    constexpr size_t BUFFER_SIZE = 32;
+    char buffer[BUFFER_SIZE] = { 0 };
+    auto length =
+        snprintf(buffer, sizeof(buffer), "%.3fms", static_cast<double>(nanoseconds) / NANOSECONDS_PER_MILLISECOND);
+    if (length <= 0) {
+        return "";
+    }
+    return std::string(buffer, std::min(static_cast<size_t>(length), BUFFER_SIZE - 1));
+}
+
+void DumpFrame(const FrameTimingRecord& frame)
+{
+    DumpLog::GetInstance().Print(1, "VsyncTime: " + std::to_string(frame.vsyncTime) +
+                                        ", duration: " + ToMilliseconds(frame.duration) +
+                                        ", missedVsyncs: " + std::to_string(frame.missedVsyncs) +
+                                        ", worstPhase: " + GetFramePhaseName(frame.GetWorstPhase()));
+    int64_t phasesDuration = 0;
+    for (size_t phase = 0; phase < FRAME_PHASE_COUNT; ++phase) {
+        phasesDuration += frame.phaseDurations[phase];
+        if (frame.phaseDurations[phase] == 0) {
+            continue;
+        }
+        DumpLog::GetInstance().Print(2, std::string(GetFramePhaseName(static_cast<FramePhase>(phase))) + ": " +
+                                            ToMilliseconds(frame.phaseDurations[phase]));
+        for (const auto& node : frame.topNodes[phase]) {
+            if (node.nodeId < 0) {
+                break;
+            }
+            DumpLog::GetInstance().Print(
+                3, node.tag + "(" + std::to_string(node.nodeId) + "): " + ToMilliseconds(node.duration));
+        }
+    }
+    DumpLog::GetInstance().Print(2, "Other: " + ToMilliseconds(std::max<int64_t>(frame.duration - phasesDuration, 0)));
+}
+
+} // namespace
+
+const char* GetFramePhaseName(FramePhase phase)
+{
+    switch (phase) {
+        case FramePhase::TOUCH:
+            return "Touch";
+        case FramePhase::ANIMATION:
+            return "Animation";
+        case FramePhase::BUILD:
+            return "Build";
+        case FramePhase::LAYOUT:
+            return "Layout";
+        case FramePhase::RENDER:
+            return "Render";
+        case FramePhase::MESSAGE:
+            return "Message";
+        case FramePhase::FOCUS:
+            return "Focus";
+        default:
+            return "Unknown";
+    }
+}
+
+FramePhase FrameTimingRecord::GetWorstPhase() const
+{
+    auto iter = std::max_element(phaseDurations.begin(), phaseDurations.end());
+    return static_cast<FramePhase>(std::distance(phaseDurations.begin(), iter));
+}
+
+void FrameTiming::BeginFrame(uint64_t vsyncTime, int64_t budget)
+{
+    // nodes are reset in place to keep the capacity of their tags.
+    currentFrame_.vsyncTime = vsyncTime;
+    currentFrame_.start = GetSysTimestamp();
+    currentFrame_.duration = 0;
+    currentFrame_.budget = budget > 0 ? budget : DEFAULT_FRAME_BUDGET;
+    currentFrame_.missedVsyncs = 0;
+    currentFrame_.phaseDurations.fill(0);
+    for (auto& nodes : currentFrame_.topNodes) {
+        for (auto& node : nodes) {
+            node.nodeId = -1;
+            node.duration = 0;
+        }
+    }
+    inFrame_ = true;
+}
+
+void FrameTiming::EndFrame()
+{
+    if (!inFrame_) {
+        return;
+    }
+    inFrame_ = false;
+    currentFrame_.duration = GetSysTimestamp() - currentFrame_.start;
+    currentFrame_.missedVsyncs = static_cast<uint32_t>(currentFrame_.duration / currentFrame_.budget);
+
+    ++stats_.frameCount;
+    ++stats_.missedVsyncHistogram[std::min<size_t>(currentFrame_.missedVsyncs, MISSED_VSYNC_HISTOGRAM_SIZE - 1)];
+    for (size_t phase = 0; phase < FRAME_PHASE_COUNT; ++phase) {
+        auto duration = currentFrame_.phaseDurations[phase];
+        stats_.phases[phase].totalDuration += duration;
+        stats_.phases[phase].maxDuration = std::max(stats_.phases[phase].maxDuration, duration);
+    }
+    if (currentFrame_.missedVsyncs > 0) {
+        auto worstPhase = currentFrame_.GetWorstPhase();
+        ++stats_.jankCount;
+        ++stats_.phases[static_cast<size_t>(worstPhase)].jankCount;
+        jankFrames_[jankFrameHead_ % JANK_FRAME_RECORD_COUNT] = currentFrame_;
+        ++jankFrameHead_;
+        LOGD("janky frame, duration: %{public}" PRId64 ", missed vsyncs: %{public}u, worst phase: %{public}s",
+            currentFrame_.duration, currentFrame_.missedVsyncs, GetFramePhaseName(worstPhase));
+    }
+    std::swap(lastFrame_, currentFrame_);
+}
+
+void FrameTiming::AddPhaseDuration(FramePhase phase, int64_t duration)
+{
+    if (!inFrame_ || phase >= FramePhase::COUNT) {
+        return;
+    }
+    currentFrame_.phaseDurations[static_cast<size_t>(phase)] += duration;
+}
+
+void FrameTiming::AddNodeDuration(FramePhase phase, int32_t nodeId, const std::string& tag, int64_t duration)
+{
+    if (!inFrame_ || phase >= FramePhase::COUNT) {
+        return;
+    }
+    auto& nodes = currentFrame_.topNodes[static_cast<size_t>(phase)];
+    auto& last = nodes.back();
+    if (last.nodeId >= 0 && last.duration >= duration) {
+        return;
+    }
+    // replace the last one and move it to its position.
+    last.nodeId = nodeId;
+    last.tag.assign(tag);
+    last.duration = duration;
+    for (size_t index = nodes.size() - 1; index > 0; --index) {
+        auto& prev = nodes[index - 1];
+        if (prev.nodeId >= 0 && prev.duration >= duration) {
+            break;
+        }
+        std::swap(prev, nodes[index]);
+    }
+}
+
+std::vector<FrameTimingRecord> FrameTiming::GetJankFrames() const
+{
+    std::vector<FrameTimingRecord> frames;
+    auto begin = jankFrameHead_ > JANK_FRAME_RECORD_COUNT ? jankFrameHead_ - JANK_FRAME_RECORD_COUNT : 0;
+    frames.reserve(jankFrameHead_ - begin);
+    for (auto index = begin; index < jankFrameHead_; ++index) {
+        frames.emplace_back(jankFrames_[index % JANK_FRAME_RECORD_COUNT]);
+    }
+    return frames;
+}
+
+void FrameTiming::Reset()
+{
+    stats_ = FrameTimingStats();
+    lastFrame_ = FrameTimingRecord();
+    jankFrameHead_ = 0;
+}
+
+void FrameTiming::Dump() const
+{
+    DumpLog::GetInstance().Print("FrameTiming:");
+    DumpLog::GetInstance().Print(1, "FrameCount: " + std::to_string(stats_.frameCount) +
+                                        ", JankCount: " + std::to_string(stats_.jankCount) +
+                                        ", Budget: " + ToMilliseconds(lastFrame_.budget));
+    std::string histogram = "MissedVsyncs:";
+    for (size_t bucket = 0; bucket < MISSED_VSYNC_HISTOGRAM_SIZE; ++bucket) {
+        histogram.append(" ").append(std::to_string(bucket));
+        if (bucket == MISSED_VSYNC_HISTOGRAM_SIZE - 1) {
+            histogram.append("+");
+        }
+        histogram.append(":").append(std::to_string(stats_.missedVsyncHistogram[bucket]));
+    }
+    DumpLog::GetInstance().Print(1, histogram);
+    for (size_t phase = 0; phase < FRAME_PHASE_COUNT; ++phase) {
+        const auto& phaseStats = stats_.phases[phase];
+        auto average = stats_.frameCount == 0 ? 0 : phaseStats.totalDuration / static_cast<int64_t>(stats_.frameCount);
+        DumpLog::GetInstance().Print(1, std::string(GetFramePhaseName(static_cast<FramePhase>(phase))) +
+                                            ": average: " + ToMilliseconds(average) +
+                                            ", max: " + ToMilliseconds(phaseStats.maxDuration) +
+                                            ", jankCount: " + std::to_string(phaseStats.jankCount));
+    }
+    auto jankFrames = GetJankFrames();
+    if (jankFrames.empty()) {
+        return;
+    }
+    DumpLog::GetInstance().Print("JankFrames:");
+    for (const auto& frame : jankFrames) {
+        DumpFrame(frame);
+    }
+}
+
+FramePhaseScope::FramePhaseScope(FrameTiming* frameTiming, FramePhase phase) : frameTiming_(frameTiming), phase_(phase)
+{
+    if (frameTiming_ && frameTiming_->IsInFrame()) {
+        start_ = GetSysTimestamp();
+    }
+}
+
+FramePhaseScope::~FramePhaseScope()
+{
+    if (start_ > 0) {
+        frameTiming_->AddPhaseDuration(phase_, GetSysTimestamp() - start_);
+    }
+}
+
+} // namespace OHOS::Ace
@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_ACE_FRAMEWORKS_BASE_LOG_FRAME_TIMING_H
+#define FOUNDATION_ACE_FRAMEWORKS_BASE_LOG_FRAME_TIMING_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "base/utils/macros.h"
+#include "base/utils/noncopyable.h"
+
+namespace OHOS::Ace {
+
+enum class FramePhase : uint8_t {
+    TOUCH = 0,
+    ANIMATION,
+    BUILD,
+    LAYOUT,
+    RENDER,
+    MESSAGE,
+    FOCUS,
+    COUNT,
+};
+
+constexpr size_t FRAME_PHASE_COUNT = static_cast<size_t>(FramePhase::COUNT);
+// slowest nodes kept for every phase of a frame.
+constexpr size_t FRAME_TOP_NODE_COUNT = 3;
+// frames missing [0, MISSED_VSYNC_HISTOGRAM_SIZE - 1) vsyncs are counted in their own bucket, the others in the last.
+constexpr size_t MISSED_VSYNC_HISTOGRAM_SIZE = 8;
+// latest janky frames kept with their phases and nodes.
+constexpr size_t JANK_FRAME_RECORD_COUNT = 16;
+
+ACE_EXPORT const char* GetFramePhaseName(FramePhase phase);
+
+struct FrameNodeCost {
+    int32_t nodeId = -1;
+    std::string tag;
+    int64_t duration = 0;
+};
+
+struct FrameTimingRecord {
+    uint64_t vsyncTime = 0;
+    // monotonic time in nanoseconds
+    int64_t start = 0;
+    int64_t duration = 0;
+    int64_t budget = 0;
+    uint32_t missedVsyncs = 0;
+    std::array<int64_t, FRAME_PHASE_COUNT> phaseDurations {};
+    // ordered by duration descending, unused slots have negative node ids.
+    std::array<std::array<FrameNodeCost, FRAME_TOP_NODE_COUNT>, FRAME_PHASE_COUNT> topNodes;
+
+    // the phase which takes the longest time in the frame.
+    FramePhase GetWorstPhase() const;
+};
+
+struct FramePhaseStats {
+    int64_t totalDuration = 0;
+    int64_t maxDuration = 0;
+    // janky frames in which the phase is the worst one.
+    uint64_t jankCount = 0;
+};
+
+struct FrameTimingStats {
+    uint64_t frameCount = 0;
+    uint64_t jankCount = 0;
+    std::array<uint64_t, MISSED_VSYNC_HISTOGRAM_SIZE> missedVsyncHistogram {};
+    std::array<FramePhaseStats, FRAME_PHASE_COUNT> phases;
+};
+
+// Per-frame phase budget accounting of a pipeline, always on. Phases and node costs reported between BeginFrame and
+// EndFrame are summed into the frame, a frame taking longer than its vsync budget is janky and is attributed to its
+// worst phase. Only fixed-size state is kept, so it's cheap enough for production. Used on the UI thread only.
+class ACE_EXPORT FrameTiming final {
+public:
+    FrameTiming() = default;
+    ~FrameTiming() = default;
+
+    // [budget] is the vsync period in nanoseconds.
+    void BeginFrame(uint64_t vsyncTime, int64_t budget);
+    void EndFrame();
+
+    bool IsInFrame() const
+    {
+        return inFrame_;
+    }
+
+    void AddPhaseDuration(FramePhase phase, int64_t duration);
+    void AddNodeDuration(FramePhase phase, int32_t nodeId, const std::string& tag, int64_t duration);
+
+    const FrameTimingStats& GetStats() const
+    {
+        return stats_;
+    }
+
+    // the latest finished frame.
+    const FrameTimingRecord& GetLastFrame() const
+    {
+        return lastFrame_;
+    }
+
+    // the latest janky frames, the oldest first.
+    std::vector<FrameTimingRecord> GetJankFrames() const;
+
+    void Reset();
+    void Dump() const;
+
+private:
+    FrameTimingStats stats_;
+    FrameTimingRecord currentFrame_;
+    FrameTimingRecord lastFrame_;
+    std::array<FrameTimingRecord, JANK_FRAME_RECORD_COUNT> jankFrames_;
+    uint64_t jankFrameHead_ = 0;
+    bool inFrame_ = false;
+
+    ACE_DISALLOW_COPY_AND_MOVE(FrameTiming);
+};
+
+// Adds the time of the scope to [phase] of the frame, [frameTiming] may be null.
+class ACE_EXPORT FramePhaseScope final {
+public:
+    FramePhaseScope(FrameTiming* frameTiming, FramePhase phase);
+    ~FramePhaseScope();
+
+    ACE_DISALLOW_COPY_AND_MOVE(FramePhaseScope);
+
+private:
+    FrameTiming* frameTiming_ = nullptr;
+    FramePhase phase_ = FramePhase::TOUCH;
+    int64_t start_ = 0;
+};
+
+} // namespace OHOS::Ace
+
+#endif // FOUNDATION_ACE_FRAMEWORKS_BASE_LOG_FRAME_TIMING_H
@@ -0,0 +1,269 @@
+/*
+ * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "base/log/frame_trace.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cinttypes>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+#include "base/log/log.h"
+#include "base/utils/time_util.h"
+
+namespace OHOS::Ace {
+namespace {
+
+constexpr int64_t NANOSECONDS_PER_MICROSECOND = 1000;
+
+// Ring buffer of one thread. Only the owner thread writes. Every slot publishes the write index of its event, other
+// threads read a slot only while it holds the expected index, so events overwritten while reading are dropped.
+class FrameTraceBuffer final {
+public:
+    explicit FrameTraceBuffer(int32_t threadIndex) : threadIndex_(threadIndex) {}
+    ~FrameTraceBuffer() = default;
+
+    void Record(const FrameTraceEvent& event)
+    {
+        auto head = head_.load(std::memory_order_relaxed);
+        auto& slot = slots_[head % FrameTrace::CAPACITY];
+        slot.index.store(INVALID_INDEX, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        slot.name.store(event.name, std::memory_order_relaxed);
+        slot.start.store(event.start, std::memory_order_relaxed);
+        slot.duration.store(event.duration, std::memory_order_relaxed);
+        slot.nodeId.store(event.nodeId, std::memory_order_relaxed);
+        slot.threadIndex.store(event.threadIndex, std::memory_order_relaxed);
+        slot.index.store(head, std::memory_order_release);
+        head_.store(head + 1, std::memory_order_release);
+    }
+
+    void Collect(std::vector<FrameTraceEvent>& result) const
+    {
+        auto head = head_.load(std::memory_order_acquire);
+        auto begin = std::max(head > FrameTrace::CAPACITY ? head - FrameTrace::CAPACITY : 0,
+            clearedHead_.load(std::memory_order_relaxed));
+        for (auto index = begin; index < head; ++index) {
+            const auto& slot = slots_[index % FrameTrace::CAPACITY];
+            if (slot.index.load(std::memory_order_acquire) != index) {
+                continue;
+            }
+            FrameTraceEvent event { slot.name.load(std::memory_order_relaxed),
+                slot.start.load(std::memory_order_relaxed), slot.duration.load(std::memory_order_relaxed),
+                slot.nodeId.load(std::memory_order_relaxed), slot.threadIndex.load(std::memory_order_relaxed) };
+            std::atomic_thread_fence(std::memory_order_acquire);
+            // the owner started to overwrite the slot while reading.
+            if (slot.index.load(std::memory_order_relaxed) != index) {
+                continue;
+            }
+            result.emplace_back(event);
+        }
+    }
+
+    void Clear()
+    {
+        clearedHead_.store(head_.load(std::memory_order_acquire), std::memory_order_relaxed);
+    }
+
+    int32_t GetThreadIndex() const
+    {
+        return threadIndex_;
+    }
+
+    // called with the buffers locked, before the buffer is taken by another thread.
+    void SetThreadIndex(int32_t threadIndex)
+    {
+        threadIndex_ = threadIndex;
+    }
+
+private:
+    static constexpr uint64_t INVALID_INDEX = UINT64_MAX;
+
+    struct Slot {
+        std::atomic<uint64_t> index { INVALID_INDEX };
+        std::atomic<const char*> name { nullptr };
+        std::atomic<int64_t> start { 0 };
+        std::atomic<int64_t> duration { 0 };
+        std::atomic<int32_t> nodeId { -1 };
+        std::atomic<int32_t> threadIndex { 0 };
+    };
+
+    std::array<Slot, FrameTrace::CAPACITY> slots_;
+    std::atomic<uint64_t> head_ { 0 };
+    std::atomic<uint64_t> clearedHead_ { 0 };
+    int32_t threadIndex_ = 0;
+};
+
+std::atomic<bool> g_enabled { true };
+std::mutex g_buffersMutex;
+// buffers are kept after their threads exit, so the events are still dumped, and are taken again by new threads.
+std::vector<std::shared_ptr<FrameTraceBuffer>> g_buffers;
+std::vector<std::shared_ptr<FrameTraceBuffer>> g_freeBuffers;
+int32_t g_nextThreadIndex = 0;
+
+// Gives the buffer back when its thread exits, so the number of buffers is bounded by the threads alive at once.
+class ThreadBufferHolder final {
+public:
+    ThreadBufferHolder() = default;
+    ~ThreadBufferHolder()
+    {
+        if (buffer_) {
+            std::scoped_lock<std::mutex> lock(g_buffersMutex);
+            g_freeBuffers.emplace_back(std::move(buffer_));
+        }
+    }
+
+    FrameTraceBuffer& Get()
+    {
+        if (!buffer_) {
+            std::scoped_lock<std::mutex> lock(g_buffersMutex);
+            if (g_freeBuffers.empty()) {
+                buffer_ = std::make_shared<FrameTraceBuffer>(g_nextThreadIndex);
+                g_buffers.emplace_back(buffer_);
+            } else {
+                buffer_ = std::move(g_freeBuffers.back());
+                g_freeBuffers.pop_back();
+                buffer_->SetThreadIndex(g_nextThreadIndex);
+            }
+            ++g_nextThreadIndex;
+        }
+        return *buffer_;
+    }
+
+    ACE_DISALLOW_COPY_AND_MOVE(ThreadBufferHolder);
+
+private:
+    std::shared_ptr<FrameTraceBuffer> buffer_;
+};
+
+FrameTraceBuffer& GetThreadBuffer()
+{
+    thread_local ThreadBufferHolder holder;
+    return holder.Get();
+}
+
+void AppendMicroseconds(std::string& out, int64_t nanoseconds)
+{
+    constexpr size_t BUFFER_SIZE = 32;
+    char buffer[BUFFER_SIZE] = { 0 };
+    auto length = snprintf(buffer, sizeof(buffer), "%" PRId64 ".%03" PRId64,
+        nanoseconds / NANOSECONDS_PER_MICROSECOND, nanoseconds % NANOSECONDS_PER_MICROSECOND);
+    if (length > 0) {
+        out.append(buffer, std::min(static_cast<size_t>(length), BUFFER_SIZE - 1));
+    }
+}
+
+} // namespace
+
+void FrameTrace::Record(const char* name, int64_t start, int64_t duration, int32_t nodeId)
+{
+    if (!g_enabled.load(std::memory_order_relaxed)) {
+        return;
+    }
+    auto& buffer = GetThreadBuffer();
+    buffer.Record({ name, start, duration, nodeId, buffer.GetThreadIndex() });
+}
+
+void FrameTrace::SetEnabled(bool enabled)
+{
+    g_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+bool FrameTrace::IsEnabled()
+{
+    return g_enabled.load(std::memory_order_relaxed);
+}
+
+std::vector<FrameTraceEvent> FrameTrace::Collect()
+{
+    std::vector<FrameTraceEvent> events;
+    {
+        std::scoped_lock<std::mutex> lock(g_buffersMutex);
+        for (const auto& buffer : g_buffers) {
+            buffer->Collect(events);
+        }
+    }
+    std::stable_sort(events.begin(), events.end(),
+        [](const FrameTraceEvent& lhs, const FrameTraceEvent& rhs) { return lhs.start < rhs.start; });
+    return events;
+}
+
+std::string FrameTrace::DumpChromeTrace()
+{
+    auto events = Collect();
+    std::string out = "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    bool isFirst = true;
+    for (const auto& event : events) {
+        if (!event.name) {
+            continue;
+        }
+        out.append(isFirst ? "\n" : ",\n");
+        isFirst = false;
+        out.append("{\"name\":\"").append(event.name).append("\",\"ph\":\"X\",\"pid\":0,\"tid\":");
+        out.append(std::to_string(event.threadIndex)).append(",\"ts\":");
+        AppendMicroseconds(out, event.start);
+        out.append(",\"dur\":");
+        AppendMicroseconds(out, event.duration);
+        if (event.nodeId >= 0) {
+            out.append(",\"args\":{\"nodeId\":").append(std::to_string(event.nodeId)).append("}");
+        }
+        out.append("}");
+    }
+    out.append("\n]}\n");
+    return out;
+}
+
+bool FrameTrace::DumpChromeTrace(const std::string& path)
+{
+    auto content = DumpChromeTrace();
+    std::unique_ptr<FILE, decltype(&fclose)> file(fopen(path.c_str(), "w"), &fclose);
+    if (!file) {
+        LOGE("failed to open frame trace file %{private}s", path.c_str());
+        return false;
+    }
+    if (fwrite(content.data(), 1, content.size(), file.get()) != content.size()) {
+        LOGE("failed to write frame trace file %{private}s", path.c_str());
+        return false;
+    }
+    return true;
+}
+
+void FrameTrace::Clear()
+{
+    std::scoped_lock<std::mutex> lock(g_buffersMutex);
+    for (const auto& buffer : g_buffers) {
+        buffer->Clear();
+    }
+}
+
+FrameTraceScope::FrameTraceScope(const char* name, int32_t nodeId) : name_(name), nodeId_(nodeId)
+{
+    if (FrameTrace::IsEnabled()) {
+        start_ = GetSysTimestamp();
+    }
+}
+
+FrameTraceScope::~FrameTraceScope()
+{
+    if (start_ > 0) {
+        FrameTrace::Record(name_, start_, GetSysTimestamp() - start_, nodeId_);
+    }
+}
+
+} // namespace OHOS::Ace
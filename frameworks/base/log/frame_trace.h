@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_ACE_FRAMEWORKS_BASE_LOG_FRAME_TRACE_H
+#define FOUNDATION_ACE_FRAMEWORKS_BASE_LOG_FRAME_TRACE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "base/utils/macros.h"
+#include "base/utils/noncopyable.h"
+
+// [name] must be a string literal, it's kept as the id of the event without copying or formatting.
+#define ACE_FRAME_TRACE(name, ...) FrameTraceScope aceFrameTraceScope("" name, ##__VA_ARGS__)
+
+namespace OHOS::Ace {
+
+struct FrameTraceEvent {
+    // static string, compared by address
+    const char* name = nullptr;
+    // monotonic time in nanoseconds
+    int64_t start = 0;
+    int64_t duration = 0;
+    int32_t nodeId = -1;
+    int32_t threadIndex = 0;
+};
+
+// Always-on recorder of binary trace events. Every thread writes the events into its own ring buffer without locks,
+// keeping the latest CAPACITY events, so jank in production can be captured without enabling the system trace.
+// Events are dumped as a Chrome trace json, which chrome://tracing and Perfetto open.
+class ACE_EXPORT FrameTrace final {
+public:
+    static constexpr size_t CAPACITY = 4096;
+
+    static void Record(const char* name, int64_t start, int64_t duration, int32_t nodeId = -1);
+
+    static void SetEnabled(bool enabled);
+    static bool IsEnabled();
+
+    // recorded events of all threads ordered by start time.
+    static std::vector<FrameTraceEvent> Collect();
+    static std::string DumpChromeTrace();
+    static bool DumpChromeTrace(const std::string& path);
+    // drop events recorded so far.
+    static void Clear();
+
+private:
+    FrameTrace() = default;
+    ~FrameTrace() = default;
+};
+
+class ACE_EXPORT FrameTraceScope final {
+public:
+    explicit FrameTraceScope(const char* name, int32_t nodeId = -1);
+    ~FrameTraceScope();
+
+    ACE_DISALLOW_COPY_AND_MOVE(FrameTraceScope);
+
+private:
+    const char* name_ = nullptr;
+    int32_t nodeId_ = -1;
+    int64_t start_ = 0;
+};
+
+} // namespace OHOS::Ace
+
+#endif // FOUNDATION_ACE_FRAMEWORKS_BASE_LOG_FRAME_TRACE_H
@@ -15,8 +15,11 @@
 
 #include "base/memory/memory_monitor.h"
 
+#include <algorithm>
+#include <functional>
 #include <map>
 #include <mutex>
+#include <unordered_map>
 
 #if !defined(WINDOWS_PLATFORM) and !defined(MAC_PLATFORM) and !defined(IOS_PLATFORM) and !defined(LINUX_PLATFORM)
 #include <malloc.h>
@@ -37,8 +40,55 @@ void PurgeMallocCache()
 #endif
 }
 
+namespace {
+
+constexpr uint32_t INVALID_TYPE_INDEX = UINT32_MAX;
+// a type growing on so many pushes onto the same depth is a leak suspect.
+constexpr uint32_t LEAK_SUSPECT_GROWTH_COUNT = 3;
+// deeper page stacks share the snapshot of the max depth.
+constexpr size_t MAX_SNAPSHOT_PAGE_DEPTH = 32;
+
+// names given to DECLARE_ACE_TYPE of the base classes of categories, their type ids are hashes of the names.
+constexpr const char* CATEGORY_TYPE_NAMES[MEMORY_CATEGORY_COUNT] = {
+    "FrameNode",
+    "LayoutWrapper",
+    "CanvasImage",
+    "NG::Paragraph",
+};
+
+constexpr const char* CATEGORY_NAMES[MEMORY_CATEGORY_COUNT] = {
+    "FrameNode",
+    "LayoutWrapper",
+    "Image",
+    "Paragraph",
+};
+
+MemoryCategory GetCategory(const TypeInfoBase* typeInfo)
+{
+    if (typeInfo == nullptr) {
+        return MemoryCategory::COUNT;
+    }
+    static const auto categoryTypeIds = []() {
+        std::array<TypeInfoBase::IdType, MEMORY_CATEGORY_COUNT> typeIds {};
+        for (size_t index = 0; index < MEMORY_CATEGORY_COUNT; ++index) {
+            typeIds[index] = std::hash<std::string> {}(CATEGORY_TYPE_NAMES[index]);
+        }
+        return typeIds;
+    }();
+    for (size_t index = 0; index < MEMORY_CATEGORY_COUNT; ++index) {
+        if (TypeInfoHelper::InstanceOf(typeInfo, categoryTypeIds[index])) {
+            return static_cast<MemoryCategory>(index);
+        }
+    }
+    return MemoryCategory::COUNT;
+}
+
+} // namespace
+
 bool MemoryMonitor::isEnable_ = SystemProperties::GetIsUseMemoryMonitor();
 
+// Objects are accounted to their types by compact indexes and to the pages they are created for, so the monitor is
+// cheap enough to keep enabled in beta builds.
 class MemoryMonitorImpl : public MemoryMonitor {
 public:
     void Add(void* ptr) final
@@ -63,11 +113,15 @@ public:
         }
         count_--;
 
-        if (it->second.size > 0) {
-            total_ -= it->second.size;
-            auto& info = typeMap_[it->second.typeName];
+        const auto& memInfo = it->second;
+        if (memInfo.typeIndex != INVALID_TYPE_INDEX) {
+            total_ -= memInfo.size;
+            auto& info = typeInfos_[memInfo.typeIndex];
             info.count--;
-            info.total -= it->second.size;
+            info.total -= memInfo.size;
+            if (info.category != MemoryCategory::COUNT) {
+                RemoveFromPage(memInfo.pageId, info.category, memInfo.size);
+            }
         }
         memoryMap_.erase(it);
     }
@@ -75,19 +129,82 @@ public:
     void Update(void* ptr, size_t size, const std::string& typeName) final
     {
         std::lock_guard<std::mutex> lock(mutex_);
-        auto it = memoryMap_.find(ptr);
-        if (it == memoryMap_.end()) {
-            LOGE("Address MUST be in memory map");
-            return;
+        auto typeIndex = GetTypeIndex(typeName, nullptr);
+        UpdateLocked(ptr, size, typeIndex);
+    }
+
+    void Update(void* ptr, size_t size, const char* typeName, const TypeInfoBase* typeInfo) final
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        uint32_t typeIndex = INVALID_TYPE_INDEX;
+        auto iter = typeIndexesByAddress_.find(typeName);
+        if (iter != typeIndexesByAddress_.end()) {
+            typeIndex = iter->second;
+        } else {
+            // the same type may have different name addresses in different libraries.
+            typeIndex = GetTypeIndex(typeName ? typeName : "Unknown", typeInfo);
+            typeIndexesByAddress_.emplace(typeName, typeIndex);
         }
+        UpdateLocked(ptr, size, typeIndex);
+    }
 
-        it->second.size = size;
-        it->second.typeName = typeName;
+    void SetCurrentPage(int32_t pageId) final
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        currentPageId_ = pageId;
+    }
 
-        total_ += size;
-        auto& info = typeMap_[typeName];
-        info.count++;
-        info.total += size;
+    void OnPageTransition(size_t pageDepth) final
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto& snapshot = snapshots_[std::min(pageDepth, MAX_SNAPSHOT_PAGE_DEPTH)];
+        bool hasLastSnapshot = !snapshot.empty();
+        snapshot.resize(typeInfos_.size());
+        for (size_t index = 0; index < typeInfos_.size(); ++index) {
+            auto& info = typeInfos_[index];
+            auto& typeSnapshot = snapshot[index];
+            if (hasLastSnapshot && info.count > typeSnapshot.count) {
+                typeSnapshot.growthCount++;
+            } else {
+                typeSnapshot.growthCount = 0;
+            }
+            typeSnapshot.count = info.count;
+            bool isLeakSuspect = typeSnapshot.growthCount >= LEAK_SUSPECT_GROWTH_COUNT;
+            if (isLeakSuspect && !info.isLeakSuspect) {
+                LOGW("%{public}s may leak, count = %{public}zu", info.typeName.c_str(), info.count);
+            }
+            info.isLeakSuspect = isLeakSuspect;
+        }
+    }
+
+    std::vector<MemoryTypeStats> GetTypeStats() const final
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        std::vector<MemoryTypeStats> result;
+        result.reserve(typeInfos_.size());
+        for (const auto& info : typeInfos_) {
+            result.push_back({ info.typeName, info.count, info.total, info.peakCount, info.isLeakSuspect });
+        }
+        return result;
+    }
+
+    MemoryPageStats GetPageStats(int32_t pageId) const final
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto iter = pageStats_.find(pageId);
+        return iter == pageStats_.end() ? MemoryPageStats() : iter->second;
+    }
+
+    std::vector<std::string> GetLeakSuspects() const final
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        std::vector<std::string> result;
+        for (const auto& info : typeInfos_) {
+            if (info.isLeakSuspect) {
+                result.emplace_back(info.typeName);
+            }
+        }
+        return result;
     }
 
     void Dump() const final
@@ -99,28 +216,116 @@ public:
         std::lock_guard<std::mutex> lock(mutex_);
         std::string out = "total = " + std::to_string(total_) + ", count = " + std::to_string(count_);
         DumpLog::GetInstance().Print(0, out);
-        for (auto&& [typeName, info] : typeMap_) {
-            if (info.total == 0) {
+        std::map<std::string, const TypeInfo*> sortedInfos;
+        for (const auto& info : typeInfos_) {
+            sortedInfos.emplace(info.typeName, &info);
+        }
+        for (auto&& [typeName, info] : sortedInfos) {
+            if (info->total == 0) {
                 continue;
             }
-            out = typeName + ": total = " + std::to_string(info.total) + ", count = " + std::to_string(info.count);
+            out = typeName + ": total = " + std::to_string(info->total) + ", count = " + std::to_string(info->count) +
+                  ", peak = " + std::to_string(info->peakCount);
             DumpLog::GetInstance().Print(1, out);
         }
+        DumpLog::GetInstance().Print(0, "pages:");
+        for (auto&& [pageId, stats] : pageStats_) {
+            out = "page " + std::to_string(pageId) + ":";
+            for (size_t index = 0; index < MEMORY_CATEGORY_COUNT; ++index) {
+                out.append(" ").append(CATEGORY_NAMES[index]).append(" = ").append(std::to_string(stats[index].count));
+                out.append("(").append(std::to_string(stats[index].total)).append(")");
+            }
+            DumpLog::GetInstance().Print(1, out);
+        }
+        DumpLog::GetInstance().Print(0, "leak suspects:");
+        for (const auto& info : typeInfos_) {
+            if (info.isLeakSuspect) {
+                DumpLog::GetInstance().Print(1, info.typeName + ": count = " + std::to_string(info.count));
+            }
+        }
     }
 
 private:
     struct MemInfo {
         size_t size = 0;
-        std::string typeName = "Unknown";
+        uint32_t typeIndex = INVALID_TYPE_INDEX;
+        int32_t pageId = -1;
     };
 
     struct TypeInfo {
+        std::string typeName;
+        MemoryCategory category = MemoryCategory::COUNT;
         size_t count = 0;
         size_t total = 0;
+        size_t peakCount = 0;
+        bool isLeakSuspect = false;
+    };
+
+    struct TypeSnapshot {
+        size_t count = 0;
+        uint32_t growthCount = 0;
     };
 
-    std::map<void*, MemInfo> memoryMap_;
-    std::map<std::string, TypeInfo> typeMap_;
+    uint32_t GetTypeIndex(const std::string& typeName, const TypeInfoBase* typeInfo)
+    {
+        auto iter = typeIndexes_.find(typeName);
+        if (iter != typeIndexes_.end()) {
+            return iter->second;
+        }
+        auto typeIndex = static_cast<uint32_t>(typeInfos_.size());
+        // the category depends on the type only, so it's decided by the first instance.
+        typeInfos_.push_back({ typeName, GetCategory(typeInfo) });
+        typeIndexes_.emplace(typeName, typeIndex);
+        return typeIndex;
+    }
+
+    void UpdateLocked(void* ptr, size_t size, uint32_t typeIndex)
+    {
+        auto it = memoryMap_.find(ptr);
+        if (it == memoryMap_.end()) {
+            LOGE("Address MUST be in memory map");
+            return;
+        }
+
+        it->second.size = size;
+        it->second.typeIndex = typeIndex;
+        it->second.pageId = currentPageId_;
+
+        total_ += size;
+        auto& info = typeInfos_[typeIndex];
+        info.count++;
+        info.total += size;
+        info.peakCount = std::max(info.peakCount, info.count);
+        if (info.category != MemoryCategory::COUNT) {
+            auto& stats = pageStats_[currentPageId_][static_cast<size_t>(info.category)];
+            stats.count++;
+            stats.total += size;
+        }
+    }
+
+    void RemoveFromPage(int32_t pageId, MemoryCategory category, size_t size)
+    {
+        auto iter = pageStats_.find(pageId);
+        if (iter == pageStats_.end()) {
+            return;
+        }
+        auto& stats = iter->second[static_cast<size_t>(category)];
+        stats.count--;
+        stats.total -= size;
+        // drop pages all objects of which are released.
+        if (std::all_of(iter->second.begin(), iter->second.end(),
+                [](const MemoryCategoryStats& categoryStats) { return categoryStats.count == 0; })) {
+            pageStats_.erase(iter);
+        }
+    }
+
+    std::unordered_map<void*, MemInfo> memoryMap_;
+    std::vector<TypeInfo> typeInfos_;
+    std::unordered_map<std::string, uint32_t> typeIndexes_;
+    std::unordered_map<const char*, uint32_t> typeIndexesByAddress_;
+    std::map<int32_t, MemoryPageStats> pageStats_;
+    std::unordered_map<size_t, std::vector<TypeSnapshot>> snapshots_;
+    int32_t currentPageId_ = -1;
     size_t total_ = 0;
     size_t count_ = 0;
 
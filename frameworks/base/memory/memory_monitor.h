@@ -16,7 +16,10 @@
 #ifndef FOUNDATION_ACE_FRAMEWORKS_BASE_MEMORY_MEMORY_MONITOR_H
 #define FOUNDATION_ACE_FRAMEWORKS_BASE_MEMORY_MEMORY_MONITOR_H
 
+#include <array>
+#include <cstdint>
 #include <string>
+#include <vector>
 
 #include "base/memory/memory_monitor_def.h"
 #include "base/memory/type_info_base.h"
@@ -26,6 +29,33 @@ namespace OHOS::Ace {
 
 void PurgeMallocCache();
 
+// Objects accounted per page, recognized by their base classes.
+enum class MemoryCategory : uint8_t {
+    FRAME_NODE = 0,
+    LAYOUT_WRAPPER,
+    IMAGE,
+    PARAGRAPH,
+    COUNT,
+};
+
+constexpr size_t MEMORY_CATEGORY_COUNT = static_cast<size_t>(MemoryCategory::COUNT);
+
+struct MemoryTypeStats {
+    std::string typeName;
+    // live objects and their bytes
+    size_t count = 0;
+    size_t total = 0;
+    size_t peakCount = 0;
+    bool isLeakSuspect = false;
+};
+
+struct MemoryCategoryStats {
+    size_t count = 0;
+    size_t total = 0;
+};
+
+using MemoryPageStats = std::array<MemoryCategoryStats, MEMORY_CATEGORY_COUNT>;
+
 class ACE_FORCE_EXPORT_WITH_PREVIEW MemoryMonitor {
 public:
     static MemoryMonitor& GetInstance();
@@ -35,13 +65,25 @@ public:
     virtual void Add(void* ptr) = 0;
     virtual void Remove(void* ptr) = 0;
     virtual void Update(void* ptr, size_t size, const std::string& typeName) = 0;
+    // [typeName] is a static string of the type, [typeInfo] may be null if the type has no 'TypeInfoBase'.
+    virtual void Update(void* ptr, size_t size, const char* typeName, const TypeInfoBase* typeInfo) = 0;
     virtual void Dump() const = 0;
 
+    // Objects claimed from now on are accounted to the page.
+    virtual void SetCurrentPage(int32_t pageId) = 0;
+    // Called before a page is pushed onto [pageDepth] pages. Live counts of types are compared with the last push
+    // onto the same depth, types growing on every one of several pushes are leak suspects.
+    virtual void OnPageTransition(size_t pageDepth) = 0;
+
+    virtual std::vector<MemoryTypeStats> GetTypeStats() const = 0;
+    virtual MemoryPageStats GetPageStats(int32_t pageId) const = 0;
+    virtual std::vector<std::string> GetLeakSuspects() const = 0;
+
     template<class T>
     void Update(T* ptr, void* refPtr)
     {
         if (ptr != nullptr && ptr->RefCount() == 0) {
-            Update(refPtr, TypeInfo<T>::Size(ptr), TypeInfo<T>::Name(ptr));
+            Update(refPtr, TypeInfo<T>::Size(ptr), TypeInfo<T>::Name(ptr), TypeInfo<T>::Base(ptr));
         }
     }
 
@@ -65,6 +107,11 @@ private:
         {
             return sizeof(T);
         }
+
+        static const TypeInfoBase* Base(T*)
+        {
+            return nullptr;
+        }
     };
 
     template<class T>
@@ -78,6 +125,11 @@ private:
         {
             return TypeInfoHelper::TypeSize(rawPtr);
         }
+
+        static const TypeInfoBase* Base(T* rawPtr)
+        {
+            return rawPtr;
+        }
     };
     static bool isEnable_;
 };
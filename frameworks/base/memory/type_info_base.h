@@ -156,6 +156,11 @@ public:
     {
         return DynamicCast<T>(&instance) != nullptr;
     }
+    // Check whether instance is the type of [id], for types not visible at compile time.
+    static bool InstanceOf(const TypeInfoBase* rawPtr, TypeInfoBase::IdType id)
+    {
+        return rawPtr != nullptr && rawPtr->SafeCastById(id) != 0;
+    }
 };
 
 } // namespace OHOS::Ace
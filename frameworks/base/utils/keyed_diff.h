@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_ACE_FRAMEWORKS_BASE_UTILS_KEYED_DIFF_H
+#define FOUNDATION_ACE_FRAMEWORKS_BASE_UTILS_KEYED_DIFF_H
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace OHOS::Ace {
+
+struct KeyedDiffResult {
+    // index of the matched old item for each new item, -1 if the new item is inserted.
+    std::vector<int32_t> oldIndexes;
+    // for each new item, true if it keeps its order relative to the other kept items, i.e. it is part of the
+    // longest increasing subsequence of [oldIndexes]. Kept items which are not stable have to be moved.
+    std::vector<bool> stable;
+    // for each old item, true if no new item matches it.
+    std::vector<bool> removed;
+    // first index of the new list which differs from the old list, -1 if both lists are equal.
+    int32_t firstChangedIndex = -1;
+    int32_t insertedCount = 0;
+    int32_t removedCount = 0;
+    int32_t movedCount = 0;
+};
+
+// Matches the keys of a new list against the keys of an old list, and computes the minimal set of moves to turn
+// the old order into the new one. A key appearing more than once is matched only once, later duplicates are
+// handled as inserted items. Runs in O(n log n).
+template<class Key, class OldKeys, class NewKeys>
+KeyedDiffResult ComputeKeyedDiff(const OldKeys& oldKeys, const NewKeys& newKeys)
+{
+    KeyedDiffResult result;
+    std::unordered_map<Key, int32_t> oldIndexByKey;
+    int32_t oldCount = 0;
+    for (const auto& key : oldKeys) {
+        oldIndexByKey.emplace(key, oldCount++);
+    }
+    result.removed.assign(oldCount, true);
+
+    auto oldIter = oldKeys.begin();
+    int32_t newIndex = 0;
+    for (const auto& key : newKeys) {
+        auto iter = oldIndexByKey.find(key);
+        int32_t oldIndex = -1;
+        if (iter != oldIndexByKey.end() && result.removed[iter->second]) {
+            oldIndex = iter->second;
+            result.removed[oldIndex] = false;
+        } else {
+            ++result.insertedCount;
+        }
+        result.oldIndexes.emplace_back(oldIndex);
+        if (result.firstChangedIndex < 0 && (oldIter == oldKeys.end() || *oldIter != key)) {
+            result.firstChangedIndex = newIndex;
+        }
+        if (oldIter != oldKeys.end()) {
+            ++oldIter;
+        }
+        ++newIndex;
+    }
+    result.removedCount = oldCount - (newIndex - result.insertedCount);
+    // new list is a prefix of the old one
+    if (result.firstChangedIndex < 0 && oldIter != oldKeys.end()) {
+        result.firstChangedIndex = newIndex;
+    }
+
+    // longest increasing subsequence of the matched old indexes, [tails] holds the new index of the smallest tail
+    // of every subsequence length.
+    std::vector<int32_t> tails;
+    std::vector<int32_t> prev(result.oldIndexes.size(), -1);
+    for (int32_t i = 0; i < static_cast<int32_t>(result.oldIndexes.size()); ++i) {
+        auto oldIndex = result.oldIndexes[i];
+        if (oldIndex < 0) {
+            continue;
+        }
+        int32_t low = 0;
+        int32_t high = static_cast<int32_t>(tails.size());
+        while (low < high) {
+            auto mid = low + (high - low) / 2;
+            if (result.oldIndexes[tails[mid]] < oldIndex) {
+                low = mid + 1;
+            } else {
+                high = mid;
+            }
+        }
+        prev[i] = low > 0 ? tails[low - 1] : -1;
+        if (low == static_cast<int32_t>(tails.size())) {
+            tails.emplace_back(i);
+        } else {
+            tails[low] = i;
+        }
+    }
+    result.stable.assign(result.oldIndexes.size(), false);
+    for (auto i = tails.empty() ? -1 : tails.back(); i >= 0; i = prev[i]) {
+        result.stable[i] = true;
+    }
+    result.movedCount = newIndex - result.insertedCount - static_cast<int32_t>(tails.size());
+    return result;
+}
+
+} // namespace OHOS::Ace
+
+#endif // FOUNDATION_ACE_FRAMEWORKS_BASE_UTILS_KEYED_DIFF_H
@@ -17,7 +17,10 @@
 #define FOUNDATION_ACE_FRAMEWORKS_BASE_UTILS_LINEAR_MAP_H
 
 #include <algorithm>
+#include <cstdint>
 #include <cstring>
+#include <string>
+#include <vector>
 
 namespace OHOS::Ace {
 template<typename T>
@@ -57,6 +60,64 @@ int64_t BinarySearchFindIndex(const LinearEnumMapNode<K, V>* vec, size_t length,
         return it - vec;
     }
 }
+// Hash index of a linear map, built once for tables looked up on hot paths such as setting styles and attributes.
+// Finds keys with one hash and usually one strcmp instead of log(n) strcmps of binary search, the map doesn't need
+// to be sorted. The first one of duplicated keys is found.
+template<typename T>
+class LinearMapIndex final {
+public:
+    LinearMapIndex(const LinearMapNode<T>* vec, size_t length) : vec_(vec)
+    {
+        size_t capacity = 1;
+        // load factor is at most 0.5, so probing ends soon for missing keys.
+        while (capacity < length * 2) {
+            capacity <<= 1;
+        }
+        slots_.assign(capacity, -1);
+        mask_ = capacity - 1;
+        for (size_t index = 0; index < length; ++index) {
+            auto slot = Hash(vec[index].key, strlen(vec[index].key)) & mask_;
+            while (slots_[slot] >= 0 && strcmp(vec[slots_[slot]].key, vec[index].key) != 0) {
+                slot = (slot + 1) & mask_;
+            }
+            if (slots_[slot] < 0) {
+                slots_[slot] = static_cast<int32_t>(index);
+            }
+        }
+    }
+    ~LinearMapIndex() = default;
+
+    // returns the index of [key] in the map, or -1 if not found, same as BinarySearchFindIndex.
+    int64_t Find(const std::string& key) const
+    {
+        auto slot = Hash(key.c_str(), key.size()) & mask_;
+        while (slots_[slot] >= 0) {
+            if (strcmp(vec_[slots_[slot]].key, key.c_str()) == 0) {
+                return slots_[slot];
+            }
+            slot = (slot + 1) & mask_;
+        }
+        return -1;
+    }
+
+private:
+    static size_t Hash(const char* key, size_t length)
+    {
+        // FNV-1a
+        constexpr uint32_t OFFSET_BASIS = 2166136261U;
+        constexpr uint32_t PRIME = 16777619U;
+        uint32_t hash = OFFSET_BASIS;
+        for (size_t i = 0; i < length; ++i) {
+            hash = (hash ^ static_cast<uint8_t>(key[i])) * PRIME;
+        }
+        return hash;
+    }
+
+    const LinearMapNode<T>* vec_ = nullptr;
+    std::vector<int32_t> slots_;
+    size_t mask_ = 0;
+};
+
 } // namespace OHOS::Ace
 
 #endif // FOUNDATION_ACE_FRAMEWORKS_BASE_UTILS_LINEAR_MAP_H
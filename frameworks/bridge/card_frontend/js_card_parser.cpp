@@ -16,6 +16,8 @@
 #include "frameworks/bridge/card_frontend/js_card_parser.h"
 
 #include <array>
+#include <deque>
+#include <stack>
 
 #include "base/i18n/localization.h"
 #include "base/resource/ace_res_config.h"
@@ -522,34 +524,160 @@ void GetBadgeConfig(const std::unique_ptr<JsonValue>& jsonDataSets, BadgeConfig&
     }
 }
 
-bool GetStrValue(const std::string& key, std::stack<std::string>& keyStack)
+std::string GetValueString(const std::unique_ptr<JsonValue>& value)
 {
-    auto topKey = keyStack.top();
-    auto data = JsonUtil::ParseJsonString(topKey);
+    return value->IsString() ? value->GetString() : value->ToString();
+}
+
+// Values of a member or index expression under evaluation. They are views of the data, a string holding json is
+// parsed when it is indexed and kept here until the expression is evaluated.
+class ExpressionValueStack final {
+public:
+    bool Empty() const
+    {
+        return values_.empty();
+    }
+
+    size_t Size() const
+    {
+        return values_.size();
+    }
+
+    const std::unique_ptr<JsonValue>& Top() const
+    {
+        return values_.top();
+    }
+
+    void Push(std::unique_ptr<JsonValue>&& value)
+    {
+        values_.emplace(std::move(value));
+    }
+
+    void Pop()
+    {
+        values_.pop();
+    }
+
+    const std::unique_ptr<JsonValue>& TopContainer()
+    {
+        const auto& top = values_.top();
+        if (!top->IsString()) {
+            return top;
+        }
+        parsedValues_.emplace_back(JsonUtil::ParseJsonString(top->GetString()));
+        return parsedValues_.back();
+    }
+
+private:
+    std::stack<std::unique_ptr<JsonValue>> values_;
+    std::deque<std::unique_ptr<JsonValue>> parsedValues_;
+};
+
+bool GetStrValue(const std::string& key, ExpressionValueStack& valueStack)
+{
+    if (valueStack.Empty()) {
+        return false;
+    }
+    const auto& data = valueStack.TopContainer();
     CHECK_NULL_RETURN_NOLOG(data, false);
     if (!data->IsValid() || !data->Contains(key)) {
         return false;
     }
-    keyStack.pop();
     auto dataValue = data->GetValue(key);
-    auto dataStr = dataValue->IsString() ? dataValue->GetString() : dataValue->ToString();
-    keyStack.emplace(dataStr);
+    valueStack.Pop();
+    valueStack.Push(std::move(dataValue));
     return true;
 }
 
-bool GetIndexValue(const std::string& key, std::stack<std::string>& keyStack)
+bool GetIndexValue(const std::string& key, ExpressionValueStack& valueStack)
 {
-    auto topValue = keyStack.top();
-    auto data = JsonUtil::ParseJsonString(topValue);
+    if (valueStack.Empty()) {
+        return false;
+    }
+    const auto& data = valueStack.TopContainer();
     CHECK_NULL_RETURN_NOLOG(data, false);
     auto index = StringToInt(key);
     if (!data->IsValid() || !data->IsArray() || (data->IsArray() && index >= data->GetArraySize())) {
         return false;
     }
-    keyStack.pop();
     auto dataValue = data->GetArrayItem(index);
-    auto dataStr = dataValue->IsString() ? dataValue->GetString() : dataValue->ToString();
-    keyStack.emplace(dataStr);
+    valueStack.Pop();
+    valueStack.Push(std::move(dataValue));
+    return true;
+}
+
+// a.b --> data.a.b, .b --> top.b
+bool ParsePointOperator(
+    const std::string& key, ExpressionValueStack& valueStack, const std::unique_ptr<JsonValue>& dataJson)
+{
+    std::vector<std::string> keys;
+    StringUtils::StringSplitter(key, '.', keys);
+    if (keys.empty()) {
+        return false;
+    }
+    std::unique_ptr<JsonValue> result;
+    if (key[0] == '.') {
+        if (valueStack.Empty()) {
+            return false;
+        }
+        result = GetJsonValue(keys, valueStack.TopContainer());
+        valueStack.Pop();
+    } else {
+        result = GetJsonValue(keys, dataJson);
+    }
+    if (result && result->IsValid()) {
+        valueStack.Push(std::move(result));
+        return true;
+    }
+    return false;
+}
+
+bool ParseIndexOperator(
+    const std::string& key, ExpressionValueStack& valueStack, const std::unique_ptr<JsonValue>& dataJson)
+{
+    if (StringUtils::IsNumber(key)) {
+        return GetIndexValue(key, valueStack);
+    }
+    if (key.empty() && valueStack.Size() >= 2) {
+        // list[keys[0]], the inner value is the index of the outer one.
+        auto topValue = GetValueString(valueStack.Top());
+        valueStack.Pop();
+        return GetStrValue(topValue, valueStack) || GetIndexValue(topValue, valueStack);
+    }
+    if (!key.empty() && dataJson->Contains(key)) {
+        auto dataStr = GetValueString(dataJson->GetValue(key));
+        return GetStrValue(dataStr, valueStack) || GetIndexValue(dataStr, valueStack);
+    }
+    if (key.find('.') != std::string::npos) {
+        std::vector<std::string> keys;
+        StringUtils::StringSplitter(key, '.', keys);
+        auto jsonValue = GetJsonValue(keys, dataJson);
+        if (jsonValue && jsonValue->IsValid()) {
+            auto result = GetValueString(jsonValue);
+            return GetStrValue(result, valueStack) || GetIndexValue(result, valueStack);
+        }
+        return true;
+    }
+    return false;
+}
+
+// Evaluates a member or index expression on the data, e.g. list[idx].name.
+bool ParseArrayExpression(
+    const CardExpression& expression, const std::unique_ptr<JsonValue>& dataJson, std::string& value)
+{
+    CHECK_NULL_RETURN_NOLOG(dataJson, false);
+    ExpressionValueStack valueStack;
+    for (const auto& step : expression.steps) {
+        auto result = step.isIndex ? ParseIndexOperator(step.key, valueStack, dataJson)
+                                   : ParsePointOperator(step.key, valueStack, dataJson);
+        if (!result) {
+            return false;
+        }
+    }
+    if (valueStack.Size() != 1) {
+        return false;
+    }
+    value = GetValueString(valueStack.Top());
     return true;
 }
 
@@ -605,11 +733,6 @@ std::string GetArrStrFromVec(const std::vector<std::string>& vec)
     return res;
 }
 
-bool IsMultiVariable(const std::string& value)
-{
-    return StartWith(value, "$f(") && EndWith(value, ")");
-}
-
 } // namespace
 
 void JsCardParser::UpdateProps(const std::string& key, std::string value, const std::unique_ptr<JsonValue>& propsJson)
@@ -634,15 +757,10 @@ void JsCardParser::ParseAttributes(const std::unique_ptr<JsonValue>& rootJson, i
     std::vector<std::pair<std::string, std::string>>& attrs, JsCommandDomElementOperator* command,
     const std::unique_ptr<JsonValue>& dataJson, const std::unique_ptr<JsonValue>& propsJson)
 {
-    auto attrList = rootJson->GetValue("attr");
-    CHECK_NULL_VOID_NOLOG(attrList);
-    if (!attrList->IsValid()) {
-        return;
-    }
-    auto attr = attrList->GetChild();
-    while (attr && attr->IsValid()) {
-        auto key = attr->GetKey();
-        auto value = attr->IsString() ? attr->GetString() : attr->ToString();
+    const auto& plan = templatePlan_.GetNodePlan(rootJson);
+    for (const auto& attr : plan.attributes) {
+        const auto& key = attr.key;
+        auto value = attr.value;
         static const LinearMapNode<void (*)(std::string&, JsCommandDomElementOperator*, JsCardParser&)>
             attrOperators[] = {
                 { "clockconfig",
@@ -682,16 +800,14 @@ void JsCardParser::ParseAttributes(const std::unique_ptr<JsonValue>& rootJson, i
         auto operatorIter = BinarySearchFindIndex(attrOperators, ArraySize(attrOperators), key.c_str());
         if (operatorIter != -1) {
             attrOperators[operatorIter].value(value, command, *this);
-            attr = attr->GetNext();
             continue;
         }
-        if (IsVariable(value)) {
+        if (attr.type == CardBindingType::VARIABLE) {
             ParseVariable(value, dataJson, propsJson);
-        } else if (IsMultiVariable(value)) {
+        } else if (attr.type == CardBindingType::MULTI) {
             ParseMultiVariable(value, dataJson, propsJson);
         }
         attrs.emplace_back(std::make_pair(key, value));
-        attr = attr->GetNext();
     }
 }
 
@@ -902,31 +1018,26 @@ void JsCardParser::GetPlurals(std::string& value)
 void JsCardParser::ParseStyles(const std::unique_ptr<JsonValue>& rootJson, int32_t nodeId,
     std::vector<std::pair<std::string, std::string>>& styles, const std::unique_ptr<JsonValue>& styleJson)
 {
-    // parse class style
-    auto classList = rootJson->GetValue("classList");
-    if (classList && classList->IsValid()) {
-        auto styleList = classList->GetChild();
-        while (styleList && styleList->IsValid()) {
-            auto value = styleList->GetString();
-            if (IsVariable(value)) {
-                ParseVariable(value);
-            }
-            std::string styleClass("." + value);
-            SelectStyle(styleClass, styleJson, styles);
-            SelectMediaQueryStyle(styleClass, styles);
-            styleList = styleList->GetNext();
-        }
-    }
-
-    // parse id style
-    if (rootJson->Contains("id")) {
-        auto value = rootJson->GetValue("id")->GetString();
-        if (IsVariable(value)) {
+    auto& plan = templatePlan_.GetNodePlan(rootJson);
+    // parse class and id style, styles of static selectors are selected once and reused.
+    for (const auto& selector : plan.selectors) {
+        auto value = selector.value;
+        if (selector.type == CardBindingType::VARIABLE) {
             ParseVariable(value);
+            std::string styleSelector(selector.key + value);
+            SelectStyle(styleSelector, styleJson, styles);
+            SelectMediaQueryStyle(styleSelector, styles);
+            continue;
         }
-        std::string idStyle("#" + value);
-        SelectStyle(idStyle, styleJson, styles);
-        SelectMediaQueryStyle(idStyle, styles);
+        std::string styleSelector(selector.key + value);
+        auto iter = plan.selectorStyles.find(styleSelector);
+        if (iter == plan.selectorStyles.end()) {
+            std::vector<std::pair<std::string, std::string>> selectorStyles;
+            SelectStyle(styleSelector, styleJson, selectorStyles);
+            iter = plan.selectorStyles.emplace(styleSelector, std::move(selectorStyles)).first;
+        }
+        styles.insert(styles.end(), iter->second.begin(), iter->second.end());
+        SelectMediaQueryStyle(styleSelector, styles);
     }
 
     // parse inline style
@@ -936,23 +1047,16 @@ void JsCardParser::ParseStyles(const std::unique_ptr<JsonValue>& rootJson, int32
 void JsCardParser::ParseInlineStyles(
     const std::unique_ptr<JsonValue>& rootJson, std::vector<std::pair<std::string, std::string>>& styles)
 {
-    auto styleList = rootJson->GetValue("style");
-    CHECK_NULL_VOID_NOLOG(styleList);
-    if (!styleList->IsValid()) {
-        return;
-    }
-    auto style = styleList->GetChild();
-    while (style && style->IsValid()) {
-        auto key = style->GetKey();
-        auto value = style->IsString() ? style->GetString() : style->ToString();
-        if (IsVariable(value)) {
+    const auto& plan = templatePlan_.GetNodePlan(rootJson);
+    for (const auto& style : plan.inlineStyles) {
+        auto value = style.value;
+        if (style.type == CardBindingType::VARIABLE) {
             ParseVariable(value);
         }
-        if (key == "fontFamily") {
+        if (style.key == "fontFamily") {
             RegisterFont(value);
         }
-        styles.emplace_back(std::make_pair(key, value));
-        style = style->GetNext();
+        styles.emplace_back(std::make_pair(style.key, value));
     }
 }
 
@@ -1188,13 +1292,20 @@ void JsCardParser::UpdatePageData(const std::string& dataList, const RefPtr<JsAc
         LOGE("update card data error");
         return;
     }
+    dirtyKeys_.clear();
     while (data && data->IsValid()) {
         auto key = data->GetKey();
         dataJson_->Replace(key.c_str(), data);
         repeatJson_->Replace(key.c_str(), data);
+        dirtyKeys_.emplace(key);
         data = data->GetNext();
     }
+    // only the nodes which depend on the changed keys need to be updated.
+    JsCardTemplatePlan::ExpandDirtyKeys(dataJson_, dirtyKeys_);
+    isPartialUpdate_ = true;
     SetUpdateStatus(page);
+    isPartialUpdate_ = false;
+    dirtyKeys_.clear();
 }
 
 void JsCardParser::UpdateStyle(const RefPtr<JsAcePage>& page)
@@ -1205,79 +1316,11 @@ void JsCardParser::UpdateStyle(const RefPtr<JsAcePage>& page)
 
 bool JsCardParser::ParseComplexExpression(std::string& value, const std::unique_ptr<JsonValue>& json)
 {
-    if (value.find('[') == std::string::npos && value.find('.') == std::string::npos) {
-        return false;
-    }
-    std::stack<std::string> keyStack;
-    auto key = value;
-    if (!ParseArrayExpression(key, keyStack, json) || keyStack.size() != 1) {
+    const auto& expression = templatePlan_.GetExpression(value);
+    if (!expression.isPath) {
         return false;
     }
-    auto result = keyStack.top();
-    keyStack.pop();
-    value = result;
-    return true;
-}
-
-bool JsCardParser::ParseArrayExpression(
-    const std::string& expression, std::stack<std::string>& keyStack, const std::unique_ptr<JsonValue>& json)
-{
-    auto dataJson = isRepeat_ ? repeatJson_->ToString() : json->ToString();
-    auto dataValue = JsonUtil::ParseJsonString(dataJson);
-    std::string tmpKey;
-    for (char i : expression) {
-        switch (i) {
-            case '[':
-                if (tmpKey.empty()) {
-                    return false;
-                }
-                if (!ParsePointOperator(tmpKey, keyStack, dataJson)) {
-                    return false;
-                }
-                tmpKey.clear();
-                break;
-            case ']':
-                if (StringUtils::IsNumber(tmpKey)) {
-                    if (!GetIndexValue(tmpKey, keyStack)) {
-                        return false;
-                    }
-                } else if (tmpKey.empty() && keyStack.size() >= 2) {
-                    auto topValue = keyStack.top();
-                    keyStack.pop();
-                    if (!GetStrValue(topValue, keyStack) && !GetIndexValue(topValue, keyStack)) {
-                        return false;
-                    }
-                } else if (!tmpKey.empty() && dataValue->Contains(tmpKey)) {
-                    auto data = dataValue->GetValue(tmpKey);
-                    auto dataStr = data->IsString() ? data->GetString() : data->ToString();
-                    if (!GetStrValue(dataStr, keyStack) && !GetIndexValue(dataStr, keyStack)) {
-                        return false;
-                    }
-                } else if (tmpKey.find('.') != std::string::npos) {
-                    std::vector<std::string> keys;
-                    StringUtils::StringSplitter(tmpKey, '.', keys);
-                    auto jsonValue = GetJsonValue(keys, dataValue);
-                    if (jsonValue && jsonValue->IsValid()) {
-                        auto result = jsonValue->IsString() ? jsonValue->GetString() : jsonValue->ToString();
-                        if (!GetStrValue(result, keyStack) && !GetIndexValue(result, keyStack)) {
-                            return false;
-                        }
-                    }
-                } else {
-                    return false;
-                }
-                tmpKey.clear();
-                break;
-            default: {
-                tmpKey += i;
-                break;
-            }
-        }
-    }
-    if (!tmpKey.empty()) {
-        return ParsePointOperator(tmpKey, keyStack, dataJson);
-    }
-    return true;
+    return ParseArrayExpression(expression, isRepeat_ ? repeatJson_ : json, value);
 }
 
 void JsCardParser::UpdateDomNode(const RefPtr<Framework::JsAcePage>& page, const std::unique_ptr<JsonValue>& rootJson,
@@ -1336,6 +1379,18 @@ void JsCardParser::UpdateDomNode(const RefPtr<Framework::JsAcePage>& page, const
         UpdateDomNode(page, customJsonTemplate, parentId, idArray, customJsonData, customJsonStyle, customJsonProps);
         return;
     }
+    auto childList = rootJson->GetValue("children");
+    if (isPartialUpdate_ && !isRepeat_ && !propsJson && !templatePlan_.GetNodePlan(rootJson).DependsOn(dirtyKeys_)) {
+        // none of the bindings of this node changed, keep its attributes and styles.
+        if (childList && childList->IsValid()) {
+            auto child = childList->GetChild();
+            while (child && child->IsValid()) {
+                UpdateDomNode(page, child, selfId, idArray, dataJson, styleJson, propsJson);
+                child = child->GetNext();
+            }
+        }
+        return;
+    }
     std::vector<std::pair<std::string, std::string>> attrs;
     std::vector<std::pair<std::string, std::string>> styles(customStyles_);
     customStyles_.clear();
@@ -1357,7 +1412,6 @@ void JsCardParser::UpdateDomNode(const RefPtr<Framework::JsAcePage>& page, const
     page->PushCommand(attrCommand);
     page->PushCommand(styleCommand);
 
-    auto childList = rootJson->GetValue("children");
     if (childList && childList->IsValid()) {
         auto child = childList->GetChild();
         while (child && child->IsValid()) {
@@ -1415,38 +1469,21 @@ void JsCardParser::ParseMultiVariable(
 
 bool JsCardParser::ParseTernaryExpression(std::string& value, const std::unique_ptr<JsonValue>& propsJson)
 {
-    if (value.find('?') == std::string::npos || value.find(':') == std::string::npos) {
-        return false;
-    }
-    // eg:{{flag ? key1 : key2}}, flagStr[0] = "flag", flagStr[1] = "key1 : key2".
-    std::vector<std::string> flagStr;
-    StringUtils::SplitStr(value, "?", flagStr);
-    if (flagStr.size() != 2) {
+    // eg:{{flag ? key1 : key2}}, split once by the template plan.
+    const auto& expression = templatePlan_.GetExpression(value);
+    if (!expression.isTernary) {
         return false;
     }
+    auto flagStr = expression.condition;
     bool flag = false;
-    if (GetAndParseProps(flagStr[0], propsJson) || GetVariable(flagStr[0])) {
-        flag = flagStr[0] == TRUE;
-    }
-
-    std::vector<std::string> keyStr;
-    StringUtils::SplitStr(flagStr[1], ":", keyStr);
-    if (keyStr.size() != 2) {
-        return false;
-    }
-    for (auto& key : keyStr) {
-        if (StartWith(key, "\'") && EndWith(key, "\'")) {
-            key = key.substr(1, key.size() - 2);
-        }
-        if (StartWith(key, "\"") && EndWith(key, "\"")) {
-            key = key.substr(1, key.size() - 2);
-        }
+    if (GetAndParseProps(flagStr, propsJson) || GetVariable(flagStr)) {
+        flag = flagStr == TRUE;
     }
 
-    // parse key1 and key2.
-    GetVariable(keyStr[0]);
-    GetVariable(keyStr[1]);
-    value = flag ? keyStr[0] : keyStr[1];
+    // parse key1 or key2.
+    auto key = flag ? expression.trueValue : expression.falseValue;
+    GetVariable(key);
+    value = key;
     return true;
 }
 
@@ -1633,30 +1670,6 @@ void JsCardParser::ParseSpecialAttr(
     }
 }
 
-bool JsCardParser::ParsePointOperator(
-    const std::string& tmpKey, std::stack<std::string>& keyStack, const std::string& dataJson)
-{
-    std::unique_ptr<JsonValue> data;
-    if (tmpKey[0] == '.') {
-        if (keyStack.empty()) {
-            return false;
-        }
-        data = JsonUtil::ParseJsonString(keyStack.top());
-        keyStack.pop();
-    } else {
-        data = JsonUtil::ParseJsonString(dataJson);
-    }
-    std::vector<std::string> keys;
-    StringUtils::StringSplitter(tmpKey, '.', keys);
-    auto result = GetJsonValue(keys, data);
-    if (result && result->IsValid()) {
-        auto dataStr = result->IsString() ? result->GetString() : result->ToString();
-        keyStack.emplace(dataStr);
-        return true;
-    }
-    return false;
-}
-
 void JsCardParser::CreateDomNode(const RefPtr<Framework::JsAcePage>& page, const std::unique_ptr<JsonValue>& rootJson,
     int32_t parentId, const std::unique_ptr<JsonValue>& dataJson, const std::unique_ptr<JsonValue>& actionJson,
     const std::unique_ptr<JsonValue>& styleJson, const std::unique_ptr<JsonValue>& propsJson, bool isNewNode)
@@ -2006,6 +2019,8 @@ void JsCardParser::ParseVersionAndUpdateData()
 
 bool JsCardParser::Initialize()
 {
+    // plans of the last template are keyed by its nodes, which are released with it.
+    templatePlan_.Clear();
     rootJson_ = rootBody_->GetValue("template");
     styleJson_ = rootBody_->GetValue("styles");
     eventJson_ = rootBody_->GetValue("actions");
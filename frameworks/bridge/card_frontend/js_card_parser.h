@@ -17,9 +17,11 @@
 #define FOUNDATION_ACE_FRAMEWORKS_BRIDGE_CARD_FRONTEND_JS_CARD_PARSER_H
 
 #include <map>
+#include <unordered_set>
 #include <vector>
 
 #include "base/memory/referenced.h"
+#include "frameworks/bridge/card_frontend/js_card_template_plan.h"
 #include "frameworks/bridge/common/media_query/media_queryer.h"
 #include "frameworks/bridge/js_frontend/frontend_delegate_impl.h"
 #include "frameworks/bridge/js_frontend/js_command.h"
@@ -125,6 +127,11 @@ public:
         cardHapPath_ = path;
     }
 
+    const JsCardTemplatePlan& GetTemplatePlan() const
+    {
+        return templatePlan_;
+    }
+
 private:
     void GetResImageUrl(std::string& value);
     bool GetI18nData(std::string& value);
@@ -143,8 +150,6 @@ private:
     bool ParseComplexExpression(std::string& value, const std::unique_ptr<JsonValue>& json);
     bool ParseTernaryExpression(std::string& value, const std::unique_ptr<JsonValue>& propsJson = nullptr);
     bool ParseLogicalExpression(std::string& value, const std::unique_ptr<JsonValue>& propsJson = nullptr);
-    bool ParseArrayExpression(
-        const std::string& expression, std::stack<std::string>& keyStack, const std::unique_ptr<JsonValue>& json);
     bool ParseSpecialVariable(std::string& value);
     void CreateDomNode(const RefPtr<Framework::JsAcePage>& page, const std::unique_ptr<JsonValue>& rootJson,
         int32_t parentId, const std::unique_ptr<JsonValue>& dataJson, const std::unique_ptr<JsonValue>& actionJson,
@@ -174,7 +179,6 @@ private:
     template<typename T>
     void ParseSpecialAttr(
         const std::function<void(const std::unique_ptr<JsonValue>&, T&)>& function, std::string& variable, T& value);
-    bool ParsePointOperator(const std::string& tmpKey, std::stack<std::string>& keyStack, const std::string& dataJson);
     void ResetRepeatIndexItem();
     void CreateRepeatDomNode(
         const RefPtr<Framework::JsAcePage>& page, const std::unique_ptr<JsonValue>& rootJson, int32_t parentId);
@@ -221,6 +225,11 @@ private:
     std::vector<std::pair<std::string, std::string>> customStyles_;
     MediaQueryer mediaQueryer_;
 
+    // compiled template, and the data keys changed by the ongoing UpdatePageData.
+    JsCardTemplatePlan templatePlan_;
+    std::unordered_set<std::string> dirtyKeys_;
+    bool isPartialUpdate_ = false;
+
     // for repeat attr
     bool isRepeat_ = false;
     std::string repeatIndex_;
@@ -0,0 +1,293 @@
+/*
+ * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "frameworks/bridge/card_frontend/js_card_template_plan.h"
+
+#include <algorithm>
+#include <cctype>
+
+#include "base/utils/string_utils.h"
+#include "base/utils/utils.h"
+#include "frameworks/bridge/common/utils/utils.h"
+
+namespace OHOS::Ace::Framework {
+namespace {
+
+const char VARIABLE_START[] = "{{";
+const char VARIABLE_END[] = "}}";
+const char BLOCK_VALUE[] = "blockValue";
+
+bool IsIdentifierStart(char ch)
+{
+    return std::isalpha(static_cast<unsigned char>(ch)) || ch == '_' || ch == '$';
+}
+
+bool IsIdentifierPart(char ch)
+{
+    return std::isalnum(static_cast<unsigned char>(ch)) || ch == '_' || ch == '$';
+}
+
+// Collects the root identifiers of one expression, e.g. "flag ? list[idx].name : 'none'" --> flag, list, idx.
+void CollectExpressionKeys(const std::string& expression, std::unordered_set<std::string>& keys)
+{
+    size_t pos = 0;
+    char quote = 0;
+    while (pos < expression.size()) {
+        char ch = expression[pos];
+        if (quote != 0) {
+            quote = (ch == quote) ? 0 : quote;
+            ++pos;
+            continue;
+        }
+        if (ch == '\'' || ch == '"') {
+            quote = ch;
+            ++pos;
+            continue;
+        }
+        if (!IsIdentifierStart(ch)) {
+            ++pos;
+            continue;
+        }
+        auto start = pos;
+        while (pos < expression.size() && IsIdentifierPart(expression[pos])) {
+            ++pos;
+        }
+        // a.b --> only "a" is a data key.
+        if (start > 0 && expression[start - 1] == '.') {
+            continue;
+        }
+        auto key = expression.substr(start, pos - start);
+        if (key != "true" && key != "false") {
+            keys.emplace(std::move(key));
+        }
+    }
+}
+
+std::string GetJsonString(const std::unique_ptr<JsonValue>& json)
+{
+    return json->IsString() ? json->GetString() : json->ToString();
+}
+
+void CompileBindings(const std::unique_ptr<JsonValue>& list, std::vector<CardBinding>& bindings,
+    std::unordered_set<std::string>& dependencies)
+{
+    CHECK_NULL_VOID_NOLOG(list);
+    if (!list->IsValid()) {
+        return;
+    }
+    auto item = list->GetChild();
+    while (item && item->IsValid()) {
+        CardBinding binding;
+        binding.key = item->GetKey();
+        binding.value = GetJsonString(item);
+        binding.type = JsCardTemplatePlan::GetBindingType(binding.value);
+        JsCardTemplatePlan::CollectDependencies(binding.value, dependencies);
+        bindings.emplace_back(std::move(binding));
+        item = item->GetNext();
+    }
+}
+
+void CompileSelector(const std::string& prefix, const std::string& value, CardNodePlan& plan)
+{
+    CardBinding selector;
+    selector.key = prefix;
+    selector.value = value;
+    selector.type = JsCardTemplatePlan::GetBindingType(value);
+    JsCardTemplatePlan::CollectDependencies(value, plan.dependencies);
+    plan.selectors.emplace_back(std::move(selector));
+}
+
+void CompilePath(const std::string& expression, CardExpression& result)
+{
+    if (expression.find('[') == std::string::npos && expression.find('.') == std::string::npos) {
+        return;
+    }
+    std::string key;
+    for (char ch : expression) {
+        if (ch == '[') {
+            if (key.empty()) {
+                result.steps.clear();
+                return;
+            }
+            result.steps.push_back({ false, std::move(key) });
+            key.clear();
+        } else if (ch == ']') {
+            result.steps.push_back({ true, std::move(key) });
+            key.clear();
+        } else {
+            key += ch;
+        }
+    }
+    if (!key.empty()) {
+        result.steps.push_back({ false, std::move(key) });
+    }
+    result.isPath = true;
+}
+
+void CompileTernary(const std::string& expression, CardExpression& result)
+{
+    if (expression.find('?') == std::string::npos || expression.find(':') == std::string::npos) {
+        return;
+    }
+    // flag ? key1 : key2 --> "flag", "key1 : key2" --> "key1", "key2".
+    std::vector<std::string> flagStr;
+    StringUtils::SplitStr(expression, "?", flagStr);
+    if (flagStr.size() != 2) {
+        return;
+    }
+    std::vector<std::string> keyStr;
+    StringUtils::SplitStr(flagStr[1], ":", keyStr);
+    if (keyStr.size() != 2) {
+        return;
+    }
+    for (auto& key : keyStr) {
+        if (StartWith(key, "\'") && EndWith(key, "\'")) {
+            key = key.substr(1, key.size() - 2);
+        }
+        if (StartWith(key, "\"") && EndWith(key, "\"")) {
+            key = key.substr(1, key.size() - 2);
+        }
+    }
+    result.isTernary = true;
+    result.condition = std::move(flagStr[0]);
+    result.trueValue = std::move(keyStr[0]);
+    result.falseValue = std::move(keyStr[1]);
+}
+
+} // namespace
+
+bool CardNodePlan::DependsOn(const std::unordered_set<std::string>& dirtyKeys) const
+{
+    if (alwaysUpdate) {
+        return true;
+    }
+    if (dependencies.size() < dirtyKeys.size()) {
+        return std::any_of(dependencies.begin(), dependencies.end(),
+            [&dirtyKeys](const std::string& key) { return dirtyKeys.count(key) > 0; });
+    }
+    return std::any_of(dirtyKeys.begin(), dirtyKeys.end(),
+        [this](const std::string& key) { return dependencies.count(key) > 0; });
+}
+
+CardNodePlan& JsCardTemplatePlan::GetNodePlan(const std::unique_ptr<JsonValue>& node)
+{
+    auto object = node->GetJsonObject();
+    auto iter = nodePlans_.find(object);
+    if (iter != nodePlans_.end()) {
+        return iter->second;
+    }
+    auto& plan = nodePlans_[object];
+    CompileNode(node, plan);
+    return plan;
+}
+
+void JsCardTemplatePlan::CompileNode(const std::unique_ptr<JsonValue>& node, CardNodePlan& plan)
+{
+    plan.alwaysUpdate = node->Contains("repeat") || node->Contains(BLOCK_VALUE) ||
+                        node->GetString("type") == "block";
+
+    auto shown = node->GetValue("shown");
+    if (shown && shown->IsValid()) {
+        CollectDependencies(GetJsonString(shown), plan.dependencies);
+    }
+    CompileBindings(node->GetValue("attr"), plan.attributes, plan.dependencies);
+    CompileBindings(node->GetValue("style"), plan.inlineStyles, plan.dependencies);
+
+    auto classList = node->GetValue("classList");
+    if (classList && classList->IsValid()) {
+        auto item = classList->GetChild();
+        while (item && item->IsValid()) {
+            CompileSelector(".", item->GetString(), plan);
+            item = item->GetNext();
+        }
+    }
+    if (node->Contains("id")) {
+        CompileSelector("#", node->GetValue("id")->GetString(), plan);
+    }
+
+    // event params may reference data, e.g. "params": { "name": "{{name}}" }.
+    auto events = node->GetValue("events");
+    if (events && events->IsValid()) {
+        CollectDependencies(events->ToString(), plan.dependencies);
+    }
+}
+
+void JsCardTemplatePlan::CollectDependencies(const std::string& value, std::unordered_set<std::string>& dependencies)
+{
+    auto startPos = value.find(VARIABLE_START);
+    while (startPos != std::string::npos) {
+        auto endPos = value.find(VARIABLE_END, startPos + 2);
+        if (endPos == std::string::npos) {
+            return;
+        }
+        CollectExpressionKeys(value.substr(startPos + 2, endPos - startPos - 2), dependencies);
+        startPos = value.find(VARIABLE_START, endPos + 2);
+    }
+}
+
+void JsCardTemplatePlan::ExpandDirtyKeys(
+    const std::unique_ptr<JsonValue>& dataJson, std::unordered_set<std::string>& dirtyKeys)
+{
+    CHECK_NULL_VOID_NOLOG(dataJson);
+    // key -> keys referenced by its value, for the data values which are bindings themselves.
+    std::unordered_map<std::string, std::unordered_set<std::string>> references;
+    auto data = dataJson->GetChild();
+    while (data && data->IsValid()) {
+        auto value = GetJsonString(data);
+        if (value.find(VARIABLE_START) != std::string::npos) {
+            CollectDependencies(value, references[data->GetKey()]);
+        }
+        data = data->GetNext();
+    }
+    bool changed = true;
+    while (changed) {
+        changed = false;
+        for (const auto& [key, keys] : references) {
+            if (dirtyKeys.count(key) > 0) {
+                continue;
+            }
+            if (std::any_of(keys.begin(), keys.end(),
+                [&dirtyKeys](const std::string& ref) { return dirtyKeys.count(ref) > 0; })) {
+                dirtyKeys.emplace(key);
+                changed = true;
+            }
+        }
+    }
+}
+
+const CardExpression& JsCardTemplatePlan::GetExpression(const std::string& expression)
+{
+    auto iter = expressions_.find(expression);
+    if (iter != expressions_.end()) {
+        return iter->second;
+    }
+    auto& result = expressions_[expression];
+    CompilePath(expression, result);
+    CompileTernary(expression, result);
+    return result;
+}
+
+CardBindingType JsCardTemplatePlan::GetBindingType(const std::string& value)
+{
+    if (StartWith(value, VARIABLE_START) && EndWith(value, VARIABLE_END)) {
+        return CardBindingType::VARIABLE;
+    }
+    if (StartWith(value, "$f(") && EndWith(value, ")")) {
+        return CardBindingType::MULTI;
+    }
+    return CardBindingType::CONSTANT;
+}
+
+} // namespace OHOS::Ace::Framework
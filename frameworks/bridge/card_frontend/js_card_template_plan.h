@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_ACE_FRAMEWORKS_BRIDGE_CARD_FRONTEND_JS_CARD_TEMPLATE_PLAN_H
+#define FOUNDATION_ACE_FRAMEWORKS_BRIDGE_CARD_FRONTEND_JS_CARD_TEMPLATE_PLAN_H
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "base/json/json_util.h"
+
+namespace OHOS::Ace::Framework {
+
+enum class CardBindingType {
+    CONSTANT, // plain value, no binding.
+    VARIABLE, // {{expression}}
+    MULTI,    // $f({{key1}} and {{key2}})
+};
+
+// One attribute/style/shown binding of a template node, classified once at compile time.
+struct CardBinding {
+    std::string key;
+    std::string value;
+    CardBindingType type = CardBindingType::CONSTANT;
+};
+
+// Instruction plan of a single template node. Bindings are classified once, styles of static selectors are
+// resolved once, and the data keys referenced by the node are recorded so that a data update can skip nodes
+// which do not depend on any changed key.
+struct CardNodePlan {
+    // Nodes of repeat, block and custom component templates are evaluated on every update.
+    bool alwaysUpdate = false;
+    std::unordered_set<std::string> dependencies;
+    std::vector<CardBinding> attributes;
+    std::vector<CardBinding> inlineStyles;
+    // Class and id selectors in declaration order, e.g. ".title", "#{{id}}".
+    std::vector<CardBinding> selectors;
+    // Styles of the static selectors, filled on first selection.
+    std::unordered_map<std::string, std::vector<std::pair<std::string, std::string>>> selectorStyles;
+
+    bool DependsOn(const std::unordered_set<std::string>& dirtyKeys) const;
+};
+
+// Step of a member or index expression, e.g. "list[idx].name" --> "list", [idx], ".name".
+struct CardExpressionStep {
+    bool isIndex = false;
+    std::string key;
+};
+
+// Tokens of a {{ }} expression, split once per expression text and reused on every update.
+struct CardExpression {
+    // list[idx].name, a.b
+    bool isPath = false;
+    std::vector<CardExpressionStep> steps;
+    // flag ? key1 : key2
+    bool isTernary = false;
+    std::string condition;
+    std::string trueValue;
+    std::string falseValue;
+};
+
+class JsCardTemplatePlan final {
+public:
+    JsCardTemplatePlan() = default;
+    ~JsCardTemplatePlan() = default;
+
+    // Returns the compiled plan of |node|, compiling it on first use.
+    CardNodePlan& GetNodePlan(const std::unique_ptr<JsonValue>& node);
+
+    // Expands |dirtyKeys| with the data keys whose values reference a dirty key, e.g. "title": "{{name}}".
+    static void ExpandDirtyKeys(const std::unique_ptr<JsonValue>& dataJson, std::unordered_set<std::string>& dirtyKeys);
+
+    // Collects the top-level data keys referenced by every {{ }} expression in |value|.
+    static void CollectDependencies(const std::string& value, std::unordered_set<std::string>& dependencies);
+
+    static CardBindingType GetBindingType(const std::string& value);
+
+    // Returns the tokens of |expression|, the text between {{ and }}, splitting it on first use.
+    const CardExpression& GetExpression(const std::string& expression);
+
+    // Plans are keyed by the template nodes, they must be cleared when the template is replaced.
+    void Clear()
+    {
+        nodePlans_.clear();
+        expressions_.clear();
+    }
+
+    size_t GetPlanSize() const
+    {
+        return nodePlans_.size();
+    }
+
+private:
+    static void CompileNode(const std::unique_ptr<JsonValue>& node, CardNodePlan& plan);
+
+    std::unordered_map<const JsonObject*, CardNodePlan> nodePlans_;
+    std::unordered_map<std::string, CardExpression> expressions_;
+};
+
+} // namespace OHOS::Ace::Framework
+
+#endif // FOUNDATION_ACE_FRAMEWORKS_BRIDGE_CARD_FRONTEND_JS_CARD_TEMPLATE_PLAN_H
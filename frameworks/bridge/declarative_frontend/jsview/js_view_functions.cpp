@@ -47,23 +47,23 @@ JSRef<JSObject> GenConstraint(const std::optional<NG::LayoutConstraintF>& parent
     return constraint;
 }
 
-JSRef<JSObject> GenPadding(const std::unique_ptr<NG::PaddingProperty>& paddingNative)
+JSRef<JSObject> GenPadding(const NG::PaddingProperty& paddingNative)
 {
     JSRef<JSObject> padding = JSRef<JSObject>::New();
-    padding->SetProperty("top", paddingNative->top->ToString());
-    padding->SetProperty("right", paddingNative->right->ToString());
-    padding->SetProperty("bottom", paddingNative->bottom->ToString());
-    padding->SetProperty("left", paddingNative->left->ToString());
+    padding->SetProperty("top", paddingNative.top->ToString());
+    padding->SetProperty("right", paddingNative.right->ToString());
+    padding->SetProperty("bottom", paddingNative.bottom->ToString());
+    padding->SetProperty("left", paddingNative.left->ToString());
     return padding;
 }
 
-JSRef<JSObject> GenEdgeWidths(const std::unique_ptr<NG::BorderWidthProperty>& edgeWidthsNative)
+JSRef<JSObject> GenEdgeWidths(const NG::BorderWidthProperty& edgeWidthsNative)
 {
     JSRef<JSObject> edgeWidths = JSRef<JSObject>::New();
-    edgeWidths->SetProperty("top", edgeWidthsNative->topDimen->ToString());
-    edgeWidths->SetProperty("right", edgeWidthsNative->rightDimen->ToString());
-    edgeWidths->SetProperty("bottom", edgeWidthsNative->bottomDimen->ToString());
-    edgeWidths->SetProperty("left", edgeWidthsNative->leftDimen->ToString());
+    edgeWidths->SetProperty("top", edgeWidthsNative.topDimen->ToString());
+    edgeWidths->SetProperty("right", edgeWidthsNative.rightDimen->ToString());
+    edgeWidths->SetProperty("bottom", edgeWidthsNative.bottomDimen->ToString());
+    edgeWidths->SetProperty("left", edgeWidthsNative.leftDimen->ToString());
     return edgeWidths;
 }
 
@@ -75,16 +75,16 @@ JSRef<JSObject> GenBorderInfo(const RefPtr<NG::LayoutWrapper>& layoutWrapper)
         return borderInfo;
     }
 
-    const std::unique_ptr<NG::PaddingProperty> defaultPadding = std::make_unique<NG::PaddingProperty>();
-    const std::unique_ptr<NG::BorderWidthProperty>& defaultEdgeWidth = std::make_unique<NG::BorderWidthProperty>();
+    const NG::PaddingProperty defaultPadding;
+    const NG::BorderWidthProperty defaultEdgeWidth;
     borderInfo->SetPropertyObject("borderWidth",
         GenEdgeWidths(
-            layoutProperty->GetBorderWidthProperty() ? layoutProperty->GetBorderWidthProperty() : defaultEdgeWidth));
+            layoutProperty->GetBorderWidthProperty() ? *layoutProperty->GetBorderWidthProperty() : defaultEdgeWidth));
 
     borderInfo->SetPropertyObject("margin",
-        GenPadding(layoutProperty->GetMarginProperty() ? layoutProperty->GetMarginProperty() : defaultPadding));
+        GenPadding(layoutProperty->GetMarginProperty() ? *layoutProperty->GetMarginProperty() : defaultPadding));
     borderInfo->SetPropertyObject("padding",
-        GenPadding(layoutProperty->GetPaddingProperty() ? layoutProperty->GetPaddingProperty() : defaultPadding));
+        GenPadding(layoutProperty->GetPaddingProperty() ? *layoutProperty->GetPaddingProperty() : defaultPadding));
 
     return borderInfo;
 }
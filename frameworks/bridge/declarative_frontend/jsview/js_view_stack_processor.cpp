@@ -15,6 +15,7 @@
 
 #include "bridge/declarative_frontend/jsview/js_view_stack_processor.h"
 
+#include "base/utils/string_utils.h"
 #include "bridge/declarative_frontend/engine/bindings.h"
 #include "bridge/declarative_frontend/engine/js_types.h"
 #include "bridge/declarative_frontend/jsview/models/view_stack_model_impl.h"
@@ -22,7 +23,14 @@
 #include "core/common/container.h"
 #include "core/components_ng/base/view_stack_model.h"
 #include "core/components_ng/base/view_stack_model_ng.h"
+#include "core/components_ng/base/view_abstract_model.h"
 #include "core/components_ng/base/view_stack_processor.h"
+#include "core/components_ng/pattern/blank/blank_model.h"
+#include "core/components_ng/pattern/image/image_model.h"
+#include "core/components_ng/pattern/linear_layout/column_model.h"
+#include "core/components_ng/pattern/linear_layout/row_model.h"
+#include "core/components_ng/pattern/stack/stack_model.h"
+#include "core/components_ng/pattern/text/text_model.h"
 #include "frameworks/core/pipeline/base/element_register.h"
 
 namespace OHOS::Ace {
@@ -51,6 +59,155 @@ ViewStackModel* ViewStackModel::GetInstance()
 
 } // namespace OHOS::Ace
 namespace OHOS::Ace::Framework {
+namespace {
+
+CalcDimension GetDimensionArg(const NG::BuildCommandArgs& args, uint32_t index, DimensionUnit unit)
+{
+    if (args.IsString(index)) {
+        return StringUtils::StringToCalcDimension(args.GetString(index), false, unit);
+    }
+    return CalcDimension(args.GetNumber(index), unit);
+}
+
+std::optional<Dimension> GetSpaceArg(const NG::BuildCommandArgs& args)
+{
+    if (args.GetCount() == 0) {
+        return std::nullopt;
+    }
+    auto space = GetDimensionArg(args, 0, DimensionUnit::VP);
+    return space.IsValid() ? space : Dimension();
+}
+
+// handlers of the codes, which call the models like the bindings of the components and attributes.
+const NG::BuildCommandHandlers& GetBuildCommandHandlers()
+{
+    static const NG::BuildCommandHandlers handlers = []() {
+        NG::BuildCommandHandlers handlers;
+        handlers.creators.resize(static_cast<size_t>(BuildComponentCode::COUNT));
+        auto setCreator = [&handlers](BuildComponentCode code, NG::BuildCommandHandler handler) {
+            handlers.creators[static_cast<size_t>(code)] = handler;
+        };
+        setCreator(BuildComponentCode::COLUMN, [](const NG::BuildCommandArgs& args) {
+            ColumnModel::GetInstance()->Create(GetSpaceArg(args), nullptr, "");
+        });
+        setCreator(BuildComponentCode::ROW, [](const NG::BuildCommandArgs& args) {
+            RowModel::GetInstance()->Create(GetSpaceArg(args), nullptr, "");
+        });
+        setCreator(BuildComponentCode::STACK, [](const NG::BuildCommandArgs& /* args */) {
+            StackModel::GetInstance()->Create();
+        });
+        setCreator(BuildComponentCode::TEXT, [](const NG::BuildCommandArgs& args) {
+            TextModel::GetInstance()->Create(args.GetString(0));
+        });
+        setCreator(BuildComponentCode::IMAGE, [](const NG::BuildCommandArgs& args) {
+            RefPtr<PixelMap> pixmap = nullptr;
+            ImageModel::GetInstance()->Create(args.GetString(0), true, pixmap, "", "");
+        });
+        setCreator(BuildComponentCode::BLANK, [](const NG::BuildCommandArgs& /* args */) {
+            BlankModel::GetInstance()->Create();
+        });
+
+        handlers.setters.resize(static_cast<size_t>(BuildAttributeCode::COUNT));
+        auto setSetter = [&handlers](BuildAttributeCode code, NG::BuildCommandHandler handler) {
+            handlers.setters[static_cast<size_t>(code)] = handler;
+        };
+        setSetter(BuildAttributeCode::WIDTH, [](const NG::BuildCommandArgs& args) {
+            ViewAbstractModel::GetInstance()->SetWidth(GetDimensionArg(args, 0, DimensionUnit::VP));
+        });
+        setSetter(BuildAttributeCode::HEIGHT, [](const NG::BuildCommandArgs& args) {
+            ViewAbstractModel::GetInstance()->SetHeight(GetDimensionArg(args, 0, DimensionUnit::VP));
+        });
+        setSetter(BuildAttributeCode::PADDING, [](const NG::BuildCommandArgs& args) {
+            ViewAbstractModel::GetInstance()->SetPadding(GetDimensionArg(args, 0, DimensionUnit::VP));
+        });
+        setSetter(BuildAttributeCode::MARGIN, [](const NG::BuildCommandArgs& args) {
+            ViewAbstractModel::GetInstance()->SetMargin(GetDimensionArg(args, 0, DimensionUnit::VP));
+        });
+        setSetter(BuildAttributeCode::BACKGROUND_COLOR, [](const NG::BuildCommandArgs& args) {
+            ViewAbstractModel::GetInstance()->SetBackgroundColor(Color(static_cast<uint32_t>(args.GetNumber(0))));
+        });
+        setSetter(BuildAttributeCode::LAYOUT_WEIGHT, [](const NG::BuildCommandArgs& args) {
+            ViewAbstractModel::GetInstance()->SetLayoutWeight(static_cast<int32_t>(args.GetNumber(0)));
+        });
+        setSetter(BuildAttributeCode::FONT_SIZE, [](const NG::BuildCommandArgs& args) {
+            TextModel::GetInstance()->SetFontSize(GetDimensionArg(args, 0, DimensionUnit::FP));
+        });
+        setSetter(BuildAttributeCode::FONT_COLOR, [](const NG::BuildCommandArgs& args) {
+            TextModel::GetInstance()->SetTextColor(Color(static_cast<uint32_t>(args.GetNumber(0))));
+        });
+        return handlers;
+    }();
+    return handlers;
+}
+
+bool DecodeBuildCommands(const JSRef<JSArray>& commands, NG::BuildCommandBuffer& buffer)
+{
+    auto length = commands->Length();
+    buffer.Reserve(length / 2, length / 2);
+    size_t pos = 0;
+    auto nextNumber = [&commands, &pos, length](int32_t& value) {
+        if (pos >= length) {
+            return false;
+        }
+        auto item = commands->GetValueAt(pos++);
+        if (!item->IsNumber()) {
+            return false;
+        }
+        value = item->ToNumber<int32_t>();
+        return true;
+    };
+    while (pos < length) {
+        int32_t type = 0;
+        if (!nextNumber(type)) {
+            return false;
+        }
+        switch (static_cast<NG::BuildCommandType>(type)) {
+            case NG::BuildCommandType::CREATE:
+            case NG::BuildCommandType::SET_ATTRIBUTE: {
+                int32_t code = 0;
+                int32_t argCount = 0;
+                if (!nextNumber(code) || !nextNumber(argCount) || code < 0 || argCount < 0 ||
+                    pos + static_cast<size_t>(argCount) > length) {
+                    return false;
+                }
+                auto codeCount = static_cast<NG::BuildCommandType>(type) == NG::BuildCommandType::CREATE
+                                     ? static_cast<int32_t>(BuildComponentCode::COUNT)
+                                     : static_cast<int32_t>(BuildAttributeCode::COUNT);
+                if (code >= codeCount) {
+                    return false;
+                }
+                if (static_cast<NG::BuildCommandType>(type) == NG::BuildCommandType::CREATE) {
+                    buffer.Create(static_cast<uint16_t>(code));
+                } else {
+                    buffer.SetAttribute(static_cast<uint16_t>(code));
+                }
+                for (int32_t i = 0; i < argCount; ++i) {
+                    auto arg = commands->GetValueAt(pos++);
+                    if (arg->IsString()) {
+                        buffer.AddString(arg->ToString());
+                    } else if (arg->IsNumber()) {
+                        buffer.AddNumber(arg->ToNumber<double>());
+                    } else {
+                        return false;
+                    }
+                }
+                break;
+            }
+            case NG::BuildCommandType::POP:
+                buffer.Pop();
+                break;
+            case NG::BuildCommandType::POP_CONTAINER:
+                buffer.PopContainer();
+                break;
+            default:
+                // nodes can't be pushed from JS.
+                return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
 
 void JSViewStackProcessor::JSVisualState(const JSCallbackInfo& info)
 {
@@ -87,6 +244,8 @@ void JSViewStackProcessor::JSBind(BindingTarget globalObj)
         "ImplicitPopBeforeContinue", &JSViewStackProcessor::JsImplicitPopBeforeContinue, opt);
     JSClass<JSViewStackProcessor>::StaticMethod("visualState", JSVisualState, opt);
     JSClass<JSViewStackProcessor>::StaticMethod("MakeUniqueId", &JSViewStackProcessor::JSMakeUniqueId, opt);
+    JSClass<JSViewStackProcessor>::StaticMethod(
+        "ExecuteBuildCommands", &JSViewStackProcessor::JsExecuteBuildCommands, opt);
     JSClass<JSViewStackProcessor>::StaticMethod("UsesNewPipeline", &JSViewStackProcessor::JsUsesNewPipeline, opt);
     JSClass<JSViewStackProcessor>::Bind<>(globalObj);
 }
@@ -142,6 +301,23 @@ void JSViewStackProcessor::JSMakeUniqueId(const JSCallbackInfo& info)
     const auto result = ElementRegister::GetInstance()->MakeUniqueId();
     info.SetReturnValue(JSRef<JSVal>::Make(ToJSValue(result)));
 }
+void JSViewStackProcessor::JsExecuteBuildCommands(const JSCallbackInfo& info)
+{
+    // the old pipeline has no batched build.
+    if (info.Length() < 1 || !info[0]->IsArray() || !Container::IsCurrentUseNewPipeline()) {
+        info.SetReturnValue(JSRef<JSVal>::Make(ToJSValue(false)));
+        return;
+    }
+    NG::BuildCommandBuffer buffer;
+    if (!DecodeBuildCommands(JSRef<JSArray>::Cast(info[0]), buffer)) {
+        LOGE("invalid build commands");
+        info.SetReturnValue(JSRef<JSVal>::Make(ToJSValue(false)));
+        return;
+    }
+    auto result = NG::ViewStackProcessor::GetInstance()->ExecuteBuildCommands(buffer, GetBuildCommandHandlers());
+    info.SetReturnValue(JSRef<JSVal>::Make(ToJSValue(result)));
+}
+
 /**
  * return true of current Container uses new Pipeline
  */
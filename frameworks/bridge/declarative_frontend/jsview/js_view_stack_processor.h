@@ -26,6 +26,30 @@
 
 namespace OHOS::Ace::Framework {
 
+// Component codes of the create commands of ViewStackProcessor.ExecuteBuildCommands, shared with the JS encoder.
+enum class BuildComponentCode : uint16_t {
+    COLUMN = 0, // (space?: number | string)
+    ROW,        // (space?: number | string)
+    STACK,      // ()
+    TEXT,       // (content?: string)
+    IMAGE,      // (src: string)
+    BLANK,      // ()
+    COUNT,
+};
+
+// Attribute codes of the set attribute commands of ViewStackProcessor.ExecuteBuildCommands.
+enum class BuildAttributeCode : uint16_t {
+    WIDTH = 0,        // (value: number | string), numbers in vp
+    HEIGHT,           // (value: number | string), numbers in vp
+    PADDING,          // (value: number | string), numbers in vp
+    MARGIN,           // (value: number | string), numbers in vp
+    BACKGROUND_COLOR, // (argb: number)
+    LAYOUT_WEIGHT,    // (value: number)
+    FONT_SIZE,        // (value: number | string), numbers in fp
+    FONT_COLOR,       // (argb: number)
+    COUNT,
+};
+
 class JSViewStackProcessor {
 public:
     JSViewStackProcessor() = default;
@@ -55,6 +79,16 @@ public:
      */
     static void JSMakeUniqueId(const JSCallbackInfo& info);
 
+    /**
+     * Builds a subtree from the commands in one array, in one call and one pass of the view stack.
+     * Create and set attribute commands are [type, code, argCount, ...args], pop and pop container commands are [type],
+     * types are those of NG::BuildCommandType, codes those of BuildComponentCode and BuildAttributeCode.
+     * JS signature: ExecuteBuildCommands(commands: Array<number | string>) : boolean
+     * Returns false and builds nothing if the commands are invalid or the pipeline doesn't support them, the caller
+     * then builds by the component bindings.
+     */
+    static void JsExecuteBuildCommands(const JSCallbackInfo& info);
+
     static void SetViewMap(const std::string& viewId, const JSRef<JSObject>& jsView)
     {
         if (viewMap_.find(viewId) != viewMap_.end()) {
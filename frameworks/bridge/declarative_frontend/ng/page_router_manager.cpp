@@ -21,6 +21,7 @@
 #include <string>
 
 #include "base/i18n/localization.h"
+#include "base/memory/memory_monitor.h"
 #include "base/memory/referenced.h"
 #include "base/ressched/ressched_report.h"
 #include "base/utils/utils.h"
@@ -61,6 +62,17 @@ void ExitToDesktop()
         TaskExecutor::TaskType::UI);
 }
 
+// Called before the page [pageId] is built onto [pageDepth] pages, so all nodes built for the page are accounted to
+// it, and pages popped before are released by now unless they leak.
+void OnMemoryMonitorPageLoading(int32_t pageId, size_t pageDepth)
+{
+    if (!MemoryMonitor::IsEnable()) {
+        return;
+    }
+    MemoryMonitor::GetInstance().OnPageTransition(pageDepth);
+    MemoryMonitor::GetInstance().SetCurrentPage(pageId);
+}
+
 } // namespace
 
 void PageRouterManager::LoadOhmUrl(const RouterPageInfo& target, const std::string& params)
@@ -791,6 +803,7 @@ void PageRouterManager::LoadPage(int32_t pageId, const RouterPageInfo& target, c
     auto pageNode =
         FrameNode::CreateFrameNode(V2::PAGE_ETS_TAG, ElementRegister::GetInstance()->MakeUniqueId(), pagePattern);
     pageNode->SetHostPageId(pageId);
+    OnMemoryMonitorPageLoading(pageId, pageRouterStack_.size());
     pageRouterStack_.emplace_back(pageNode);
     auto result = loadJs_(target.path, errorCallback);
     if (!result) {
@@ -817,6 +830,7 @@ void PageRouterManager::LoadCard(int32_t pageId, const RouterPageInfo& target, c
     auto pageNode =
         FrameNode::CreateFrameNode(V2::PAGE_ETS_TAG, ElementRegister::GetInstance()->MakeUniqueId(), pagePattern);
     pageNode->SetHostPageId(pageId);
+    OnMemoryMonitorPageLoading(pageId, pageRouterStack_.size());
     pageRouterStack_.emplace_back(pageNode);
 
     if (!loadCard_) {
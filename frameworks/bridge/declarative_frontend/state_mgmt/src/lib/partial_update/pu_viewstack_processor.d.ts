@@ -77,4 +77,13 @@ declare class ViewStackProcessor {
    * calls UsesNewPipeline static function
    */
   public static UsesNewPipeline();
+
+  /**
+   * build a subtree from commands encoded in one array, in one call
+   * create and set attribute commands are [type, code, argCount, ...args]
+   * pop and pop container commands are [type]
+   * see JSViewStackProcessor::JsExecuteBuildCommands for the types and codes
+   * returns false if nothing was built, the caller then builds by the components
+   */
+  public static ExecuteBuildCommands(commands: Array<number | string>): boolean;
 }
@@ -3009,4 +3009,136 @@ HWTEST_F(CardFrontendTest, CardFrontendOnMediaFeatureUpdate001, TestSize.Level1)
     ASSERT_NE(cardFrontend->manifestParser_, nullptr);
     ASSERT_EQ(cardFrontend->type_, FrontendType::JS_CARD);
 }
-} // namespace OHOS::Ace::Framework
\ No newline at end of file
+
+/**
+ * @tc.name: CardTemplatePlanTest001
+ * @tc.desc: Test dependencies collected by the compiled template plan.
+ * @tc.type: FUNC
+ */
+HWTEST_F(CardFrontendTest, CardTemplatePlanTest001, TestSize.Level1)
+{
+    std::unordered_set<std::string> dependencies;
+    JsCardTemplatePlan::CollectDependencies("{{flag ? list[idx].name : 'none'}}", dependencies);
+    ASSERT_EQ(dependencies.size(), 3);
+    ASSERT_TRUE(dependencies.count("flag") && dependencies.count("list") && dependencies.count("idx"));
+
+    dependencies.clear();
+    JsCardTemplatePlan::CollectDependencies("$f({{aaa}}.{{bbb && true}})", dependencies);
+    ASSERT_EQ(dependencies.size(), 2);
+    ASSERT_TRUE(dependencies.count("aaa") && dependencies.count("bbb"));
+
+    auto dataJson = JsonUtil::ParseJsonString("{\"title\": \"{{name}}\", \"name\": \"tom\", \"age\": 1}");
+    std::unordered_set<std::string> dirtyKeys = { "name" };
+    JsCardTemplatePlan::ExpandDirtyKeys(dataJson, dirtyKeys);
+    ASSERT_EQ(dirtyKeys.size(), 2);
+    ASSERT_TRUE(dirtyKeys.count("title"));
+}
+
+/**
+ * @tc.name: CardTemplatePlanTest002
+ * @tc.desc: Test that a data update only updates the nodes bound to the changed keys.
+ * @tc.type: FUNC
+ */
+HWTEST_F(CardFrontendTest, CardTemplatePlanTest002, TestSize.Level1)
+{
+    const std::string rootJson = "{\n"
+                                 "\t\"template\": {\n"
+                                 "\t\t\"type\": \"div\",\n"
+                                 "\t\t\"classList\": [\"container\"],\n"
+                                 "\t\t\"children\": [{\n"
+                                 "\t\t\t\"type\": \"text\",\n"
+                                 "\t\t\t\"attr\": { \"value\": \"{{title}}\" }\n"
+                                 "\t\t}, {\n"
+                                 "\t\t\t\"type\": \"text\",\n"
+                                 "\t\t\t\"attr\": { \"value\": \"{{subtitle}}\" }\n"
+                                 "\t\t}]\n"
+                                 "\t},\n"
+                                 "\t\"styles\": { \".container\": { \"width\": \"100px\" } },\n"
+                                 "\t\"actions\": {},\n"
+                                 "\t\"data\": {\n"
+                                 "\t\t\"title\": \"hello\",\n"
+                                 "\t\t\"subtitle\": \"world\"\n"
+                                 "\t}\n"
+                                 "}";
+    auto rootBody = JsonUtil::ParseJsonString(rootJson);
+    auto rootTemplate = rootBody->GetValue("template");
+    auto jsCardParser = AceType::MakeRefPtr<JsCardParser>(nullptr, nullptr, std::move(rootBody));
+    jsCardParser->Initialize();
+    auto document = AceType::MakeRefPtr<DOMDocument>(1);
+    auto page = AceType::MakeRefPtr<Framework::JsAcePage>(1, document, "", nullptr);
+    jsCardParser->CreateDomNode(page, rootTemplate, -1);
+    jsCardParser->ResetNodeId();
+    ASSERT_EQ(page->GetCommandSize(), 3);
+    ASSERT_EQ(jsCardParser->GetTemplatePlan().GetPlanSize(), 3);
+
+    /**
+     * @tc.steps: step1. update the key bound by the first text only.
+     * @tc.expected: step1. only the attribute and style commands of the first text are pushed.
+     */
+    std::vector<RefPtr<JsCommand>> commands;
+    page->PopAllCommands(commands);
+    jsCardParser->UpdatePageData("{\"title\": \"hi\"}", page);
+    ASSERT_EQ(page->GetCommandSize(), 2);
+
+    /**
+     * @tc.steps: step2. update styles.
+     * @tc.expected: step2. all nodes are updated.
+     */
+    page->PopAllCommands(commands);
+    jsCardParser->UpdateStyle(page);
+    ASSERT_EQ(page->GetCommandSize(), 6);
+}
+
+/**
+ * @tc.name: CardTemplatePlanTest003
+ * @tc.desc: Test expressions split once by the template plan and cleared with the template.
+ * @tc.type: FUNC
+ */
+HWTEST_F(CardFrontendTest, CardTemplatePlanTest003, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. split member, index and ternary expressions.
+     * @tc.expected: step1. the steps and branches of the expressions are recorded.
+     */
+    JsCardTemplatePlan plan;
+    const auto& path = plan.GetExpression("list[idx].name");
+    ASSERT_TRUE(path.isPath);
+    ASSERT_EQ(path.steps.size(), 3);
+    ASSERT_TRUE(!path.steps[0].isIndex && path.steps[0].key == "list");
+    ASSERT_TRUE(path.steps[1].isIndex && path.steps[1].key == "idx");
+    ASSERT_TRUE(!path.steps[2].isIndex && path.steps[2].key == ".name");
+    ASSERT_FALSE(plan.GetExpression("[0]").isPath);
+    const auto& ternary = plan.GetExpression("flag ? 'yes' : no");
+    ASSERT_TRUE(ternary.isTernary);
+    ASSERT_TRUE(ternary.condition == "flag" && ternary.trueValue == "yes" && ternary.falseValue == "no");
+    ASSERT_EQ(&plan.GetExpression("list[idx].name"), &path);
+
+    /**
+     * @tc.steps: step2. evaluate the expressions on the data, then initialize the parser again.
+     * @tc.expected: step2. the values are read from the data and the cached expressions are cleared.
+     */
+    const std::string rootJson = "{\n"
+                                 "\t\"template\": { \"attr\": {}, \"type\": \"text\" },\n"
+                                 "\t\"styles\": {},\n"
+                                 "\t\"actions\": {},\n"
+                                 "\t\"data\": {\n"
+                                 "\t\t\"list\": [{ \"name\": \"tom\" }, { \"name\": \"jerry\" }],\n"
+                                 "\t\t\"idx\": 1,\n"
+                                 "\t\t\"flag\": false,\n"
+                                 "\t\t\"no\": \"none\"\n"
+                                 "\t}\n"
+                                 "}";
+    auto rootBody = JsonUtil::ParseJsonString(rootJson);
+    auto jsCardParser = AceType::MakeRefPtr<JsCardParser>(nullptr, nullptr, std::move(rootBody));
+    jsCardParser->Initialize();
+    std::string value = "{{list[idx].name}}";
+    jsCardParser->ParseVariable(value);
+    ASSERT_EQ(value, "jerry");
+    value = "{{flag ? 'yes' : no}}";
+    jsCardParser->ParseVariable(value);
+    ASSERT_EQ(value, "none");
+    ASSERT_FALSE(jsCardParser->templatePlan_.expressions_.empty());
+    jsCardParser->Initialize();
+    ASSERT_TRUE(jsCardParser->templatePlan_.expressions_.empty());
+}
+} // namespace OHOS::Ace::Framework
@@ -246,7 +246,7 @@ bool EventManager::DispatchTouchEvent(const TouchEvent& event)
     if (point.type == TouchType::DOWN) {
         // first collect gesture into gesture referee.
         if (Container::IsCurrentUseNewPipeline()) {
-            refereeNG_->AddGestureToScope(point.id, iter->second);
+            refereeNG_->AddGestureToScope(point.id, iter->second, point.time);
         }
     }
 
@@ -298,7 +298,7 @@ bool EventManager::DispatchTouchEvent(const AxisEvent& event)
         // first collect gesture into gesture referee.
         if (Container::IsCurrentUseNewPipeline()) {
             if (refereeNG_) {
-                refereeNG_->AddGestureToScope(event.id, axisTouchTestResult_);
+                refereeNG_->AddGestureToScope(event.id, axisTouchTestResult_, event.time);
             }
         }
     }
@@ -15,9 +15,19 @@
 
 #include "core/common/font_loader.h"
 
+#include <fstream>
+#include <iterator>
+
+#include "base/network/download_manager.h"
 #include "base/utils/utils.h"
+#include "core/image/image_cache.h"
 
 namespace OHOS::Ace {
+namespace {
+
+constexpr char FONT_CACHE_FILE_SUFFIX[] = ".font";
+
+} // namespace
 
 FontLoader::FontLoader(const std::string& familyName, const std::string& familySrc)
     : familyName_(familyName), familySrc_(familySrc) {}
@@ -47,4 +57,75 @@ void FontLoader::SetVariationChanged(const std::function<void()>& variationChang
     variationChanged_ = variationChanged;
 }
 
+bool FontLoader::ReadCacheFile(const std::string& url, std::vector<uint8_t>& fontData)
+{
+    // cache files written in former launches are recorded once.
+    ImageCache::SetCacheFileInfo();
+    auto filePath = ImageCache::GetImageCacheFilePath(url) + FONT_CACHE_FILE_SUFFIX;
+    if (!ImageCache::GetFromCacheFile(filePath)) {
+        return false;
+    }
+    std::ifstream file(filePath, std::ios::binary);
+    if (!file.is_open()) {
+        LOGW("open font cache file failed, cannot read.");
+        return false;
+    }
+    fontData.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    return !fontData.empty();
+}
+
+void FontLoader::WriteCacheFile(const std::string& url, const std::vector<uint8_t>& fontData)
+{
+    ImageCache::WriteCacheFile(url, fontData.data(), fontData.size(), FONT_CACHE_FILE_SUFFIX);
+}
+
+void FontLoader::RemoveCacheFile(const std::string& url)
+{
+    ImageCache::RemoveCacheFile(url, FONT_CACHE_FILE_SUFFIX);
+}
+
+bool FontLoader::LoadNetworkFontData(const std::string& url, std::vector<uint8_t>& fontData,
+    const std::function<bool(const std::vector<uint8_t>&)>& isValid)
+{
+    if (ReadCacheFile(url, fontData)) {
+        if (isValid(fontData)) {
+            return true;
+        }
+        // the cache file is corrupted, download the font again.
+        LOGW("Invalid font cache file, download it again.");
+        RemoveCacheFile(url);
+        fontData.clear();
+    }
+    if (!DownloadManager::GetInstance().Download(url, fontData) || fontData.empty()) {
+        LOGE("Download font failed.");
+        return false;
+    }
+    if (!isValid(fontData)) {
+        LOGE("Invalid font data, it's not cached.");
+        return false;
+    }
+    WriteCacheFile(url, fontData);
+    return true;
+}
+
+void FontLoader::NotifyLoaded()
+{
+    isLoaded_ = true;
+    for (const auto& [node, callback] : callbacks_) {
+        if (callback) {
+            callback();
+        }
+    }
+    callbacks_.clear();
+    for (const auto& [node, callback] : callbacksNG_) {
+        if (callback) {
+            callback();
+        }
+    }
+    callbacksNG_.clear();
+    if (variationChanged_) {
+        variationChanged_();
+    }
+}
+
 } // namespace OHOS::Ace
\ No newline at end of file
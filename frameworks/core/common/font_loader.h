@@ -16,11 +16,19 @@
 #ifndef FOUNDATION_ACE_FRAMEWORKS_CORE_COMMON_FONT_LOADER_H
 #define FOUNDATION_ACE_FRAMEWORKS_CORE_COMMON_FONT_LOADER_H
 
+#include <functional>
+#include <map>
+#include <vector>
+
 #include "base/memory/ace_type.h"
 #include "core/pipeline/pipeline_base.h"
 
 namespace OHOS::Ace {
 
+namespace NG {
+class UINode;
+} // namespace NG
+
 class FontLoader : public virtual AceType {
     DECLARE_ACE_TYPE(FontLoader, AceType);
 
@@ -37,10 +45,37 @@ public:
     void RemoveCallback(const WeakPtr<RenderNode>& node);
     void SetVariationChanged(const std::function<void()>& variationChanged);
 
+    // Nodes laid out after the font is loaded use it already, so they are not notified.
+    void SetOnLoadedNG(const WeakPtr<NG::UINode>& node, const std::function<void()>& callback)
+    {
+        if (callback && !isLoaded_) {
+            callbacksNG_.emplace(node, callback);
+        }
+    }
+
+    void RemoveCallbackNG(const WeakPtr<NG::UINode>& node)
+    {
+        callbacksNG_.erase(node);
+    }
+
 protected:
+    // Font files downloaded and validated before are kept in the cache file directory, across app launches.
+    // Called on background thread.
+    static bool ReadCacheFile(const std::string& url, std::vector<uint8_t>& fontData);
+    static void WriteCacheFile(const std::string& url, const std::vector<uint8_t>& fontData);
+    static void RemoveCacheFile(const std::string& url);
+    // Reads the font of [url] from the cache file, and downloads it when it's not cached or [isValid] rejects the
+    // cached data. Downloaded data accepted by [isValid] is written to the cache file. Called on background thread.
+    static bool LoadNetworkFontData(const std::string& url, std::vector<uint8_t>& fontData,
+        const std::function<bool(const std::vector<uint8_t>&)>& isValid);
+
+    // Called on UI thread after the font is registered, only nodes using the family are notified.
+    void NotifyLoaded();
+
     std::string familyName_;
     std::string familySrc_;
     std::map<WeakPtr<RenderNode>, std::function<void()>> callbacks_;
+    std::map<WeakPtr<NG::UINode>, std::function<void()>> callbacksNG_;
     bool isLoaded_ = false;
     std::function<void()> variationChanged_;
 };
@@ -23,6 +23,8 @@
 namespace OHOS::Ace {
 
 float FontManager::fontWeightScale_ = 1.0f;
+std::function<void(const std::string&)> FontManager::onFontLoaded_;
+std::function<void()> FontManager::onFontVaried_;
 
 void FontManager::RegisterFont(
     const std::string& familyName, const std::string& familySrc, const RefPtr<PipelineBase>& context)
@@ -45,6 +47,14 @@ void FontManager::RegisterFont(
     fontLoader->SetVariationChanged([weak = WeakClaim(this), familyName]() {
         auto fontManager = weak.Upgrade();
         CHECK_NULL_VOID_NOLOG(fontManager);
+        if (onFontLoaded_) {
+            onFontLoaded_(familyName);
+        }
+        // nodes using the font are notified by their callbacks, relayout of all texts is only needed for the weight
+        // scale to be applied to the new font.
+        if (NearEqual(fontWeightScale_, 1.0f)) {
+            return;
+        }
         fontManager->VaryFontCollectionWithFontWeightScale();
     });
 }
@@ -123,8 +133,21 @@ void FontManager::RemoveVariationNode(const WeakPtr<RenderNode>& node)
     variationNodes_.erase(node);
 }
 
+void FontManager::SetOnFontLoaded(std::function<void(const std::string&)>&& onFontLoaded)
+{
+    onFontLoaded_ = std::move(onFontLoaded);
+}
+
+void FontManager::SetOnFontVaried(std::function<void()>&& onFontVaried)
+{
+    onFontVaried_ = std::move(onFontVaried);
+}
+
 void FontManager::NotifyVariationNodes()
 {
+    if (onFontVaried_) {
+        onFontVaried_();
+    }
 #ifndef NG_BUILD
     for (const auto& node : variationNodes_) {
         auto refNode = node.Upgrade();
@@ -53,6 +53,29 @@ public:
     void RemoveVariationNode(const WeakPtr<RenderNode>& node);
     void NotifyVariationNodes();
 
+    // Hooks of caches of shaped text, which are out of date when fonts change. [onFontLoaded] is called with the
+    // family name after a custom font is loaded, [onFontVaried] when the font weight scale is applied.
+    static void SetOnFontLoaded(std::function<void(const std::string&)>&& onFontLoaded);
+    static void SetOnFontVaried(std::function<void()>&& onFontVaried);
+
+    // [callback] is called when the custom font [familyName] is loaded, nodes only relayout for their own fonts.
+    void RegisterCallbackNG(
+        const WeakPtr<NG::UINode>& node, const std::string& familyName, const std::function<void()>& callback)
+    {
+        for (auto& fontLoader : fontLoaders_) {
+            if (fontLoader->GetFamilyName() == familyName) {
+                fontLoader->SetOnLoadedNG(node, callback);
+            }
+        }
+    }
+
+    void UnRegisterCallbackNG(const WeakPtr<NG::UINode>& node)
+    {
+        for (auto& fontLoader : fontLoaders_) {
+            fontLoader->RemoveCallbackNG(node);
+        }
+    }
+
 protected:
     static float fontWeightScale_;
 
@@ -62,6 +85,8 @@ private:
     std::set<WeakPtr<RenderNode>> fontNodes_;
     // Render nodes need to layout when wght scale is changed.
     std::set<WeakPtr<RenderNode>> variationNodes_;
+    static std::function<void(const std::string&)> onFontLoaded_;
+    static std::function<void()> onFontVaried_;
 };
 
 } // namespace OHOS::Ace
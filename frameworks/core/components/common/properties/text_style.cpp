@@ -38,7 +38,8 @@ bool TextStyle::operator==(const TextStyle& rhs) const
            allowScale_ == rhs.allowScale_ && wordBreak_ == rhs.wordBreak_ &&
            textDecorationColor_ == rhs.textDecorationColor_ && textCase_ == rhs.textCase_ &&
            baselineOffset_ == rhs.baselineOffset_ && adaptHeight_ == rhs.adaptHeight_ &&
-           textIndent_ == rhs.textIndent_ && verticalAlign_ == rhs.verticalAlign_ && wordSpacing_ == rhs.wordSpacing_;
+           textIndent_ == rhs.textIndent_ && verticalAlign_ == rhs.verticalAlign_ && wordSpacing_ == rhs.wordSpacing_ &&
+           whiteSpace_ == rhs.whiteSpace_;
 }
 
 bool TextStyle::operator!=(const TextStyle& rhs) const
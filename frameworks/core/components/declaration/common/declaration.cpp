@@ -646,6 +646,8 @@ void Declaration::SetAttr(const std::vector<std::pair<std::string, std::string>>
             } },
 #endif
     };
+    static const LinearMapIndex<void (*)(const std::string&, Declaration&)> attrSetterIndex(
+        attrSetters, ArraySize(attrSetters));
 
     for (const auto& attr : attrs) {
         if (attr.first == DOM_DISABLED) {
@@ -663,7 +665,7 @@ void Declaration::SetAttr(const std::vector<std::pair<std::string, std::string>>
         if (SetSpecializedAttr(attr)) {
             continue;
         }
-        auto operatorIter = BinarySearchFindIndex(attrSetters, ArraySize(attrSetters), attr.first.c_str());
+        auto operatorIter = attrSetterIndex.Find(attr.first);
         if (operatorIter != -1) {
             attrSetters[operatorIter].value(attr.second, *this);
         }
@@ -1610,16 +1612,22 @@ void Declaration::SetCurrentStyle(const std::pair<std::string, std::string>& sty
             } },
     };
 
-    auto operatorIter = BinarySearchFindIndex(styleSetter, ArraySize(styleSetter), style.first.c_str());
-    if (operatorIter != -1) {
-        styleSetter[operatorIter].value(style.second, *this);
+    static const LinearMapIndex<void (*)(const std::string&, Declaration&)> styleSetterIndex(
+        styleSetter, ArraySize(styleSetter));
+    auto operatorIter = styleSetterIndex.Find(style.first);
+    if (operatorIter == -1) {
+        return;
     }
+    styleSetter[operatorIter].value(style.second, *this);
 
-    auto& renderAttr = static_cast<CommonRenderAttribute&>(GetAttribute(AttributeTag::COMMON_RENDER_ATTR));
-    static const std::unordered_set<std::string> displayStyleSet = { DOM_OPACITY, DOM_DISPLAY, DOM_VISIBILITY };
-    if (displayStyleSet.find(style.first) != displayStyleSet.end() &&
-        AceApplicationInfo::GetInstance().GetIsCardType() && renderAttr.show == "false") {
-        SetShowAttr(renderAttr.show);
+    // keys of the map are the names themselves, compared by address.
+    auto key = styleSetter[operatorIter].key;
+    if ((key == DOM_OPACITY || key == DOM_DISPLAY || key == DOM_VISIBILITY) &&
+        AceApplicationInfo::GetInstance().GetIsCardType()) {
+        auto& renderAttr = static_cast<CommonRenderAttribute&>(GetAttribute(AttributeTag::COMMON_RENDER_ATTR));
+        if (renderAttr.show == "false") {
+            SetShowAttr(renderAttr.show);
+        }
     }
 }
 
@@ -1970,11 +1978,13 @@ void Declaration::AddEvent(int32_t pageId, const std::string& eventId, const std
                 }
             } },
     };
+    static const LinearMapIndex<void (*)(int32_t, const std::string&, Declaration&)> eventSetterIndex(
+        eventSetters, ArraySize(eventSetters));
     for (const auto& event : events) {
         if (SetSpecializedEvent(pageId, eventId, event)) {
             continue;
         }
-        auto setterIter = BinarySearchFindIndex(eventSetters, ArraySize(eventSetters), event.c_str());
+        auto setterIter = eventSetterIndex.Find(event);
         if (setterIter != -1) {
             eventSetters[setterIter].value(pageId, eventId, *this);
         }
@@ -60,18 +60,8 @@ void FlutterFontLoader::LoadFromNetwork(const OHOS::Ace::RefPtr<OHOS::Ace::Pipel
             // Load font.
             FlutterFontCollection::GetInstance().LoadFontFromList(
                 fontData.data(), fontData.size(), fontLoader->familyName_);
-            fontLoader->isLoaded_ = true;
-
             // When font is already loaded, notify all which used this font.
-            for (const auto& [node, callback] : fontLoader->callbacks_) {
-                if (callback) {
-                    callback();
-                }
-            }
-            fontLoader->callbacks_.clear();
-            if (fontLoader->variationChanged_) {
-                fontLoader->variationChanged_();
-            }
+            fontLoader->NotifyLoaded();
         }, TaskExecutor::TaskType::UI);
     }, TaskExecutor::TaskType::BACKGROUND);
 }
@@ -110,17 +100,7 @@ void FlutterFontLoader::LoadFromAsset(const OHOS::Ace::RefPtr<OHOS::Ace::Pipelin
             // Load font.
             FlutterFontCollection::GetInstance().LoadFontFromList(
                     assetData->GetData(), assetData->GetSize(), fontLoader->familyName_);
-            fontLoader->isLoaded_ = true;
-
-            for (const auto& [node, callback] : fontLoader->callbacks_) {
-                if (callback) {
-                    callback();
-                }
-            }
-            fontLoader->callbacks_.clear();
-            if (fontLoader->variationChanged_) {
-                fontLoader->variationChanged_();
-            }
+            fontLoader->NotifyLoaded();
         }, TaskExecutor::TaskType::UI);
     }, TaskExecutor::TaskType::BACKGROUND);
 }
@@ -41,6 +41,27 @@ std::shared_ptr<txt::FontCollection> RosenFontCollection::GetFontCollection()
 }
 
 void RosenFontCollection::LoadFontFromList(const uint8_t* fontData, size_t length, std::string familyName)
+{
+    if (std::find(families_.begin(), families_.end(), familyName) != families_.end()) {
+        return;
+    }
+    if (!fontCollection_) {
+        families_.emplace_back(familyName);
+        return;
+    }
+    RegisterTypeface(MakeTypeface(fontData, length), familyName);
+}
+
+sk_sp<SkTypeface> RosenFontCollection::MakeTypeface(const uint8_t* fontData, size_t length)
+{
+    if (!fontData || length == 0) {
+        return nullptr;
+    }
+    std::unique_ptr<SkStreamAsset> fontStream = std::make_unique<SkMemoryStream>(fontData, length, true);
+    return SkTypeface::MakeFromStream(std::move(fontStream));
+}
+
+void RosenFontCollection::RegisterTypeface(const sk_sp<SkTypeface>& typeface, const std::string& familyName)
 {
     auto it = std::find(families_.begin(), families_.end(), familyName);
     if (it != families_.end()) {
@@ -49,9 +70,7 @@ void RosenFontCollection::LoadFontFromList(const uint8_t* fontData, size_t lengt
 
     families_.emplace_back(familyName);
 
-    if (fontCollection_) {
-        std::unique_ptr<SkStreamAsset> font_stream = std::make_unique<SkMemoryStream>(fontData, length, true);
-        sk_sp<SkTypeface> typeface = SkTypeface::MakeFromStream(std::move(font_stream));
+    if (fontCollection_ && typeface) {
         txt::TypefaceFontAssetProvider& font_provider = dynamicFontManager_->font_provider();
         if (familyName.empty()) {
             font_provider.RegisterTypeface(typeface);
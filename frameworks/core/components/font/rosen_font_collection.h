@@ -19,6 +19,7 @@
 #include <future>
 
 #include "flutter/common/task_runners.h"
+#include "include/core/SkTypeface.h"
 #include "txt/font_collection.h"
 
 #include "core/components/font/font_collection.h"
@@ -33,6 +34,11 @@ public:
 
     void LoadFontFromList(const uint8_t* fontData, size_t length, std::string familyName);
 
+    // Parses the font data, called on any thread. Returns null if the data is not a valid font.
+    static sk_sp<SkTypeface> MakeTypeface(const uint8_t* fontData, size_t length);
+    // Registers the parsed font as [familyName], called on UI thread.
+    void RegisterTypeface(const sk_sp<SkTypeface>& typeface, const std::string& familyName);
+
     void VaryFontCollectionWithFontWeightScale(float fontWeightScale);
 
     void LoadSystemFont();
@@ -15,7 +15,6 @@
 
 #include "core/components/font/rosen_font_loader.h"
 
-#include "base/network/download_manager.h"
 #include "core/components/font/rosen_font_collection.h"
 #include "core/pipeline/base/rosen_render_context.h"
 
@@ -49,31 +48,24 @@ void RosenFontLoader::LoadFromNetwork(const OHOS::Ace::RefPtr<OHOS::Ace::Pipelin
             if (!fontLoader || !context) {
                 return;
             }
+            // Parse the font off UI thread, only registering it is left to UI thread.
             std::vector<uint8_t> fontData;
-            if (!DownloadManager::GetInstance().Download(fontLoader->familySrc_, fontData) || fontData.empty()) {
+            sk_sp<SkTypeface> typeface;
+            auto isValid = [&typeface](const std::vector<uint8_t>& data) {
+                typeface = RosenFontCollection::MakeTypeface(data.data(), data.size());
+                return typeface != nullptr;
+            };
+            if (!LoadNetworkFontData(fontLoader->familySrc_, fontData, isValid)) {
+                LOGE("Load font of family %{public}s failed", fontLoader->familyName_.c_str());
                 return;
             }
             context->GetTaskExecutor()->PostTask(
-                [fontData, weak] {
+                [typeface, weak] {
                     auto fontLoader = weak.Upgrade();
                     if (!fontLoader) {
                         return;
                     }
-                    // Load font.
-                    RosenFontCollection::GetInstance().LoadFontFromList(
-                        fontData.data(), fontData.size(), fontLoader->familyName_);
-                    fontLoader->isLoaded_ = true;
-
-                    // When font is already loaded, notify all which used this font.
-                    for (const auto& [node, callback] : fontLoader->callbacks_) {
-                        if (callback) {
-                            callback();
-                        }
-                    }
-                    fontLoader->callbacks_.clear();
-                    if (fontLoader->variationChanged_) {
-                        fontLoader->variationChanged_();
-                    }
+                    fontLoader->RegisterTypeface(typeface);
                 },
                 TaskExecutor::TaskType::UI);
         },
@@ -106,31 +98,30 @@ void RosenFontLoader::LoadFromAsset(const OHOS::Ace::RefPtr<OHOS::Ace::PipelineB
                 LOGE("No asset data!");
                 return;
             }
+            auto typeface = RosenFontCollection::MakeTypeface(assetData->GetData(), assetData->GetSize());
+            if (!typeface) {
+                LOGE("Invalid font data of family %{public}s", fontLoader->familyName_.c_str());
+                return;
+            }
 
             context->GetTaskExecutor()->PostTask(
-                [assetData, weak] {
+                [typeface, weak] {
                     auto fontLoader = weak.Upgrade();
                     if (!fontLoader) {
                         return;
                     }
-                    // Load font.
-                    RosenFontCollection::GetInstance().LoadFontFromList(
-                        assetData->GetData(), assetData->GetSize(), fontLoader->familyName_);
-                    fontLoader->isLoaded_ = true;
-
-                    for (const auto& [node, callback] : fontLoader->callbacks_) {
-                        if (callback) {
-                            callback();
-                        }
-                    }
-                    fontLoader->callbacks_.clear();
-                    if (fontLoader->variationChanged_) {
-                        fontLoader->variationChanged_();
-                    }
+                    fontLoader->RegisterTypeface(typeface);
                 },
                 TaskExecutor::TaskType::UI);
         },
         TaskExecutor::TaskType::BACKGROUND);
 }
 
+void RosenFontLoader::RegisterTypeface(const sk_sp<SkTypeface>& typeface)
+{
+    RosenFontCollection::GetInstance().RegisterTypeface(typeface, familyName_);
+    // When font is already loaded, notify all which used this font.
+    NotifyLoaded();
+}
+
 } // namespace OHOS::Ace
@@ -16,6 +16,8 @@
 #ifndef FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_FONT_ROSEN_FONT_LOADER_H
 #define FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_FONT_ROSEN_FONT_LOADER_H
 
+#include "include/core/SkTypeface.h"
+
 #include "core/common/font_loader.h"
 
 namespace OHOS::Ace {
@@ -34,6 +36,7 @@ public:
 private:
     void LoadFromNetwork(const RefPtr<PipelineBase>& context);
     void LoadFromAsset(const RefPtr<PipelineBase>& context);
+    void RegisterTypeface(const sk_sp<SkTypeface>& typeface);
 };
 
 } // namespace OHOS::Ace
@@ -649,4 +649,48 @@ HWTEST_F(ThemeConstantsTest, ThemeResourceReadByName002, TestSize.Level1)
     EXPECT_EQ(mediaPath, "");
 }
 
+/**
+ * @tc.name: ThemeResourceCache001
+ * @tc.desc: Resolved resources are cached and the cache is invalidated on configuration update.
+ * @tc.type: FUNC
+ */
+HWTEST_F(ThemeConstantsTest, ThemeResourceCache001, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. Construct theme constants with mock adapter, read resources twice.
+     * @tc.expected: step1. The second read hits the cache and returns the same value.
+     */
+    auto resAdapter = AceType::MakeRefPtr<ResourceAdapterMock>();
+    auto themeConstants = AceType::MakeRefPtr<ThemeConstants>(resAdapter);
+    auto color = themeConstants->GetColorByName(SYS_RES_NAME_COLOR);
+    auto cachedColor = themeConstants->GetColorByName(SYS_RES_NAME_COLOR);
+    EXPECT_EQ(color.GetValue(), cachedColor.GetValue());
+    auto dimension = themeConstants->GetDimension(SYS_RES_ID_DIMENSION);
+    auto cachedDimension = themeConstants->GetDimension(SYS_RES_ID_DIMENSION);
+    EXPECT_TRUE(NearEqual(dimension.Value(), cachedDimension.Value()));
+    auto stats = themeConstants->GetResourceCacheStats();
+    EXPECT_EQ(stats.hitCount, 2);
+    EXPECT_EQ(stats.missCount, 2);
+    EXPECT_EQ(stats.size, 2);
+
+    /**
+     * @tc.steps: step2. Read the same name with another type.
+     * @tc.expected: step2. Types are cached separately.
+     */
+    themeConstants->GetStringByName(SYS_RES_NAME_COLOR);
+    EXPECT_EQ(themeConstants->GetResourceCacheStats().missCount, 3);
+
+    /**
+     * @tc.steps: step3. Update configuration and read again.
+     * @tc.expected: step3. The cache is cleared, value is resolved from adapter again.
+     */
+    themeConstants->UpdateConfig(ResourceConfiguration());
+    EXPECT_EQ(themeConstants->GetResourceCacheStats().size, 0);
+    color = themeConstants->GetColorByName(SYS_RES_NAME_COLOR);
+    EXPECT_EQ(color.GetValue(), SYS_VALUE_COLOR.GetValue());
+    stats = themeConstants->GetResourceCacheStats();
+    EXPECT_EQ(stats.missCount, 4);
+    EXPECT_TRUE(NearEqual(stats.GetHitRate(), 2.0 / 6.0));
+}
+
 } // namespace OHOS::Ace
@@ -65,7 +65,9 @@ public:
     void BuildEmptyTrees();
     void BuildSingleChildTrees(const string& child, const string& textData = "");
     void BuildMultipleChildrenTrees(const vector<string>& children, const vector<string>& textData = vector<string>());
+    void BuildKeyedChildrenTrees(const vector<string>& keys);
     void UpdateAndValidate();
+    list<RefPtr<Element>> GetRowChildren() const;
 
     static void DumpElementTree(const RefPtr<Element>& element, int32_t depth, vector<NodeInfo>& treeInfo);
     static void DumpRenderTree(const RefPtr<RenderNode>& renderNode, int32_t depth, vector<NodeInfo>& treeInfo);
@@ -249,6 +251,38 @@ void ViewUpdateTest::BuildMultipleChildrenTrees(const vector<string>& children,
     newComposedComponent_ = AceType::MakeRefPtr<ComposedComponent>(ROOT_COMPOSE_ID, ROOT_COMPOSE_NAME, rowComponent);
 }
 
+void ViewUpdateTest::BuildKeyedChildrenTrees(const vector<string>& keys)
+{
+    newElementTree_.clear();
+    newElementTree_.emplace_back("RootElement", 0, 1);
+    newElementTree_.emplace_back("ComposedElement", 1, 1);
+    newElementTree_.emplace_back("RowElement", 2, keys.size());
+
+    newRenderTree_.clear();
+    newRenderTree_.emplace_back("FlutterRenderRoot", 0, 1);
+    newRenderTree_.emplace_back("RenderFlex", 1, keys.size());
+
+    std::list<RefPtr<Component>> rowChildren;
+    for (const auto& key : keys) {
+        auto textComponent = AceType::MakeRefPtr<TextComponent>(key);
+        rowChildren.emplace_back(AceType::MakeRefPtr<ComposedComponent>(key, key, textComponent));
+        newElementTree_.emplace_back("ComposedElement", 3, 1);
+        newElementTree_.emplace_back("TextElement", 4, 0);
+        newRenderTree_.emplace_back("FlutterRenderText", 2, 0, key);
+    }
+    RefPtr<RowComponent> rowComponent =
+        AceType::MakeRefPtr<RowComponent>(FlexAlign::CENTER, FlexAlign::CENTER, rowChildren);
+    newComposedComponent_ = AceType::MakeRefPtr<ComposedComponent>(ROOT_COMPOSE_ID, ROOT_COMPOSE_NAME, rowComponent);
+}
+
+list<RefPtr<Element>> ViewUpdateTest::GetRowChildren() const
+{
+    if (composedElement_->GetChildren().empty()) {
+        return {};
+    }
+    return composedElement_->GetChildren().front()->GetChildren();
+}
+
 void ViewUpdateTest::UpdateAndValidate()
 {
     vector<NodeInfo> elementTreeInfo;
@@ -748,4 +782,50 @@ HWTEST_F(ViewUpdateTest, ViewUpdateTest013, TestSize.Level1)
     UpdateAndValidate();
 }
 
+/**
+ * @tc.name: ViewUpdateTest014
+ * @tc.desc: View Updates caused by inserting and reordering keyed components.
+ * @tc.type: FUNC
+ */
+HWTEST_F(ViewUpdateTest, ViewUpdateTest014, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "ViewUpdateTest014";
+
+    /**
+     * @tc.steps: step1. Build a Row Component with three keyed children "a" | "b" | "c", update and check results.
+     * @tc.expected: step1. Element tree and render tree are the same as expected.
+     */
+    BuildKeyedChildrenTrees({ "a", "b", "c" });
+    UpdateAndValidate();
+    auto oldChildren = GetRowChildren();
+    ASSERT_EQ(oldChildren.size(), 3);
+    vector<RefPtr<Element>> elements(oldChildren.begin(), oldChildren.end());
+
+    /**
+     * @tc.steps: step2. Insert a keyed child at the front: "d" | "a" | "b" | "c", update and check results.
+     * @tc.expected: step2. Trees are the same as expected, and elements of "a", "b", "c" are reused.
+     */
+    BuildKeyedChildrenTrees({ "d", "a", "b", "c" });
+    UpdateAndValidate();
+    auto children = GetRowChildren();
+    ASSERT_EQ(children.size(), 4);
+    auto iter = std::next(children.begin());
+    for (const auto& element : elements) {
+        EXPECT_EQ(*(iter++), element);
+    }
+
+    /**
+     * @tc.steps: step3. Remove "d" and reverse the others: "c" | "b" | "a", update and check results.
+     * @tc.expected: step3. Trees are the same as expected, and elements of "a", "b", "c" are reused.
+     */
+    BuildKeyedChildrenTrees({ "c", "b", "a" });
+    UpdateAndValidate();
+    children = GetRowChildren();
+    ASSERT_EQ(children.size(), 3);
+    auto reverseIter = elements.rbegin();
+    for (const auto& element : children) {
+        EXPECT_EQ(element, *(reverseIter++));
+    }
+}
+
 } // namespace OHOS::Ace
@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_THEME_RESOLVED_RESOURCE_CACHE_H
+#define FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_THEME_RESOLVED_RESOURCE_CACHE_H
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <variant>
+
+#include "base/geometry/dimension.h"
+#include "core/components/common/properties/color.h"
+
+namespace OHOS::Ace {
+
+enum class ResolvedResourceType : uint8_t {
+    COLOR = 0,
+    DIMENSION,
+    STRING,
+    INT,
+    DOUBLE,
+    TYPE_COUNT,
+};
+
+using ResolvedResourceValue = std::variant<Color, Dimension, std::string, int32_t, double>;
+
+struct ResolvedResourceCacheStats {
+    uint64_t hitCount = 0;
+    uint64_t missCount = 0;
+    size_t size = 0;
+
+    double GetHitRate() const
+    {
+        auto total = hitCount + missCount;
+        return total == 0 ? 0.0 : static_cast<double>(hitCount) / static_cast<double>(total);
+    }
+};
+
+// Values resolved from ResourceAdapter for one resource configuration, keyed by (resId or name, type).
+// It must be cleared whenever the configuration of the adapter changes.
+class ResolvedResourceCache final {
+public:
+    ResolvedResourceCache() = default;
+    ~ResolvedResourceCache() = default;
+
+    template<class T>
+    bool Get(uint32_t resId, ResolvedResourceType type, T& value)
+    {
+        auto iter = idValues_.find(MakeKey(resId, type));
+        if (iter == idValues_.end()) {
+            ++missCount_;
+            return false;
+        }
+        return GetValue(iter->second, value);
+    }
+
+    template<class T>
+    bool Get(const std::string& resName, ResolvedResourceType type, T& value)
+    {
+        auto& values = nameValues_[static_cast<size_t>(type)];
+        auto iter = values.find(resName);
+        if (iter == values.end()) {
+            ++missCount_;
+            return false;
+        }
+        return GetValue(iter->second, value);
+    }
+
+    void Put(uint32_t resId, ResolvedResourceType type, ResolvedResourceValue&& value)
+    {
+        if (size_ >= MAX_SIZE) {
+            Clear();
+        }
+        if (idValues_.insert_or_assign(MakeKey(resId, type), std::move(value)).second) {
+            ++size_;
+        }
+    }
+
+    void Put(const std::string& resName, ResolvedResourceType type, ResolvedResourceValue&& value)
+    {
+        if (size_ >= MAX_SIZE) {
+            Clear();
+        }
+        if (nameValues_[static_cast<size_t>(type)].insert_or_assign(resName, std::move(value)).second) {
+            ++size_;
+        }
+    }
+
+    void Clear()
+    {
+        idValues_.clear();
+        for (auto& values : nameValues_) {
+            values.clear();
+        }
+        size_ = 0;
+    }
+
+    void AppendStats(ResolvedResourceCacheStats& stats) const
+    {
+        stats.hitCount += hitCount_;
+        stats.missCount += missCount_;
+        stats.size += size_;
+    }
+
+private:
+    static constexpr size_t MAX_SIZE = 4096;
+    static constexpr uint32_t TYPE_SHIFT = 32;
+
+    static uint64_t MakeKey(uint32_t resId, ResolvedResourceType type)
+    {
+        return (static_cast<uint64_t>(type) << TYPE_SHIFT) | resId;
+    }
+
+    template<class T>
+    bool GetValue(const ResolvedResourceValue& cached, T& value)
+    {
+        auto result = std::get_if<T>(&cached);
+        if (!result) {
+            ++missCount_;
+            return false;
+        }
+        ++hitCount_;
+        value = *result;
+        return true;
+    }
+
+    std::unordered_map<uint64_t, ResolvedResourceValue> idValues_;
+    std::array<std::unordered_map<std::string, ResolvedResourceValue>,
+        static_cast<size_t>(ResolvedResourceType::TYPE_COUNT)> nameValues_;
+    size_t size_ = 0;
+    uint64_t hitCount_ = 0;
+    uint64_t missCount_ = 0;
+};
+
+} // namespace OHOS::Ace
+
+#endif // FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_THEME_RESOLVED_RESOURCE_CACHE_H
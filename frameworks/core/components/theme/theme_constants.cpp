@@ -93,13 +93,31 @@ const ResValueWrapper* ThemeConstants::GetPlatformConstants(uint32_t key)
     return nullptr;
 }
 
+template<class T, class Key, class Resolver>
+T ThemeConstants::GetCachedResource(const Key& key, ResolvedResourceType type, const Resolver& resolver) const
+{
+    {
+        std::lock_guard<std::mutex> lock(resourceCacheMutex_);
+        T value;
+        if (resourceCaches_[resourceScope_].Get(key, type, value)) {
+            return value;
+        }
+    }
+    // resolve out of the lock, resource manager may be slow.
+    T value = resolver(key);
+    std::lock_guard<std::mutex> lock(resourceCacheMutex_);
+    resourceCaches_[resourceScope_].Put(key, type, ResolvedResourceValue(value));
+    return value;
+}
+
 Color ThemeConstants::GetColor(uint32_t key) const
 {
     if (IsGlobalResource(key)) {
         if (!resAdapter_) {
             return ERROR_VALUE_COLOR;
         }
-        return resAdapter_->GetColor(key);
+        return GetCachedResource<Color>(
+            key, ResolvedResourceType::COLOR, [this](uint32_t resId) { return resAdapter_->GetColor(resId); });
     }
     const auto& valueWrapper = GetValue(key);
     if (!ValueTypeMatch(valueWrapper, key, ThemeConstantsType::COLOR)) {
@@ -117,7 +135,8 @@ Color ThemeConstants::GetColorByName(const std::string& resName) const
     if (!resAdapter_) {
         return ERROR_VALUE_COLOR;
     }
-    return resAdapter_->GetColorByName(resName);
+    return GetCachedResource<Color>(resName, ResolvedResourceType::COLOR,
+        [this](const std::string& name) { return resAdapter_->GetColorByName(name); });
 }
 
 Dimension ThemeConstants::GetDimension(uint32_t key) const
@@ -126,11 +145,13 @@ Dimension ThemeConstants::GetDimension(uint32_t key) const
         if (!resAdapter_) {
             return ERROR_VALUE_DIMENSION;
         }
-        auto result = resAdapter_->GetDimension(key);
-        if (NearZero(result.Value())) {
-            result = StringUtils::StringToDimension(resAdapter_->GetString(key));
-        }
-        return result;
+        return GetCachedResource<Dimension>(key, ResolvedResourceType::DIMENSION, [this](uint32_t resId) {
+            auto result = resAdapter_->GetDimension(resId);
+            if (NearZero(result.Value())) {
+                result = StringUtils::StringToDimension(resAdapter_->GetString(resId));
+            }
+            return result;
+        });
     }
     const auto& valueWrapper = GetValue(key);
     if (!ValueTypeMatch(valueWrapper, key, ThemeConstantsType::DIMENSION)) {
@@ -148,11 +169,13 @@ Dimension ThemeConstants::GetDimensionByName(const std::string& resName) const
     if (!resAdapter_) {
         return ERROR_VALUE_DIMENSION;
     }
-    auto result = resAdapter_->GetDimensionByName(resName);
-    if (NearZero(result.Value())) {
-        result = StringUtils::StringToDimension(resAdapter_->GetStringByName(resName));
-    }
-    return result;
+    return GetCachedResource<Dimension>(resName, ResolvedResourceType::DIMENSION, [this](const std::string& name) {
+        auto result = resAdapter_->GetDimensionByName(name);
+        if (NearZero(result.Value())) {
+            result = StringUtils::StringToDimension(resAdapter_->GetStringByName(name));
+        }
+        return result;
+    });
 }
 
 int32_t ThemeConstants::GetInt(uint32_t key) const
@@ -161,7 +184,8 @@ int32_t ThemeConstants::GetInt(uint32_t key) const
         if (!resAdapter_) {
             return ERROR_VALUE_INT;
         }
-        return resAdapter_->GetInt(key);
+        return GetCachedResource<int32_t>(
+            key, ResolvedResourceType::INT, [this](uint32_t resId) { return resAdapter_->GetInt(resId); });
     }
     const auto& valueWrapper = GetValue(key);
     if (!ValueTypeMatch(valueWrapper, key, ThemeConstantsType::INT)) {
@@ -179,7 +203,8 @@ int32_t ThemeConstants::GetIntByName(const std::string& resName) const
     if (!resAdapter_) {
         return ERROR_VALUE_INT;
     }
-    return resAdapter_->GetIntByName(resName);
+    return GetCachedResource<int32_t>(resName, ResolvedResourceType::INT,
+        [this](const std::string& name) { return resAdapter_->GetIntByName(name); });
 }
 
 double ThemeConstants::GetDouble(uint32_t key) const
@@ -188,7 +213,8 @@ double ThemeConstants::GetDouble(uint32_t key) const
         if (!resAdapter_) {
             return ERROR_VALUE_DOUBLE;
         }
-        return resAdapter_->GetDouble(key);
+        return GetCachedResource<double>(
+            key, ResolvedResourceType::DOUBLE, [this](uint32_t resId) { return resAdapter_->GetDouble(resId); });
     }
     const auto& valueWrapper = GetValue(key);
     if (!ValueTypeMatch(valueWrapper, key, ThemeConstantsType::DOUBLE)) {
@@ -206,7 +232,8 @@ double ThemeConstants::GetDoubleByName(const std::string& resName) const
     if (!resAdapter_) {
         return ERROR_VALUE_DOUBLE;
     }
-    return resAdapter_->GetDoubleByName(resName);
+    return GetCachedResource<double>(resName, ResolvedResourceType::DOUBLE,
+        [this](const std::string& name) { return resAdapter_->GetDoubleByName(name); });
 }
 
 std::string ThemeConstants::GetString(uint32_t key) const
@@ -215,7 +242,8 @@ std::string ThemeConstants::GetString(uint32_t key) const
         if (!resAdapter_) {
             return "";
         }
-        return resAdapter_->GetString(key);
+        return GetCachedResource<std::string>(
+            key, ResolvedResourceType::STRING, [this](uint32_t resId) { return resAdapter_->GetString(resId); });
     }
     const auto& valueWrapper = GetValue(key);
     if (!ValueTypeMatch(valueWrapper, key, ThemeConstantsType::STRING)) {
@@ -233,7 +261,8 @@ std::string ThemeConstants::GetStringByName(const std::string& resName) const
     if (!resAdapter_) {
         return "";
     }
-    return resAdapter_->GetStringByName(resName);
+    return GetCachedResource<std::string>(resName, ResolvedResourceType::STRING,
+        [this](const std::string& name) { return resAdapter_->GetStringByName(name); });
 }
 
 std::string ThemeConstants::GetPluralString(uint32_t key, int count) const
@@ -432,6 +461,35 @@ double ThemeConstants::GetBlendAlpha(const BlendAlpha& blendAlpha) const
     return BLEND_ALPHA_MAX;
 }
 
+void ThemeConstants::UpdateResourceScope(const std::string& bundleName, const std::string& moduleName)
+{
+    std::lock_guard<std::mutex> lock(resourceCacheMutex_);
+    if (resourceScope_.size() == bundleName.size() + moduleName.size() + 1 &&
+        resourceScope_.compare(0, bundleName.size(), bundleName) == 0 &&
+        resourceScope_.compare(bundleName.size() + 1, moduleName.size(), moduleName) == 0) {
+        return;
+    }
+    resourceScope_ = bundleName + "/" + moduleName;
+}
+
+void ThemeConstants::ClearResourceCache()
+{
+    std::lock_guard<std::mutex> lock(resourceCacheMutex_);
+    for (auto& [scope, cache] : resourceCaches_) {
+        cache.Clear();
+    }
+}
+
+ResolvedResourceCacheStats ThemeConstants::GetResourceCacheStats() const
+{
+    ResolvedResourceCacheStats stats;
+    std::lock_guard<std::mutex> lock(resourceCacheMutex_);
+    for (const auto& [scope, cache] : resourceCaches_) {
+        cache.AppendStats(stats);
+    }
+    return stats;
+}
+
 void ThemeConstants::LoadTheme(int32_t themeId)
 {
     if (!resAdapter_) {
@@ -16,6 +16,7 @@
 #ifndef FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_THEME_THEME_CONSTANTS_H
 #define FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_THEME_THEME_CONSTANTS_H
 
+#include <mutex>
 #include <unordered_map>
 
 #include "base/geometry/dimension.h"
@@ -27,6 +28,7 @@
 #include "core/components/common/properties/edge.h"
 #include "core/components/common/properties/radius.h"
 #include "core/components/common/properties/text_style.h"
+#include "core/components/theme/resolved_resource_cache.h"
 #include "core/components/theme/resource_adapter.h"
 #include "core/components/theme/theme_attributes.h"
 #include "core/components/theme/theme_style.h"
@@ -50,6 +52,7 @@ public:
         if (resAdapter_) {
             resAdapter_->Init(resourceInfo);
         }
+        ClearResourceCache();
     }
 
     void UpdateConfig(const ResourceConfiguration& config)
@@ -57,6 +60,7 @@ public:
         if (resAdapter_) {
             resAdapter_->UpdateConfig(config);
         }
+        ClearResourceCache();
     }
 
     void ParseTheme();
@@ -303,6 +307,7 @@ public:
         if (resAdapter_) {
             resAdapter_->UpdateResourceManager(bundleName, moduleName);
         }
+        UpdateResourceScope(bundleName, moduleName);
     }
 
     void ReloadResource()
@@ -310,8 +315,14 @@ public:
         if (resAdapter_) {
             resAdapter_->Reload();
         }
+        ClearResourceCache();
     }
 
+    /*
+     * Get hit and miss counts of the resolved resource cache in front of the resource adapter.
+     */
+    ResolvedResourceCacheStats GetResourceCacheStats() const;
+
 private:
     static const ResValueWrapper* GetPlatformConstants(uint32_t key);
     static const ResValueWrapper* styleMapDefault[];
@@ -329,10 +340,21 @@ private:
     void ParseCustomStyle(const std::string& content);
     void LoadFile(const RefPtr<Asset>& asset);
 
+    // Resolve global resource from adapter through the cache of current bundle and module.
+    template<class T, class Key, class Resolver>
+    T GetCachedResource(const Key& key, ResolvedResourceType type, const Resolver& resolver) const;
+    void UpdateResourceScope(const std::string& bundleName, const std::string& moduleName);
+    void ClearResourceCache();
+
     RefPtr<ResourceAdapter> resAdapter_;
     RefPtr<ThemeStyle> currentThemeStyle_;
     ThemeConstantsMap customStyleMap_;
 
+    // Resolved resources of each bundle and module, cleared when resource configuration changes.
+    mutable std::mutex resourceCacheMutex_;
+    mutable std::unordered_map<std::string, ResolvedResourceCache> resourceCaches_;
+    std::string resourceScope_;
+
     ACE_DISALLOW_COPY_AND_MOVE(ThemeConstants);
 };
 
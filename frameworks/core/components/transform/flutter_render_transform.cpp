@@ -86,15 +86,7 @@ Point FlutterRenderTransform::GetTransformPoint(const Point& point)
 Rect FlutterRenderTransform::GetTransformRect(const Rect& rect)
 {
     Matrix4 transform = GetEffectiveTransform(GetTransitionPaintRect().GetOffset());
-    Point ltPoint = transform * Point(rect.Left(), rect.Top());
-    Point rtPoint = transform * Point(rect.Right(), rect.Top());
-    Point lbPoint = transform * Point(rect.Left(), rect.Bottom());
-    Point rbPoint = transform * Point(rect.Right(), rect.Bottom());
-    auto left = std::min(std::min(ltPoint.GetX(), rtPoint.GetX()), std::min(lbPoint.GetX(), rbPoint.GetX()));
-    auto right = std::max(std::max(ltPoint.GetX(), rtPoint.GetX()), std::max(lbPoint.GetX(), rbPoint.GetX()));
-    auto top = std::min(std::min(ltPoint.GetY(), rtPoint.GetY()), std::min(lbPoint.GetY(), rbPoint.GetY()));
-    auto bottom = std::max(std::max(ltPoint.GetY(), rtPoint.GetY()), std::max(lbPoint.GetY(), rbPoint.GetY()));
-    return Rect(left, top, right - left, bottom - top).CombineRect(rect);
+    return transform.MapRect(rect).CombineRect(rect);
 }
 
 Matrix4 FlutterRenderTransform::GetEffectiveTransform(const Offset& offset)
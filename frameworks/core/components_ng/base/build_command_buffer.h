@@ -0,0 +1,199 @@
+/*
+ * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_BASE_BUILD_COMMAND_BUFFER_H
+#define FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_BASE_BUILD_COMMAND_BUFFER_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "base/memory/referenced.h"
+#include "core/components_ng/base/ui_node.h"
+
+namespace OHOS::Ace::NG {
+
+enum class BuildCommandType : uint8_t {
+    // create a component by its code, which pushes its node like the Create function of the models.
+    CREATE = 0,
+    // push a node created beforehand.
+    PUSH,
+    // set an attribute of the top node by its code, like the Set functions of the models.
+    SET_ATTRIBUTE,
+    POP,
+    POP_CONTAINER,
+};
+
+class BuildCommandBuffer;
+
+// Arguments of a CREATE or SET_ATTRIBUTE command, numbers or strings.
+class BuildCommandArgs final {
+public:
+    BuildCommandArgs(const BuildCommandBuffer& buffer, uint32_t start, uint32_t count)
+        : buffer_(buffer), start_(start), count_(count)
+    {}
+    ~BuildCommandArgs() = default;
+
+    uint32_t GetCount() const
+    {
+        return count_;
+    }
+
+    inline bool IsString(uint32_t index) const;
+    inline double GetNumber(uint32_t index, double defaultValue = 0.0) const;
+    // empty for a number or a missing argument.
+    inline const std::string& GetString(uint32_t index) const;
+
+private:
+    const BuildCommandBuffer& buffer_;
+    uint32_t start_ = 0;
+    uint32_t count_ = 0;
+};
+
+using BuildCommandHandler = void (*)(const BuildCommandArgs& args);
+
+// Handlers of the component codes of CREATE commands and the attribute codes of SET_ATTRIBUTE commands, indexed by
+// the codes. The frontend defines the codes and its handlers call the models like its bindings do.
+struct BuildCommandHandlers {
+    std::vector<BuildCommandHandler> creators;
+    std::vector<BuildCommandHandler> setters;
+};
+
+// The build of a subtree recorded by the frontend as plain codes and arguments, executed by
+// ViewStackProcessor::ExecuteBuildCommands in one pass. Arguments are added to the last command.
+class BuildCommandBuffer final {
+public:
+    BuildCommandBuffer() = default;
+    ~BuildCommandBuffer() = default;
+
+    void Create(uint16_t component)
+    {
+        AddCommand(BuildCommandType::CREATE, component, static_cast<uint32_t>(args_.size()));
+    }
+
+    void Push(const RefPtr<UINode>& node)
+    {
+        AddCommand(BuildCommandType::PUSH, 0, static_cast<uint32_t>(nodes_.size()));
+        nodes_.emplace_back(node);
+    }
+
+    void SetAttribute(uint16_t attribute)
+    {
+        AddCommand(BuildCommandType::SET_ATTRIBUTE, attribute, static_cast<uint32_t>(args_.size()));
+    }
+
+    void Pop()
+    {
+        AddCommand(BuildCommandType::POP, 0, 0);
+    }
+
+    void PopContainer()
+    {
+        AddCommand(BuildCommandType::POP_CONTAINER, 0, 0);
+    }
+
+    void AddNumber(double number)
+    {
+        AddArg({ number, -1 });
+    }
+
+    void AddString(std::string&& string)
+    {
+        AddArg({ 0.0, static_cast<int32_t>(strings_.size()) });
+        strings_.emplace_back(std::move(string));
+    }
+
+    void Reserve(size_t commandCount, size_t argCount)
+    {
+        commands_.reserve(commandCount);
+        args_.reserve(argCount);
+    }
+
+    void Clear()
+    {
+        commands_.clear();
+        args_.clear();
+        strings_.clear();
+        nodes_.clear();
+    }
+
+    size_t GetSize() const
+    {
+        return commands_.size();
+    }
+
+    bool IsEmpty() const
+    {
+        return commands_.empty();
+    }
+
+private:
+    friend class BuildCommandArgs;
+    friend class ViewStackProcessor;
+
+    struct Command {
+        BuildCommandType type = BuildCommandType::POP;
+        // component or attribute code.
+        uint16_t code = 0;
+        // start of the arguments in args_, or index into nodes_ for PUSH.
+        uint32_t index = 0;
+        uint32_t argCount = 0;
+    };
+
+    struct Arg {
+        double number = 0.0;
+        // index into strings_ for a string.
+        int32_t stringIndex = -1;
+    };
+
+    void AddCommand(BuildCommandType type, uint16_t code, uint32_t index)
+    {
+        commands_.push_back({ type, code, index, 0 });
+    }
+
+    void AddArg(const Arg& arg)
+    {
+        if (commands_.empty()) {
+            return;
+        }
+        args_.emplace_back(arg);
+        ++commands_.back().argCount;
+    }
+
+    std::vector<Command> commands_;
+    std::vector<Arg> args_;
+    std::vector<std::string> strings_;
+    std::vector<RefPtr<UINode>> nodes_;
+};
+
+bool BuildCommandArgs::IsString(uint32_t index) const
+{
+    return index < count_ && buffer_.args_[start_ + index].stringIndex >= 0;
+}
+
+double BuildCommandArgs::GetNumber(uint32_t index, double defaultValue) const
+{
+    return index < count_ && !IsString(index) ? buffer_.args_[start_ + index].number : defaultValue;
+}
+
+const std::string& BuildCommandArgs::GetString(uint32_t index) const
+{
+    static const std::string emptyString;
+    return IsString(index) ? buffer_.strings_[buffer_.args_[start_ + index].stringIndex] : emptyString;
+}
+
+} // namespace OHOS::Ace::NG
+
+#endif // FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_BASE_BUILD_COMMAND_BUFFER_H
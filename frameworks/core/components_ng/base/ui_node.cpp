@@ -71,6 +71,19 @@ void UINode::AddChild(const RefPtr<UINode>& child, int32_t slot, bool silently)
     DoAddChild(it, child, silently);
 }
 
+void UINode::AppendNewChild(const RefPtr<UINode>& child, bool silently)
+{
+    CHECK_NULL_VOID(child);
+    if (child->GetParent()) {
+        AddChild(child, DEFAULT_NODE_SLOT, silently);
+        return;
+    }
+    // remove from disappearing children
+    RemoveDisappearingChild(child);
+    auto it = children_.end();
+    DoAddChild(it, child, silently);
+}
+
 std::list<RefPtr<UINode>>::iterator UINode::RemoveChild(const RefPtr<UINode>& child)
 {
     CHECK_NULL_RETURN(child, children_.end());
@@ -54,6 +54,8 @@ public:
 
     // Tree operation start.
     void AddChild(const RefPtr<UINode>& child, int32_t slot = DEFAULT_NODE_SLOT, bool silently = false);
+    // Append a child which has no parent. Such a child is in no children list, so the search of AddChild is skipped.
+    void AppendNewChild(const RefPtr<UINode>& child, bool silently = false);
     std::list<RefPtr<UINode>>::iterator RemoveChild(const RefPtr<UINode>& child);
     int32_t RemoveChildAndReturnIndex(const RefPtr<UINode>& child);
     void ReplaceChild(const RefPtr<UINode>& oldNode, const RefPtr<UINode>& newNode);
@@ -110,6 +110,11 @@ void ViewStackProcessor::Pop()
         return;
     }
 
+    if (IsBatchBuilding()) {
+        MountToParentInBatch(currentNode, parent);
+        return;
+    }
+
     currentNode->MountToParent(parent, DEFAULT_NODE_SLOT, AceType::InstanceOf<ForEachNode>(parent));
     auto currentFrameNode = AceType::DynamicCast<FrameNode>(currentNode);
     if (currentFrameNode) {
@@ -118,6 +123,90 @@ void ViewStackProcessor::Pop()
     LOGD("ViewStackProcessor Pop size %{public}d", static_cast<int32_t>(elementsStack_.size()));
 }
 
+void ViewStackProcessor::MountToParentInBatch(const RefPtr<UINode>& node, const RefPtr<UINode>& parent)
+{
+    CHECK_NULL_VOID(node);
+    CHECK_NULL_VOID(parent);
+    if (AceType::InstanceOf<ForEachNode>(parent)) {
+        node->MountToParent(parent, DEFAULT_NODE_SLOT, true);
+    } else {
+        parent->AppendNewChild(node);
+        if (parent->IsInDestroying()) {
+            parent->SetChildrenInDestroying();
+        }
+        if (parent->GetPageId() != 0) {
+            node->SetHostPageId(parent->GetPageId());
+        }
+    }
+    auto frameNode = AceType::DynamicCast<FrameNode>(node);
+    if (frameNode) {
+        batchTasks_.push_back({ frameNode, true });
+    }
+}
+
+bool ViewStackProcessor::ExecuteBuildCommands(
+    const BuildCommandBuffer& buffer, const BuildCommandHandlers& handlers)
+{
+    // a node which can't be created would leave the later commands on the wrong nodes, so nothing is built.
+    for (const auto& command : buffer.commands_) {
+        if (command.type == BuildCommandType::CREATE &&
+            (command.code >= handlers.creators.size() || !handlers.creators[command.code])) {
+            LOGE("no creator of build command code %{public}d", command.code);
+            return false;
+        }
+    }
+    ++batchDepth_;
+    for (const auto& command : buffer.commands_) {
+        switch (command.type) {
+            case BuildCommandType::CREATE:
+            case BuildCommandType::SET_ATTRIBUTE: {
+                const auto& table = command.type == BuildCommandType::CREATE ? handlers.creators : handlers.setters;
+                if (command.code >= table.size() || !table[command.code]) {
+                    LOGW("no setter of build command code %{public}d", command.code);
+                    break;
+                }
+                table[command.code](BuildCommandArgs(buffer, command.index, command.argCount));
+                break;
+            }
+            case BuildCommandType::PUSH:
+                Push(buffer.nodes_[command.index]);
+                break;
+            case BuildCommandType::POP:
+                Pop();
+                break;
+            case BuildCommandType::POP_CONTAINER:
+                PopContainer();
+                break;
+            default:
+                LOGW("unknown build command %{public}d", static_cast<int32_t>(command.type));
+                break;
+        }
+    }
+    --batchDepth_;
+    if (batchDepth_ == 0) {
+        FlushBatchTasks();
+    }
+    return true;
+}
+
+void ViewStackProcessor::FlushBatchTasks()
+{
+    // the callbacks may build again, so run them out of the member.
+    std::vector<BatchTask> tasks;
+    tasks.swap(batchTasks_);
+    for (const auto& task : tasks) {
+        if (task.isMountDone) {
+            task.frameNode->OnMountToParentDone();
+        } else {
+            task.frameNode->MarkModifyDone();
+        }
+    }
+    tasks.clear();
+    if (batchTasks_.empty()) {
+        batchTasks_.swap(tasks);
+    }
+}
+
 void ViewStackProcessor::PopContainer()
 {
     auto top = GetMainElementNode();
@@ -147,7 +236,11 @@ RefPtr<UINode> ViewStackProcessor::Finish()
     elementsStack_.pop();
     auto frameNode = AceType::DynamicCast<FrameNode>(element);
     if (frameNode) {
-        frameNode->MarkModifyDone();
+        if (IsBatchBuilding()) {
+            batchTasks_.push_back({ frameNode, false });
+        } else {
+            frameNode->MarkModifyDone();
+        }
         auto renderContext = frameNode->GetRenderContext();
         if (renderContext) {
             renderContext->SetNeedDebugBoundary(true);
@@ -23,6 +23,7 @@
 
 #include "base/memory/referenced.h"
 #include "core/components/common/properties/animation_option.h"
+#include "core/components_ng/base/build_command_buffer.h"
 #include "core/components_ng/base/frame_node.h"
 #include "core/components_ng/base/ui_node.h"
 #include "core/components_ng/event/state_style_manager.h"
@@ -170,6 +171,18 @@ public:
     // End of Render function, create component tree and flush modify task.
     RefPtr<UINode> Finish();
 
+    // Execute a recorded build in one pass, the codes of its commands are run by [handlers]. Nodes popped in the batch
+    // are appended to their parents without searching the siblings, and their modify done and mount done callbacks
+    // run in order once the whole batch is mounted, so the dirty marks of children stop at their already marked
+    // ancestors. Returns false and builds nothing if a component code has no creator, attribute codes without a setter
+    // are skipped.
+    bool ExecuteBuildCommands(const BuildCommandBuffer& buffer, const BuildCommandHandlers& handlers);
+
+    bool IsBatchBuilding() const
+    {
+        return batchDepth_ > 0;
+    }
+
     // Set key to be used for next node on the stack
     void PushKey(const std::string& key);
 
@@ -308,6 +321,15 @@ private:
 
     bool ShouldPopImmediately();
 
+    void MountToParentInBatch(const RefPtr<UINode>& node, const RefPtr<UINode>& parent);
+    void FlushBatchTasks();
+
+    struct BatchTask {
+        RefPtr<FrameNode> frameNode;
+        // true for OnMountToParentDone, false for MarkModifyDone.
+        bool isMountDone = false;
+    };
+
     // Singleton instance
     static thread_local std::unique_ptr<ViewStackProcessor> instance;
 
@@ -335,6 +357,10 @@ private:
 
     AnimationOption implicitAnimationOption_;
 
+    // nesting depth of ExecuteBuildCommands, and the callbacks deferred to the end of the outermost one.
+    int32_t batchDepth_ = 0;
+    std::vector<BatchTask> batchTasks_;
+
     ACE_DISALLOW_COPY_AND_MOVE(ViewStackProcessor);
 };
 
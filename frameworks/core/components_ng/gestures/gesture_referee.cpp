@@ -14,6 +14,8 @@
  */
 #include "core/components_ng/gestures/gesture_referee.h"
 
+#include <chrono>
+
 #include "base/memory/ace_type.h"
 #include "base/memory/referenced.h"
 #include "base/utils/utils.h"
@@ -21,6 +23,22 @@
 #include "core/components_ng/gestures/recognizers/recognizer_group.h"
 
 namespace OHOS::Ace::NG {
+namespace {
+
+// closed scopes kept for reuse, enough for the fingers of two hands.
+constexpr size_t MAX_POOLED_SCOPES = 10;
+
+} // namespace
+
+void GestureScope::Reset(size_t touchId)
+{
+    recognizers_.clear();
+    touchId_ = touchId;
+    isDelay_ = false;
+    hasGestureAccepted_ = false;
+    openTime_ = TimeStamp();
+    queryStateFunc_ = nullptr;
+}
 
 void GestureScope::AddMember(const RefPtr<NGGestureRecognizer>& recognizer)
 {
@@ -46,6 +64,11 @@ bool GestureScope::Existed(const RefPtr<NGGestureRecognizer>& recognizer)
     return result != recognizers_.cend();
 }
 
+bool GestureScope::IsSoleMember(const RefPtr<NGGestureRecognizer>& recognizer) const
+{
+    return recognizers_.size() == 1 && recognizers_.front() == recognizer;
+}
+
 bool GestureScope::CheckNeedBlocked(const RefPtr<NGGestureRecognizer>& recognizer)
 {
     for (const auto& weak : recognizers_) {
@@ -157,7 +180,34 @@ void GestureScope::Close()
     }
 }
 
-void GestureReferee::AddGestureToScope(size_t touchId, const TouchTestResult& result)
+RefPtr<GestureScope> GestureReferee::AcquireScope(size_t touchId, const TimeStamp& downTime)
+{
+    ++statistics_.openedScopes;
+    RefPtr<GestureScope> scope;
+    if (scopePool_.empty()) {
+        scope = MakeRefPtr<GestureScope>(touchId);
+    } else {
+        ++statistics_.reusedScopes;
+        scope = std::move(scopePool_.back());
+        scopePool_.pop_back();
+        scope->Reset(touchId);
+    }
+    // events made up without a time stamp are timed from now.
+    scope->SetOpenTime(downTime == TimeStamp() ? std::chrono::high_resolution_clock::now() : downTime);
+    return scope;
+}
+
+void GestureReferee::RecycleScope(const RefPtr<GestureScope>& scope)
+{
+    // a scope still held elsewhere can not be reset under its owner.
+    if (!scope || scopePool_.size() >= MAX_POOLED_SCOPES || scope->RefCount() > 1) {
+        return;
+    }
+    scope->Reset(0);
+    scopePool_.emplace_back(scope);
+}
+
+void GestureReferee::AddGestureToScope(size_t touchId, const TouchTestResult& result, const TimeStamp& downTime)
 {
     RefPtr<GestureScope> scope;
     const auto iter = gestureScopes_.find(touchId);
@@ -165,7 +215,7 @@ void GestureReferee::AddGestureToScope(size_t touchId, const TouchTestResult& re
         LOGI("gesture scope of touch id %{public}d already exists.", static_cast<int32_t>(touchId));
         scope = iter->second;
     } else {
-        scope = MakeRefPtr<GestureScope>(touchId);
+        scope = AcquireScope(touchId, downTime);
         gestureScopes_.try_emplace(touchId, scope);
     }
     for (const auto& item : result) {
@@ -186,7 +236,9 @@ void GestureReferee::CleanGestureScope(size_t touchId)
             return;
         }
         scope->Close();
+        auto closed = std::move(iter->second);
         gestureScopes_.erase(iter);
+        RecycleScope(closed);
     }
 }
 
@@ -216,9 +268,49 @@ bool GestureReferee::CheckSourceTypeChange(SourceType type, bool isAxis_)
 
 void GestureReferee::CleanAll()
 {
-    for (auto iter = gestureScopes_.begin(); iter != gestureScopes_.end(); iter++) {
-        iter->second->Close();
-        gestureScopes_.erase(iter);
+    auto scopes = std::move(gestureScopes_);
+    gestureScopes_.clear();
+    for (auto& [touchId, scope] : scopes) {
+        scope->Close();
+    }
+    for (auto& [touchId, scope] : scopes) {
+        RecycleScope(std::move(scope));
+    }
+}
+
+void GestureReferee::RecordAcceptLatency()
+{
+    auto now = std::chrono::high_resolution_clock::now();
+    for (const auto& [touchId, scope] : gestureScopes_) {
+        if (scope->HasGestureAccepted()) {
+            continue;
+        }
+        auto latency = std::chrono::duration_cast<std::chrono::microseconds>(now - scope->GetOpenTime()).count();
+        ++statistics_.acceptedScopes;
+        statistics_.totalAcceptLatency += latency;
+        statistics_.maxAcceptLatency = std::max<int64_t>(statistics_.maxAcceptLatency, latency);
+    }
+}
+
+void GestureReferee::AcceptGesture(const RefPtr<NGGestureRecognizer>& recognizer)
+{
+    for (const auto& [touchId, scope] : gestureScopes_) {
+        scope->OnAcceptGesture(recognizer);
+    }
+}
+
+void GestureReferee::CleanDelayClosedScopes()
+{
+    auto iter = gestureScopes_.begin();
+    while (iter != gestureScopes_.end()) {
+        if (iter->second->IsDelayClosed()) {
+            iter->second->Close();
+            auto closed = std::move(iter->second);
+            iter = gestureScopes_.erase(iter);
+            RecycleScope(closed);
+        } else {
+            ++iter;
+        }
     }
 }
 
@@ -250,6 +342,19 @@ void GestureReferee::HandleAcceptDisposal(const RefPtr<NGGestureRecognizer>& rec
         return;
     }
 
+    // a single finger on a single recognizer: nothing can block it and nothing has to be rejected.
+    if (gestureScopes_.size() == 1 && gestureScopes_.begin()->second->IsSoleMember(recognizer)) {
+        ++statistics_.fastPathAccepts;
+        auto prevState = recognizer->GetRefereeState();
+        RecordAcceptLatency();
+        recognizer->OnAccepted();
+        AcceptGesture(recognizer);
+        if (prevState == RefereeState::PENDING) {
+            CleanDelayClosedScopes();
+        }
+        return;
+    }
+
     bool isBlocked = false;
     for (const auto& scope : gestureScopes_) {
         if (scope.second->CheckNeedBlocked(recognizer)) {
@@ -262,22 +367,12 @@ void GestureReferee::HandleAcceptDisposal(const RefPtr<NGGestureRecognizer>& rec
         return;
     }
     auto prevState = recognizer->GetRefereeState();
+    RecordAcceptLatency();
     recognizer->OnAccepted();
-    std::list<size_t> delayIds;
-    for (const auto& scope : gestureScopes_) {
-        scope.second->OnAcceptGesture(recognizer);
-    }
+    AcceptGesture(recognizer);
     // clean delay task.
     if (prevState == RefereeState::PENDING) {
-        auto iter = gestureScopes_.begin();
-        while (iter != gestureScopes_.end()) {
-            if (iter->second->IsDelayClosed()) {
-                iter->second->Close();
-                iter = gestureScopes_.erase(iter);
-            } else {
-                ++iter;
-            }
-        }
+        CleanDelayClosedScopes();
     }
 }
 
@@ -328,22 +423,12 @@ void GestureReferee::HandleRejectDisposal(const RefPtr<NGGestureRecognizer>& rec
             newBlockRecognizer->OnPending();
         } else if (newBlockRecognizer->GetRefereeState() == RefereeState::SUCCEED_BLOCKED) {
             newBlockRecognizer->OnAccepted();
-            for (const auto& scope : gestureScopes_) {
-                scope.second->OnAcceptGesture(newBlockRecognizer);
-            }
+            AcceptGesture(newBlockRecognizer);
         }
     }
 
     // clean delay task.
-    auto iter = gestureScopes_.begin();
-    while (iter != gestureScopes_.end()) {
-        if (iter->second->IsDelayClosed()) {
-            iter->second->Close();
-            iter = gestureScopes_.erase(iter);
-        } else {
-            ++iter;
-        }
-    }
+    CleanDelayClosedScopes();
 }
 
 bool GestureReferee::HasGestureAccepted(size_t touchId) const
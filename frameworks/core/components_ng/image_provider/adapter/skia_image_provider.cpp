@@ -13,9 +13,11 @@
  * limitations under the License.
  */
 
+#include <algorithm>
 #include <mutex>
 #include <utility>
 
+#include "include/codec/SkAndroidCodec.h"
 #include "include/codec/SkCodec.h"
 #include "include/core/SkGraphics.h"
 
@@ -23,6 +25,8 @@
 #include "base/memory/referenced.h"
 #include "core/common/container.h"
 #include "core/components_ng/image_provider/adapter/skia_image_data.h"
+#include "core/components_ng/image_provider/image_decode_scheduler.h"
+#include "core/components_ng/image_provider/image_loading_context.h"
 #include "core/components_ng/image_provider/image_object.h"
 #include "core/components_ng/image_provider/image_provider.h"
 #include "core/components_ng/image_provider/image_utils.h"
@@ -36,18 +40,58 @@
 namespace OHOS::Ace::NG {
 namespace {
 
-sk_sp<SkImage> ApplySizeToSkImage(const std::unique_ptr<SkCodec>& codec, int32_t width, int32_t height)
+// scale decoded pixels down to the exact target size, returns [bitmap] itself if scaling fails
+SkBitmap ScaleBitmap(const SkBitmap& bitmap, int32_t width, int32_t height)
 {
     ACE_FUNCTION_TRACE();
-    auto info = codec->getInfo();
-    info.makeWH(width, height);
+    SkBitmap scaledBitmap;
+    if (!scaledBitmap.tryAllocPixels(bitmap.info().makeWH(width, height))) {
+        return bitmap;
+    }
+#if defined(NEW_SKIA) || defined(FLUTTER_2_5)
+    if (!bitmap.pixmap().scalePixels(
+            scaledBitmap.pixmap(), SkSamplingOptions(SkFilterMode::kLinear, SkMipmapMode::kNone))) {
+#else
+    if (!bitmap.pixmap().scalePixels(scaledBitmap.pixmap(), kLow_SkFilterQuality)) {
+#endif
+        LOGW("scale decoded pixels to [%{public}d x %{public}d] failed", width, height);
+        return bitmap;
+    }
+    return scaledBitmap;
+}
 
-    SkBitmap bitmap;
-    bitmap.allocPixels(info);
+sk_sp<SkImage> ApplySizeToSkImage(std::unique_ptr<SkCodec> codec, int32_t width, int32_t height)
+{
+    ACE_FUNCTION_TRACE();
+    auto androidCodec = SkAndroidCodec::MakeFromCodec(std::move(codec));
+    CHECK_NULL_RETURN(androidCodec, {});
+    auto info = androidCodec->getInfo();
+
+    // Let the codec downsample while decoding (scaled decode for jpeg / webp, subsampling for other formats), so
+    // the full resolution bitmap of a large image shown as a thumbnail is never allocated.
+    // [decodeSize] is the smallest size the codec supports that is not smaller than the target.
+    SkAndroidCodec::AndroidOptions options;
+    auto decodeSize = SkISize::Make(width, height);
+    options.fSampleSize = std::max(androidCodec->computeSampleSize(&decodeSize), 1);
+    if (decodeSize.width() < width || decodeSize.height() < height) {
+        options.fSampleSize = 1;
+        decodeSize = info.dimensions();
+    }
+    auto decodeInfo = info.makeWH(decodeSize.width(), decodeSize.height());
+    ACE_SCOPED_TRACE("decode [%d x %d] -> [%d x %d], sampleSize = %d", info.width(), info.height(),
+        decodeSize.width(), decodeSize.height(), options.fSampleSize);
 
-    auto res = codec->getPixels(info, bitmap.getPixels(), bitmap.rowBytes(), nullptr);
+    SkBitmap bitmap;
+    CHECK_NULL_RETURN(bitmap.tryAllocPixels(decodeInfo), {});
+    auto res = androidCodec->getAndroidPixels(decodeInfo, bitmap.getPixels(), bitmap.rowBytes(), &options);
     CHECK_NULL_RETURN(res == SkCodec::kSuccess, {});
 
+    // sampled size can still be up to twice the target, don't keep the extra pixels in cache
+    if (decodeSize.width() > width && decodeSize.height() > height) {
+        bitmap = ScaleBitmap(bitmap, width, height);
+    }
+    LOGD("decoded image [%{public}d x %{public}d] at [%{public}d x %{public}d], sampleSize = %{public}d",
+        info.width(), info.height(), bitmap.width(), bitmap.height(), options.fSampleSize);
     bitmap.setImmutable();
     return SkImage::MakeFromBitmap(bitmap);
 }
@@ -62,7 +106,7 @@ sk_sp<SkImage> ResizeSkImage(const sk_sp<SkData>& data, const SizeF& resizeTarge
     auto info = codec->getInfo();
 
     if ((info.width() > width && info.height() > height) || forceResize) {
-        return ApplySizeToSkImage(codec, width, height);
+        return ApplySizeToSkImage(std::move(codec), width, height);
     }
     return SkImage::MakeFromEncoded(data);
 }
@@ -114,7 +158,9 @@ void ImageProvider::MakeCanvasImage(const WeakPtr<ImageObject>& objWp, const Wea
             }
         });
         tasks_[key].bgTask_ = task;
-        ImageUtils::PostToBg(task);
+        auto ctx = ctxWp.Upgrade();
+        // decode the images closest to the viewport first
+        ImageDecodeScheduler::Post(key, task, ctx ? ctx->GetDecodePriority() : 0.0f);
     }
 }
 
@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "core/components_ng/image_provider/image_decode_scheduler.h"
+
+#include <algorithm>
+#include <cinttypes>
+
+#include "base/log/log.h"
+#include "base/utils/time_util.h"
+#include "core/components_ng/image_provider/image_utils.h"
+
+namespace OHOS::Ace::NG {
+
+std::mutex ImageDecodeScheduler::mutex_;
+DecodeJobQueue ImageDecodeScheduler::queue_;
+DecodeSchedulerStats ImageDecodeScheduler::stats_;
+
+void DecodeJobQueue::Push(const std::string& key, std::function<void()>&& task, float priority, int64_t postTime)
+{
+    Remove(key);
+    JobOrder order(priority, sequence_++);
+    orders_.emplace(order, key);
+    jobs_[key] = { std::move(task), order, postTime };
+}
+
+bool DecodeJobQueue::Pop(std::function<void()>& task, int64_t& postTime)
+{
+    if (orders_.empty()) {
+        return false;
+    }
+    auto orderIter = orders_.begin();
+    auto jobIter = jobs_.find(orderIter->second);
+    orders_.erase(orderIter);
+    if (jobIter == jobs_.end()) {
+        return false;
+    }
+    task = std::move(jobIter->second.task);
+    postTime = jobIter->second.postTime;
+    jobs_.erase(jobIter);
+    return true;
+}
+
+bool DecodeJobQueue::UpdatePriority(const std::string& key, float priority)
+{
+    auto iter = jobs_.find(key);
+    if (iter == jobs_.end()) {
+        return false;
+    }
+    auto& job = iter->second;
+    if (job.order.first == priority) {
+        return true;
+    }
+    // keep the posting sequence, so jobs moved to the same priority still run in posting order.
+    orders_.erase(job.order);
+    job.order.first = priority;
+    orders_.emplace(job.order, key);
+    return true;
+}
+
+bool DecodeJobQueue::Remove(const std::string& key)
+{
+    auto iter = jobs_.find(key);
+    if (iter == jobs_.end()) {
+        return false;
+    }
+    orders_.erase(iter->second.order);
+    jobs_.erase(iter);
+    return true;
+}
+
+void ImageDecodeScheduler::Post(const std::string& key, std::function<void()>&& task, float priority)
+{
+    {
+        std::scoped_lock<std::mutex> lock(mutex_);
+        queue_.Push(key, std::move(task), priority, GetMicroTickCount());
+        ++stats_.postedCount;
+    }
+    ImageUtils::PostToBg([] { ImageDecodeScheduler::RunNext(); });
+}
+
+void ImageDecodeScheduler::UpdatePriority(const std::string& key, float priority)
+{
+    std::scoped_lock<std::mutex> lock(mutex_);
+    queue_.UpdatePriority(key, priority);
+}
+
+void ImageDecodeScheduler::Remove(const std::string& key)
+{
+    std::scoped_lock<std::mutex> lock(mutex_);
+    if (queue_.Remove(key)) {
+        ++stats_.removedCount;
+    }
+}
+
+DecodeSchedulerStats ImageDecodeScheduler::GetStats()
+{
+    std::scoped_lock<std::mutex> lock(mutex_);
+    return stats_;
+}
+
+void ImageDecodeScheduler::RunNext()
+{
+    std::function<void()> task;
+    {
+        std::scoped_lock<std::mutex> lock(mutex_);
+        int64_t postTime = 0;
+        // runner of a removed job finds the queue shorter, nothing to do.
+        if (!queue_.Pop(task, postTime)) {
+            return;
+        }
+        auto waitTime = GetMicroTickCount() - postTime;
+        ++stats_.runCount;
+        stats_.totalWaitUs += waitTime;
+        stats_.maxWaitUs = std::max(stats_.maxWaitUs, waitTime);
+        LOGD("decode job waited %{public}" PRId64 " us, %{public}zu jobs pending", waitTime, queue_.Size());
+    }
+    if (task) {
+        task();
+    }
+}
+
+} // namespace OHOS::Ace::NG
@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_IMAGE_PROVIDER_IMAGE_DECODE_SCHEDULER_H
+#define FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_IMAGE_PROVIDER_IMAGE_DECODE_SCHEDULER_H
+
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace OHOS::Ace::NG {
+
+struct DecodeSchedulerStats {
+    uint64_t postedCount = 0;
+    uint64_t runCount = 0;
+    uint64_t removedCount = 0;
+    // time between posting a job and a background worker starting it.
+    int64_t totalWaitUs = 0;
+    int64_t maxWaitUs = 0;
+
+    int64_t GetAverageWaitUs() const
+    {
+        return runCount == 0 ? 0 : totalWaitUs / static_cast<int64_t>(runCount);
+    }
+};
+
+// Pending decode jobs ordered by priority, lower value runs first and equal priorities run in posting order.
+class DecodeJobQueue {
+public:
+    DecodeJobQueue() = default;
+    ~DecodeJobQueue() = default;
+
+    void Push(const std::string& key, std::function<void()>&& task, float priority, int64_t postTime);
+    bool Pop(std::function<void()>& task, int64_t& postTime);
+    bool UpdatePriority(const std::string& key, float priority);
+    bool Remove(const std::string& key);
+
+    size_t Size() const
+    {
+        return jobs_.size();
+    }
+
+private:
+    using JobOrder = std::pair<float, uint64_t>;
+
+    struct Job {
+        std::function<void()> task;
+        JobOrder order;
+        int64_t postTime = 0;
+    };
+
+    std::map<JobOrder, std::string> orders_;
+    std::unordered_map<std::string, Job> jobs_;
+    uint64_t sequence_ = 0;
+};
+
+// Schedules MakeCanvasImage (decode) jobs on the background thread by priority instead of posting order.
+// The priority of an image is its distance to the viewport, updated as the image scrolls, so a worker always
+// starts the job closest to the screen when it becomes free.
+class ImageDecodeScheduler {
+public:
+    static void Post(const std::string& key, std::function<void()>&& task, float priority);
+    static void UpdatePriority(const std::string& key, float priority);
+    // remove a job which has not started yet
+    static void Remove(const std::string& key);
+    static DecodeSchedulerStats GetStats();
+
+private:
+    // each posted job posts one runner to the background thread, the runner takes the most urgent job
+    static void RunNext();
+
+    static std::mutex mutex_;
+    static DecodeJobQueue queue_;
+    static DecodeSchedulerStats stats_;
+};
+
+} // namespace OHOS::Ace::NG
+
+#endif // FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_IMAGE_PROVIDER_IMAGE_DECODE_SCHEDULER_H
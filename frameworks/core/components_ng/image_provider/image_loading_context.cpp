@@ -260,6 +260,22 @@ void ImageLoadingContext::SetImageFit(ImageFit imageFit)
     imageFit_ = imageFit;
 }
 
+void ImageLoadingContext::SetDecodePriority(float priority)
+{
+    if (NearEqual(decodePriority_, priority)) {
+        return;
+    }
+    decodePriority_ = priority;
+    if (!syncLoad_ && IsMakingCanvasImage() && !canvasKey_.empty()) {
+        ImageProvider::UpdateTaskPriority(canvasKey_);
+    }
+}
+
+bool ImageLoadingContext::IsMakingCanvasImage() const
+{
+    return stateManager_->GetCurrentState() == ImageLoadingState::MAKE_CANVAS_IMAGE;
+}
+
 const ImageSourceInfo& ImageLoadingContext::GetSourceInfo() const
 {
     return src_;
@@ -66,6 +66,14 @@ public:
     void SetAutoResize(bool needResize);
     void SetSourceSize(const std::optional<SizeF>& sourceSize = std::nullopt);
 
+    // decode priority is the distance from the image to the viewport, 0 when visible
+    void SetDecodePriority(float priority);
+    float GetDecodePriority() const
+    {
+        return decodePriority_;
+    }
+    bool IsMakingCanvasImage() const;
+
     // callbacks that will be called by ImageProvider when load process finishes
     void DataReadyCallback(const RefPtr<ImageObject>& imageObj);
     void SuccessCallback(const RefPtr<CanvasImage>& canvasImage);
@@ -124,6 +132,7 @@ private:
 
     // to cancel MakeCanvasImage task
     std::string canvasKey_;
+    float decodePriority_ = 0.0f;
 
     friend class ImageStateManager;
     ACE_DISALLOW_COPY_AND_MOVE(ImageLoadingContext);
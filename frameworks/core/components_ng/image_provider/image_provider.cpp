@@ -16,6 +16,7 @@
 #include "core/components_ng/image_provider/image_provider.h"
 
 #include <cstdint>
+#include <limits>
 #include <mutex>
 
 #include "base/log/ace_trace.h"
@@ -24,6 +25,7 @@
 #include "core/common/container_scope.h"
 #include "core/components_ng/image_provider/adapter/skia_image_data.h"
 #include "core/components_ng/image_provider/animated_image_object.h"
+#include "core/components_ng/image_provider/image_decode_scheduler.h"
 #include "core/components_ng/image_provider/image_loading_context.h"
 #include "core/components_ng/image_provider/image_object.h"
 #include "core/components_ng/image_provider/image_utils.h"
@@ -232,6 +234,7 @@ void ImageProvider::CancelTask(const std::string& key, const WeakPtr<ImageLoadin
         LOGD("cancel bgTask %s, result: %d", key.c_str(), canceled);
         if (canceled) {
             tasks_.erase(it);
+            ImageDecodeScheduler::Remove(key);
             return;
         }
     }
@@ -239,6 +242,22 @@ void ImageProvider::CancelTask(const std::string& key, const WeakPtr<ImageLoadin
     it->second.ctxs_.erase(ctx);
 }
 
+void ImageProvider::UpdateTaskPriority(const std::string& key)
+{
+    std::scoped_lock<std::mutex> lock(taskMtx_);
+    auto it = tasks_.find(key);
+    CHECK_NULL_VOID_NOLOG(it != tasks_.end());
+    // a task shared by several LoadingContexts is as urgent as the closest one
+    float priority = std::numeric_limits<float>::max();
+    for (const auto& ctxWp : it->second.ctxs_) {
+        auto ctx = ctxWp.Upgrade();
+        if (ctx) {
+            priority = std::min(priority, ctx->GetDecodePriority());
+        }
+    }
+    ImageDecodeScheduler::UpdatePriority(key, priority);
+}
+
 void ImageProvider::CreateImageObject(const ImageSourceInfo& src, const WeakPtr<ImageLoadingContext>& ctx, bool sync)
 {
     if (!RegisterTask(src.GetKey(), ctx)) {
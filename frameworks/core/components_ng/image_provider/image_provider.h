@@ -80,6 +80,9 @@ public:
     // cancel a scheduled background task
     static void CancelTask(const std::string& key, const WeakPtr<ImageLoadingContext>& ctx);
 
+    // reschedule a pending MakeCanvasImage task after decode priority of its LoadingContexts changed
+    static void UpdateTaskPriority(const std::string& key);
+
 private:
     /** Check if task is already running and register task in the task map,
      * making sure the same task runs only once (CreateImageObject with same
@@ -34,8 +34,7 @@ namespace OHOS::Ace::NG {
 void BoxLayoutAlgorithm::Measure(LayoutWrapper* layoutWrapper)
 {
     auto layoutConstraint = layoutWrapper->GetLayoutProperty()->CreateChildConstraint();
-    auto pipeline = OHOS::Ace::PipelineBase::GetCurrentContext();
-    if (pipeline && pipeline->GetIsAppWindow() && pipeline->GetIsLayoutFullScreen()) {
+    if (layoutWrapper->IsLayoutFullScreenWindow()) {
         auto layoutProperty = layoutWrapper->GetLayoutProperty();
         if (layoutProperty) {
             auto safeArea = layoutProperty->GetSafeArea();
@@ -63,12 +62,24 @@ void BoxLayoutAlgorithm::Layout(LayoutWrapper* layoutWrapper)
     }
 }
 
+RefPtr<LayoutAlgorithm> BoxLayoutAlgorithm::CreateRemeasureAlgorithm() const
+{
+    // the algorithms deriving from box layout may get inputs from their patterns.
+    if (AceType::TypeId(this) != AceType::TypeId<BoxLayoutAlgorithm>()) {
+        return nullptr;
+    }
+    return MakeRefPtr<BoxLayoutAlgorithm>();
+}
+
+bool BoxLayoutAlgorithm::CanMeasureInParallel() const
+{
+    return AceType::TypeId(this) == AceType::TypeId<BoxLayoutAlgorithm>();
+}
+
 std::optional<SizeF> BoxLayoutAlgorithm::MeasureContent(
     const LayoutConstraintF& contentConstraint, LayoutWrapper* layoutWrapper)
 {
-    auto host = layoutWrapper->GetHostNode();
-    CHECK_NULL_RETURN(host, std::nullopt);
-    if (!host->IsAtomicNode()) {
+    if (!layoutWrapper->IsHostAtomicNode()) {
         return std::nullopt;
     }
     const auto& layoutProperty = layoutWrapper->GetLayoutProperty();
@@ -151,8 +162,7 @@ void BoxLayoutAlgorithm::PerformMeasureSelfWithChildList(
         }
         frameSize.UpdateIllegalSizeWithCheck(SizeF { 0.0f, 0.0f });
     } while (false);
-    auto pipeline = OHOS::Ace::PipelineBase::GetCurrentContext();
-    if (pipeline && pipeline->GetIsAppWindow() && pipeline->GetIsLayoutFullScreen()) {
+    if (layoutWrapper->IsLayoutFullScreenWindow()) {
         auto layoutProperty = layoutWrapper->GetLayoutProperty();
         if (layoutProperty) {
             auto safeArea = layoutProperty->GetSafeArea();
@@ -35,6 +35,10 @@ public:
     std::optional<SizeF> MeasureContent(
         const LayoutConstraintF& contentConstraint, LayoutWrapper* layoutWrapper) override;
 
+    RefPtr<LayoutAlgorithm> CreateRemeasureAlgorithm() const override;
+
+    bool CanMeasureInParallel() const override;
+
     // Called to perform measure current render node.
     static void PerformMeasureSelf(LayoutWrapper* layoutWrapper);
 
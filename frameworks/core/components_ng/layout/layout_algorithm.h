@@ -65,6 +65,28 @@ public:
         return MAIN_TASK;
     }
 
+    // A new algorithm with the inputs of this one, used to measure the node again while the layout wrapper keeps
+    // the state of this measure in its measure cache. Null when the state cannot be kept apart.
+    virtual RefPtr<LayoutAlgorithm> CreateRemeasureAlgorithm() const
+    {
+        return nullptr;
+    }
+
+    // Whether the subtree can be measured on a background worker. Measure may then only read and write the layout
+    // wrappers of the subtree, the state copied to them and to the algorithms by PrepareParallelMeasure, and no frame
+    // node, pattern, render context or pipeline.
+    virtual bool CanMeasureInParallel() const
+    {
+        return false;
+    }
+
+    // Called on the main thread before the subtree is handed to a worker, to copy what Measure needs from the frame
+    // node and the pipeline. Returns false to keep the subtree on the main thread.
+    virtual bool PrepareParallelMeasure(LayoutWrapper* layoutWrapper)
+    {
+        return true;
+    }
+
 protected:
     virtual void OnReset() {}
 
@@ -138,6 +160,11 @@ public:
         return layoutAlgorithm_;
     }
 
+    void SetLayoutAlgorithm(const RefPtr<LayoutAlgorithm>& layoutAlgorithm)
+    {
+        layoutAlgorithm_ = layoutAlgorithm;
+    }
+
 private:
     RefPtr<LayoutAlgorithm> layoutAlgorithm_;
 
@@ -63,12 +63,8 @@ std::string TextDirectionToString(TextDirection type)
 void LayoutProperty::Reset()
 {
     layoutConstraint_.reset();
-    calcLayoutConstraint_.reset();
-    padding_.reset();
-    margin_.reset();
-    borderWidth_.reset();
-    magicItemProperty_.reset();
-    positionProperty_.reset();
+    groups_.Reset(LayoutPropertyGroups::GetGroupMask<CALC_LAYOUT_CONSTRAINT_GROUP, PADDING_GROUP, MARGIN_GROUP,
+        BORDER_WIDTH_GROUP, MAGIC_ITEM_GROUP, POSITION_GROUP>());
     measureType_.reset();
     layoutDirection_.reset();
     propVisibility_.reset();
@@ -80,21 +76,21 @@ void LayoutProperty::Reset()
 
 void LayoutProperty::ToJsonValue(std::unique_ptr<JsonValue>& json) const
 {
-    ACE_PROPERTY_TO_JSON_VALUE(calcLayoutConstraint_, MeasureProperty);
-    ACE_PROPERTY_TO_JSON_VALUE(positionProperty_, PositionProperty);
-    ACE_PROPERTY_TO_JSON_VALUE(magicItemProperty_, MagicItemProperty);
-    ACE_PROPERTY_TO_JSON_VALUE(flexItemProperty_, FlexItemProperty);
-    ACE_PROPERTY_TO_JSON_VALUE(borderWidth_, BorderWidthProperty);
+    ACE_PROPERTY_TO_JSON_VALUE(GetCalcLayoutConstraint(), MeasureProperty);
+    ACE_PROPERTY_TO_JSON_VALUE(GetPositionProperty(), PositionProperty);
+    ACE_PROPERTY_TO_JSON_VALUE(GetMagicItemProperty(), MagicItemProperty);
+    ACE_PROPERTY_TO_JSON_VALUE(GetFlexItemProperty(), FlexItemProperty);
+    ACE_PROPERTY_TO_JSON_VALUE(GetBorderWidthProperty(), BorderWidthProperty);
     ACE_PROPERTY_TO_JSON_VALUE(gridProperty_, GridProperty);
 
-    if (padding_) {
-        json->Put("padding", padding_->ToJsonString().c_str());
+    if (GetPaddingProperty()) {
+        json->Put("padding", GetPaddingProperty()->ToJsonString().c_str());
     } else {
         json->Put("padding", "0.00vp");
     }
 
-    if (margin_) {
-        json->Put("margin", margin_->ToJsonString().c_str());
+    if (GetMarginProperty()) {
+        json->Put("margin", GetMarginProperty()->ToJsonString().c_str());
     } else {
         json->Put("margin", "0.00vp");
     }
@@ -121,27 +117,8 @@ void LayoutProperty::UpdateLayoutProperty(const LayoutProperty* layoutProperty)
     if (layoutProperty->gridProperty_) {
         gridProperty_ = std::make_unique<GridProperty>(*layoutProperty->gridProperty_);
     }
-    if (layoutProperty->calcLayoutConstraint_) {
-        calcLayoutConstraint_ = std::make_unique<MeasureProperty>(*layoutProperty->calcLayoutConstraint_);
-    }
-    if (layoutProperty->padding_) {
-        padding_ = std::make_unique<PaddingProperty>(*layoutProperty->padding_);
-    }
-    if (layoutProperty->margin_) {
-        margin_ = std::make_unique<PaddingProperty>(*layoutProperty->margin_);
-    }
-    if (layoutProperty->borderWidth_) {
-        borderWidth_ = std::make_unique<BorderWidthProperty>(*layoutProperty->borderWidth_);
-    }
-    if (layoutProperty->magicItemProperty_) {
-        magicItemProperty_ = std::make_unique<MagicItemProperty>(*layoutProperty->magicItemProperty_);
-    }
-    if (layoutProperty->positionProperty_) {
-        positionProperty_ = std::make_unique<PositionProperty>(*layoutProperty->positionProperty_);
-    }
-    if (layoutProperty->flexItemProperty_) {
-        flexItemProperty_ = std::make_unique<FlexItemProperty>(*layoutProperty->flexItemProperty_);
-    }
+    // shared until either side updates a group.
+    groups_ = layoutProperty->groups_;
     geometryTransition_ = layoutProperty->geometryTransition_;
     propVisibility_ = layoutProperty->GetVisibility();
     measureType_ = layoutProperty->measureType_;
@@ -155,24 +132,20 @@ void LayoutProperty::UpdateLayoutProperty(const LayoutProperty* layoutProperty)
 
 void LayoutProperty::UpdateCalcLayoutProperty(const MeasureProperty& constraint)
 {
-    if (!calcLayoutConstraint_) {
-        calcLayoutConstraint_ = std::make_unique<MeasureProperty>(constraint);
-        propertyChangeFlag_ = propertyChangeFlag_ | PROPERTY_UPDATE_MEASURE;
-        return;
-    }
-    if (*calcLayoutConstraint_ == constraint) {
+    if (GetCalcLayoutConstraint() && *GetCalcLayoutConstraint() == constraint) {
         return;
     }
-    calcLayoutConstraint_->selfIdealSize = constraint.selfIdealSize;
-    calcLayoutConstraint_->maxSize = constraint.maxSize;
-    calcLayoutConstraint_->minSize = constraint.minSize;
+    auto calcLayoutConstraint = GetOrCreateCalcLayoutConstraint();
+    calcLayoutConstraint->selfIdealSize = constraint.selfIdealSize;
+    calcLayoutConstraint->maxSize = constraint.maxSize;
+    calcLayoutConstraint->minSize = constraint.minSize;
     propertyChangeFlag_ = propertyChangeFlag_ | PROPERTY_UPDATE_MEASURE;
 }
 
 void LayoutProperty::UpdateLayoutConstraint(const LayoutConstraintF& parentConstraint)
 {
     layoutConstraint_ = parentConstraint;
-    if (margin_) {
+    if (GetMarginProperty()) {
         // TODO: add margin is negative case.
         auto margin = CreateMargin();
         MinusPaddingToSize(margin, layoutConstraint_->maxSize);
@@ -181,20 +154,21 @@ void LayoutProperty::UpdateLayoutConstraint(const LayoutConstraintF& parentConst
         MinusPaddingToSize(margin, layoutConstraint_->selfIdealSize);
         MinusPaddingToSize(margin, layoutConstraint_->parentIdealSize);
     }
-    if (calcLayoutConstraint_) {
-        if (calcLayoutConstraint_->maxSize.has_value()) {
-            layoutConstraint_->UpdateMaxSizeWithCheck(ConvertToSize(calcLayoutConstraint_->maxSize.value(),
+    const auto* calcLayoutConstraint = GetCalcLayoutConstraint();
+    if (calcLayoutConstraint) {
+        if (calcLayoutConstraint->maxSize.has_value()) {
+            layoutConstraint_->UpdateMaxSizeWithCheck(ConvertToSize(calcLayoutConstraint->maxSize.value(),
                 layoutConstraint_->scaleProperty, layoutConstraint_->percentReference));
         }
-        if (calcLayoutConstraint_->minSize.has_value()) {
-            layoutConstraint_->UpdateMinSizeWithCheck(ConvertToSize(calcLayoutConstraint_->minSize.value(),
+        if (calcLayoutConstraint->minSize.has_value()) {
+            layoutConstraint_->UpdateMinSizeWithCheck(ConvertToSize(calcLayoutConstraint->minSize.value(),
                 layoutConstraint_->scaleProperty, layoutConstraint_->percentReference));
         }
-        if (calcLayoutConstraint_->selfIdealSize.has_value()) {
+        if (calcLayoutConstraint->selfIdealSize.has_value()) {
             LOGD("CalcLayoutConstraint->selfIdealSize = %{public}s",
-                calcLayoutConstraint_->selfIdealSize.value().ToString().c_str());
+                calcLayoutConstraint->selfIdealSize.value().ToString().c_str());
             layoutConstraint_->UpdateIllegalSelfIdealSizeWithCheck(
-                ConvertToOptionalSize(calcLayoutConstraint_->selfIdealSize.value(), layoutConstraint_->scaleProperty,
+                ConvertToOptionalSize(calcLayoutConstraint->selfIdealSize.value(), layoutConstraint_->scaleProperty,
                     layoutConstraint_->percentReference));
         }
     }
@@ -229,11 +203,12 @@ void LayoutProperty::CheckBorderAndPadding()
 
 void LayoutProperty::CheckAspectRatio()
 {
-    auto hasAspectRatio = magicItemProperty_ ? magicItemProperty_->HasAspectRatio() : false;
+    const auto* magicItemProperty = GetMagicItemProperty();
+    auto hasAspectRatio = magicItemProperty ? magicItemProperty->HasAspectRatio() : false;
     if (!hasAspectRatio) {
         return;
     }
-    auto aspectRatio = magicItemProperty_->GetAspectRatioValue();
+    auto aspectRatio = magicItemProperty->GetAspectRatioValue();
     // Adjust by aspect ratio, firstly pick height based on width. It means that when width, height and aspectRatio are
     // all set, the height is not used.
     auto maxWidth = layoutConstraint_->maxSize.Width();
@@ -326,15 +301,16 @@ void LayoutProperty::CheckSelfIdealSize()
     if (measureType_ == MeasureType::MATCH_PARENT) {
         layoutConstraint_->UpdateIllegalSelfIdealSizeWithCheck(layoutConstraint_->parentIdealSize);
     }
-    if (!calcLayoutConstraint_) {
+    const auto* calcLayoutConstraint = GetCalcLayoutConstraint();
+    if (!calcLayoutConstraint) {
         return;
     }
-    if (calcLayoutConstraint_->maxSize.has_value()) {
-        layoutConstraint_->selfIdealSize.UpdateSizeWhenSmaller(ConvertToSize(calcLayoutConstraint_->maxSize.value(),
+    if (calcLayoutConstraint->maxSize.has_value()) {
+        layoutConstraint_->selfIdealSize.UpdateSizeWhenSmaller(ConvertToSize(calcLayoutConstraint->maxSize.value(),
             layoutConstraint_->scaleProperty, layoutConstraint_->percentReference));
     }
-    if (calcLayoutConstraint_->minSize.has_value()) {
-        layoutConstraint_->selfIdealSize.UpdateSizeWhenLarger(ConvertToSize(calcLayoutConstraint_->minSize.value(),
+    if (calcLayoutConstraint->minSize.has_value()) {
+        layoutConstraint_->selfIdealSize.UpdateSizeWhenLarger(ConvertToSize(calcLayoutConstraint->minSize.value(),
             layoutConstraint_->scaleProperty, layoutConstraint_->percentReference));
     }
 }
@@ -370,14 +346,14 @@ void LayoutProperty::UpdateContentConstraint()
     if (contentConstraint_->parentIdealSize.Height()) {
         contentConstraint_->percentReference.SetHeight(contentConstraint_->parentIdealSize.Height().value());
     }
-    if (padding_) {
+    if (GetPaddingProperty()) {
         auto paddingF = ConvertToPaddingPropertyF(
-            *padding_, contentConstraint_->scaleProperty, contentConstraint_->percentReference.Width());
+            *GetPaddingProperty(), contentConstraint_->scaleProperty, contentConstraint_->percentReference.Width());
         contentConstraint_->MinusPaddingOnBothSize(paddingF.left, paddingF.right, paddingF.top, paddingF.bottom);
     }
-    if (borderWidth_) {
+    if (GetBorderWidthProperty()) {
         auto borderWidthF = ConvertToBorderWidthPropertyF(
-            *borderWidth_, contentConstraint_->scaleProperty, contentConstraint_->percentReference.Width());
+            *GetBorderWidthProperty(), contentConstraint_->scaleProperty, contentConstraint_->percentReference.Width());
         contentConstraint_->MinusPaddingOnBothSize(
             borderWidthF.leftDimen, borderWidthF.rightDimen, borderWidthF.topDimen, borderWidthF.bottomDimen);
     }
@@ -387,9 +363,9 @@ PaddingPropertyF LayoutProperty::CreatePaddingAndBorder()
 {
     if (layoutConstraint_.has_value()) {
         auto padding = ConvertToPaddingPropertyF(
-            padding_, ScaleProperty::CreateScaleProperty(), layoutConstraint_->percentReference.Width());
+            GetPaddingProperty(), ScaleProperty::CreateScaleProperty(), layoutConstraint_->percentReference.Width());
         auto borderWidth = ConvertToBorderWidthPropertyF(
-            borderWidth_, ScaleProperty::CreateScaleProperty(), layoutConstraint_->percentReference.Width());
+            GetBorderWidthProperty(), ScaleProperty::CreateScaleProperty(), layoutConstraint_->percentReference.Width());
 
         return PaddingPropertyF { padding.left.value_or(0) + borderWidth.leftDimen.value_or(0),
             padding.right.value_or(0) + borderWidth.rightDimen.value_or(0),
@@ -397,9 +373,9 @@ PaddingPropertyF LayoutProperty::CreatePaddingAndBorder()
             padding.bottom.value_or(0) + borderWidth.bottomDimen.value_or(0) };
     }
     auto padding = ConvertToPaddingPropertyF(
-        padding_, ScaleProperty::CreateScaleProperty(), PipelineContext::GetCurrentRootWidth());
+        GetPaddingProperty(), ScaleProperty::CreateScaleProperty(), PipelineContext::GetCurrentRootWidth());
     auto borderWidth = ConvertToBorderWidthPropertyF(
-        borderWidth_, ScaleProperty::CreateScaleProperty(), PipelineContext::GetCurrentRootWidth());
+        GetBorderWidthProperty(), ScaleProperty::CreateScaleProperty(), PipelineContext::GetCurrentRootWidth());
 
     return PaddingPropertyF { padding.left.value_or(0) + borderWidth.leftDimen.value_or(0),
         padding.right.value_or(0) + borderWidth.rightDimen.value_or(0),
@@ -412,9 +388,9 @@ PaddingPropertyF LayoutProperty::CreatePaddingAndBorderWithDefault(float padding
 {
     if (layoutConstraint_.has_value()) {
         auto padding = ConvertToPaddingPropertyF(
-            padding_, ScaleProperty::CreateScaleProperty(), layoutConstraint_->percentReference.Width());
+            GetPaddingProperty(), ScaleProperty::CreateScaleProperty(), layoutConstraint_->percentReference.Width());
         auto borderWidth = ConvertToBorderWidthPropertyF(
-            borderWidth_, ScaleProperty::CreateScaleProperty(), layoutConstraint_->percentReference.Width());
+            GetBorderWidthProperty(), ScaleProperty::CreateScaleProperty(), layoutConstraint_->percentReference.Width());
         return PaddingPropertyF { padding.left.value_or(paddingHorizontalDefault) +
                                       borderWidth.leftDimen.value_or(borderHorizontalDefault),
             padding.right.value_or(paddingHorizontalDefault) + borderWidth.rightDimen.value_or(borderHorizontalDefault),
@@ -422,9 +398,9 @@ PaddingPropertyF LayoutProperty::CreatePaddingAndBorderWithDefault(float padding
             padding.bottom.value_or(paddingVerticalDefault) + borderWidth.bottomDimen.value_or(borderVerticalDefault) };
     }
     auto padding = ConvertToPaddingPropertyF(
-        padding_, ScaleProperty::CreateScaleProperty(), PipelineContext::GetCurrentRootWidth());
+        GetPaddingProperty(), ScaleProperty::CreateScaleProperty(), PipelineContext::GetCurrentRootWidth());
     auto borderWidth = ConvertToBorderWidthPropertyF(
-        borderWidth_, ScaleProperty::CreateScaleProperty(), PipelineContext::GetCurrentRootWidth());
+        GetBorderWidthProperty(), ScaleProperty::CreateScaleProperty(), PipelineContext::GetCurrentRootWidth());
 
     return PaddingPropertyF { padding.left.value_or(paddingHorizontalDefault) +
                                   borderWidth.leftDimen.value_or(borderHorizontalDefault),
@@ -437,22 +413,22 @@ PaddingPropertyF LayoutProperty::CreatePaddingWithoutBorder()
 {
     if (layoutConstraint_.has_value()) {
         return ConvertToPaddingPropertyF(
-            padding_, layoutConstraint_->scaleProperty, layoutConstraint_->percentReference.Width());
+            GetPaddingProperty(), layoutConstraint_->scaleProperty, layoutConstraint_->percentReference.Width());
     }
 
     return ConvertToPaddingPropertyF(
-        padding_, ScaleProperty::CreateScaleProperty(), PipelineContext::GetCurrentRootWidth());
+        GetPaddingProperty(), ScaleProperty::CreateScaleProperty(), PipelineContext::GetCurrentRootWidth());
 }
 
 MarginPropertyF LayoutProperty::CreateMargin()
 {
     if (layoutConstraint_.has_value()) {
         return ConvertToMarginPropertyF(
-            margin_, layoutConstraint_->scaleProperty, layoutConstraint_->percentReference.Width());
+            GetMarginProperty(), layoutConstraint_->scaleProperty, layoutConstraint_->percentReference.Width());
     }
 
     return ConvertToMarginPropertyF(
-        margin_, ScaleProperty::CreateScaleProperty(), PipelineContext::GetCurrentRootWidth());
+        GetMarginProperty(), ScaleProperty::CreateScaleProperty(), PipelineContext::GetCurrentRootWidth());
 }
 
 void LayoutProperty::SetHost(const WeakPtr<FrameNode>& host)
@@ -39,6 +39,7 @@
 #include "core/components_ng/property/measure_property.h"
 #include "core/components_ng/property/position_property.h"
 #include "core/components_ng/property/property.h"
+#include "core/components_ng/property/property_group_block.h"
 #include "core/pipeline/base/element_register.h"
 #include "core/pipeline_ng/ui_task_scheduler.h"
 
@@ -46,6 +47,20 @@ namespace OHOS::Ace::NG {
 
 class FrameNode;
 
+// indexes of the groups in LayoutPropertyGroups.
+enum LayoutPropertyGroup : size_t {
+    CALC_LAYOUT_CONSTRAINT_GROUP = 0,
+    PADDING_GROUP,
+    MARGIN_GROUP,
+    BORDER_WIDTH_GROUP,
+    MAGIC_ITEM_GROUP,
+    POSITION_GROUP,
+    FLEX_ITEM_GROUP,
+};
+
+using LayoutPropertyGroups = PropertyGroupBlock<MeasureProperty, PaddingProperty, MarginProperty, BorderWidthProperty,
+    MagicItemProperty, PositionProperty, FlexItemProperty>;
+
 class ACE_EXPORT LayoutProperty : public Property {
     DECLARE_ACE_TYPE(LayoutProperty, Property);
 
@@ -71,39 +86,19 @@ public:
         return contentConstraint_;
     }
 
-    const std::unique_ptr<MagicItemProperty>& GetMagicItemProperty() const
-    {
-        return magicItemProperty_;
-    }
-
-    const std::unique_ptr<PaddingProperty>& GetPaddingProperty() const
-    {
-        return padding_;
-    }
-
-    const std::unique_ptr<MarginProperty>& GetMarginProperty() const
-    {
-        return margin_;
-    }
-
-    const std::unique_ptr<BorderWidthProperty>& GetBorderWidthProperty() const
-    {
-        return borderWidth_;
-    }
-
-    const std::unique_ptr<PositionProperty>& GetPositionProperty() const
-    {
-        return positionProperty_;
-    }
-
-    const std::unique_ptr<MeasureProperty>& GetCalcLayoutConstraint() const
-    {
-        return calcLayoutConstraint_;
-    }
+    ACE_DEFINE_PROPERTY_GROUP_IN_BLOCK(groups_, MAGIC_ITEM_GROUP, MagicItemProperty, MagicItemProperty);
+    ACE_DEFINE_PROPERTY_GROUP_IN_BLOCK(groups_, PADDING_GROUP, PaddingProperty, PaddingProperty);
+    ACE_DEFINE_PROPERTY_GROUP_IN_BLOCK(groups_, MARGIN_GROUP, MarginProperty, MarginProperty);
+    ACE_DEFINE_PROPERTY_GROUP_IN_BLOCK(groups_, BORDER_WIDTH_GROUP, BorderWidthProperty, BorderWidthProperty);
+    ACE_DEFINE_PROPERTY_GROUP_IN_BLOCK(groups_, POSITION_GROUP, PositionProperty, PositionProperty);
+    ACE_DEFINE_PROPERTY_GROUP_IN_BLOCK(groups_, CALC_LAYOUT_CONSTRAINT_GROUP, CalcLayoutConstraint, MeasureProperty);
+    ACE_DEFINE_PROPERTY_GROUP_IN_BLOCK(groups_, FLEX_ITEM_GROUP, FlexItemProperty, FlexItemProperty);
 
-    const std::unique_ptr<FlexItemProperty>& GetFlexItemProperty() const
+public:
+    // the groups are shared with the clones of the property until either is updated.
+    const LayoutPropertyGroups& GetPropertyGroups() const
     {
-        return flexItemProperty_;
+        return groups_;
     }
 
     TextDirection GetLayoutDirection() const
@@ -123,52 +118,49 @@ public:
 
     void UpdatePadding(const PaddingProperty& value)
     {
-        if (!padding_) {
-            padding_ = std::make_unique<PaddingProperty>();
-        }
-        if (padding_->UpdateWithCheck(value)) {
+        auto changed = UpdateGroupWithCheck<PADDING_GROUP>(
+            [&value](PaddingProperty& group) { return group.UpdateWithCheck(value); });
+        if (changed) {
             propertyChangeFlag_ = propertyChangeFlag_ | PROPERTY_UPDATE_LAYOUT | PROPERTY_UPDATE_MEASURE;
         }
     }
 
     void UpdateMargin(const MarginProperty& value)
     {
-        if (!margin_) {
-            margin_ = std::make_unique<MarginProperty>();
-        }
-        if (margin_->UpdateWithCheck(value)) {
+        auto changed = UpdateGroupWithCheck<MARGIN_GROUP>(
+            [&value](MarginProperty& group) { return group.UpdateWithCheck(value); });
+        if (changed) {
             propertyChangeFlag_ = propertyChangeFlag_ | PROPERTY_UPDATE_LAYOUT | PROPERTY_UPDATE_MEASURE;
         }
     }
 
     void UpdateBorderWidth(const BorderWidthProperty& value)
     {
-        if (!borderWidth_) {
-            borderWidth_ = std::make_unique<BorderWidthProperty>();
-        }
-        if (borderWidth_->UpdateWithCheck(value)) {
+        auto changed = UpdateGroupWithCheck<BORDER_WIDTH_GROUP>(
+            [&value](BorderWidthProperty& group) { return group.UpdateWithCheck(value); });
+        if (changed) {
             propertyChangeFlag_ = propertyChangeFlag_ | PROPERTY_UPDATE_LAYOUT | PROPERTY_UPDATE_MEASURE;
         }
     }
 
     void UpdateAlignment(Alignment value)
     {
-        if (!positionProperty_) {
-            positionProperty_ = std::make_unique<PositionProperty>();
-        }
-        if (positionProperty_->UpdateAlignment(value)) {
-            propertyChangeFlag_ = propertyChangeFlag_ | PROPERTY_UPDATE_LAYOUT;
+        const auto* position = GetPositionProperty();
+        if (position && position->CheckAlignment(value)) {
+            return;
         }
+        GetOrCreatePositionProperty()->UpdateAlignment(value);
+        propertyChangeFlag_ = propertyChangeFlag_ | PROPERTY_UPDATE_LAYOUT;
     }
 
     void UpdateLayoutWeight(float value)
     {
-        if (!magicItemProperty_) {
-            magicItemProperty_ = std::make_unique<MagicItemProperty>();
-        }
-        if (magicItemProperty_->UpdateLayoutWeight(value)) {
-            propertyChangeFlag_ = propertyChangeFlag_ | PROPERTY_UPDATE_MEASURE;
+        const auto* magicItem = GetMagicItemProperty();
+        if (magicItem && magicItem->CheckLayoutWeight(value)) {
+            return;
         }
+        GetOrCreateMagicItemProperty()->UpdateLayoutWeight(value);
+        propertyChangeFlag_ = propertyChangeFlag_ | PROPERTY_UPDATE_MEASURE;
     }
 
     void UpdateLayoutDirection(TextDirection value)
@@ -199,12 +191,12 @@ public:
 
     void UpdateAspectRatio(float ratio)
     {
-        if (!magicItemProperty_) {
-            magicItemProperty_ = std::make_unique<MagicItemProperty>();
-        }
-        if (magicItemProperty_->UpdateAspectRatio(ratio)) {
-            propertyChangeFlag_ = propertyChangeFlag_ | PROPERTY_UPDATE_MEASURE;
+        const auto* magicItem = GetMagicItemProperty();
+        if (magicItem && magicItem->CheckAspectRatio(ratio)) {
+            return;
         }
+        GetOrCreateMagicItemProperty()->UpdateAspectRatio(ratio);
+        propertyChangeFlag_ = propertyChangeFlag_ | PROPERTY_UPDATE_MEASURE;
     }
 
     void UpdateMeasureType(MeasureType measureType)
@@ -221,40 +213,43 @@ public:
 
     void UpdateUserDefinedIdealSize(const CalcSize& value)
     {
-        if (!calcLayoutConstraint_) {
-            calcLayoutConstraint_ = std::make_unique<MeasureProperty>();
-        }
-        if (calcLayoutConstraint_->UpdateSelfIdealSizeWithCheck(value)) {
+        auto changed = UpdateGroupWithCheck<CALC_LAYOUT_CONSTRAINT_GROUP>(
+            [&value](MeasureProperty& group) { return group.UpdateSelfIdealSizeWithCheck(value); });
+        if (changed) {
             propertyChangeFlag_ = propertyChangeFlag_ | PROPERTY_UPDATE_MEASURE;
         }
     }
 
     void ClearUserDefinedIdealSize(bool clearWidth, bool clearHeight)
     {
-        if (!calcLayoutConstraint_) {
+        const auto* calcLayoutConstraint = GetCalcLayoutConstraint();
+        if (!calcLayoutConstraint || !calcLayoutConstraint->selfIdealSize) {
             return;
         }
-        if (calcLayoutConstraint_->ClearSelfIdealSize(clearWidth, clearHeight)) {
-            propertyChangeFlag_ = propertyChangeFlag_ | PROPERTY_UPDATE_MEASURE;
+        const auto& selfIdealSize = calcLayoutConstraint->selfIdealSize;
+        bool changed = (clearWidth && selfIdealSize->Width().has_value()) ||
+                       (clearHeight && selfIdealSize->Height().has_value());
+        if (!changed) {
+            return;
         }
+        GetOrCreateCalcLayoutConstraint()->ClearSelfIdealSize(clearWidth, clearHeight);
+        propertyChangeFlag_ = propertyChangeFlag_ | PROPERTY_UPDATE_MEASURE;
     }
 
     void UpdateCalcMinSize(const CalcSize& value)
     {
-        if (!calcLayoutConstraint_) {
-            calcLayoutConstraint_ = std::make_unique<MeasureProperty>();
-        }
-        if (calcLayoutConstraint_->UpdateMinSizeWithCheck(value)) {
+        auto changed = UpdateGroupWithCheck<CALC_LAYOUT_CONSTRAINT_GROUP>(
+            [&value](MeasureProperty& group) { return group.UpdateMinSizeWithCheck(value); });
+        if (changed) {
             propertyChangeFlag_ = propertyChangeFlag_ | PROPERTY_UPDATE_MEASURE;
         }
     }
 
     void UpdateCalcMaxSize(const CalcSize& value)
     {
-        if (!calcLayoutConstraint_) {
-            calcLayoutConstraint_ = std::make_unique<MeasureProperty>();
-        }
-        if (calcLayoutConstraint_->UpdateMaxSizeWithCheck(value)) {
+        auto changed = UpdateGroupWithCheck<CALC_LAYOUT_CONSTRAINT_GROUP>(
+            [&value](MeasureProperty& group) { return group.UpdateMaxSizeWithCheck(value); });
+        if (changed) {
             propertyChangeFlag_ = propertyChangeFlag_ | PROPERTY_UPDATE_MEASURE;
         }
     }
@@ -273,62 +268,62 @@ public:
 
     void UpdateFlexGrow(float flexGrow)
     {
-        if (!flexItemProperty_) {
-            flexItemProperty_ = std::make_unique<FlexItemProperty>();
-        }
-        if (flexItemProperty_->UpdateFlexGrow(flexGrow)) {
-            propertyChangeFlag_ = propertyChangeFlag_ | PROPERTY_UPDATE_MEASURE;
+        const auto* flexItem = GetFlexItemProperty();
+        if (flexItem && flexItem->CheckFlexGrow(flexGrow)) {
+            return;
         }
+        GetOrCreateFlexItemProperty()->UpdateFlexGrow(flexGrow);
+        propertyChangeFlag_ = propertyChangeFlag_ | PROPERTY_UPDATE_MEASURE;
     }
 
     void UpdateFlexShrink(float flexShrink)
     {
-        if (!flexItemProperty_) {
-            flexItemProperty_ = std::make_unique<FlexItemProperty>();
-        }
-        if (flexItemProperty_->UpdateFlexShrink(flexShrink)) {
-            propertyChangeFlag_ = propertyChangeFlag_ | PROPERTY_UPDATE_MEASURE;
+        const auto* flexItem = GetFlexItemProperty();
+        if (flexItem && flexItem->CheckFlexShrink(flexShrink)) {
+            return;
         }
+        GetOrCreateFlexItemProperty()->UpdateFlexShrink(flexShrink);
+        propertyChangeFlag_ = propertyChangeFlag_ | PROPERTY_UPDATE_MEASURE;
     }
 
     void UpdateFlexBasis(const Dimension& flexBasis)
     {
-        if (!flexItemProperty_) {
-            flexItemProperty_ = std::make_unique<FlexItemProperty>();
-        }
-        if (flexItemProperty_->UpdateFlexBasis(flexBasis)) {
-            propertyChangeFlag_ = propertyChangeFlag_ | PROPERTY_UPDATE_MEASURE;
+        const auto* flexItem = GetFlexItemProperty();
+        if (flexItem && flexItem->CheckFlexBasis(flexBasis)) {
+            return;
         }
+        GetOrCreateFlexItemProperty()->UpdateFlexBasis(flexBasis);
+        propertyChangeFlag_ = propertyChangeFlag_ | PROPERTY_UPDATE_MEASURE;
     }
 
     void UpdateAlignSelf(const FlexAlign& flexAlign)
     {
-        if (!flexItemProperty_) {
-            flexItemProperty_ = std::make_unique<FlexItemProperty>();
-        }
-        if (flexItemProperty_->UpdateAlignSelf(flexAlign)) {
-            propertyChangeFlag_ = propertyChangeFlag_ | PROPERTY_UPDATE_MEASURE;
+        const auto* flexItem = GetFlexItemProperty();
+        if (flexItem && flexItem->CheckAlignSelf(flexAlign)) {
+            return;
         }
+        GetOrCreateFlexItemProperty()->UpdateAlignSelf(flexAlign);
+        propertyChangeFlag_ = propertyChangeFlag_ | PROPERTY_UPDATE_MEASURE;
     }
 
     void UpdateAlignRules(const std::map<AlignDirection, AlignRule>& alignRules)
     {
-        if (!flexItemProperty_) {
-            flexItemProperty_ = std::make_unique<FlexItemProperty>();
-        }
-        if (flexItemProperty_->UpdateAlignRules(alignRules)) {
-            propertyChangeFlag_ = propertyChangeFlag_ | PROPERTY_UPDATE_MEASURE;
+        const auto* flexItem = GetFlexItemProperty();
+        if (flexItem && flexItem->CheckAlignRules(alignRules)) {
+            return;
         }
+        GetOrCreateFlexItemProperty()->UpdateAlignRules(alignRules);
+        propertyChangeFlag_ = propertyChangeFlag_ | PROPERTY_UPDATE_MEASURE;
     }
 
     void UpdateDisplayIndex(int32_t displayIndex)
     {
-        if (!flexItemProperty_) {
-            flexItemProperty_ = std::make_unique<FlexItemProperty>();
-        }
-        if (flexItemProperty_->UpdateDisplayIndex(displayIndex)) {
-            propertyChangeFlag_ = propertyChangeFlag_ | PROPERTY_UPDATE_MEASURE;
+        const auto* flexItem = GetFlexItemProperty();
+        if (flexItem && flexItem->CheckDisplayIndex(displayIndex)) {
+            return;
         }
+        GetOrCreateFlexItemProperty()->UpdateDisplayIndex(displayIndex);
+        propertyChangeFlag_ = propertyChangeFlag_ | PROPERTY_UPDATE_MEASURE;
     }
 
     void UpdateGridProperty(
@@ -338,6 +333,11 @@ public:
 
     void BuildGridProperty(const RefPtr<FrameNode>& host);
 
+    bool HasGridProperty() const
+    {
+        return gridProperty_ != nullptr;
+    }
+
     void UpdateContentConstraint();
 
     LayoutConstraintF CreateChildConstraint() const;
@@ -416,17 +416,25 @@ private:
     void CheckAspectRatio();
     void CheckBorderAndPadding();
 
+    // Runs [update] on a copy of the group and stores the copy only when it changed, so an update to the same value
+    // neither creates the group nor detaches the groups shared with the clones of the property.
+    template<size_t I, typename Update>
+    bool UpdateGroupWithCheck(const Update& update)
+    {
+        const auto* group = groups_.Get<I>();
+        auto updated = group ? *group : typename LayoutPropertyGroups::template GroupType<I>();
+        if (!update(updated)) {
+            return false;
+        }
+        *groups_.GetOrCreate<I>() = std::move(updated);
+        return true;
+    }
+
     // available in measure process.
     std::optional<LayoutConstraintF> layoutConstraint_;
     std::optional<LayoutConstraintF> contentConstraint_;
 
-    std::unique_ptr<MeasureProperty> calcLayoutConstraint_;
-    std::unique_ptr<PaddingProperty> padding_;
-    std::unique_ptr<MarginProperty> margin_;
-    std::unique_ptr<BorderWidthProperty> borderWidth_;
-    std::unique_ptr<MagicItemProperty> magicItemProperty_;
-    std::unique_ptr<PositionProperty> positionProperty_;
-    std::unique_ptr<FlexItemProperty> flexItemProperty_;
+    LayoutPropertyGroups groups_;
     std::unique_ptr<GridProperty> gridProperty_;
     std::optional<MeasureType> measureType_;
     std::optional<TextDirection> layoutDirection_;
@@ -16,11 +16,17 @@
 #include "core/components_ng/layout/layout_wrapper.h"
 
 #include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
 
 #include "base/log/ace_trace.h"
 #include "base/memory/ace_type.h"
+#include "base/thread/task_executor.h"
 #include "base/utils/system_properties.h"
 #include "base/utils/utils.h"
+#include "core/common/container.h"
 #include "core/components/common/layout/constants.h"
 #include "core/components_ng/base/frame_node.h"
 #include "core/components_ng/layout/layout_wrapper_builder.h"
@@ -31,6 +37,85 @@
 #include "core/pipeline_ng/ui_task_scheduler.h"
 
 namespace OHOS::Ace::NG {
+namespace {
+// flex and relative layouts measure a child with alternating constraints, e.g. before and after distributing the
+// remaining space, keeping a few results covers them.
+constexpr size_t MEASURE_CACHE_SIZE = 3;
+
+std::atomic<uint64_t> g_measureCount { 0 };
+std::atomic<uint64_t> g_unchangedSkipCount { 0 };
+std::atomic<uint64_t> g_cacheHitCount { 0 };
+
+// a subtree below this size measures faster on the calling thread than it takes to hand it to a worker.
+constexpr int32_t DEFAULT_PARALLEL_MEASURE_MIN_NODE_COUNT = 32;
+
+std::atomic<bool> g_parallelMeasureEnabled { false };
+std::atomic<int32_t> g_parallelMeasureMinNodeCount { DEFAULT_PARALLEL_MEASURE_MIN_NODE_COUNT };
+std::atomic<uint64_t> g_parallelDispatchCount { 0 };
+std::atomic<uint64_t> g_parallelWorkerCount { 0 };
+// set while the thread measures the subtrees of a batch, the frame nodes and the pipeline must not be read then.
+thread_local bool g_isMeasuringInParallel = false;
+
+// Subtrees measured by the workers and the calling thread together, each takes the next subtree until none is left.
+class ParallelMeasureBatch {
+public:
+    ParallelMeasureBatch(std::vector<std::pair<RefPtr<LayoutWrapper>, LayoutConstraintF>>&& subtrees, int32_t instanceId)
+        : subtrees_(std::move(subtrees)), size_(subtrees_.size()), instanceId_(instanceId)
+    {}
+    ~ParallelMeasureBatch() = default;
+
+    // returns the number of subtrees measured by this call.
+    size_t Run()
+    {
+        ContainerScope scope(instanceId_);
+        size_t count = 0;
+        // a worker of the task executor may be inside a batch of its own, keep its state.
+        auto wasMeasuringInParallel = g_isMeasuringInParallel;
+        g_isMeasuringInParallel = true;
+        for (auto index = next_.fetch_add(1); index < size_; index = next_.fetch_add(1)) {
+            const auto& [wrapper, constraint] = subtrees_[index];
+            wrapper->Measure(constraint);
+            ++count;
+        }
+        g_isMeasuringInParallel = wasMeasuringInParallel;
+        if (count > 0) {
+            std::scoped_lock<std::mutex> lock(mutex_);
+            finishedCount_ += count;
+            if (finishedCount_ == size_) {
+                finished_.notify_all();
+            }
+        }
+        return count;
+    }
+
+    void Wait()
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        finished_.wait(lock, [this] { return finishedCount_ == size_; });
+    }
+
+    // workers starting after the batch finished do not touch the subtrees, the wrappers are released on the caller.
+    void Clear()
+    {
+        subtrees_.clear();
+    }
+
+    size_t GetSize() const
+    {
+        return size_;
+    }
+
+private:
+    std::vector<std::pair<RefPtr<LayoutWrapper>, LayoutConstraintF>> subtrees_;
+    const size_t size_ = 0;
+    int32_t instanceId_ = -1;
+    std::atomic<size_t> next_ { 0 };
+    std::mutex mutex_;
+    std::condition_variable finished_;
+    size_t finishedCount_ = 0;
+};
+} // namespace
+
 RefPtr<LayoutWrapper> LayoutWrapper::GetOrCreateChildByIndex(int32_t index, bool addToRenderTree)
 {
     if ((index >= currentChildCount_) || (index < 0)) {
@@ -198,6 +283,13 @@ void LayoutWrapper::Measure(const std::optional<LayoutConstraintF>& parentConstr
     LOGD("Measure: %{public}s, depth: %{public}d, Constraint: %{public}s", host->GetTag().c_str(), host->GetDepth(),
         layoutProperty_->GetLayoutConstraint()->ToString().c_str());
 
+    // the node has been measured in this layout pass, reuse the result of the same constraint.
+    bool useMeasureCache = parentConstraint && CanUseMeasureCache();
+    if (useMeasureCache && RestoreMeasureResult(parentConstraint.value())) {
+        LOGD("%{public}s (depth: %{public}d) reuse measure result", host->GetTag().c_str(), host->GetDepth());
+        return;
+    }
+
     if (isConstraintNotChanged_ && !skipMeasureContent_) {
         if (!CheckNeedForceMeasureAndLayout()) {
             LOGD("%{public}s (depth: %{public}d) skip measure content", host->GetTag().c_str(), host->GetDepth());
@@ -206,7 +298,11 @@ void LayoutWrapper::Measure(const std::optional<LayoutConstraintF>& parentConstr
     }
 
     if (!skipMeasureContent_.value_or(false)) {
+        if (useMeasureCache) {
+            PrepareRemeasure();
+        }
         skipMeasureContent_ = false;
+        g_measureCount.fetch_add(1, std::memory_order_relaxed);
         auto size = layoutAlgorithm_->MeasureContent(layoutProperty_->CreateContentConstraint(), this);
         if (size.has_value()) {
             geometryNode_->SetContentSize(size.value());
@@ -225,6 +321,11 @@ void LayoutWrapper::Measure(const std::optional<LayoutConstraintF>& parentConstr
             LOGD("aspect ratio affects, new width: %{public}f, height: %{public}f", width, height);
             geometryNode_->SetFrameSize(SizeF({ width, height }));
         }
+        // the result is only saved to the measure cache when the node is measured with another constraint.
+        measuredConstraint_ = parentConstraint;
+        measureCacheFlag_ = layoutProperty_->GetPropertyChangeFlag();
+    } else {
+        g_unchangedSkipCount.fetch_add(1, std::memory_order_relaxed);
     }
 
     LOGD("on Measure Done: type: %{public}s, depth: %{public}d, Size: %{public}s", host->GetTag().c_str(),
@@ -296,6 +397,258 @@ CheckNodeMap LayoutWrapper::GetChildrenFlexLayouts(
     return nodeMap;
 }
 
+bool LayoutWrapper::CanUseMeasureCache() const
+{
+    // lazily built children and geometry transitions change the children between two measures.
+    return (skipMeasureContent_ == false) && !layoutWrapperBuilder_ && !lazyBuildFunction_ &&
+           !layoutProperty_->GetGeometryTransition();
+}
+
+bool LayoutWrapper::RestoreMeasureResult(const LayoutConstraintF& constraint)
+{
+    if (layoutProperty_->GetPropertyChangeFlag() != measureCacheFlag_) {
+        // the properties have been updated during the layout, the results are out of date.
+        InvalidateMeasureCache();
+        return false;
+    }
+    if (measuredConstraint_ == constraint) {
+        // the node and its children still hold the result of the constraint.
+        g_cacheHitCount.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+    auto iter = std::find_if(measureCache_.begin(), measureCache_.end(),
+        [&constraint](const MeasureCacheEntry& entry) { return entry.constraint == constraint; });
+    if (iter == measureCache_.end()) {
+        return false;
+    }
+    // keep the result the node holds before it is replaced, the entry is moved to the front first so that saving
+    // doesn't drop it.
+    measureCache_.splice(measureCache_.begin(), measureCache_, iter);
+    SaveMeasureResult();
+    measureCache_.splice(measureCache_.begin(), measureCache_, iter);
+    const auto& entry = measureCache_.front();
+    for (const auto& child : entry.children) {
+        // children measured with other constraints since then get their results back from their own cache.
+        if (child.constraint && child.wrapper->measuredConstraint_ != child.constraint) {
+            child.wrapper->Measure(child.constraint);
+        }
+        child.wrapper->geometryNode_ = child.geometryNode->Clone();
+    }
+    geometryNode_ = entry.geometryNode->Clone();
+    layoutAlgorithm_->SetLayoutAlgorithm(entry.layoutAlgorithm);
+    measuredConstraint_ = constraint;
+    g_cacheHitCount.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+void LayoutWrapper::PrepareRemeasure()
+{
+    // measure with a new algorithm so that the cached results keep theirs.
+    const auto& layoutAlgorithm = layoutAlgorithm_->GetLayoutAlgorithm();
+    auto remeasureAlgorithm = layoutAlgorithm ? layoutAlgorithm->CreateRemeasureAlgorithm() : nullptr;
+    if (!remeasureAlgorithm) {
+        // the algorithm state can't be kept apart, the result the node holds is overwritten without saving it.
+        InvalidateMeasureCache();
+        return;
+    }
+    if (layoutProperty_->GetPropertyChangeFlag() == measureCacheFlag_) {
+        SaveMeasureResult();
+    }
+    layoutAlgorithm_->SetLayoutAlgorithm(remeasureAlgorithm);
+}
+
+void LayoutWrapper::SaveMeasureResult()
+{
+    if (!measuredConstraint_) {
+        return;
+    }
+    const auto& constraint = measuredConstraint_.value();
+    // a result restored from the cache is still there.
+    if (std::any_of(measureCache_.begin(), measureCache_.end(),
+            [&constraint](const MeasureCacheEntry& item) { return item.constraint == constraint; })) {
+        return;
+    }
+    MeasureCacheEntry entry { constraint, geometryNode_->Clone(), layoutAlgorithm_->GetLayoutAlgorithm(), {} };
+    entry.children.reserve(children_.size());
+    for (const auto& child : children_) {
+        entry.children.push_back({ child, child->measuredConstraint_, child->geometryNode_->Clone() });
+    }
+    measureCache_.emplace_front(std::move(entry));
+    if (measureCache_.size() > MEASURE_CACHE_SIZE) {
+        measureCache_.pop_back();
+    }
+}
+
+void LayoutWrapper::InvalidateMeasureCache()
+{
+    measureCache_.clear();
+}
+
+MeasureCacheStats LayoutWrapper::GetMeasureCacheStats()
+{
+    MeasureCacheStats stats;
+    stats.measureCount = g_measureCount.load(std::memory_order_relaxed);
+    stats.unchangedSkipCount = g_unchangedSkipCount.load(std::memory_order_relaxed);
+    stats.cacheHitCount = g_cacheHitCount.load(std::memory_order_relaxed);
+    return stats;
+}
+
+void LayoutWrapper::ResetMeasureCacheStats()
+{
+    g_measureCount.store(0, std::memory_order_relaxed);
+    g_unchangedSkipCount.store(0, std::memory_order_relaxed);
+    g_cacheHitCount.store(0, std::memory_order_relaxed);
+}
+
+int32_t LayoutWrapper::GetParallelMeasureNodeCount() const
+{
+    // lazily built children are created on the main thread.
+    if (layoutWrapperBuilder_ || lazyBuildFunction_ || !layoutProperty_ || !geometryNode_ || !layoutAlgorithm_) {
+        return 0;
+    }
+    if (layoutProperty_->GetGeometryTransition() || layoutProperty_->HasGridProperty()) {
+        return 0;
+    }
+    if (layoutAlgorithm_->SkipMeasure()) {
+        return 1;
+    }
+    const auto& layoutAlgorithm = layoutAlgorithm_->GetLayoutAlgorithm();
+    if (layoutAlgorithm && !layoutAlgorithm->CanMeasureInParallel()) {
+        return 0;
+    }
+    int32_t nodeCount = 1;
+    for (const auto& child : children_) {
+        auto childCount = child->GetParallelMeasureNodeCount();
+        if (childCount == 0) {
+            return 0;
+        }
+        nodeCount += childCount;
+    }
+    return nodeCount;
+}
+
+int32_t LayoutWrapper::MeasureSubtreesInParallel(
+    const std::vector<std::pair<RefPtr<LayoutWrapper>, LayoutConstraintF>>& subtrees)
+{
+    // subtrees of a subtree being measured in parallel are measured by its thread, dispatching them again could
+    // wait on workers busy with the outer batch.
+    if (!IsParallelMeasureEnabled() || IsMeasuringInParallel()) {
+        return 0;
+    }
+    auto minNodeCount = g_parallelMeasureMinNodeCount.load(std::memory_order_relaxed);
+    std::vector<std::pair<RefPtr<LayoutWrapper>, LayoutConstraintF>> selected;
+    for (const auto& subtree : subtrees) {
+        if (subtree.first && subtree.first->GetParallelMeasureNodeCount() >= minNodeCount &&
+            subtree.first->PrepareParallelMeasure()) {
+            selected.emplace_back(subtree);
+        }
+    }
+    // a single subtree gains nothing from a worker.
+    if (selected.size() < 2) {
+        return 0;
+    }
+    auto batch = std::make_shared<ParallelMeasureBatch>(std::move(selected), Container::CurrentId());
+    g_parallelDispatchCount.fetch_add(batch->GetSize(), std::memory_order_relaxed);
+    auto pipeline = PipelineContext::GetCurrentContext();
+    auto taskExecutor = pipeline ? pipeline->GetTaskExecutor() : nullptr;
+    if (taskExecutor) {
+        // the calling thread measures too, one worker less.
+        auto workerCount = std::min<size_t>(batch->GetSize(), std::max(std::thread::hardware_concurrency(), 1u)) - 1;
+        for (size_t i = 0; i < workerCount; ++i) {
+            taskExecutor->PostTask(
+                [batch]() {
+                    ACE_SCOPED_TRACE("LayoutWrapper::ParallelMeasure");
+                    g_parallelWorkerCount.fetch_add(batch->Run(), std::memory_order_relaxed);
+                },
+                TaskExecutor::TaskType::BACKGROUND);
+        }
+    }
+    // subtrees the workers have not taken yet are measured here, so the batch finishes even without free workers.
+    batch->Run();
+    batch->Wait();
+    batch->Clear();
+    return static_cast<int32_t>(batch->GetSize());
+}
+
+bool LayoutWrapper::PrepareParallelMeasure()
+{
+    auto pipeline = PipelineBase::GetCurrentContext();
+    return PrepareParallelMeasure(pipeline && pipeline->GetIsAppWindow() && pipeline->GetIsLayoutFullScreen());
+}
+
+bool LayoutWrapper::PrepareParallelMeasure(bool isLayoutFullScreenWindow)
+{
+    auto host = GetHostNode();
+    CHECK_NULL_RETURN(host, false);
+    CHECK_NULL_RETURN(layoutAlgorithm_, false);
+    parallelMeasureState_ = ParallelMeasureState { isLayoutFullScreenWindow, host->IsAtomicNode() };
+    if (layoutAlgorithm_->SkipMeasure()) {
+        return true;
+    }
+    const auto& layoutAlgorithm = layoutAlgorithm_->GetLayoutAlgorithm();
+    if (layoutAlgorithm && !layoutAlgorithm->PrepareParallelMeasure(this)) {
+        return false;
+    }
+    return std::all_of(children_.begin(), children_.end(), [isLayoutFullScreenWindow](const auto& child) {
+        return child->PrepareParallelMeasure(isLayoutFullScreenWindow);
+    });
+}
+
+bool LayoutWrapper::IsMeasuringInParallel()
+{
+    return g_isMeasuringInParallel;
+}
+
+bool LayoutWrapper::IsLayoutFullScreenWindow() const
+{
+    if (parallelMeasureState_) {
+        return parallelMeasureState_->isLayoutFullScreenWindow;
+    }
+    // a subtree measured by a worker has been prepared.
+    ACE_DCHECK(!IsMeasuringInParallel());
+    auto pipeline = PipelineBase::GetCurrentContext();
+    return pipeline && pipeline->GetIsAppWindow() && pipeline->GetIsLayoutFullScreen();
+}
+
+bool LayoutWrapper::IsHostAtomicNode() const
+{
+    if (parallelMeasureState_) {
+        return parallelMeasureState_->isAtomicNode;
+    }
+    ACE_DCHECK(!IsMeasuringInParallel());
+    auto host = GetHostNode();
+    return host && host->IsAtomicNode();
+}
+
+void LayoutWrapper::SetParallelMeasureEnabled(bool enabled)
+{
+    g_parallelMeasureEnabled.store(enabled, std::memory_order_relaxed);
+}
+
+bool LayoutWrapper::IsParallelMeasureEnabled()
+{
+    return g_parallelMeasureEnabled.load(std::memory_order_relaxed);
+}
+
+void LayoutWrapper::SetParallelMeasureMinNodeCount(int32_t nodeCount)
+{
+    g_parallelMeasureMinNodeCount.store(std::max(nodeCount, 1), std::memory_order_relaxed);
+}
+
+ParallelMeasureStats LayoutWrapper::GetParallelMeasureStats()
+{
+    ParallelMeasureStats stats;
+    stats.dispatchCount = g_parallelDispatchCount.load(std::memory_order_relaxed);
+    stats.workerCount = g_parallelWorkerCount.load(std::memory_order_relaxed);
+    return stats;
+}
+
+void LayoutWrapper::ResetParallelMeasureStats()
+{
+    g_parallelDispatchCount.store(0, std::memory_order_relaxed);
+    g_parallelWorkerCount.store(0, std::memory_order_relaxed);
+}
+
 bool LayoutWrapper::SkipMeasureContent() const
 {
     return (skipMeasureContent_ == true) || layoutAlgorithm_->SkipMeasure();
@@ -16,10 +16,12 @@
 #ifndef FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_LAYOUTS_LAYOUT_WRAPPER_H
 #define FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_LAYOUTS_LAYOUT_WRAPPER_H
 
+#include <list>
 #include <map>
 #include <optional>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include "base/geometry/offset.h"
 #include "base/log/ace_performance_check.h"
@@ -46,6 +48,27 @@ class FrameNode;
 
 using LazyBuildFunction = std::function<void(RefPtr<LayoutWrapper>)>;
 
+struct MeasureCacheStats {
+    // measures run by the layout algorithms.
+    uint64_t measureCount = 0;
+    // measures skipped as neither the constraint nor the properties changed since the last layout.
+    uint64_t unchangedSkipCount = 0;
+    // measures skipped as the node was already measured with the constraint in this layout pass.
+    uint64_t cacheHitCount = 0;
+
+    uint64_t GetSkipCount() const
+    {
+        return unchangedSkipCount + cacheHitCount;
+    }
+};
+
+struct ParallelMeasureStats {
+    // subtrees handed to MeasureSubtreesInParallel which qualified for the workers.
+    uint64_t dispatchCount = 0;
+    // the part of them measured by background workers, the calling thread measures the rest.
+    uint64_t workerCount = 0;
+};
+
 class ACE_EXPORT LayoutWrapper : public AceType {
     DECLARE_ACE_TYPE(LayoutWrapper, AceType)
 public:
@@ -64,6 +87,8 @@ public:
         hostNode_ = std::move(hostNode);
         geometryNode_ = std::move(geometryNode);
         layoutProperty_ = std::move(layoutProperty);
+        InvalidateMeasureCache();
+        parallelMeasureState_.reset();
     }
 
     void AppendChild(const RefPtr<LayoutWrapper>& child)
@@ -182,6 +207,47 @@ public:
         return isConstraintNotChanged_;
     }
 
+    // Drop the results kept for the constraints this node was measured with in the current layout pass.
+    void InvalidateMeasureCache();
+
+    size_t GetMeasureCacheSize() const
+    {
+        return measureCache_.size();
+    }
+
+    static MeasureCacheStats GetMeasureCacheStats();
+    static void ResetMeasureCacheStats();
+
+    // Node count of the subtree when its layout algorithms can measure on a background worker, 0 otherwise.
+    int32_t GetParallelMeasureNodeCount() const;
+
+    // Copy what the subtree reads from its frame nodes and the pipeline while measuring to the layout wrappers and
+    // their algorithms, on the main thread. Workers don't access the frame nodes and the pipeline, which the main
+    // thread may change. Returns false when a layout algorithm needs the subtree to be measured on the main thread.
+    bool PrepareParallelMeasure();
+
+    // Whether the calling thread is measuring a subtree handed to MeasureSubtreesInParallel.
+    static bool IsMeasuringInParallel();
+
+    // Whether the window lays out under the system bars, the constraints are then reduced by the safe area.
+    bool IsLayoutFullScreenWindow() const;
+    bool IsHostAtomicNode() const;
+
+    // Measure the subtrees of at least the minimum node count which can measure on background workers, the calling
+    // thread takes part and returns once all of them are measured. Results only go to the layout wrappers, the
+    // frame nodes get them when the wrappers are swapped on the main thread. Subtrees which don't qualify or fail
+    // PrepareParallelMeasure are left to the caller.
+    // Returns the number of subtrees measured.
+    static int32_t MeasureSubtreesInParallel(
+        const std::vector<std::pair<RefPtr<LayoutWrapper>, LayoutConstraintF>>& subtrees);
+
+    // Parallel measure is opt-in, disabled by default.
+    static void SetParallelMeasureEnabled(bool enabled);
+    static bool IsParallelMeasureEnabled();
+    static void SetParallelMeasureMinNodeCount(int32_t nodeCount);
+    static ParallelMeasureStats GetParallelMeasureStats();
+    static void ResetParallelMeasureStats();
+
     // dirty layoutBox mount to host and switch layoutBox.
     // Notice: only the cached layoutWrapper (after call GetChildLayoutWrapper) will update the host.
     void MountToHostOnMainThread();
@@ -236,6 +302,35 @@ public:
     std::pair<int32_t, int32_t> GetLazyBuildRange();
 
 private:
+    struct ChildMeasureResult {
+        RefPtr<LayoutWrapper> wrapper;
+        std::optional<LayoutConstraintF> constraint;
+        RefPtr<GeometryNode> geometryNode;
+    };
+
+    // The result of measuring the node with a parent constraint, with the algorithm holding the state for the
+    // layout and the results of the children, which later measures with other constraints overwrite.
+    struct MeasureCacheEntry {
+        LayoutConstraintF constraint;
+        RefPtr<GeometryNode> geometryNode;
+        RefPtr<LayoutAlgorithm> layoutAlgorithm;
+        std::vector<ChildMeasureResult> children;
+    };
+
+    // state of the frame node and the pipeline copied by PrepareParallelMeasure.
+    struct ParallelMeasureState {
+        bool isLayoutFullScreenWindow = false;
+        bool isAtomicNode = false;
+    };
+
+    bool PrepareParallelMeasure(bool isLayoutFullScreenWindow);
+
+    bool CanUseMeasureCache() const;
+    bool RestoreMeasureResult(const LayoutConstraintF& constraint);
+    void PrepareRemeasure();
+    // saves the result the node holds, before a measure or restore with another constraint overwrites it.
+    void SaveMeasureResult();
+
     // Used to save a persist wrapper created by child, ifElse, ForEach, the map stores [index, Wrapper].
     std::list<RefPtr<LayoutWrapper>> children_;
     // Speed up the speed of getting child by index.
@@ -259,6 +354,15 @@ private:
     std::optional<bool> skipMeasureContent_;
     std::optional<bool> needForceMeasureAndLayout_;
 
+    // results of the constraints the node was measured with before, most recently used first.
+    std::list<MeasureCacheEntry> measureCache_;
+    // the parent constraint of the result the node holds.
+    std::optional<LayoutConstraintF> measuredConstraint_;
+    // the property change flags of the node when it was measured.
+    PropertyChangeFlag measureCacheFlag_ = PROPERTY_UPDATE_NORMAL;
+
+    std::optional<ParallelMeasureState> parallelMeasureState_;
+
     LazyBuildFunction lazyBuildFunction_;
 
     // performance check
@@ -207,7 +207,9 @@ bool SharedTransitionExchange::CreateSizeAnimation(const RefPtr<FrameNode>& src,
         auto src = weakFrame.Upgrade();
         CHECK_NULL_VOID(src);
         if (src->GetLayoutProperty()->GetCalcLayoutConstraint()) {
-            src->GetLayoutProperty()->GetCalcLayoutConstraint()->selfIdealSize = initSize;
+            auto calcLayoutConstraint = *src->GetLayoutProperty()->GetCalcLayoutConstraint();
+            calcLayoutConstraint.selfIdealSize = initSize;
+            src->GetLayoutProperty()->UpdateCalcLayoutProperty(calcLayoutConstraint);
         }
         if (initAspectRatio.has_value()) {
             src->GetLayoutProperty()->UpdateAspectRatio(initAspectRatio.value());
@@ -55,7 +55,7 @@ void CheckBoxPattern::OnModifyDone()
     margin.right = CalcLength(checkBoxTheme->GetHotZoneHorizontalPadding().Value());
     margin.top = CalcLength(checkBoxTheme->GetHotZoneVerticalPadding().Value());
     margin.bottom = CalcLength(checkBoxTheme->GetHotZoneVerticalPadding().Value());
-    auto& setMargin = layoutProperty->GetMarginProperty();
+    const auto& setMargin = layoutProperty->GetMarginProperty();
     if (setMargin) {
         if (setMargin->left.has_value()) {
             margin.left = setMargin->left;
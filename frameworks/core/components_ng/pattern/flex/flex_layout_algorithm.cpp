@@ -17,6 +17,7 @@
 
 #include <algorithm>
 #include <iterator>
+#include <vector>
 
 #include "base/geometry/axis.h"
 #include "base/geometry/dimension.h"
@@ -139,6 +140,14 @@ float GetMainAxisMargin(const RefPtr<LayoutWrapper>& child, FlexDirection direct
     return childMainAxisMargin;
 }
 
+// the layout property of the layout wrapper is a copy of the node's, the node isn't read so that the flex can be
+// measured on a background worker.
+bool IsVisibleGone(const RefPtr<LayoutWrapper>& layoutWrapper)
+{
+    return layoutWrapper && layoutWrapper->GetLayoutProperty() &&
+           layoutWrapper->GetLayoutProperty()->GetVisibilityValue(VisibleType::VISIBLE) == VisibleType::GONE;
+}
+
 } // namespace
 
 float FlexLayoutAlgorithm::GetChildMainAxisSize(const RefPtr<LayoutWrapper>& layoutWrapper) const
@@ -162,9 +171,7 @@ float FlexLayoutAlgorithm::GetSelfCrossAxisSize(const RefPtr<LayoutWrapper>& lay
 
 void FlexLayoutAlgorithm::CheckSizeValidity(const RefPtr<LayoutWrapper>& layoutWrapper)
 {
-    if (layoutWrapper && layoutWrapper->GetHostNode() &&
-        layoutWrapper->GetHostNode()->GetLayoutProperty()->GetVisibilityValue(VisibleType::VISIBLE) ==
-            VisibleType::GONE) {
+    if (IsVisibleGone(layoutWrapper)) {
         return;
     }
     ++validSizeCount_;
@@ -256,8 +263,7 @@ void FlexLayoutAlgorithm::TravelChildrenFlexProps(LayoutWrapper* layoutWrapper,
         node.layoutWrapper = child;
         node.layoutConstraint = childLayoutConstraint;
 
-        if (child && child->GetHostNode() && child->GetHostNode()->GetLayoutProperty() &&
-            child->GetHostNode()->GetLayoutProperty()->GetVisibilityValue(VisibleType::VISIBLE) == VisibleType::GONE) {
+        if (IsVisibleGone(child)) {
             node.layoutConstraint.selfIdealSize = OptionalSize<float>(0.0f, 0.0f);
             continue;
         }
@@ -335,10 +341,7 @@ void FlexLayoutAlgorithm::MeasureAndCleanMagicNodes(FlexItemProperties& flexItem
                         childLayoutWeight = childMagicItemProperty->GetLayoutWeight().value_or(0.0f);
                     }
                     if (LessOrEqual(childLayoutWeight, 0.0f)) {
-                        if (child.layoutWrapper && child.layoutWrapper->GetHostNode() &&
-                            child.layoutWrapper->GetHostNode()->GetLayoutProperty() &&
-                            child.layoutWrapper->GetHostNode()->GetLayoutProperty()->GetVisibilityValue(
-                                VisibleType::VISIBLE) == VisibleType::GONE) {
+                        if (IsVisibleGone(child.layoutWrapper)) {
                             continue;
                         }
                         childLayoutWrapper->Measure(child.layoutConstraint);
@@ -493,6 +496,9 @@ void FlexLayoutAlgorithm::MeasureAndCleanMagicNodes(FlexItemProperties& flexItem
             ++iter;
         }
     } else {
+        if (LayoutWrapper::IsParallelMeasureEnabled()) {
+            MeasureChildrenInParallel();
+        }
         auto iter = magicNodes_.rbegin();
         while (iter != magicNodes_.rend()) {
             auto childList = iter->second;
@@ -501,10 +507,7 @@ void FlexLayoutAlgorithm::MeasureAndCleanMagicNodes(FlexItemProperties& flexItem
                 UpdateChildLayoutConstrainByFlexBasis(direction_, childLayoutWrapper, child.layoutConstraint);
                 childLayoutWrapper->Measure(child.layoutConstraint);
                 UpdateAllocatedSize(childLayoutWrapper, crossAxisSize_);
-                if (child.layoutWrapper && child.layoutWrapper->GetHostNode() &&
-                    child.layoutWrapper->GetHostNode()->GetLayoutProperty() &&
-                    child.layoutWrapper->GetHostNode()->GetLayoutProperty()->GetVisibilityValue(VisibleType::VISIBLE) ==
-                        VisibleType::GONE) {
+                if (IsVisibleGone(child.layoutWrapper)) {
                     continue;
                 }
                 CheckSizeValidity(childLayoutWrapper);
@@ -530,6 +533,21 @@ void FlexLayoutAlgorithm::MeasureAndCleanMagicNodes(FlexItemProperties& flexItem
     }
 }
 
+void FlexLayoutAlgorithm::MeasureChildrenInParallel()
+{
+    // without weights and display priorities the children measure with constraints of their own, the large subtrees
+    // are measured on the workers first and the measure in order below reuses their results.
+    std::vector<std::pair<RefPtr<LayoutWrapper>, LayoutConstraintF>> subtrees;
+    for (const auto& [displayPriority, childList] : magicNodes_) {
+        for (const auto& child : childList) {
+            auto childLayoutConstraint = child.layoutConstraint;
+            UpdateChildLayoutConstrainByFlexBasis(direction_, child.layoutWrapper, childLayoutConstraint);
+            subtrees.emplace_back(child.layoutWrapper, childLayoutConstraint);
+        }
+    }
+    LayoutWrapper::MeasureSubtreesInParallel(subtrees);
+}
+
 void FlexLayoutAlgorithm::SecondaryMeasureByProperty(
     FlexItemProperties& flexItemProperties, LayoutWrapper* layoutWrapper)
 {
@@ -754,10 +772,7 @@ void FlexLayoutAlgorithm::AdjustTotalAllocatedSize(LayoutWrapper* layoutWrapper)
         allocatedSize_ = 0.0;
     }
     for (const auto& child : children) {
-        if (child->IsOutOfLayout() ||
-            (layoutWrapper && layoutWrapper->GetHostNode() && layoutWrapper->GetHostNode()->GetLayoutProperty() &&
-                child->GetHostNode()->GetLayoutProperty()->GetVisibilityValue(VisibleType::VISIBLE) ==
-                    VisibleType::GONE)) {
+        if (child->IsOutOfLayout() || IsVisibleGone(child)) {
             continue;
         }
         allocatedSize_ += GetChildMainAxisSize(child);
@@ -774,6 +789,22 @@ float FlexLayoutAlgorithm::GetStretchCrossAxisLimit() const
     return crossAxisLimit;
 }
 
+RefPtr<LayoutAlgorithm> FlexLayoutAlgorithm::CreateRemeasureAlgorithm() const
+{
+    // the algorithms deriving from flex layout may get inputs from their patterns.
+    if (AceType::TypeId(this) != AceType::TypeId<FlexLayoutAlgorithm>()) {
+        return nullptr;
+    }
+    auto layoutAlgorithm = MakeRefPtr<FlexLayoutAlgorithm>();
+    layoutAlgorithm->isLinearLayoutFeature_ = isLinearLayoutFeature_;
+    return layoutAlgorithm;
+}
+
+bool FlexLayoutAlgorithm::CanMeasureInParallel() const
+{
+    return AceType::TypeId(this) == AceType::TypeId<FlexLayoutAlgorithm>();
+}
+
 void FlexLayoutAlgorithm::Layout(LayoutWrapper* layoutWrapper)
 {
     const auto& children = layoutWrapper->GetAllChildrenWithBuild();
@@ -861,8 +892,7 @@ void FlexLayoutAlgorithm::PlaceChildren(
             child->Layout();
             continue;
         }
-        if (layoutWrapper && layoutWrapper->GetHostNode() && layoutWrapper->GetHostNode()->GetLayoutProperty() &&
-            child->GetHostNode()->GetLayoutProperty()->GetVisibilityValue(VisibleType::VISIBLE) == VisibleType::GONE) {
+        if (IsVisibleGone(child)) {
             continue;
         }
         auto alignItem = GetSelfAlign(child);
@@ -60,6 +60,10 @@ public:
 
     void Layout(LayoutWrapper* layoutWrapper) override;
 
+    RefPtr<LayoutAlgorithm> CreateRemeasureAlgorithm() const override;
+
+    bool CanMeasureInParallel() const override;
+
     void SetLinearLayoutFeature()
     {
         isLinearLayoutFeature_ = true;
@@ -81,6 +85,7 @@ private:
     float GetStretchCrossAxisLimit() const;
     void MeasureOutOfLayoutChildren(LayoutWrapper* layoutWrapper);
     void MeasureAndCleanMagicNodes(FlexItemProperties& flexItemProperties);
+    void MeasureChildrenInParallel();
     void SecondaryMeasureByProperty(FlexItemProperties& flexItemProperties, LayoutWrapper* layoutWrapper);
     void UpdateLayoutConstraintOnMainAxis(LayoutConstraintF& layoutConstraint, float size);
     void UpdateLayoutConstraintOnCrossAxis(LayoutConstraintF& layoutConstraint, float size);
@@ -584,7 +584,7 @@ void WrapLayoutAlgorithm::CalcFlexGrowLayout(
     CHECK_NULL_VOID(itemWrapper);
     auto layoutProperty = itemWrapper->GetLayoutProperty();
     CHECK_NULL_VOID(layoutProperty);
-    auto& flexItemProperty = layoutProperty->GetFlexItemProperty();
+    const auto& flexItemProperty = layoutProperty->GetFlexItemProperty();
     CHECK_NULL_VOID_NOLOG(flexItemProperty);
     auto layoutConstraint = layoutProperty->GetLayoutConstraint();
     if (!layoutConstraint.has_value()) {
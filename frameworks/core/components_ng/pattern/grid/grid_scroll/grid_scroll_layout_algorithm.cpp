@@ -247,7 +247,18 @@ void GridScrollLayoutAlgorithm::FillGridViewportAndMeasureChildren(
     UpdateGridLayoutInfo(layoutWrapper, mainSize);
     SkipForwardLines(mainSize, layoutWrapper);
     SkipBackwardLines(mainSize, layoutWrapper);
-    if (layoutWrapper->GetHostNode()->GetChildrenUpdated() != -1) {
+    auto updatedIndex = layoutWrapper->GetHostNode()->GetChildrenUpdated();
+    if (updatedIndex > gridLayoutInfo_.endIndex_ && gridLayoutInfo_.endIndex_ >= 0) {
+        // items in viewport are unchanged, only the lines after viewport are filled again.
+        LOGI("data reload after viewport, updatedIndex:%{public}d, endIndex_:%{public}d", updatedIndex,
+            gridLayoutInfo_.endIndex_);
+        auto& gridMatrix = gridLayoutInfo_.gridMatrix_;
+        gridMatrix.erase(gridMatrix.upper_bound(gridLayoutInfo_.endMainLineIndex_), gridMatrix.end());
+        auto& lineHeightMap = gridLayoutInfo_.lineHeightMap_;
+        lineHeightMap.erase(lineHeightMap.upper_bound(gridLayoutInfo_.endMainLineIndex_), lineHeightMap.end());
+        gridLayoutInfo_.reachEnd_ = false;
+        gridLayoutInfo_.offsetEnd_ = false;
+    } else if (updatedIndex != -1) {
         gridLayoutInfo_.lineHeightMap_.clear();
         gridLayoutInfo_.gridMatrix_.clear();
         gridLayoutInfo_.endIndex_ = -1;
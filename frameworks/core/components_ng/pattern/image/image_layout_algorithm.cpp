@@ -26,7 +26,7 @@ namespace OHOS::Ace::NG {
 namespace {
 // returns maximum size of image component
 // if maxSize is infinite, match screen size and retain aspectRatio
-SizeF GetMaxSize(const SizeF& maxSize, float aspectRatio)
+SizeF GetMaxSize(const SizeF& maxSize, float aspectRatio, float rootWidth)
 {
     if (NearZero(aspectRatio)) {
         return SizeF(0.0, 0.0);
@@ -35,8 +35,7 @@ SizeF GetMaxSize(const SizeF& maxSize, float aspectRatio)
     bool infWidth = GreaterOrEqualToInfinity(maxSize.Width());
     bool infHeight = GreaterOrEqualToInfinity(maxSize.Height());
     if (infWidth && infHeight) {
-        auto width = PipelineContext::GetCurrentRootWidth();
-        return SizeF(width, width / aspectRatio);
+        return SizeF(rootWidth, rootWidth / aspectRatio);
     }
     if (infWidth) {
         return SizeF(maxSize.Height() * aspectRatio, maxSize.Height());
@@ -58,13 +57,11 @@ std::optional<SizeF> ImageLayoutAlgorithm::MeasureContent(
     // case 2: image component is not set with size, use image source size to determine component size
     // if image data and altImage are both not ready, can not decide content size,
     // return std::nullopt and wait for next layout task triggered by [OnImageDataReady]
-    if ((!loadingCtx_ || !loadingCtx_->GetImageSize().IsPositive()) &&
-        (!altLoadingCtx_ || !altLoadingCtx_->GetImageSize().IsPositive())) {
+    auto imageSize = parallelMeasureInputs_ ? parallelMeasureInputs_->imageSize : GetImageSize();
+    if (!imageSize) {
         return std::nullopt;
     }
-    // if image data is valid, use image source, or use altImage data
-    auto imageLoadingContext = loadingCtx_ ? loadingCtx_ : altLoadingCtx_;
-    auto rawImageSize = imageLoadingContext->GetImageSize();
+    auto rawImageSize = imageSize.value();
     SizeF size(rawImageSize);
     do {
         auto aspectRatio = static_cast<float>(Size::CalcRatio(rawImageSize));
@@ -79,7 +76,7 @@ std::optional<SizeF> ImageLayoutAlgorithm::MeasureContent(
         bool fitOriginalSize = props->GetFitOriginalSize().value_or(false);
         if (contentConstraint.selfIdealSize.IsNull()) {
             if (!fitOriginalSize) {
-                size.SetSizeT(GetMaxSize(contentConstraint.maxSize, aspectRatio));
+                size.SetSizeT(GetMaxSize(contentConstraint.maxSize, aspectRatio, GetRootWidth()));
             }
             break;
         }
@@ -105,6 +102,39 @@ std::optional<SizeF> ImageLayoutAlgorithm::MeasureContent(
     return contentConstraint.Constrain(size);
 }
 
+std::optional<SizeF> ImageLayoutAlgorithm::GetImageSize() const
+{
+    // an image measured by a worker has been prepared.
+    ACE_DCHECK(!LayoutWrapper::IsMeasuringInParallel());
+    if ((!loadingCtx_ || !loadingCtx_->GetImageSize().IsPositive()) &&
+        (!altLoadingCtx_ || !altLoadingCtx_->GetImageSize().IsPositive())) {
+        return std::nullopt;
+    }
+    // if image data is valid, use image source, or use altImage data
+    auto imageLoadingContext = loadingCtx_ ? loadingCtx_ : altLoadingCtx_;
+    return imageLoadingContext->GetImageSize();
+}
+
+float ImageLayoutAlgorithm::GetRootWidth() const
+{
+    if (parallelMeasureInputs_) {
+        return parallelMeasureInputs_->rootWidth;
+    }
+    ACE_DCHECK(!LayoutWrapper::IsMeasuringInParallel());
+    return PipelineContext::GetCurrentRootWidth();
+}
+
+bool ImageLayoutAlgorithm::CanMeasureInParallel() const
+{
+    return AceType::TypeId(this) == AceType::TypeId<ImageLayoutAlgorithm>();
+}
+
+bool ImageLayoutAlgorithm::PrepareParallelMeasure(LayoutWrapper* layoutWrapper)
+{
+    parallelMeasureInputs_ = ParallelMeasureInputs { GetImageSize(), PipelineContext::GetCurrentRootWidth() };
+    return true;
+}
+
 void ImageLayoutAlgorithm::Layout(LayoutWrapper* layoutWrapper)
 {
     BoxLayoutAlgorithm::Layout(layoutWrapper);
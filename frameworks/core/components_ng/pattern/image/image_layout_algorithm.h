@@ -36,6 +36,7 @@ public:
     {
         loadingCtx_ = nullptr;
         altLoadingCtx_ = nullptr;
+        parallelMeasureInputs_.reset();
     }
 
     std::optional<SizeF> MeasureContent(
@@ -43,9 +44,23 @@ public:
 
     void Layout(LayoutWrapper* layoutWrapper) override;
 
+    bool CanMeasureInParallel() const override;
+    bool PrepareParallelMeasure(LayoutWrapper* layoutWrapper) override;
+
 private:
+    // what MeasureContent reads from the loading contexts and the pipeline, copied before measuring on a worker.
+    struct ParallelMeasureInputs {
+        std::optional<SizeF> imageSize;
+        float rootWidth = 0.0f;
+    };
+
+    // size of the image source, or of the alt image when the source isn't ready, null if neither is ready.
+    std::optional<SizeF> GetImageSize() const;
+    float GetRootWidth() const;
+
     RefPtr<ImageLoadingContext> loadingCtx_;
     RefPtr<ImageLoadingContext> altLoadingCtx_;
+    std::optional<ParallelMeasureInputs> parallelMeasureInputs_;
     ACE_DISALLOW_COPY_AND_MOVE(ImageLayoutAlgorithm);
 };
 } // namespace OHOS::Ace::NG
@@ -15,6 +15,7 @@
 
 #include "core/components_ng/pattern/image/image_pattern.h"
 
+#include <algorithm>
 #include <array>
 
 #include "base/log/dump_log.h"
@@ -125,6 +126,7 @@ void ImagePattern::RegisterVisibleAreaChange()
         CHECK_NULL_VOID(self);
         LOGD("current image visible ratio = %f", ratio);
         self->OnVisibleChange(visible);
+        self->UpdateDecodePriority(visible);
     };
     auto host = GetHost();
     CHECK_NULL_VOID(host);
@@ -132,6 +134,38 @@ void ImagePattern::RegisterVisibleAreaChange()
     pipeline->AddVisibleAreaChangeNode(host, 0.0f, callback, false);
 }
 
+float ImagePattern::GetViewportDistance() const
+{
+    auto host = GetHost();
+    CHECK_NULL_RETURN(host, 0.0f);
+    auto pipeline = PipelineContext::GetCurrentContext();
+    CHECK_NULL_RETURN(pipeline, 0.0f);
+    auto rect = host->GetTransformRectRelativeToWindow();
+    auto rootWidth = static_cast<float>(pipeline->GetRootWidth());
+    auto rootHeight = static_cast<float>(pipeline->GetRootHeight());
+    auto distanceX = std::max({ 0.0f, -rect.Right(), rect.Left() - rootWidth });
+    auto distanceY = std::max({ 0.0f, -rect.Bottom(), rect.Top() - rootHeight });
+    return distanceX + distanceY;
+}
+
+void ImagePattern::UpdateDecodePriority(bool visible)
+{
+    if (visible && decodeCanceled_) {
+        decodeCanceled_ = false;
+        LoadImageDataIfNeed();
+        return;
+    }
+    CHECK_NULL_VOID_NOLOG(loadingCtx_);
+    if (!visible && loadingCtx_->IsMakingCanvasImage()) {
+        // the image is not shown, drop its pending decode task instead of decoding it for nothing
+        LOGD("image left viewport, cancel decoding %{private}s", loadingCtx_->GetSourceInfo().ToString().c_str());
+        loadingCtx_ = nullptr;
+        decodeCanceled_ = true;
+        return;
+    }
+    loadingCtx_->SetDecodePriority(visible ? 0.0f : GetViewportDistance());
+}
+
 void ImagePattern::OnImageLoadSuccess()
 {
     auto host = GetHost();
@@ -231,6 +265,10 @@ bool ImagePattern::OnDirtyLayoutWrapperSwap(const RefPtr<LayoutWrapper>& dirty,
     if (config.skipMeasure || dirty->SkipMeasureContent()) {
         return false;
     }
+    // canvas image may be requested during this layout, order its decoding by the new position
+    if (loadingCtx_ && loadingCtx_->IsMakingCanvasImage()) {
+        loadingCtx_->SetDecodePriority(GetViewportDistance());
+    }
     return image_;
 }
 
@@ -253,6 +291,11 @@ void ImagePattern::LoadImageDataIfNeed()
 
         loadingCtx_ = AceType::MakeRefPtr<ImageLoadingContext>(src, std::move(loadNotifier), syncLoad_);
         LOGI("start loading image %{public}s", src.ToString().c_str());
+        decodeCanceled_ = false;
+        if (!syncLoad_) {
+            // track visibility to prioritize decoding of the images on screen
+            RegisterVisibleAreaChange();
+        }
         loadingCtx_->LoadImageData();
     }
     if (loadingCtx_->NeedAlt() && imageLayoutProperty->GetAlt()) {
@@ -385,6 +428,14 @@ void ImagePattern::OnNotifyMemoryLevel(int32_t level)
         return;
     }
 
+    ReleaseImageData();
+    auto pipeline = PipelineContext::GetCurrentContext();
+    CHECK_NULL_VOID(pipeline);
+    pipeline->FlushMessages();
+}
+
+void ImagePattern::ReleaseImageData()
+{
     // clean image data
     loadingCtx_ = nullptr;
     image_ = nullptr;
@@ -398,9 +449,33 @@ void ImagePattern::OnNotifyMemoryLevel(int32_t level)
     auto rsRenderContext = frameNode->GetRenderContext();
     CHECK_NULL_VOID(rsRenderContext);
     rsRenderContext->ClearDrawCommands();
-    auto pipeline = PipelineContext::GetCurrentContext();
-    CHECK_NULL_VOID(pipeline);
-    pipeline->FlushMessages();
+}
+
+size_t ImagePattern::GetHibernationSize() const
+{
+    // decoded images are RGBA
+    constexpr size_t BYTES_PER_PIXEL = 4;
+    size_t size = 0;
+    if (image_) {
+        size += static_cast<size_t>(std::max(image_->GetWidth(), 0)) *
+                static_cast<size_t>(std::max(image_->GetHeight(), 0)) * BYTES_PER_PIXEL;
+    }
+    if (altImage_) {
+        size += static_cast<size_t>(std::max(altImage_->GetWidth(), 0)) *
+                static_cast<size_t>(std::max(altImage_->GetHeight(), 0)) * BYTES_PER_PIXEL;
+    }
+    return size;
+}
+
+void ImagePattern::OnHibernate()
+{
+    // the page is hidden, the image is loaded again from its source info when the page is shown.
+    ReleaseImageData();
+}
+
+void ImagePattern::OnRehydrate()
+{
+    LoadImageDataIfNeed();
 }
 
 void ImagePattern::OnWindowHide()
@@ -73,6 +73,9 @@ public:
 
     void LoadImageDataIfNeed();
     void OnNotifyMemoryLevel(int32_t level) override;
+    size_t GetHibernationSize() const override;
+    void OnHibernate() override;
+    void OnRehydrate() override;
     void OnWindowHide() override;
     void OnWindowShow() override;
     void OnVisibleChange(bool isVisible) override;
@@ -99,6 +102,7 @@ private:
     void OnModifyDone() override;
 
     void PaintImage(RenderContext* renderContext, const OffsetF& offset);
+    void ReleaseImageData();
 
     void OnImageDataReady();
     void OnImageLoadFail();
@@ -110,6 +114,8 @@ private:
     void PrepareAnimation();
     void SetRedrawCallback();
     void RegisterVisibleAreaChange();
+    void UpdateDecodePriority(bool visible);
+    float GetViewportDistance() const;
 
     void InitCopy();
     void HandleCopy();
@@ -133,6 +139,8 @@ private:
     CopyOptions copyOption_ = CopyOptions::None;
     bool syncLoad_ = false;
     bool isShow_ = true; // TODO: remove it later when use [isActive_] to determine image data management
+    // decode task was dropped when the image left the viewport, reload when it comes back
+    bool decodeCanceled_ = false;
 
     RefPtr<ImageLoadingContext> loadingCtx_;
     RefPtr<CanvasImage> image_;
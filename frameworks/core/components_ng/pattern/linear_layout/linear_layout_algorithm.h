@@ -36,6 +36,19 @@ public:
     }
     ~LinearLayoutAlgorithm() override = default;
 
+    RefPtr<LayoutAlgorithm> CreateRemeasureAlgorithm() const override
+    {
+        if (AceType::TypeId(this) != AceType::TypeId<LinearLayoutAlgorithm>()) {
+            return nullptr;
+        }
+        return MakeRefPtr<LinearLayoutAlgorithm>();
+    }
+
+    bool CanMeasureInParallel() const override
+    {
+        return AceType::TypeId(this) == AceType::TypeId<LinearLayoutAlgorithm>();
+    }
+
 private:
     ACE_DISALLOW_COPY_AND_MOVE(LinearLayoutAlgorithm);
 };
@@ -304,6 +304,16 @@ public:
     virtual void OnWindowSizeChanged(int32_t width, int32_t height, WindowSizeChangeReason type) {}
     virtual void OnNotifyMemoryLevel(int32_t level) {}
 
+    // Hidden pages keep their trees, StageManager hibernates the pages hidden the longest beyond its budget.
+    // OnHibernate releases what can be rebuilt from the properties, such as decoded images and shaped paragraphs,
+    // keeping the geometry, and OnRehydrate rebuilds it when the page is shown again.
+    virtual size_t GetHibernationSize() const
+    {
+        return 0;
+    }
+    virtual void OnHibernate() {}
+    virtual void OnRehydrate() {}
+
     // get XTS inspector value
     virtual void ToJsonValue(std::unique_ptr<JsonValue>& json) const {}
 
@@ -135,7 +135,7 @@ void ProgressLayoutAlgorithm::SetRadius(LayoutWrapper* layoutWrapper, float widt
     Dimension radius;
     auto layoutProperty = layoutWrapper->GetLayoutProperty();
     CHECK_NULL_VOID(layoutProperty);
-    auto& borderWidthProperty = layoutProperty->GetBorderWidthProperty();
+    const auto& borderWidthProperty = layoutProperty->GetBorderWidthProperty();
     float borderWidth = 0;
     if (borderWidthProperty) {
         borderWidth = borderWidthProperty->leftDimen->ConvertToPx();
@@ -69,7 +69,7 @@ void RadioPattern::OnModifyDone()
     margin.right = CalcLength(radioTheme->GetHotZoneHorizontalPadding().Value());
     margin.top = CalcLength(radioTheme->GetHotZoneVerticalPadding().Value());
     margin.bottom = CalcLength(radioTheme->GetHotZoneVerticalPadding().Value());
-    auto& setMargin = layoutProperty->GetMarginProperty();
+    const auto& setMargin = layoutProperty->GetMarginProperty();
     if (setMargin) {
         if (setMargin->left.has_value()) {
             margin.left = setMargin->left;
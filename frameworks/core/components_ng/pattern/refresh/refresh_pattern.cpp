@@ -366,7 +366,7 @@ float RefreshPattern::GetFadeAwayRatio()
     CHECK_NULL_RETURN(progressChild_, 0.0f);
     auto progressLayoutProperty = progressChild_->GetLayoutProperty<LoadingProgressLayoutProperty>();
     CHECK_NULL_RETURN(progressLayoutProperty, 0.0f);
-    auto& marginProperty = progressLayoutProperty->GetMarginProperty();
+    const auto& marginProperty = progressLayoutProperty->GetMarginProperty();
     CHECK_NULL_RETURN(marginProperty, 0.0f);
     auto triggerLoading = std::clamp(triggerLoadingDistance_, 0.0f,
         static_cast<float>(TRIGGER_REFRESH_DISTANCE.ConvertToPx()));
@@ -524,7 +524,7 @@ void SearchModelNG::CreateTextField(const RefPtr<SearchNode>& parentNode,
     auto pattern = frameNode->GetPattern<TextFieldPattern>();
     auto textEditingValue = pattern->GetTextEditingValue();
     if (textFieldLayoutProperty) {
-        if (value.has_value() && value.value() != textEditingValue.text) {
+        if (value.has_value() && value.value() != textEditingValue.GetText()) {
             pattern->InitEditingValueText(value.value());
         }
         textFieldLayoutProperty->UpdatePlaceholder(placeholder.value_or(""));
@@ -267,7 +267,7 @@ void SearchPattern::OnClickButtonAndImage()
     auto textFieldPattern = textFieldFrameNode->GetPattern<TextFieldPattern>();
     CHECK_NULL_VOID(textFieldPattern);
     auto text = textFieldPattern->GetEditingValue();
-    searchEventHub->UpdateSubmitEvent(text.text);
+    searchEventHub->UpdateSubmitEvent(text.GetText());
     textFieldPattern->CloseKeyboard(true);
 }
 
@@ -827,7 +827,7 @@ void SearchPattern::ToJsonValueForTextField(std::unique_ptr<JsonValue>& json) co
     auto textFieldPattern = textFieldFrameNode->GetPattern<TextFieldPattern>();
     CHECK_NULL_VOID(textFieldPattern);
 
-    json->Put("value", textFieldPattern->GetTextEditingValue().text.c_str());
+    json->Put("value", textFieldPattern->GetTextEditingValue().GetText().c_str());
     json->Put("placeholder", textFieldPattern->GetPlaceHolder().c_str());
     json->Put("placeholderColor", textFieldPattern->GetPlaceholderColor().c_str());
     json->Put("placeholderFont", textFieldPattern->GetPlaceholderFont().c_str());
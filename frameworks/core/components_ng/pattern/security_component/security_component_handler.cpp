@@ -276,7 +276,7 @@ static bool InitChildInfo(SecurityComponent::LocationButton& buttonInfo, RefPtr<
 
         auto bgProp = buttonNode->GetLayoutProperty<ButtonLayoutProperty>();
         CHECK_NULL_RETURN(bgProp, false);
-        auto& borderWidth = bgProp->GetBorderWidthProperty();
+        const auto& borderWidth = bgProp->GetBorderWidthProperty();
         CHECK_NULL_RETURN(borderWidth, false);
         buttonInfo.borderWidth_ = borderWidth->leftDimen.value().ConvertToVp();
     }
@@ -15,10 +15,12 @@
 
 #include "core/components_ng/pattern/stage/stage_manager.h"
 
+#include <algorithm>
 #include <unordered_map>
 
 #include "base/geometry/ng/size_t.h"
 #include "base/log/ace_performance_check.h"
+#include "base/memory/memory_monitor.h"
 #include "base/memory/referenced.h"
 #include "base/utils/utils.h"
 #include "core/animation/page_transition_common.h"
@@ -94,6 +96,39 @@ void FirePageTransition(const RefPtr<FrameNode>& page, PageTransitionType transi
             context->SetIsNeedShowFocus(false);
         });
 }
+
+void SetMemoryMonitorPage(const RefPtr<FrameNode>& page)
+{
+    if (!MemoryMonitor::IsEnable()) {
+        return;
+    }
+    CHECK_NULL_VOID(page);
+    auto pagePattern = page->GetPattern<PagePattern>();
+    CHECK_NULL_VOID(pagePattern);
+    auto pageInfo = pagePattern->GetPageInfo();
+    CHECK_NULL_VOID(pageInfo);
+    MemoryMonitor::GetInstance().SetCurrentPage(pageInfo->GetPageId());
+}
+
+template<typename Visitor>
+void VisitPatterns(const RefPtr<UINode>& node, const Visitor& visitor)
+{
+    CHECK_NULL_VOID(node);
+    auto frameNode = AceType::DynamicCast<FrameNode>(node);
+    if (frameNode && frameNode->GetPattern()) {
+        visitor(frameNode->GetPattern());
+    }
+    for (const auto& child : node->GetChildren()) {
+        VisitPatterns(child, visitor);
+    }
+}
+
+size_t GetHibernationSize(const RefPtr<FrameNode>& page)
+{
+    size_t size = 0;
+    VisitPatterns(page, [&size](const RefPtr<Pattern>& pattern) { size += pattern->GetHibernationSize(); });
+    return size;
+}
 } // namespace
 
 void StageManager::StartTransition(const RefPtr<FrameNode>& srcPage, const RefPtr<FrameNode>& destPage, RouteType type)
@@ -153,10 +188,13 @@ bool StageManager::PushPage(const RefPtr<FrameNode>& node, bool needHideLast, bo
     if (!children.empty() && needHideLast) {
         FirePageHide(children.back(), needTransition ? PageTransitionType::EXIT_PUSH : PageTransitionType::NONE);
         outPageNode = AceType::DynamicCast<FrameNode>(children.back());
+        OnPageHidden(outPageNode);
     }
     auto rect = stageNode_->GetGeometryNode()->GetFrameRect();
     rect.SetOffset({});
     node->GetRenderContext()->SyncGeometryProperties(rect);
+    // nodes built for the page are accounted to it, the router sets the page before the page is loaded already.
+    SetMemoryMonitorPage(node);
     // mount to parent and mark build render tree.
     node->MountToParent(stageNode_);
     // then build the total child.
@@ -226,6 +264,7 @@ bool StageManager::PopPage(bool needShowNext, bool needTransition)
     RefPtr<FrameNode> inPageNode;
     if (needShowNext && children.size() >= transitionPageSize) {
         auto newPageNode = *(++children.rbegin());
+        OnPageShown(newPageNode);
         FirePageShow(newPageNode, needTransition ? PageTransitionType::ENTER_POP : PageTransitionType::NONE);
         inPageNode = AceType::DynamicCast<FrameNode>(newPageNode);
     }
@@ -281,6 +320,7 @@ bool StageManager::PopPageToIndex(int32_t index, bool needShowNext, bool needTra
     RefPtr<FrameNode> inPageNode;
     if (needShowNext) {
         const auto& newPageNode = *iter;
+        OnPageShown(newPageNode);
         FirePageShow(newPageNode, needTransition ? PageTransitionType::ENTER_POP : PageTransitionType::NONE);
         inPageNode = AceType::DynamicCast<FrameNode>(newPageNode);
     }
@@ -323,6 +363,7 @@ bool StageManager::CleanPageStack()
         auto pageNode = children.front();
         stageNode_->RemoveChild(pageNode);
     }
+    RemoveDetachedHiddenPages();
     stageNode_->RebuildRenderContextTree();
     pipeline->RequestFrame();
     return true;
@@ -349,9 +390,11 @@ bool StageManager::MovePageToFront(const RefPtr<FrameNode>& node, bool needHideL
     }
     if (needHideLast) {
         FirePageHide(lastPage, needTransition ? PageTransitionType::EXIT_PUSH : PageTransitionType::NONE);
+        OnPageHidden(lastPage);
     }
     node->MovePosition(static_cast<int32_t>(stageNode_->GetChildren().size() - 1));
     node->GetRenderContext()->ResetPageTransitionEffect();
+    OnPageShown(node);
     FirePageShow(node, needTransition ? PageTransitionType::ENTER_PUSH : PageTransitionType::NONE);
 
     stageNode_->RebuildRenderContextTree();
@@ -363,6 +406,107 @@ bool StageManager::MovePageToFront(const RefPtr<FrameNode>& node, bool needHideL
     return true;
 }
 
+void StageManager::OnPageHidden(const RefPtr<UINode>& node)
+{
+    auto page = DynamicCast<FrameNode>(node);
+    CHECK_NULL_VOID(page);
+    RemoveDetachedHiddenPages();
+    hiddenPages_.push_back({ page, GetHibernationSize(page), false });
+    EnforceHibernationBudget(hibernationBudget_);
+}
+
+void StageManager::OnPageShown(const RefPtr<UINode>& node)
+{
+    auto page = DynamicCast<FrameNode>(node);
+    CHECK_NULL_VOID(page);
+    auto iter = std::find_if(hiddenPages_.begin(), hiddenPages_.end(),
+        [&page](const HiddenPage& hiddenPage) { return hiddenPage.page == page; });
+    if (iter == hiddenPages_.end()) {
+        return;
+    }
+    bool isHibernated = iter->isHibernated;
+    hiddenPages_.erase(iter);
+    if (!isHibernated) {
+        return;
+    }
+    LOGD("rehydrate page %{public}d", page->GetId());
+    VisitPatterns(page, [](const RefPtr<Pattern>& pattern) { pattern->OnRehydrate(); });
+}
+
+void StageManager::RemoveDetachedHiddenPages()
+{
+    // pages popped or cleaned while hidden.
+    hiddenPages_.remove_if([this](const HiddenPage& hiddenPage) {
+        auto page = hiddenPage.page.Upgrade();
+        return !page || page->GetParent() != stageNode_;
+    });
+}
+
+bool StageManager::EnforceHibernationBudget(size_t budget)
+{
+    size_t totalSize = GetHiddenPagesSize();
+    if (totalSize <= budget) {
+        return false;
+    }
+    auto pageInTransition = srcPageNode_.Upgrade();
+    bool hibernated = false;
+    for (auto& hiddenPage : hiddenPages_) {
+        if (totalSize <= budget) {
+            break;
+        }
+        if (hiddenPage.isHibernated) {
+            continue;
+        }
+        auto page = hiddenPage.page.Upgrade();
+        if (!page || page == pageInTransition) {
+            continue;
+        }
+        LOGD("hibernate page %{public}d, releasing %{public}zu bytes", page->GetId(), hiddenPage.size);
+        VisitPatterns(page, [](const RefPtr<Pattern>& pattern) { pattern->OnHibernate(); });
+        hiddenPage.isHibernated = true;
+        totalSize -= hiddenPage.size;
+        hibernated = true;
+    }
+    return hibernated;
+}
+
+void StageManager::SetHibernationBudget(size_t budget)
+{
+    hibernationBudget_ = budget;
+    RemoveDetachedHiddenPages();
+    EnforceHibernationBudget(hibernationBudget_);
+}
+
+void StageManager::HibernateHiddenPages()
+{
+    RemoveDetachedHiddenPages();
+    if (!EnforceHibernationBudget(0)) {
+        return;
+    }
+    auto pipeline = PipelineContext::GetCurrentContext();
+    CHECK_NULL_VOID(pipeline);
+    // release the draw commands held by the render service.
+    pipeline->FlushMessages();
+}
+
+bool StageManager::IsPageHibernated(const RefPtr<FrameNode>& page) const
+{
+    auto iter = std::find_if(hiddenPages_.begin(), hiddenPages_.end(),
+        [&page](const HiddenPage& hiddenPage) { return hiddenPage.page == page; });
+    return iter != hiddenPages_.end() && iter->isHibernated;
+}
+
+size_t StageManager::GetHiddenPagesSize() const
+{
+    size_t totalSize = 0;
+    for (const auto& hiddenPage : hiddenPages_) {
+        if (!hiddenPage.isHibernated) {
+            totalSize += hiddenPage.size;
+        }
+    }
+    return totalSize;
+}
+
 void StageManager::FirePageHide(const RefPtr<UINode>& node, PageTransitionType transitionType)
 {
     auto pageNode = DynamicCast<FrameNode>(node);
@@ -405,6 +549,7 @@ void StageManager::FirePageShow(const RefPtr<UINode>& node, PageTransitionType t
     auto pagePattern = pageNode->GetPattern<PagePattern>();
     CHECK_NULL_VOID(pagePattern);
     pagePattern->OnShow();
+    SetMemoryMonitorPage(pageNode);
     // With or without a page transition, we need to make the coming page visible first
     pagePattern->ProcessShowState();
 
@@ -17,6 +17,7 @@
 #define FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_PATTERNS_STAGE_STAGE_MANAGER_H
 
 #include <cstdint>
+#include <list>
 
 #include "base/memory/ace_type.h"
 #include "base/memory/referenced.h"
@@ -52,14 +53,44 @@ public:
 
     void ReloadStage();
 
+    // Hidden pages keep their trees for instant back navigation. Beyond the budget, the releasable memory of the
+    // pages hidden the longest is hibernated, and restored when they are shown again.
+    void SetHibernationBudget(size_t budget);
+    size_t GetHibernationBudget() const
+    {
+        return hibernationBudget_;
+    }
+    // hibernate every hidden page, on memory pressure.
+    void HibernateHiddenPages();
+    bool IsPageHibernated(const RefPtr<FrameNode>& page) const;
+    // releasable memory held by the hidden pages which are not hibernated.
+    size_t GetHiddenPagesSize() const;
+
 private:
     void CheckNodeCountAndDepth(const RefPtr<FrameNode>& pageNode);
     void StopPageTransition();
 
+    void OnPageHidden(const RefPtr<UINode>& node);
+    void OnPageShown(const RefPtr<UINode>& node);
+    // hibernate the pages hidden the longest until the rest fits in the budget, returns true if any is hibernated.
+    bool EnforceHibernationBudget(size_t budget);
+    void RemoveDetachedHiddenPages();
+
+    struct HiddenPage {
+        WeakPtr<FrameNode> page;
+        size_t size = 0;
+        bool isHibernated = false;
+    };
+
     RefPtr<FrameNode> stageNode_;
     RefPtr<StagePattern> stagePattern_;
     WeakPtr<FrameNode> destPageNode_;
     WeakPtr<FrameNode> srcPageNode_;
+    // in the order of hiding, the page hidden the longest first.
+    std::list<HiddenPage> hiddenPages_;
+    size_t hibernationBudget_ = DEFAULT_HIBERNATION_BUDGET;
+
+    static constexpr size_t DEFAULT_HIBERNATION_BUDGET = 32 * 1024 * 1024;
 
     ACE_DISALLOW_COPY_AND_MOVE(StageManager);
 };
@@ -0,0 +1,244 @@
+/*
+ * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "core/components_ng/pattern/text/paragraph_cache.h"
+
+#include <algorithm>
+#include <functional>
+
+#include "base/i18n/localization.h"
+#include "base/log/log.h"
+#include "base/utils/utils.h"
+
+namespace OHOS::Ace::NG {
+namespace {
+
+template<class T>
+void HashCombine(size_t& seed, const T& value)
+{
+    constexpr size_t HASH_MAGIC = 0x9e3779b9;
+    constexpr size_t LEFT_SHIFT = 6;
+    constexpr size_t RIGHT_SHIFT = 2;
+    seed ^= std::hash<T>()(value) + HASH_MAGIC + (seed << LEFT_SHIFT) + (seed >> RIGHT_SHIFT);
+}
+
+// fingerprint of the style properties affecting shaping and painting, the whole style is compared on match.
+size_t HashOfStyle(const TextStyle& textStyle)
+{
+    size_t seed = 0;
+    HashCombine(seed, textStyle.GetFontSize().Value());
+    HashCombine(seed, static_cast<int32_t>(textStyle.GetFontSize().Unit()));
+    HashCombine(seed, static_cast<int32_t>(textStyle.GetFontWeight()));
+    HashCombine(seed, static_cast<int32_t>(textStyle.GetFontStyle()));
+    HashCombine(seed, textStyle.GetMaxLines());
+    HashCombine(seed, textStyle.GetTextColor().GetValue());
+    HashCombine(seed, static_cast<int32_t>(textStyle.GetTextAlign()));
+    HashCombine(seed, static_cast<int32_t>(textStyle.GetTextOverflow()));
+    HashCombine(seed, textStyle.GetLineHeight().Value());
+    HashCombine(seed, textStyle.GetLetterSpacing().Value());
+    for (const auto& family : textStyle.GetFontFamilies()) {
+        HashCombine(seed, family);
+    }
+    return seed;
+}
+
+} // namespace
+
+ParagraphCache& ParagraphCache::GetInstance()
+{
+    static ParagraphCache instance;
+    return instance;
+}
+
+ParagraphCache::LayoutKey ParagraphCache::MakeLayoutKey(const LayoutConstraintF& constraint)
+{
+    LayoutKey layoutKey { constraint.selfIdealSize.Width().value_or(-1.0f), constraint.minSize.Width(),
+        constraint.maxSize.Width() };
+    auto pipeline = PipelineBase::GetCurrentContext();
+    if (pipeline) {
+        layoutKey.dipScale = pipeline->GetDipScale();
+        layoutKey.fontScale = pipeline->GetFontScale();
+    }
+    return layoutKey;
+}
+
+size_t ParagraphCache::HashOf(const std::string& content, const TextStyle& textStyle, const LayoutKey& layoutKey)
+{
+    size_t seed = std::hash<std::string>()(content);
+    HashCombine(seed, HashOfStyle(textStyle));
+    HashCombine(seed, layoutKey.idealWidth);
+    HashCombine(seed, layoutKey.minWidth);
+    HashCombine(seed, layoutKey.maxWidth);
+    HashCombine(seed, layoutKey.dipScale);
+    HashCombine(seed, layoutKey.fontScale);
+    return seed;
+}
+
+bool ParagraphCache::IsSameEntry(const Entry& entry, const std::string& content, const TextStyle& textStyle,
+    const LayoutKey& layoutKey, const std::string& fontLocale)
+{
+    return entry.layoutKey == layoutKey && entry.content == content && entry.textStyle == textStyle &&
+           entry.textStyle.HasHeightOverride() == textStyle.HasHeightOverride() && entry.fontLocale == fontLocale;
+}
+
+RefPtr<Paragraph> ParagraphCache::Get(
+    const std::string& content, const TextStyle& textStyle, const LayoutConstraintF& constraint)
+{
+    auto layoutKey = MakeLayoutKey(constraint);
+    auto hash = HashOf(content, textStyle, layoutKey);
+    auto fontLocale = Localization::GetInstance()->GetFontLocale();
+    std::scoped_lock<std::mutex> lock(mutex_);
+    auto range = index_.equal_range(hash);
+    for (auto iter = range.first; iter != range.second; ++iter) {
+        if (IsSameEntry(*iter->second, content, textStyle, layoutKey, fontLocale)) {
+            ++stats_.hitCount;
+            // move to front
+            entries_.splice(entries_.begin(), entries_, iter->second);
+            return iter->second->paragraph;
+        }
+    }
+    ++stats_.missCount;
+    return nullptr;
+}
+
+void ParagraphCache::Put(const std::string& content, const TextStyle& textStyle, const LayoutConstraintF& constraint,
+    const RefPtr<Paragraph>& paragraph)
+{
+    CHECK_NULL_VOID_NOLOG(paragraph);
+    auto layoutKey = MakeLayoutKey(constraint);
+    auto hash = HashOf(content, textStyle, layoutKey);
+    auto fontLocale = Localization::GetInstance()->GetFontLocale();
+    std::scoped_lock<std::mutex> lock(mutex_);
+    if (capacity_ == 0) {
+        return;
+    }
+    // a paragraph is laid out for one entry, drop it from the entry of another layout.
+    auto cached = paragraphIndex_.find(AceType::RawPtr(paragraph));
+    if (cached != paragraphIndex_.end()) {
+        if (IsSameEntry(*cached->second, content, textStyle, layoutKey, fontLocale)) {
+            entries_.splice(entries_.begin(), entries_, cached->second);
+            return;
+        }
+        EraseLocked(cached->second);
+    }
+    auto range = index_.equal_range(hash);
+    for (auto iter = range.first; iter != range.second; ++iter) {
+        if (IsSameEntry(*iter->second, content, textStyle, layoutKey, fontLocale)) {
+            paragraphIndex_.erase(AceType::RawPtr(iter->second->paragraph));
+            iter->second->paragraph = paragraph;
+            paragraphIndex_.emplace(AceType::RawPtr(paragraph), iter->second);
+            entries_.splice(entries_.begin(), entries_, iter->second);
+            return;
+        }
+    }
+    TrimLocked(capacity_ - 1);
+    entries_.push_front({ hash, content, textStyle, layoutKey, fontLocale, paragraph });
+    index_.emplace(hash, entries_.begin());
+    paragraphIndex_.emplace(AceType::RawPtr(paragraph), entries_.begin());
+}
+
+void ParagraphCache::SetCapacity(size_t capacity)
+{
+    std::scoped_lock<std::mutex> lock(mutex_);
+    capacity_ = capacity;
+    TrimLocked(capacity_);
+}
+
+void ParagraphCache::Clear()
+{
+    std::scoped_lock<std::mutex> lock(mutex_);
+    LOGI("clear paragraph cache, size = %{public}zu, hit rate = %{public}f", entries_.size(), stats_.GetHitRate());
+    entries_.clear();
+    index_.clear();
+    paragraphIndex_.clear();
+    ++generation_;
+}
+
+void ParagraphCache::ClearFontFamily(const std::string& familyName)
+{
+    if (familyName.empty()) {
+        Clear();
+        return;
+    }
+    std::scoped_lock<std::mutex> lock(mutex_);
+    for (auto iter = entries_.begin(); iter != entries_.end();) {
+        const auto& families = iter->textStyle.GetFontFamilies();
+        if (std::find(families.begin(), families.end(), familyName) == families.end()) {
+            ++iter;
+            continue;
+        }
+        EraseLocked(iter++);
+    }
+    ++generation_;
+}
+
+bool ParagraphCache::Contains(const RefPtr<Paragraph>& paragraph) const
+{
+    CHECK_NULL_RETURN_NOLOG(paragraph, false);
+    std::scoped_lock<std::mutex> lock(mutex_);
+    return paragraphIndex_.find(AceType::RawPtr(paragraph)) != paragraphIndex_.end();
+}
+
+void ParagraphCache::Remove(const RefPtr<Paragraph>& paragraph)
+{
+    CHECK_NULL_VOID_NOLOG(paragraph);
+    std::scoped_lock<std::mutex> lock(mutex_);
+    auto iter = paragraphIndex_.find(AceType::RawPtr(paragraph));
+    if (iter != paragraphIndex_.end()) {
+        EraseLocked(iter->second);
+    }
+}
+
+void ParagraphCache::TrimUnused()
+{
+    std::scoped_lock<std::mutex> lock(mutex_);
+    for (auto iter = entries_.begin(); iter != entries_.end();) {
+        if (iter->paragraph && iter->paragraph->RefCount() == 1) {
+            EraseLocked(iter++);
+            ++stats_.evictCount;
+        } else {
+            ++iter;
+        }
+    }
+}
+
+ParagraphCacheStats ParagraphCache::GetStats() const
+{
+    std::scoped_lock<std::mutex> lock(mutex_);
+    return stats_;
+}
+
+void ParagraphCache::TrimLocked(size_t capacity)
+{
+    while (entries_.size() > capacity) {
+        EraseLocked(std::prev(entries_.end()));
+        ++stats_.evictCount;
+    }
+}
+
+void ParagraphCache::EraseLocked(std::list<Entry>::iterator entry)
+{
+    paragraphIndex_.erase(AceType::RawPtr(entry->paragraph));
+    auto range = index_.equal_range(entry->hash);
+    for (auto iter = range.first; iter != range.second; ++iter) {
+        if (iter->second == entry) {
+            index_.erase(iter);
+            break;
+        }
+    }
+    entries_.erase(entry);
+}
+
+} // namespace OHOS::Ace::NG
@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_PATTERN_TEXT_PARAGRAPH_CACHE_H
+#define FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_PATTERN_TEXT_PARAGRAPH_CACHE_H
+
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "base/utils/noncopyable.h"
+#include "core/components/common/properties/text_style.h"
+#include "core/components_ng/property/layout_constraint.h"
+#include "core/components_ng/render/paragraph.h"
+
+namespace OHOS::Ace::NG {
+
+struct ParagraphCacheStats {
+    uint64_t hitCount = 0;
+    uint64_t missCount = 0;
+    uint64_t evictCount = 0;
+
+    float GetHitRate() const
+    {
+        auto total = hitCount + missCount;
+        return total == 0 ? 0.0f : static_cast<float>(hitCount) / static_cast<float>(total);
+    }
+};
+
+// Laid out paragraphs of plain texts, shared by every text node measuring the same content with the same style
+// and width constraint (e.g. identical labels of list items), so shaping runs once for all of them.
+// A cached paragraph is laid out already and must not be laid out again by its users. The cache is cleared when
+// fonts are loaded or varied, since paragraphs shaped before may use fallback fonts.
+class ParagraphCache final {
+public:
+    static ParagraphCache& GetInstance();
+
+    ParagraphCache() = default;
+    ~ParagraphCache() = default;
+
+    RefPtr<Paragraph> Get(const std::string& content, const TextStyle& textStyle, const LayoutConstraintF& constraint);
+    void Put(const std::string& content, const TextStyle& textStyle, const LayoutConstraintF& constraint,
+        const RefPtr<Paragraph>& paragraph);
+
+    void SetCapacity(size_t capacity);
+    void Clear();
+    bool Contains(const RefPtr<Paragraph>& paragraph) const;
+    // drops the entry of [paragraph], e.g. when its only node releases it.
+    void Remove(const RefPtr<Paragraph>& paragraph);
+    // drops paragraphs no node holds, which are only kept by the cache, e.g. on memory pressure.
+    void TrimUnused();
+    // drops paragraphs using [familyName], which are shaped with fallback fonts before the font is loaded.
+    void ClearFontFamily(const std::string& familyName);
+    ParagraphCacheStats GetStats() const;
+
+    size_t Size() const
+    {
+        std::scoped_lock<std::mutex> lock(mutex_);
+        return entries_.size();
+    }
+
+    // Increased by every clear, paragraphs kept out of the cache (e.g. by text fields) compare it to know whether
+    // fonts changed since they were built.
+    uint64_t GetGeneration() const
+    {
+        std::scoped_lock<std::mutex> lock(mutex_);
+        return generation_;
+    }
+
+    static constexpr size_t DEFAULT_CAPACITY = 256;
+
+private:
+    // widths of the layout constraint deciding the layout width of the paragraph, a negative ideal width means the
+    // width is not fixed. Scales of the pipeline convert vp / fp of the style to px.
+    struct LayoutKey {
+        float idealWidth = -1.0f;
+        float minWidth = 0.0f;
+        float maxWidth = 0.0f;
+        double dipScale = 1.0;
+        float fontScale = 1.0f;
+
+        bool operator==(const LayoutKey& other) const
+        {
+            return idealWidth == other.idealWidth && minWidth == other.minWidth && maxWidth == other.maxWidth &&
+                   dipScale == other.dipScale && fontScale == other.fontScale;
+        }
+    };
+
+    struct Entry {
+        size_t hash = 0;
+        std::string content;
+        TextStyle textStyle;
+        LayoutKey layoutKey;
+        // paragraphs shaped for another locale are not reusable.
+        std::string fontLocale;
+        RefPtr<Paragraph> paragraph;
+    };
+
+    static LayoutKey MakeLayoutKey(const LayoutConstraintF& constraint);
+    static size_t HashOf(const std::string& content, const TextStyle& textStyle, const LayoutKey& layoutKey);
+    static bool IsSameEntry(const Entry& entry, const std::string& content, const TextStyle& textStyle,
+        const LayoutKey& layoutKey, const std::string& fontLocale);
+
+    void TrimLocked(size_t capacity);
+    void EraseLocked(std::list<Entry>::iterator entry);
+
+    mutable std::mutex mutex_;
+    // most recently used entry at front
+    std::list<Entry> entries_;
+    std::unordered_multimap<size_t, std::list<Entry>::iterator> index_;
+    // entry of every cached paragraph, which is in one entry only, so owners look it up on every page hide.
+    std::unordered_map<const Paragraph*, std::list<Entry>::iterator> paragraphIndex_;
+    size_t capacity_ = DEFAULT_CAPACITY;
+    uint64_t generation_ = 0;
+    ParagraphCacheStats stats_;
+
+    ACE_DISALLOW_COPY_AND_MOVE(ParagraphCache);
+};
+
+} // namespace OHOS::Ace::NG
+
+#endif // FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_PATTERN_TEXT_PARAGRAPH_CACHE_H
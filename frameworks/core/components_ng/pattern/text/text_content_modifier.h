@@ -54,6 +54,11 @@ public:
         paragraph_ = paragraph;
     }
 
+    const RefPtr<Paragraph>& GetParagraph() const
+    {
+        return paragraph_;
+    }
+
     void SetPrintOffset(const OffsetF& paintOffset)
     {
         paintOffset_ = paintOffset;
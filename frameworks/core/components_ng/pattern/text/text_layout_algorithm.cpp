@@ -16,6 +16,7 @@
 #include "core/components_ng/pattern/text/text_layout_algorithm.h"
 
 #include <limits>
+#include <mutex>
 
 #include "text_layout_adapter.h"
 
@@ -25,6 +26,7 @@
 #include "core/components/text/text_theme.h"
 #include "core/components_ng/base/frame_node.h"
 #include "core/components_ng/pattern/image/image_layout_property.h"
+#include "core/components_ng/pattern/text/paragraph_cache.h"
 #include "core/components_ng/pattern/text/text_layout_property.h"
 #include "core/components_ng/pattern/text/text_pattern.h"
 #include "core/components_ng/render/drawing_prop_convertor.h"
@@ -51,6 +53,19 @@ float GetContentOffsetY(LayoutWrapper* layoutWrapper)
     }
     return offsetY;
 }
+
+// count of steps between the min and max font size of adaptive text size.
+int32_t GetAdaptFontSizeMaxIndex(double minFontSize, double maxFontSize, double stepSize)
+{
+    constexpr double ADAPT_EPSILON = 0.001;
+    if (LessOrEqual(stepSize, 0.0)) {
+        return 0;
+    }
+    return static_cast<int32_t>(std::floor((maxFontSize - minFontSize) / stepSize + ADAPT_EPSILON));
+}
+
+// the font collection isn't safe to shape paragraphs on several threads at once.
+std::mutex g_parallelParagraphMutex;
 } // namespace
 
 TextLayoutAlgorithm::TextLayoutAlgorithm() = default;
@@ -60,6 +75,11 @@ void TextLayoutAlgorithm::OnReset() {}
 std::optional<SizeF> TextLayoutAlgorithm::MeasureContent(
     const LayoutConstraintF& contentConstraint, LayoutWrapper* layoutWrapper)
 {
+    if (parallelMeasureInputs_) {
+        return MeasureContentInParallel(contentConstraint, layoutWrapper);
+    }
+    // a text measured by a worker has been prepared.
+    ACE_DCHECK(!LayoutWrapper::IsMeasuringInParallel());
     auto frameNode = layoutWrapper->GetHostNode();
     CHECK_NULL_RETURN(frameNode, std::nullopt);
     auto pipeline = frameNode->GetContext();
@@ -68,21 +88,12 @@ std::optional<SizeF> TextLayoutAlgorithm::MeasureContent(
     CHECK_NULL_RETURN(textLayoutProperty, std::nullopt);
     auto pattern = frameNode->GetPattern<TextPattern>();
     CHECK_NULL_RETURN(pattern, std::nullopt);
-    auto contentModifier = pattern->GetContentModifier();
 
     if (!contentConstraint.maxSize.IsPositive()) {
         return std::nullopt;
     }
 
-    TextStyle textStyle = CreateTextStyleUsingTheme(
-        textLayoutProperty->GetFontStyle(), textLayoutProperty->GetTextLineStyle(), pipeline->GetTheme<TextTheme>());
-    if (contentModifier) {
-        SetPropertyToModifier(textLayoutProperty, contentModifier);
-        contentModifier->ModifyTextStyle(textStyle);
-    }
-
-    // Determines whether a foreground color is set or inherited.
-    UpdateTextColorIfForeground(frameNode, textStyle);
+    TextStyle textStyle = CreateTextStyle(frameNode, pattern, pipeline, textLayoutProperty);
 
     if (textStyle.GetTextOverflow() == TextOverflow::MARQUEE) {
         return BuildTextRaceParagraph(textStyle, textLayoutProperty, contentConstraint, pipeline, layoutWrapper);
@@ -107,12 +118,38 @@ std::optional<SizeF> TextLayoutAlgorithm::MeasureContent(
     if (result == false) {
         return std::nullopt;
     }
+    return GetContentSize(
+        textStyle, contentConstraint, pipeline->GetDipScale(), pipeline->GetFontScale(), pipeline->GetLogicScale());
+}
+
+std::optional<SizeF> TextLayoutAlgorithm::MeasureContentInParallel(
+    const LayoutConstraintF& contentConstraint, LayoutWrapper* layoutWrapper)
+{
+    auto textLayoutProperty = DynamicCast<TextLayoutProperty>(layoutWrapper->GetLayoutProperty());
+    CHECK_NULL_RETURN(textLayoutProperty, std::nullopt);
+    if (!contentConstraint.maxSize.IsPositive()) {
+        return std::nullopt;
+    }
+    const auto& inputs = parallelMeasureInputs_.value();
+    auto textStyle = inputs.textStyle;
+    {
+        std::scoped_lock<std::mutex> lock(g_parallelParagraphMutex);
+        // texts of adaptive font size, which read the pipeline to build the paragraph, are not prepared.
+        if (!BuildParagraph(textStyle, textLayoutProperty, contentConstraint, nullptr, layoutWrapper)) {
+            return std::nullopt;
+        }
+    }
+    return GetContentSize(textStyle, contentConstraint, inputs.dipScale, inputs.fontScale, inputs.logicScale);
+}
+
+SizeF TextLayoutAlgorithm::GetContentSize(const TextStyle& textStyle, const LayoutConstraintF& contentConstraint,
+    double dipScale, double fontScale, double logicScale)
+{
     textStyle_ = textStyle;
 
     auto height = static_cast<float>(paragraph_->GetHeight());
     double baselineOffset = 0.0;
-    textStyle.GetBaselineOffset().NormalizeToPx(
-        pipeline->GetDipScale(), pipeline->GetFontScale(), pipeline->GetLogicScale(), height, baselineOffset);
+    textStyle.GetBaselineOffset().NormalizeToPx(dipScale, fontScale, logicScale, height, baselineOffset);
 
     baselineOffset_ = static_cast<float>(baselineOffset);
 
@@ -122,6 +159,51 @@ std::optional<SizeF> TextLayoutAlgorithm::MeasureContent(
     return SizeF(paragraph_->GetMaxWidth(), heightFinal);
 }
 
+TextStyle TextLayoutAlgorithm::CreateTextStyle(const RefPtr<FrameNode>& frameNode, const RefPtr<TextPattern>& pattern,
+    const RefPtr<PipelineContext>& pipeline, const RefPtr<TextLayoutProperty>& textLayoutProperty)
+{
+    TextStyle textStyle = CreateTextStyleUsingTheme(
+        textLayoutProperty->GetFontStyle(), textLayoutProperty->GetTextLineStyle(), pipeline->GetTheme<TextTheme>());
+    auto contentModifier = pattern->GetContentModifier();
+    if (contentModifier) {
+        SetPropertyToModifier(textLayoutProperty, contentModifier);
+        contentModifier->ModifyTextStyle(textStyle);
+    }
+
+    // Determines whether a foreground color is set or inherited.
+    UpdateTextColorIfForeground(frameNode, textStyle);
+    return textStyle;
+}
+
+bool TextLayoutAlgorithm::CanMeasureInParallel() const
+{
+    // spans are measured with the paragraphs of their spans, which belong to the pattern.
+    return AceType::TypeId(this) == AceType::TypeId<TextLayoutAlgorithm>() && spanItemChildren_.empty();
+}
+
+bool TextLayoutAlgorithm::PrepareParallelMeasure(LayoutWrapper* layoutWrapper)
+{
+    auto frameNode = layoutWrapper->GetHostNode();
+    CHECK_NULL_RETURN(frameNode, false);
+    auto pipeline = frameNode->GetContext();
+    CHECK_NULL_RETURN(pipeline, false);
+    auto textLayoutProperty = DynamicCast<TextLayoutProperty>(layoutWrapper->GetLayoutProperty());
+    CHECK_NULL_RETURN(textLayoutProperty, false);
+    auto pattern = frameNode->GetPattern<TextPattern>();
+    CHECK_NULL_RETURN(pattern, false);
+    auto textStyle = CreateTextStyle(frameNode, pattern, pipeline, textLayoutProperty);
+    // adaptive font sizes, marquees and indents read the pipeline while building the paragraph.
+    if (textStyle.GetAdaptTextSize() || textStyle.GetTextOverflow() == TextOverflow::MARQUEE ||
+        GreatNotEqual(textStyle.GetTextIndent().Value(), 0.0) ||
+        textLayoutProperty->GetHeightAdaptivePolicyValue(TextHeightAdaptivePolicy::MAX_LINES_FIRST) !=
+            TextHeightAdaptivePolicy::MAX_LINES_FIRST) {
+        return false;
+    }
+    parallelMeasureInputs_ = ParallelMeasureInputs { std::move(textStyle), pipeline->GetDipScale(),
+        pipeline->GetFontScale(), pipeline->GetLogicScale() };
+    return true;
+}
+
 void TextLayoutAlgorithm::Measure(LayoutWrapper* layoutWrapper)
 {
     BoxLayoutAlgorithm::Measure(layoutWrapper);
@@ -320,19 +402,71 @@ bool TextLayoutAlgorithm::AdaptMinTextSize(TextStyle& textStyle, const std::stri
         return false;
     }
     auto maxSize = GetMaxMeasureSize(contentConstraint);
-    while (GreatOrEqual(maxFontSize, minFontSize)) {
-        textStyle.SetFontSize(Dimension(maxFontSize));
+    // candidate sizes are counted down from the max font size by step.
+    auto maxIndex = GetAdaptFontSizeMaxIndex(minFontSize, maxFontSize, stepSize);
+    return SearchAdaptFontSize(textStyle, content, contentConstraint, layoutWrapper,
+        { maxFontSize - maxIndex * stepSize, stepSize, maxIndex }, [this, &maxSize]() {
+            return !DidExceedMaxLines(maxSize);
+        });
+}
+
+bool TextLayoutAlgorithm::SearchAdaptFontSize(TextStyle& textStyle, const std::string& content,
+    const LayoutConstraintF& contentConstraint, LayoutWrapper* layoutWrapper, const AdaptFontSizes& fontSizes,
+    const std::function<bool()>& isFit)
+{
+    auto maxSize = GetMaxMeasureSize(contentConstraint);
+    auto fontSizeAt = [&fontSizes](int32_t index) { return fontSizes.minFontSize + index * fontSizes.stepSize; };
+    int32_t low = 0;
+    int32_t high = fontSizes.maxIndex;
+    int32_t fitIndex = -1;
+    int32_t builtIndex = -1;
+    RefPtr<Paragraph> fitParagraph;
+    bool isEstimated = false;
+    adaptBuildCount_ = 0;
+    // most texts fit the largest font size, try it first.
+    auto index = high;
+    while (low <= high) {
+        textStyle.SetFontSize(Dimension(fontSizeAt(index)));
         if (!CreateParagraphAndLayout(textStyle, content, contentConstraint, layoutWrapper)) {
             return false;
         }
-        if (!DidExceedMaxLines(maxSize)) {
-            break;
+        ++adaptBuildCount_;
+        builtIndex = index;
+        bool isIndexFit = isFit();
+        if (isIndexFit) {
+            fitIndex = index;
+            fitParagraph = paragraph_;
+            low = index + 1;
+        } else {
+            high = index - 1;
         }
-        maxFontSize -= stepSize;
+        index = low + (high - low + 1) / 2;
+        // The width of a single line grows linearly with the font size, scale the measured width to the available
+        // width to guess the fitting size. Guess only once, so a bad guess can't make the search linear.
+        if (!isIndexFit && !isEstimated && low <= high && paragraph_->GetLineCount() == 1 &&
+            GreatNotEqual(paragraph_->GetLongestLine(), maxSize.Width()) && GreatNotEqual(fontSizes.stepSize, 0.0)) {
+            isEstimated = true;
+            auto estimatedSize = fontSizeAt(builtIndex) * maxSize.Width() / paragraph_->GetLongestLine();
+            auto estimatedIndex =
+                static_cast<int32_t>(std::floor((estimatedSize - fontSizes.minFontSize) / fontSizes.stepSize));
+            index = std::clamp(estimatedIndex, low, high);
+        }
+    }
+    // falls back to the smallest font size, which is the last one built when no size fits.
+    if (fitIndex >= 0 && fitIndex != builtIndex) {
+        paragraph_ = fitParagraph;
     }
+    textStyle.SetFontSize(Dimension(fontSizeAt(std::max(fitIndex, 0))));
+    LOGD("adapt font size in %{public}d paragraph builds, candidates: %{public}d", adaptBuildCount_,
+        fontSizes.maxIndex + 1);
     return true;
 }
 
+int32_t TextLayoutAlgorithm::GetAdaptBuildCount() const
+{
+    return adaptBuildCount_;
+}
+
 bool TextLayoutAlgorithm::DidExceedMaxLines(const SizeF& maxSize)
 {
     CHECK_NULL_RETURN(paragraph_, false);
@@ -389,6 +523,15 @@ std::list<RefPtr<SpanItem>>&& TextLayoutAlgorithm::GetSpanItemChildren()
 bool TextLayoutAlgorithm::BuildParagraph(TextStyle& textStyle, const RefPtr<TextLayoutProperty>& layoutProperty,
     const LayoutConstraintF& contentConstraint, const RefPtr<PipelineContext>& pipeline, LayoutWrapper* layoutWrapper)
 {
+    // Paragraphs of plain texts only depend on content, style and width constraint, share them between text nodes.
+    bool useCache = spanItemChildren_.empty() && !textStyle.GetAdaptTextSize();
+    if (useCache) {
+        paragraph_ = ParagraphCache::GetInstance().Get(
+            layoutProperty->GetContent().value_or(""), textStyle, contentConstraint);
+        if (paragraph_) {
+            return true;
+        }
+    }
     if (!textStyle.GetAdaptTextSize()) {
         if (!CreateParagraphAndLayout(
             textStyle, layoutProperty->GetContent().value_or(""), contentConstraint, layoutWrapper)) {
@@ -411,6 +554,10 @@ bool TextLayoutAlgorithm::BuildParagraph(TextStyle& textStyle, const RefPtr<Text
             paragraph_->Layout(std::ceil(paragraphNewWidth));
         }
     }
+    if (useCache) {
+        ParagraphCache::GetInstance().Put(
+            layoutProperty->GetContent().value_or(""), textStyle, contentConstraint, paragraph_);
+    }
     return true;
 }
 
@@ -596,26 +743,13 @@ bool TextLayoutAlgorithm::AdaptMaxTextSize(TextStyle& textStyle, const std::stri
             contentConstraint.maxSize.Height(), stepSize)) {
         return false;
     }
-    RefPtr<Paragraph> paragraph;
     auto maxSize = GetMaxMeasureSize(contentConstraint);
-    // Use the minFontSize to layout the paragraph. While using the minFontSize, if the paragraph could be layout in 1
-    // line, then increase the font size and try to layout using the maximum available fontsize.
-    while (LessOrEqual(minFontSize, maxFontSize)) {
-        textStyle.SetFontSize(Dimension(minFontSize));
-        if (!CreateParagraphAndLayout(textStyle, content, contentConstraint, layoutWrapper)) {
-            return false;
-        }
-        if (paragraph_->GetLineCount() > 1 || paragraph_->DidExceedMaxLines() ||
-            GreatNotEqual(paragraph_->GetLongestLine(), maxSize.Width())) {
-            if (paragraph != nullptr) {
-                paragraph_ = paragraph;
-            }
-            break;
-        }
-        minFontSize += stepSize;
-        paragraph = paragraph_;
-    }
-    return true;
+    // Use the maximum available font size which layouts the paragraph in 1 line.
+    return SearchAdaptFontSize(textStyle, content, contentConstraint, layoutWrapper,
+        { minFontSize, stepSize, GetAdaptFontSizeMaxIndex(minFontSize, maxFontSize, stepSize) }, [this, &maxSize]() {
+            return paragraph_->GetLineCount() <= 1 && !paragraph_->DidExceedMaxLines() &&
+                   !GreatNotEqual(paragraph_->GetLongestLine(), maxSize.Width());
+        });
 }
 
 std::optional<TextStyle> TextLayoutAlgorithm::GetTextStyle() const
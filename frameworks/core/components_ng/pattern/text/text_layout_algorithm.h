@@ -16,6 +16,7 @@
 #ifndef FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_PATTERN_TEXT_TEXT_LAYOUT_ALGORITHM_H
 #define FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_PATTERN_TEXT_TEXT_LAYOUT_ALGORITHM_H
 
+#include <functional>
 #include <optional>
 #include <string>
 #include <utility>
@@ -29,6 +30,7 @@
 namespace OHOS::Ace::NG {
 class PipelineContext;
 class TextContentModifier;
+class TextPattern;
 
 // TextLayoutAlgorithm acts as the underlying text layout.
 class ACE_EXPORT TextLayoutAlgorithm : public BoxLayoutAlgorithm {
@@ -52,6 +54,9 @@ public:
 
     void Layout(LayoutWrapper* layoutWrapper) override;
 
+    bool CanMeasureInParallel() const override;
+    bool PrepareParallelMeasure(LayoutWrapper* layoutWrapper) override;
+
     const RefPtr<Paragraph>& GetParagraph();
 
     std::list<RefPtr<SpanItem>>&& GetSpanItemChildren();
@@ -61,7 +66,32 @@ public:
     std::optional<TextStyle> GetTextStyle() const;
     void ApplyIndents(const TextStyle& textStyle, double width);
 
+    // count of paragraphs built by the last adaptive font size search
+    int32_t GetAdaptBuildCount() const;
+
 private:
+    // candidate font sizes of adaptive text size: minFontSize + index * stepSize, index in [0, maxIndex]
+    struct AdaptFontSizes {
+        double minFontSize = 0.0;
+        double stepSize = 0.0;
+        int32_t maxIndex = 0;
+    };
+
+    // what MeasureContent reads from the frame node and the pipeline, copied before measuring on a worker.
+    struct ParallelMeasureInputs {
+        TextStyle textStyle;
+        double dipScale = 1.0;
+        double fontScale = 1.0;
+        double logicScale = 1.0;
+    };
+
+    TextStyle CreateTextStyle(const RefPtr<FrameNode>& frameNode, const RefPtr<TextPattern>& pattern,
+        const RefPtr<PipelineContext>& pipeline, const RefPtr<TextLayoutProperty>& textLayoutProperty);
+    std::optional<SizeF> MeasureContentInParallel(
+        const LayoutConstraintF& contentConstraint, LayoutWrapper* layoutWrapper);
+    SizeF GetContentSize(const TextStyle& textStyle, const LayoutConstraintF& contentConstraint, double dipScale,
+        double fontScale, double logicScale);
+
     bool CreateParagraph(const TextStyle& textStyle, std::string content, LayoutWrapper* layoutWrapper);
     bool CreateParagraphAndLayout(const TextStyle& textStyle, const std::string& content,
         const LayoutConstraintF& contentConstraint, LayoutWrapper* layoutWrapper);
@@ -86,6 +116,10 @@ private:
     void SetPropertyToModifier(const RefPtr<TextLayoutProperty>& layoutProperty, RefPtr<TextContentModifier> modifier);
     bool AdaptMaxTextSize(TextStyle& textStyle, const std::string& content, const LayoutConstraintF& contentConstraint,
         const RefPtr<PipelineContext>& pipeline, LayoutWrapper* layoutWrapper);
+    // Binary search the largest font size fitting [isFit], falls back to the smallest font size if none fits.
+    bool SearchAdaptFontSize(TextStyle& textStyle, const std::string& content,
+        const LayoutConstraintF& contentConstraint, LayoutWrapper* layoutWrapper, const AdaptFontSizes& fontSizes,
+        const std::function<bool()>& isFit);
     void UpdateTextColorIfForeground(const RefPtr<FrameNode>& frameNode, TextStyle& textStyle);
     void UpdateParagraph(LayoutWrapper* layoutWrapper);
     OffsetF GetContentOffset(LayoutWrapper* layoutWrapper) const;
@@ -94,6 +128,8 @@ private:
     RefPtr<Paragraph> paragraph_;
     float baselineOffset_ = 0.0f;
     std::optional<TextStyle> textStyle_;
+    int32_t adaptBuildCount_ = 0;
+    std::optional<ParallelMeasureInputs> parallelMeasureInputs_;
 
     ACE_DISALLOW_COPY_AND_MOVE(TextLayoutAlgorithm);
 };
@@ -22,11 +22,13 @@
 #include "base/log/dump_log.h"
 #include "base/utils/utils.h"
 #include "base/window/drag_window.h"
+#include "core/common/font_manager.h"
 #include "core/components_ng/base/ui_node.h"
 #include "core/components_ng/event/gesture_event_hub.h"
 #include "core/components_ng/event/long_press_event.h"
 #include "core/components_ng/manager/select_overlay/select_overlay_manager.h"
 #include "core/components_ng/pattern/select_overlay/select_overlay_property.h"
+#include "core/components_ng/pattern/text/paragraph_cache.h"
 #include "core/components_ng/pattern/text/text_layout_algorithm.h"
 #include "core/components_ng/pattern/text/text_layout_property.h"
 #include "core/components_ng/pattern/text_drag/text_drag_pattern.h"
@@ -45,6 +47,11 @@ namespace OHOS::Ace::NG {
 void TextPattern::OnDetachFromFrameNode(FrameNode* node)
 {
     CloseSelectOverlay();
+    auto pipeline = PipelineContext::GetCurrentContext();
+    CHECK_NULL_VOID(pipeline);
+    auto fontManager = pipeline->GetFontManager();
+    CHECK_NULL_VOID_NOLOG(fontManager);
+    fontManager->UnRegisterCallbackNG(WeakClaim(node));
 }
 
 void TextPattern::CloseSelectOverlay()
@@ -501,6 +508,7 @@ bool TextPattern::IsDraggable(const Offset& offset)
 {
     auto host = GetHost();
     CHECK_NULL_RETURN(host, false);
+    CHECK_NULL_RETURN_NOLOG(paragraph_, false);
     if (copyOption_ != CopyOptions::None && host->IsDraggable() &&
         GreatNotEqual(textSelector_.GetTextEnd(), textSelector_.GetTextStart())) {
         // Determine if the pan location is in the selected area
@@ -609,6 +617,7 @@ std::function<void(Offset)> TextPattern::GetThumbnailCallback()
 // TextDragBase implementations
 float TextPattern::GetLineHeight() const
 {
+    CHECK_NULL_RETURN_NOLOG(paragraph_, {});
     std::vector<Rect> selectedRects;
     paragraph_->GetRectsForRange(textSelector_.GetTextStart(), textSelector_.GetTextEnd(), selectedRects);
     CHECK_NULL_RETURN(selectedRects.size(), {});
@@ -622,6 +631,7 @@ RSTypographyProperties::TextBox TextPattern::ConvertRect(const Rect& rect)
 
 std::vector<RSTypographyProperties::TextBox> TextPattern::GetTextBoxes()
 {
+    CHECK_NULL_RETURN_NOLOG(paragraph_, {});
     std::vector<Rect> selectedRects;
     paragraph_->GetRectsForRange(textSelector_.GetTextStart(), textSelector_.GetTextEnd(), selectedRects);
     std::vector<RSTypographyProperties::TextBox> res;
@@ -656,6 +666,28 @@ bool TextPattern::BetweenSelectedPosition(const Offset& globalOffset)
 // end of TextDragBase implementations
 // ===========================================================
 
+void TextPattern::RegisterFontLoadedCallback(const std::vector<std::string>& fontFamilies)
+{
+    auto host = GetHost();
+    CHECK_NULL_VOID(host);
+    auto pipeline = host->GetContext();
+    CHECK_NULL_VOID(pipeline);
+    auto fontManager = pipeline->GetFontManager();
+    CHECK_NULL_VOID_NOLOG(fontManager);
+    auto callback = [weak = WeakClaim(this)]() {
+        auto pattern = weak.Upgrade();
+        CHECK_NULL_VOID(pattern);
+        auto host = pattern->GetHost();
+        CHECK_NULL_VOID(host);
+        // the paragraph is shaped with fallback fonts before the font is loaded.
+        pattern->paragraph_.Reset();
+        host->MarkDirtyNode(PROPERTY_UPDATE_MEASURE);
+    };
+    for (const auto& fontFamily : fontFamilies) {
+        fontManager->RegisterCallbackNG(WeakPtr<UINode>(host), fontFamily, callback);
+    }
+}
+
 void TextPattern::OnModifyDone()
 {
     auto textLayoutProperty = GetLayoutProperty<TextLayoutProperty>();
@@ -668,6 +700,11 @@ void TextPattern::OnModifyDone()
         paragraph_.Reset();
     }
 
+    auto fontFamilies = textLayoutProperty->GetFontFamily();
+    if (fontFamilies.has_value()) {
+        RegisterFontLoadedCallback(fontFamilies.value());
+    }
+
     bool shouldClipToContent = textLayoutProperty->GetTextOverflow().value_or(TextOverflow::CLIP) == TextOverflow::CLIP;
     host->GetRenderContext()->SetClipToFrame(shouldClipToContent);
 
@@ -768,6 +805,10 @@ void TextPattern::BeforeCreateLayoutWrapper()
             spanNode->CleanSpanItemChildren();
             UpdateChildProperty(spanNode);
             spanNode->MountToParagraph();
+            const auto& fontStyle = spanNode->GetSpanItem()->fontStyle;
+            if (fontStyle && fontStyle->HasFontFamily()) {
+                RegisterFontLoadedCallback(fontStyle->GetFontFamilyValue());
+            }
             textForDisplay_.append(spanNode->GetSpanItem()->content);
             if (spanNode->GetSpanItem()->onClick) {
                 isSpanHasClick = true;
@@ -809,6 +850,54 @@ void TextPattern::OnVisibleChange(bool isVisible)
     }
 }
 
+bool TextPattern::IsParagraphShared() const
+{
+    CHECK_NULL_RETURN_NOLOG(paragraph_, false);
+    // owners besides other text nodes: this pattern, its content modifier and the entry of ParagraphCache.
+    int32_t ownerCount = 1;
+    if (textContentModifier_ && textContentModifier_->GetParagraph() == paragraph_) {
+        ++ownerCount;
+    }
+    if (ParagraphCache::GetInstance().Contains(paragraph_)) {
+        ++ownerCount;
+    }
+    return paragraph_->RefCount() > ownerCount;
+}
+
+size_t TextPattern::GetHibernationSize() const
+{
+    // shaped glyphs, positions and line metrics, roughly per byte of text.
+    constexpr size_t PARAGRAPH_BYTES_PER_CHAR = 32;
+    CHECK_NULL_RETURN_NOLOG(paragraph_, 0);
+    // a paragraph shared with other text nodes stays alive.
+    if (IsParagraphShared()) {
+        return 0;
+    }
+    return textForDisplay_.size() * PARAGRAPH_BYTES_PER_CHAR;
+}
+
+void TextPattern::OnHibernate()
+{
+    if (textSelector_.IsValid()) {
+        CloseSelectOverlay();
+    }
+    if (paragraph_ && !IsParagraphShared()) {
+        ParagraphCache::GetInstance().Remove(paragraph_);
+    }
+    paragraph_.Reset();
+    if (textContentModifier_) {
+        textContentModifier_->SetParagraph(nullptr);
+    }
+}
+
+void TextPattern::OnRehydrate()
+{
+    auto host = GetHost();
+    CHECK_NULL_VOID(host);
+    // the geometry is kept, the paragraph is shaped again in the next measure.
+    host->MarkDirtyNode(PROPERTY_UPDATE_MEASURE);
+}
+
 void TextPattern::AddChildSpanItem(const RefPtr<UINode>& child)
 {
     CHECK_NULL_VOID(child);
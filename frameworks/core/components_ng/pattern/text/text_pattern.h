@@ -145,6 +145,9 @@ public:
     }
 
     void OnVisibleChange(bool isVisible) override;
+    size_t GetHibernationSize() const override;
+    void OnHibernate() override;
+    void OnRehydrate() override;
 
     // ===========================================================
     // TextDragBase implementations
@@ -228,6 +231,10 @@ private:
     std::string GetSelectedText(int32_t start, int32_t end) const;
     std::wstring GetWideText() const;
     void UpdateChildProperty(const RefPtr<SpanNode>& child) const;
+    // relayout only when the custom fonts used by the text are loaded.
+    void RegisterFontLoadedCallback(const std::vector<std::string>& fontFamilies);
+    // whether the paragraph is held by other text nodes, which share it through ParagraphCache.
+    bool IsParagraphShared() const;
 
     std::list<RefPtr<SpanItem>> spanItemChildren_;
     std::string textForDisplay_;
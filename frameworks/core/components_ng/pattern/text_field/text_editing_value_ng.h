@@ -17,8 +17,10 @@
 #define FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_PATTERNS_TEXT_FIELD_TEXT_EDITING_VALUE_H
 
 #include <algorithm>
+#include <cstdint>
 #include <functional>
 #include <string>
+#include <utility>
 
 #include "base/utils/string_utils.h"
 
@@ -27,7 +29,7 @@ namespace OHOS::Ace::NG {
 struct TextEditingValueNG {
     bool operator==(const TextEditingValueNG& other) const
     {
-        return text == other.text;
+        return text_ == other.text_;
     }
 
     bool operator!=(const TextEditingValueNG& other) const
@@ -35,9 +37,44 @@ struct TextEditingValueNG {
         return !operator==(other);
     }
 
-    std::wstring GetWideText() const
+    const std::string& GetText() const
     {
-        return StringUtils::ToWstring(text);
+        return text_;
+    }
+
+    void SetText(std::string text)
+    {
+        text_ = std::move(text);
+        isWideTextDirty_ = true;
+    }
+
+    // utf-16 text is converted again only after the text is set, edits through Replace keep it up to date.
+    const std::wstring& GetWideText() const
+    {
+        if (isWideTextDirty_) {
+            wideText_ = StringUtils::ToWstring(text_);
+            isWideTextDirty_ = false;
+        }
+        return wideText_;
+    }
+
+    // Replace utf-16 range [start, end) of the text by [value] in place, without converting the whole text.
+    void Replace(int32_t start, int32_t end, const std::string& value)
+    {
+        const auto& wideText = GetWideText();
+        auto length = static_cast<int32_t>(wideText.length());
+        start = std::clamp(start, 0, length);
+        end = std::clamp(end, start, length);
+        auto wideValue = StringUtils::ToWstring(value);
+        if (wideText.empty() && !text_.empty()) {
+            // text is not valid utf-8 and converts to nothing, same as replacing the whole text.
+            SetText(value);
+            return;
+        }
+        auto byteStart = GetUtf8Length(wideText, 0, start);
+        auto byteEnd = byteStart + GetUtf8Length(wideText, start, end);
+        text_.replace(byteStart, byteEnd - byteStart, value);
+        wideText_.replace(start, end - start, wideValue);
     }
 
     void CursorMoveLeft()
@@ -57,7 +94,7 @@ struct TextEditingValueNG {
 
     std::string GetValueBeforeCursor() const
     {
-        auto wideText = GetWideText();
+        const auto& wideText = GetWideText();
         if (caretPosition > static_cast<int32_t>(wideText.length()) || caretPosition <= 0) {
             return "";
         }
@@ -66,7 +103,7 @@ struct TextEditingValueNG {
 
     std::string GetValueAfterCursor() const
     {
-        auto wideText = GetWideText();
+        const auto& wideText = GetWideText();
         if (caretPosition > static_cast<int32_t>(wideText.length()) || caretPosition < 0) {
             return "";
         }
@@ -75,7 +112,7 @@ struct TextEditingValueNG {
 
     std::string GetValueBeforePosition(int32_t position) const
     {
-        auto wideText = GetWideText();
+        const auto& wideText = GetWideText();
         position = std::clamp(position, 0, static_cast<int32_t>(wideText.length()));
         LOGI("GetValueBeforePosition %{public}d", position);
         return StringUtils::ToString(wideText.substr(0, position));
@@ -83,7 +120,7 @@ struct TextEditingValueNG {
 
     std::string GetValueAfterPosition(int32_t position) const
     {
-        auto wideText = GetWideText();
+        const auto& wideText = GetWideText();
         position = std::clamp(position, 0, static_cast<int32_t>(wideText.length()));
         LOGI("GetValueAfterPosition %{public}d", position);
         return StringUtils::ToString(wideText.substr(position));
@@ -91,7 +128,7 @@ struct TextEditingValueNG {
 
     std::string GetSelectedText(int32_t start, int32_t end) const
     {
-        auto wideText = GetWideText();
+        const auto& wideText = GetWideText();
         auto min = std::clamp(std::max(std::min(start, end), 0), 0, static_cast<int32_t>(wideText.length()));
         auto max = std::clamp(std::min(std::max(start, end), static_cast<int32_t>(wideText.length())), 0,
             static_cast<int32_t>(wideText.length()));
@@ -105,13 +142,13 @@ struct TextEditingValueNG {
 
     char16_t LastChar() const
     {
-        if (text.empty()) {
+        if (text_.empty()) {
             return 0;
         }
-        if (static_cast<size_t>(caretPosition) > text.length()) {
+        if (static_cast<size_t>(caretPosition) > text_.length()) {
             return 0;
         }
-        return text[std::max(0, caretPosition - 1)];
+        return text_[std::max(0, caretPosition - 1)];
     }
 
     std::string ToString() const
@@ -121,12 +158,97 @@ struct TextEditingValueNG {
 
     void Reset()
     {
-        text.clear();
+        SetText("");
         caretPosition = 0;
     }
 
-    std::string text;
     int32_t caretPosition = 0;
+
+private:
+    static size_t GetUtf8Length(const std::wstring& wideText, int32_t start, int32_t end)
+    {
+        constexpr uint32_t ONE_BYTE_MAX = 0x7F;
+        constexpr uint32_t TWO_BYTES_MAX = 0x7FF;
+        constexpr uint32_t SURROGATE_MIN = 0xD800;
+        constexpr uint32_t SURROGATE_MAX = 0xDFFF;
+        constexpr uint32_t THREE_BYTES_MAX = 0xFFFF;
+        constexpr size_t SURROGATE_BYTES = 2;
+        constexpr size_t THREE_BYTES = 3;
+        constexpr size_t FOUR_BYTES = 4;
+        size_t length = 0;
+        for (auto i = start; i < end; ++i) {
+            auto code = static_cast<uint32_t>(wideText[i]);
+            if (code <= ONE_BYTE_MAX) {
+                length += 1;
+            } else if (code <= TWO_BYTES_MAX) {
+                length += 2;
+            } else if (code >= SURROGATE_MIN && code <= SURROGATE_MAX) {
+                // a surrogate pair is encoded in 4 bytes
+                length += SURROGATE_BYTES;
+            } else if (code <= THREE_BYTES_MAX) {
+                length += THREE_BYTES;
+            } else {
+                length += FOUR_BYTES;
+            }
+        }
+        return length;
+    }
+
+    std::string text_;
+    mutable std::wstring wideText_;
+    mutable bool isWideTextDirty_ = false;
+};
+
+// Change between two successive recorded values of the editing text on utf-8 bytes, so undo and redo records keep
+// the changed part only instead of the whole text.
+struct TextEditRecordNG {
+    static TextEditRecordNG Make(const std::string& before, const std::string& after)
+    {
+        auto isContinuation = [](const std::string& str, size_t index) {
+            constexpr uint8_t CONTINUATION_MASK = 0xC0;
+            constexpr uint8_t CONTINUATION_BYTE = 0x80;
+            return index < str.size() && (static_cast<uint8_t>(str[index]) & CONTINUATION_MASK) == CONTINUATION_BYTE;
+        };
+        auto minLength = std::min(before.size(), after.size());
+        size_t prefix = 0;
+        while (prefix < minLength && before[prefix] == after[prefix]) {
+            ++prefix;
+        }
+        // don't split a character
+        while (prefix > 0 && (isContinuation(before, prefix) || isContinuation(after, prefix))) {
+            --prefix;
+        }
+        size_t suffix = 0;
+        while (suffix < minLength - prefix &&
+               before[before.size() - suffix - 1] == after[after.size() - suffix - 1]) {
+            ++suffix;
+        }
+        while (suffix > 0 && (isContinuation(before, before.size() - suffix) ||
+                                 isContinuation(after, after.size() - suffix))) {
+            --suffix;
+        }
+        TextEditRecordNG record;
+        record.offset = prefix;
+        record.removedText = before.substr(prefix, before.size() - prefix - suffix);
+        record.insertedText = after.substr(prefix, after.size() - prefix - suffix);
+        return record;
+    }
+
+    void Apply(std::string& text) const
+    {
+        text.replace(offset, removedText.size(), insertedText);
+    }
+
+    void Revert(std::string& text) const
+    {
+        text.replace(offset, insertedText.size(), removedText);
+    }
+
+    size_t offset = 0;
+    std::string removedText;
+    std::string insertedText;
+    int32_t caretBefore = 0;
+    int32_t caretAfter = 0;
 };
 
 } // namespace OHOS::Ace::NG
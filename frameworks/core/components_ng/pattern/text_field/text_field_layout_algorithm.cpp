@@ -29,6 +29,7 @@
 #include "core/components/text/text_theme.h"
 #include "core/components/theme/theme_manager.h"
 #include "core/components_ng/base/frame_node.h"
+#include "core/components_ng/pattern/text/paragraph_cache.h"
 #include "core/components_ng/pattern/text/text_layout_property.h"
 #include "core/components_ng/pattern/text_field/text_field_layout_property.h"
 #include "core/components_ng/pattern/text_field/text_field_pattern.h"
@@ -186,16 +187,30 @@ std::optional<SizeF> TextFieldLayoutAlgorithm::MeasureContent(
     auto isPasswordType =
         textFieldLayoutProperty->GetTextInputTypeValue(TextInputType::UNSPECIFIED) == TextInputType::VISIBLE_PASSWORD;
     auto disableTextAlign = !pattern->IsTextArea() && textFieldLayoutProperty->GetWidthAutoValue(false);
+    auto needObscureText = isPasswordType && pattern->GetTextObscured() && !showPlaceHolder;
     if (pattern->IsDragging()) {
         TextStyle dragTextStyle = textStyle;
         Color color = textStyle.GetTextColor().ChangeAlpha(DRAGGED_TEXT_OPACITY);
         dragTextStyle.SetTextColor(color);
         std::vector<TextStyle> textStyles { textStyle, dragTextStyle, textStyle };
-        CreateParagraph(textStyles, pattern->GetDragContents(), textContent,
-            isPasswordType && pattern->GetTextObscured() && !showPlaceHolder, disableTextAlign);
+        CreateParagraph(textStyles, pattern->GetDragContents(), textContent, needObscureText, disableTextAlign);
+        paragraphKey_.reset();
     } else {
-        CreateParagraph(textStyle, textContent,
-            isPasswordType && pattern->GetTextObscured() && !showPlaceHolder, disableTextAlign);
+        paragraphKey_ = TextFieldParagraphKey { textContent, textStyle, needObscureText, disableTextAlign,
+            Localization::GetInstance()->GetFontLocale(), pipeline->GetDipScale(), pipeline->GetFontScale(),
+            ParagraphCache::GetInstance().GetGeneration(), GetTextDirection(textContent) };
+        const auto& lastParagraph = pattern->GetParagraph();
+        const auto& lastKey = pattern->GetParagraphKey();
+        if (lastParagraph && lastKey == paragraphKey_) {
+            paragraph_ = lastParagraph;
+        } else if (pattern->IsTextArea() && !showPlaceHolder && !needObscureText &&
+                   textStyle.GetMaxLines() == std::numeric_limits<uint32_t>::max()) {
+            // lines of a text area without max lines are laid out apart, an edit relays out the edited lines only.
+            CreateSplitParagraph(textStyle, textContent, disableTextAlign,
+                lastKey && lastKey->IsSameStyle(paragraphKey_.value()) ? lastParagraph : nullptr);
+        } else {
+            CreateParagraph(textStyle, textContent, needObscureText, disableTextAlign);
+        }
     }
     if (textStyle.GetMaxLines() == 1 && !showPlaceHolder) {
         // for text input case, need to measure in one line without constraint.
@@ -332,7 +347,7 @@ void TextFieldLayoutAlgorithm::Layout(LayoutWrapper* layoutWrapper)
         auto textOffset = Alignment::GetAlignPosition(contentSize, textRect_.GetSize(), Alignment::CENTER_LEFT);
         // adjust text rect to the basic padding
         auto textRectOffsetX = pattern->GetPaddingLeft();
-        auto isEmptyTextEditValue = pattern->GetTextEditingValue().text.empty();
+        auto isEmptyTextEditValue = pattern->GetTextEditingValue().GetText().empty();
         if (!isEmptyTextEditValue) {
             switch (layoutProperty->GetTextAlignValue(TextAlign::START)) {
                 case TextAlign::START:
@@ -439,11 +454,11 @@ void TextFieldLayoutAlgorithm::UpdatePlaceholderTextStyle(const RefPtr<TextField
     textStyle.SetTextAlign(layoutProperty->GetTextAlignValue(TextAlign::START));
 }
 
-void TextFieldLayoutAlgorithm::CreateParagraph(const TextStyle& textStyle, std::string content,
-    bool needObscureText, bool disableTextAlign)
+RSParagraphStyle TextFieldLayoutAlgorithm::CreateParagraphStyle(
+    const TextStyle& textStyle, TextDirection textDirection, bool disableTextAlign)
 {
     RSParagraphStyle paraStyle;
-    paraStyle.textDirection_ = ToRSTextDirection(GetTextDirection(content));
+    paraStyle.textDirection_ = ToRSTextDirection(textDirection);
     if (!disableTextAlign) {
         paraStyle.textAlign_ = ToRSTextAlign(textStyle.GetTextAlign());
     }
@@ -455,6 +470,13 @@ void TextFieldLayoutAlgorithm::CreateParagraph(const TextStyle& textStyle, std::
     if (textStyle.GetTextOverflow() == TextOverflow::ELLIPSIS) {
         paraStyle.ellipsis_ = StringUtils::Str8ToStr16(StringUtils::ELLIPSIS);
     }
+    return paraStyle;
+}
+
+void TextFieldLayoutAlgorithm::CreateParagraph(const TextStyle& textStyle, std::string content,
+    bool needObscureText, bool disableTextAlign)
+{
+    auto paraStyle = CreateParagraphStyle(textStyle, GetTextDirection(content), disableTextAlign);
     auto builder = RSParagraphBuilder::CreateRosenBuilder(paraStyle, RSFontCollection::GetInstance(false));
     builder->PushStyle(ToRSTextStyle(PipelineContext::GetCurrentContext(), textStyle));
     StringUtils::TransformStrCase(content, static_cast<int32_t>(textStyle.GetTextCase()));
@@ -467,7 +489,26 @@ void TextFieldLayoutAlgorithm::CreateParagraph(const TextStyle& textStyle, std::
     builder->Pop();
 
     auto paragraph = builder->Build();
-    paragraph_.reset(paragraph.release());
+    paragraph_ = std::make_shared<TextFieldParagraph>(std::shared_ptr<RSParagraph>(paragraph.release()));
+}
+
+void TextFieldLayoutAlgorithm::CreateSplitParagraph(const TextStyle& textStyle, std::string content,
+    bool disableTextAlign, const std::shared_ptr<TextFieldParagraph>& lastParagraph)
+{
+    // all lines take the direction of the whole content, as a single paragraph does.
+    auto paraStyle = CreateParagraphStyle(textStyle, GetTextDirection(content), disableTextAlign);
+    auto rsTextStyle = ToRSTextStyle(PipelineContext::GetCurrentContext(), textStyle);
+    StringUtils::TransformStrCase(content, static_cast<int32_t>(textStyle.GetTextCase()));
+    paragraph_ = std::make_shared<TextFieldParagraph>(StringUtils::Str8ToStr16(content),
+        [paraStyle, rsTextStyle](const std::u16string& line) {
+            auto builder = RSParagraphBuilder::CreateRosenBuilder(paraStyle, RSFontCollection::GetInstance(false));
+            builder->PushStyle(rsTextStyle);
+            builder->AddText(line);
+            builder->Pop();
+            auto paragraph = builder->Build();
+            return std::shared_ptr<RSParagraph>(paragraph.release());
+        },
+        lastParagraph);
 }
 
 void TextFieldLayoutAlgorithm::CreateParagraph(const std::vector<TextStyle>& textStyles,
@@ -506,7 +547,7 @@ void TextFieldLayoutAlgorithm::CreateParagraph(const std::vector<TextStyle>& tex
     builder->Pop();
 
     auto paragraph = builder->Build();
-    paragraph_.reset(paragraph.release());
+    paragraph_ = std::make_shared<TextFieldParagraph>(std::shared_ptr<RSParagraph>(paragraph.release()));
 }
 
 void TextFieldLayoutAlgorithm::CreateCounterParagraph(
@@ -545,7 +586,7 @@ TextDirection TextFieldLayoutAlgorithm::GetTextDirection(const std::string& cont
     return textDirection;
 }
 
-const std::shared_ptr<RSParagraph>& TextFieldLayoutAlgorithm::GetParagraph()
+const std::shared_ptr<TextFieldParagraph>& TextFieldLayoutAlgorithm::GetParagraph()
 {
     return paragraph_;
 }
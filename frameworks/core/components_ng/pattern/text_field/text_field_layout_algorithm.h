@@ -16,22 +16,54 @@
 #ifndef FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_PATTERN_TEXT_FIELD_TEXT_FIELD_LAYOUT_ALGORITHM_H
 #define FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_PATTERN_TEXT_FIELD_TEXT_FIELD_LAYOUT_ALGORITHM_H
 
+#include <optional>
 #include <string>
 #include <utility>
 
 #include "base/geometry/ng/offset_t.h"
 #include "base/geometry/rect.h"
 #include "base/memory/referenced.h"
+#include "base/utils/utils.h"
 #include "core/components/text_field/textfield_theme.h"
 #include "core/components_ng/layout/layout_wrapper.h"
 #include "core/components_ng/pattern/text/text_styles.h"
 #include "core/components_ng/pattern/text_field/text_field_layout_property.h"
+#include "core/components_ng/pattern/text_field/text_field_paragraph.h"
 #include "core/components_ng/render/drawing.h"
 
 namespace OHOS::Ace::NG {
 
 constexpr Dimension SCROLL_BAR_LEFT_WIDTH = 2.0_vp;
 
+// Inputs of the paragraph built by a measure. Measures with the same inputs, e.g. when the caret or the selection
+// moves, reuse the paragraph of the last measure instead of building and shaping it again.
+struct TextFieldParagraphKey {
+    std::string content;
+    TextStyle textStyle;
+    bool needObscureText = false;
+    bool disableTextAlign = false;
+    std::string fontLocale;
+    double dipScale = 1.0;
+    float fontScale = 1.0f;
+    uint64_t fontGeneration = 0;
+    TextDirection textDirection = TextDirection::LTR;
+
+    // whether the paragraphs of the keys are built with the same styles, only their contents may differ.
+    bool IsSameStyle(const TextFieldParagraphKey& other) const
+    {
+        return needObscureText == other.needObscureText && disableTextAlign == other.disableTextAlign &&
+               NearEqual(dipScale, other.dipScale) && NearEqual(fontScale, other.fontScale) &&
+               fontGeneration == other.fontGeneration && textDirection == other.textDirection &&
+               fontLocale == other.fontLocale && textStyle == other.textStyle &&
+               textStyle.HasHeightOverride() == other.textStyle.HasHeightOverride();
+    }
+
+    bool operator==(const TextFieldParagraphKey& other) const
+    {
+        return IsSameStyle(other) && content == other.content;
+    }
+};
+
 class TextFieldContentModifier;
 class ACE_EXPORT TextFieldLayoutAlgorithm : public LayoutAlgorithm {
     DECLARE_ACE_TYPE(TextFieldLayoutAlgorithm, LayoutAlgorithm);
@@ -53,10 +85,16 @@ public:
 
     void Layout(LayoutWrapper* layoutWrapper) override;
 
-    const std::shared_ptr<RSParagraph>& GetParagraph();
+    const std::shared_ptr<TextFieldParagraph>& GetParagraph();
 
     const std::shared_ptr<RSParagraph>& GetCounterParagraph() const;
 
+    // empty if the paragraph is not reusable, e.g. it's built with dragged contents.
+    const std::optional<TextFieldParagraphKey>& GetParagraphKey() const
+    {
+        return paragraphKey_;
+    }
+
     const RectF& GetTextRect() const
     {
         return textRect_;
@@ -102,6 +140,10 @@ public:
 
 private:
     void CreateParagraph(const TextStyle& textStyle, std::string content, bool needObscureText, bool disableTextAlign);
+    void CreateSplitParagraph(const TextStyle& textStyle, std::string content, bool disableTextAlign,
+        const std::shared_ptr<TextFieldParagraph>& lastParagraph);
+    static RSParagraphStyle CreateParagraphStyle(
+        const TextStyle& textStyle, TextDirection textDirection, bool disableTextAlign);
     void CreateParagraph(const std::vector<TextStyle>& textStyles, const std::vector<std::string>& contents,
         const std::string& content, bool needObscureText, bool disableTextAlign);
     void CreateCounterParagraph(int32_t textLength, int32_t maxLength, const RefPtr<TextFieldTheme>& theme);
@@ -118,8 +160,9 @@ private:
     int32_t ConvertTouchOffsetToCaretPosition(const Offset& localOffset);
     void UpdateUnitLayout(LayoutWrapper* layoutWrapper);
 
-    std::shared_ptr<RSParagraph> paragraph_;
+    std::shared_ptr<TextFieldParagraph> paragraph_;
     std::shared_ptr<RSParagraph> counterParagraph_;
+    std::optional<TextFieldParagraphKey> paragraphKey_;
     RectF frameRect_;
     RectF textRect_;
     RectF imageRect_;
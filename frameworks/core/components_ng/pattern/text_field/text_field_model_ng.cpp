@@ -46,7 +46,7 @@ void TextFieldModelNG::CreateNode(
     CHECK_NULL_VOID(textFieldLayoutProperty);
     auto pattern = frameNode->GetPattern<TextFieldPattern>();
     auto textEditingValue = pattern->GetTextEditingValue();
-    if (value.has_value() && value.value() != textEditingValue.text) {
+    if (value.has_value() && value.value() != textEditingValue.GetText()) {
         pattern->InitEditingValueText(value.value());
     }
     textFieldLayoutProperty->UpdatePlaceholder(placeholder.value_or(""));
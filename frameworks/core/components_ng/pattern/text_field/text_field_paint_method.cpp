@@ -62,7 +62,7 @@ void TextFieldPaintMethod::UpdateContentModifier(PaintWrapper* paintWrapper)
     auto textFieldPattern = DynamicCast<TextFieldPattern>(pattern_.Upgrade());
     CHECK_NULL_VOID(textFieldPattern);
     auto textEditingValue = textFieldPattern->GetTextEditingValue();
-    std::string text = textEditingValue.text;
+    std::string text = textEditingValue.GetText();
     textFieldContentModifier_->SetTextValue(text);
     textFieldContentModifier_->SetPlaceholderValue(textFieldPattern->GetPlaceHolder());
     textFieldContentModifier_->SetTextRectY(textFieldPattern->GetTextRect().GetY());
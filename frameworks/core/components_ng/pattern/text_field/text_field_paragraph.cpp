@@ -0,0 +1,237 @@
+/*
+ * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "core/components_ng/pattern/text_field/text_field_paragraph.h"
+
+#include <algorithm>
+
+#include "base/utils/utils.h"
+
+namespace OHOS::Ace::NG {
+namespace {
+constexpr char16_t LINE_BREAK = u'\n';
+} // namespace
+
+TextFieldParagraph::TextFieldParagraph(std::shared_ptr<RSParagraph> paragraph)
+{
+    Line line;
+    line.paragraph = std::move(paragraph);
+    lines_.emplace_back(std::move(line));
+}
+
+TextFieldParagraph::TextFieldParagraph(
+    const std::u16string& content, LineBuilder&& builder, const std::shared_ptr<TextFieldParagraph>& lastParagraph)
+    : builder_(std::move(builder)), content_(content), isSplit_(true)
+{
+    size_t start = 0;
+    while (true) {
+        auto end = content_.find(LINE_BREAK, start);
+        Line line;
+        line.start = start;
+        line.text = content_.substr(start, end == std::u16string::npos ? std::u16string::npos : end - start);
+        lines_.emplace_back(std::move(line));
+        if (end == std::u16string::npos) {
+            break;
+        }
+        start = end + 1;
+    }
+
+    // an edit changes the lines around the caret, the lines before and after them keep their paragraphs.
+    size_t head = 0;
+    size_t tail = 0;
+    if (lastParagraph && lastParagraph->IsSplit()) {
+        const auto& lastLines = lastParagraph->lines_;
+        auto count = std::min(lines_.size(), lastLines.size());
+        while (head < count && lines_[head].text == lastLines[head].text) {
+            ++head;
+        }
+        while (tail < count - head &&
+               lines_[lines_.size() - 1 - tail].text == lastLines[lastLines.size() - 1 - tail].text) {
+            ++tail;
+        }
+        auto takeLine = [](Line& line, const Line& lastLine) {
+            line.paragraph = lastLine.paragraph;
+            line.height = lastLine.height;
+            line.layoutWidth = lastLine.layoutWidth;
+        };
+        for (size_t i = 0; i < head; ++i) {
+            takeLine(lines_[i], lastLines[i]);
+        }
+        for (size_t i = 1; i <= tail; ++i) {
+            takeLine(lines_[lines_.size() - i], lastLines[lastLines.size() - i]);
+        }
+    }
+    for (auto& line : lines_) {
+        if (!line.paragraph) {
+            line.paragraph = builder_(line.text);
+            ++builtCount_;
+        }
+    }
+}
+
+void TextFieldParagraph::Layout(double width)
+{
+    width_ = width;
+    double top = 0.0;
+    for (auto& line : lines_) {
+        // a line taken from the last paragraph is laid out already, unless the width changes.
+        if (!isSplit_ || !NearEqual(line.layoutWidth, width)) {
+            line.paragraph->Layout(width);
+            line.layoutWidth = width;
+            line.height = line.paragraph->GetHeight();
+        }
+        line.top = top;
+        top += line.height;
+    }
+    if (wholeParagraph_) {
+        wholeParagraph_->Layout(width);
+    }
+}
+
+double TextFieldParagraph::GetHeight() const
+{
+    if (!isSplit_) {
+        return lines_.front().paragraph->GetHeight();
+    }
+    const auto& lastLine = lines_.back();
+    return lastLine.top + lastLine.height;
+}
+
+double TextFieldParagraph::GetMaxWidth() const
+{
+    if (!isSplit_) {
+        return lines_.front().paragraph->GetMaxWidth();
+    }
+    return width_;
+}
+
+double TextFieldParagraph::GetMaxIntrinsicWidth() const
+{
+    double width = 0.0;
+    for (const auto& line : lines_) {
+        width = std::max(width, static_cast<double>(line.paragraph->GetMaxIntrinsicWidth()));
+    }
+    return width;
+}
+
+double TextFieldParagraph::GetLongestLine() const
+{
+    double width = 0.0;
+    for (const auto& line : lines_) {
+        width = std::max(width, static_cast<double>(line.paragraph->GetLongestLine()));
+    }
+    return width;
+}
+
+void TextFieldParagraph::Paint(RSCanvas* canvas, double x, double y) const
+{
+    for (const auto& line : lines_) {
+        line.paragraph->Paint(canvas, x, y + line.top);
+    }
+}
+
+std::vector<RSTypographyProperties::TextBox> TextFieldParagraph::GetRectsForRange(size_t start, size_t end,
+    RSTypographyProperties::RectHeightStyle heightStyle, RSTypographyProperties::RectWidthStyle widthStyle) const
+{
+    if (!isSplit_) {
+        return lines_.front().paragraph->GetRectsForRange(start, end, heightStyle, widthStyle);
+    }
+    std::vector<RSTypographyProperties::TextBox> boxes;
+    const Line* lineBreakLine = nullptr;
+    for (const auto& line : lines_) {
+        auto lineEnd = line.start + line.text.length();
+        if (lineEnd < start) {
+            continue;
+        }
+        if (line.start >= end) {
+            break;
+        }
+        if (!lineBreakLine && lineEnd >= start && lineEnd < end && &line != &lines_.back()) {
+            lineBreakLine = &line;
+        }
+        auto rangeStart = std::max(start, line.start) - line.start;
+        auto rangeEnd = std::min(end, lineEnd) - line.start;
+        if (rangeStart >= rangeEnd) {
+            continue;
+        }
+        auto lineBoxes = line.paragraph->GetRectsForRange(rangeStart, rangeEnd, heightStyle, widthStyle);
+        for (auto& box : lineBoxes) {
+            box.rect_.Offset(0.0f, static_cast<float>(line.top));
+            boxes.emplace_back(box);
+        }
+    }
+    // a range of line breaks only, e.g. the caret at the start of a line, is the line break of the line above.
+    if (boxes.empty() && lineBreakLine) {
+        boxes.emplace_back(GetLineBreakBox(*lineBreakLine));
+    }
+    return boxes;
+}
+
+RSTypographyProperties::TextBox TextFieldParagraph::GetLineBreakBox(const Line& line) const
+{
+    auto lineBoxes = line.text.empty() ? std::vector<RSTypographyProperties::TextBox>()
+                                       : line.paragraph->GetRectsForRange(line.text.length() - 1, line.text.length(),
+                                             RSTypographyProperties::RectHeightStyle::MAX,
+                                             RSTypographyProperties::RectWidthStyle::TIGHT);
+    if (lineBoxes.empty()) {
+        auto top = static_cast<float>(line.top);
+        auto bottom = static_cast<float>(line.top + line.height);
+        return RSTypographyProperties::TextBox(RSRect(0.0f, top, 0.0f, bottom), RSTextDirection::LTR);
+    }
+    auto box = lineBoxes.back();
+    auto right = box.rect_.GetRight();
+    return RSTypographyProperties::TextBox(
+        RSRect(right, box.rect_.GetTop() + static_cast<float>(line.top), right,
+            box.rect_.GetBottom() + static_cast<float>(line.top)),
+        box.direction_);
+}
+
+const TextFieldParagraph::Line& TextFieldParagraph::GetLineAtCoordinate(double y) const
+{
+    auto iter = std::find_if(
+        lines_.begin(), lines_.end(), [y](const Line& line) { return LessNotEqual(y, line.top + line.height); });
+    return iter == lines_.end() ? lines_.back() : *iter;
+}
+
+RSTypographyProperties::PositionAndAffinity TextFieldParagraph::GetGlyphPositionAtCoordinate(double x, double y) const
+{
+    const auto& line = GetLineAtCoordinate(y);
+    auto position = line.paragraph->GetGlyphPositionAtCoordinate(x, y - line.top);
+    return RSTypographyProperties::PositionAndAffinity(position.pos_ + line.start, position.affinity_);
+}
+
+RSTypographyProperties::PositionAndAffinity TextFieldParagraph::GetGlyphPositionAtCoordinateWithCluster(
+    double x, double y) const
+{
+    const auto& line = GetLineAtCoordinate(y);
+    auto position = line.paragraph->GetGlyphPositionAtCoordinateWithCluster(x, y - line.top);
+    return RSTypographyProperties::PositionAndAffinity(position.pos_ + line.start, position.affinity_);
+}
+
+std::shared_ptr<RSParagraph> TextFieldParagraph::GetWholeParagraph()
+{
+    if (!isSplit_) {
+        return lines_.front().paragraph;
+    }
+    if (!wholeParagraph_ && builder_) {
+        wholeParagraph_ = builder_(content_);
+        if (wholeParagraph_ && width_ >= 0.0) {
+            wholeParagraph_->Layout(width_);
+        }
+    }
+    return wholeParagraph_;
+}
+
+} // namespace OHOS::Ace::NG
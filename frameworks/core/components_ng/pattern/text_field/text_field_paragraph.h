@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_PATTERN_TEXT_FIELD_TEXT_FIELD_PARAGRAPH_H
+#define FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_PATTERN_TEXT_FIELD_TEXT_FIELD_PARAGRAPH_H
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "core/components_ng/render/drawing.h"
+
+namespace OHOS::Ace::NG {
+
+// The laid out content of a text field. A text field keeps its content in one paragraph. A text area may split it
+// into a paragraph per line, so that an edit builds and lays out the edited lines only and the other lines are
+// shifted. Positions and coordinates are those of the whole content in both cases.
+class TextFieldParagraph final {
+public:
+    // builds the paragraph of a line, with the styles of the whole content.
+    using LineBuilder = std::function<std::shared_ptr<RSParagraph>(const std::u16string& line)>;
+
+    explicit TextFieldParagraph(std::shared_ptr<RSParagraph> paragraph);
+    // Lines equal to the lines of [lastParagraph] at the same distance from the start or from the end of the content
+    // take the paragraphs of [lastParagraph], which must have been built by the same builder.
+    TextFieldParagraph(const std::u16string& content, LineBuilder&& builder,
+        const std::shared_ptr<TextFieldParagraph>& lastParagraph);
+    ~TextFieldParagraph() = default;
+
+    bool IsSplit() const
+    {
+        return isSplit_;
+    }
+
+    size_t GetLineParagraphCount() const
+    {
+        return lines_.size();
+    }
+
+    // count of the line paragraphs built by this paragraph, the others are taken from the last paragraph.
+    size_t GetBuiltLineParagraphCount() const
+    {
+        return builtCount_;
+    }
+
+    void Layout(double width);
+    double GetHeight() const;
+    double GetMaxWidth() const;
+    double GetMaxIntrinsicWidth() const;
+    double GetLongestLine() const;
+    void Paint(RSCanvas* canvas, double x, double y) const;
+
+    std::vector<RSTypographyProperties::TextBox> GetRectsForRange(size_t start, size_t end,
+        RSTypographyProperties::RectHeightStyle heightStyle, RSTypographyProperties::RectWidthStyle widthStyle) const;
+    RSTypographyProperties::PositionAndAffinity GetGlyphPositionAtCoordinate(double x, double y) const;
+    RSTypographyProperties::PositionAndAffinity GetGlyphPositionAtCoordinateWithCluster(double x, double y) const;
+
+    // the content in one paragraph, e.g. to paint the dragged text. Built on demand for a split content.
+    std::shared_ptr<RSParagraph> GetWholeParagraph();
+
+private:
+    struct Line {
+        std::u16string text;
+        std::shared_ptr<RSParagraph> paragraph;
+        // position of the line in the content, the line break after the line isn't in its paragraph.
+        size_t start = 0;
+        double top = 0.0;
+        double height = 0.0;
+        double layoutWidth = -1.0;
+    };
+
+    const Line& GetLineAtCoordinate(double y) const;
+    // box of the line break after the line, at the end of its last text line.
+    RSTypographyProperties::TextBox GetLineBreakBox(const Line& line) const;
+
+    std::vector<Line> lines_;
+    LineBuilder builder_;
+    std::u16string content_;
+    std::shared_ptr<RSParagraph> wholeParagraph_;
+    double width_ = -1.0;
+    size_t builtCount_ = 0;
+    bool isSplit_ = false;
+};
+
+} // namespace OHOS::Ace::NG
+
+#endif // FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_PATTERN_TEXT_FIELD_TEXT_FIELD_PARAGRAPH_H
@@ -209,6 +209,7 @@ bool TextFieldPattern::OnDirtyLayoutWrapperSwap(const RefPtr<LayoutWrapper>& dir
     auto paragraph = textFieldLayoutAlgorithm->GetParagraph();
     if (paragraph) {
         paragraph_ = paragraph;
+        paragraphKey_ = textFieldLayoutAlgorithm->GetParagraphKey();
     }
     auto counterParagraph = textFieldLayoutAlgorithm->GetCounterParagraph();
     if (counterParagraph) {
@@ -285,12 +286,12 @@ void TextFieldPattern::UpdateCaretInfoToController() const
     auto value = GetEditingValue();
     LOGD("Start %{public}d, end %{public}d", textSelector_.GetStart(), textSelector_.GetEnd());
     MiscServices::InputMethodController::GetInstance()->OnSelectionChange(
-        StringUtils::Str8ToStr16(value.text), textSelector_.GetStart(), textSelector_.GetEnd());
+        StringUtils::Str8ToStr16(value.GetText()), textSelector_.GetStart(), textSelector_.GetEnd());
 
 #else
     if (HasConnection()) {
         TextEditingValue value;
-        value.text = textEditingValue_.text;
+        value.text = textEditingValue_.GetText();
         value.hint = GetPlaceHolder();
         value.selection.Update(textSelector_.baseOffset, textSelector_.destinationOffset);
         connection_->SetEditingState(value, GetInstanceId());
@@ -324,7 +325,7 @@ bool TextFieldPattern::UpdateCaretPosition()
             StartTwinkling();
         }
     } else if (caretUpdateType_ == CaretUpdateType::NONE) {
-        if (GetEditingValue().text.empty()) {
+        if (GetEditingValue().GetText().empty()) {
             UpdateSelection(0);
             SetCaretOffsetForEmptyTextOrPositionZero();
         }
@@ -447,7 +448,7 @@ void TextFieldPattern::UpdateCaretOffsetByLastTouchOffset()
 // return bool that caret might move out of content rect and need adjust position
 bool TextFieldPattern::UpdateCaretPositionByMouseMovement()
 {
-    if (GetEditingValue().text.empty()) {
+    if (GetEditingValue().GetText().empty()) {
         caretRect_.SetLeft(textRect_.GetX());
         caretRect_.SetTop(textRect_.GetY());
         selectionMode_ = SelectionMode::NONE;
@@ -470,7 +471,7 @@ bool TextFieldPattern::UpdateCaretPositionByMouseMovement()
 
 void TextFieldPattern::UpdateCaretOffsetByEvent()
 {
-    if (textEditingValue_.text.empty()) {
+    if (textEditingValue_.GetText().empty()) {
         UpdateSelection(0, 0);
         SetCaretOffsetForEmptyTextOrPositionZero();
         return;
@@ -538,7 +539,7 @@ void TextFieldPattern::UpdateSelectionOffset()
 
 void TextFieldPattern::UpdateCaretPositionByTextEdit()
 {
-    if (textEditingValue_.text.empty()) {
+    if (textEditingValue_.GetText().empty()) {
         UpdateSelection(0);
         SetCaretOffsetForEmptyTextOrPositionZero();
         return;
@@ -587,7 +588,7 @@ void TextFieldPattern::SetCaretOffsetForEmptyTextOrPositionZero()
 
 void TextFieldPattern::UpdateCaretPositionByPressOffset()
 {
-    if (GetEditingValue().text.empty()) {
+    if (GetEditingValue().GetText().empty()) {
         SetCaretOffsetForEmptyTextOrPositionZero();
         return;
     }
@@ -793,7 +794,7 @@ bool TextFieldPattern::ComputeOffsetForCaretDownstream(int32_t extent, CaretMetr
 
 bool TextFieldPattern::ComputeOffsetForCaretUpstream(int32_t extent, CaretMetricsF& result) const
 {
-    auto text = textEditingValue_.text;
+    auto text = textEditingValue_.GetText();
     auto wideText = textEditingValue_.GetWideText();
     if (!paragraph_ || wideText.empty() || textEditingValue_.caretPosition == 0 ||
         textEditingValue_.caretPosition > static_cast<int32_t>(wideText.length())) {
@@ -810,7 +811,7 @@ bool TextFieldPattern::ComputeOffsetForCaretUpstream(int32_t extent, CaretMetric
     int32_t prev = extent - graphemeClusterLength;
     auto boxes = paragraph_->GetRectsForRange(
         prev, extent, RSTypographyProperties::RectHeightStyle::MAX, RSTypographyProperties::RectWidthStyle::TIGHT);
-    while (boxes.empty() && !textEditingValue_.text.empty()) {
+    while (boxes.empty() && !textEditingValue_.GetText().empty()) {
         graphemeClusterLength *= 2;
         prev = extent - graphemeClusterLength;
         if (prev < 0) {
@@ -873,6 +874,12 @@ bool TextFieldPattern::DisplayPlaceHolder()
     return value.empty();
 }
 
+ParagraphT TextFieldPattern::GetDragParagraph() const
+{
+    std::shared_ptr<RSParagraph> paragraph = dragParagraph_ ? dragParagraph_->GetWholeParagraph() : nullptr;
+    return { paragraph };
+}
+
 const TextEditingValueNG& TextFieldPattern::GetEditingValue() const
 {
     return textEditingValue_;
@@ -1103,21 +1110,26 @@ void TextFieldPattern::HandleOnUndoAction()
         LOGW("Operation records empty, cannot undo");
         return;
     }
-    auto value = operationRecords_.back();
+    auto record = std::move(operationRecords_.back());
     operationRecords_.pop_back();
-    redoOperationRecords_.push_back(value);
+    record.Revert(recordedText_);
+    recordedCaret_ = record.caretBefore;
+    redoOperationRecords_.emplace_back(std::move(record));
     if (operationRecords_.empty()) {
         LOGW("No record left, clear");
-        ClearEditingValue();
-        return;
+        // not recorded, so the cleared value can be redone
+        textEditingValue_.Reset();
+        SetEditingValueToProperty("");
+    } else {
+        textEditingValue_.SetText(recordedText_);
+        textEditingValue_.caretPosition = recordedCaret_;
+        SetEditingValueToProperty(textEditingValue_.GetText());
     }
-    textEditingValue_ = operationRecords_.back();
-    SetEditingValueToProperty(textEditingValue_.text);
     auto layoutProperty = GetLayoutProperty<TextFieldLayoutProperty>();
     CHECK_NULL_VOID(layoutProperty);
     GetHost()->MarkDirtyNode(layoutProperty->GetMaxLinesValue(Infinity<float>()) <= 1 ? PROPERTY_UPDATE_MEASURE_SELF
                                                                                       : PROPERTY_UPDATE_MEASURE);
-    FireEventHubOnChange(GetEditingValue().text);
+    FireEventHubOnChange(GetEditingValue().GetText());
 }
 
 void TextFieldPattern::HandleOnRedoAction()
@@ -1127,15 +1139,19 @@ void TextFieldPattern::HandleOnRedoAction()
         LOGW("Redo operation records empty, cannot undo");
         return;
     }
-    textEditingValue_ = redoOperationRecords_.back();
+    auto record = std::move(redoOperationRecords_.back());
     redoOperationRecords_.pop_back();
-    operationRecords_.push_back(textEditingValue_);
-    SetEditingValueToProperty(textEditingValue_.text);
+    record.Apply(recordedText_);
+    recordedCaret_ = record.caretAfter;
+    operationRecords_.emplace_back(std::move(record));
+    textEditingValue_.SetText(recordedText_);
+    textEditingValue_.caretPosition = recordedCaret_;
+    SetEditingValueToProperty(textEditingValue_.GetText());
     auto layoutProperty = GetLayoutProperty<TextFieldLayoutProperty>();
     CHECK_NULL_VOID(layoutProperty);
     GetHost()->MarkDirtyNode(layoutProperty->GetMaxLinesValue(Infinity<float>()) <= 1 ? PROPERTY_UPDATE_MEASURE_SELF
                                                                                       : PROPERTY_UPDATE_MEASURE);
-    FireEventHubOnChange(GetEditingValue().text);
+    FireEventHubOnChange(GetEditingValue().GetText());
 }
 
 void TextFieldPattern::HandleOnSelectAll()
@@ -1247,13 +1263,13 @@ void TextFieldPattern::HandleOnPaste()
         } else {
             pasteData = wData;
         }
-        value.text =
-            value.GetValueBeforePosition(start) + StringUtils::ToString(pasteData) + value.GetValueAfterPosition(end);
+        value.SetText(
+            value.GetValueBeforePosition(start) + StringUtils::ToString(pasteData) + value.GetValueAfterPosition(end));
         auto newCaretPosition = std::clamp(std::min(start, end) + static_cast<int32_t>(pasteData.length()), 0,
-            static_cast<int32_t>(StringUtils::ToWstring(value.text).length()));
-        textfield->UpdateEditingValue(value.text, newCaretPosition);
+            static_cast<int32_t>(value.GetWideText().length()));
+        textfield->UpdateEditingValue(value.GetText(), newCaretPosition);
         textfield->UpdateSelection(newCaretPosition);
-        textfield->SetEditingValueToProperty(value.text);
+        textfield->SetEditingValueToProperty(value.GetText());
         textfield->SetInSelectMode(SelectionMode::NONE);
         textfield->SetCaretUpdateType(CaretUpdateType::INPUT);
         textfield->UpdateEditingValueToRecord();
@@ -1265,7 +1281,7 @@ void TextFieldPattern::HandleOnPaste()
             auto eventHub = parentFrameNode->GetEventHub<SearchEventHub>();
             CHECK_NULL_VOID(eventHub);
             eventHub->FireOnPaste(StringUtils::ToString(pasteData));
-            textfield->FireEventHubOnChange(value.text);
+            textfield->FireEventHubOnChange(value.GetText());
             host->MarkDirtyNode(PROPERTY_UPDATE_MEASURE_SELF);
             return;
         }
@@ -1273,7 +1289,7 @@ void TextFieldPattern::HandleOnPaste()
         auto eventHub = textfield->GetHost()->GetEventHub<TextFieldEventHub>();
         CHECK_NULL_VOID(eventHub);
         eventHub->FireOnPaste(StringUtils::ToString(pasteData));
-        textfield->FireEventHubOnChange(value.text);
+        textfield->FireEventHubOnChange(value.GetText());
         host->MarkDirtyNode(layoutProperty->GetMaxLinesValue(Infinity<float>()) <= 1 ? PROPERTY_UPDATE_MEASURE_SELF
                                                                                      : PROPERTY_UPDATE_MEASURE);
     };
@@ -1336,10 +1352,9 @@ void TextFieldPattern::HandleOnCut()
         clipboard_->SetData(selectedText, layoutProperty->GetCopyOptionsValue(CopyOptions::Distributed));
 #endif
     }
-    textEditingValue_.text =
-        textEditingValue_.GetValueBeforePosition(start) + textEditingValue_.GetValueAfterPosition(end);
+    textEditingValue_.Replace(start, end, "");
     textEditingValue_.CursorMoveToPosition(start);
-    SetEditingValueToProperty(textEditingValue_.text);
+    SetEditingValueToProperty(textEditingValue_.GetText());
     selectionMode_ = SelectionMode::NONE;
     caretUpdateType_ = CaretUpdateType::EVENT;
     CloseSelectOverlay();
@@ -1353,7 +1368,7 @@ void TextFieldPattern::HandleOnCut()
         auto eventHub = parentFrameNode->GetEventHub<SearchEventHub>();
         CHECK_NULL_VOID(eventHub);
         eventHub->FireOnCut(selectedText);
-        FireEventHubOnChange(textEditingValue_.text);
+        FireEventHubOnChange(textEditingValue_.GetText());
         host->MarkDirtyNode(PROPERTY_UPDATE_MEASURE_SELF);
         return;
     }
@@ -1361,7 +1376,7 @@ void TextFieldPattern::HandleOnCut()
     auto eventHub = host->GetEventHub<TextFieldEventHub>();
     CHECK_NULL_VOID(eventHub);
     eventHub->FireOnCut(selectedText);
-    FireEventHubOnChange(textEditingValue_.text);
+    FireEventHubOnChange(textEditingValue_.GetText());
     host->MarkDirtyNode(layoutProperty->GetMaxLinesValue(Infinity<float>()) <= 1 ? PROPERTY_UPDATE_MEASURE_SELF
                                                                                  : PROPERTY_UPDATE_MEASURE);
 }
@@ -1613,12 +1628,12 @@ void TextFieldPattern::InitDragDropEvent()
             float dragTextStart = pattern->dragTextStart_;
             float dragTextEnd = pattern->dragTextEnd_;
             if (current < dragTextStart) {
-                pattern->textEditingValue_.text = pattern->textEditingValue_.GetValueBeforePosition(dragTextStart) +
-                                                  pattern->textEditingValue_.GetValueAfterPosition(dragTextEnd);
+                pattern->textEditingValue_.SetText(pattern->textEditingValue_.GetValueBeforePosition(dragTextStart) +
+                                                   pattern->textEditingValue_.GetValueAfterPosition(dragTextEnd));
                 pattern->InsertValue(str);
             } else if (current > dragTextEnd) {
-                pattern->textEditingValue_.text = pattern->textEditingValue_.GetValueBeforePosition(dragTextStart) +
-                                                  pattern->textEditingValue_.GetValueAfterPosition(dragTextEnd);
+                pattern->textEditingValue_.SetText(pattern->textEditingValue_.GetValueBeforePosition(dragTextStart) +
+                                                   pattern->textEditingValue_.GetValueAfterPosition(dragTextEnd));
                 pattern->textEditingValue_.caretPosition = current - (dragTextEnd - dragTextStart);
                 pattern->InsertValue(str);
             }
@@ -1801,6 +1816,7 @@ void TextFieldPattern::OnModifyDone()
     }
 #endif // ENABLE_DRAG_FRAMEWORK
     ProcessPasswordIcon();
+    RegisterFontLoadedCallback();
     context->AddOnAreaChangeNode(host->GetId());
     if (!clipboard_ && context) {
         clipboard_ = ClipboardProxy::GetInstance()->GetClipboard(context->GetTaskExecutor());
@@ -1836,14 +1852,13 @@ void TextFieldPattern::OnModifyDone()
     if (layoutProperty->GetTypeChangedValue(false)) {
         ClearEditingValue();
         layoutProperty->ResetTypeChanged();
-        operationRecords_.clear();
-        redoOperationRecords_.clear();
+        ClearOperationRecords();
     }
     auto maxLength = GetMaxLength();
     if (GreatOrEqual(textWidth, maxLength)) {
-        textEditingValue_.text = StringUtils::ToString(textEditingValue_.GetWideText().substr(0, maxLength));
+        textEditingValue_.SetText(StringUtils::ToString(textEditingValue_.GetWideText().substr(0, maxLength)));
         UpdateCaretPositionWithClamp(textEditingValue_.caretPosition);
-        SetEditingValueToProperty(textEditingValue_.text);
+        SetEditingValueToProperty(textEditingValue_.GetText());
     }
     FireOnChangeIfNeeded();
     caretUpdateType_ = CaretUpdateType::EVENT;
@@ -1873,7 +1888,7 @@ void TextFieldPattern::FireOnChangeIfNeeded()
     layoutProperty->UpdateNeedFireOnChangeWhenCreate(false);
     auto eventHub = GetHost()->GetEventHub<TextFieldEventHub>();
     CHECK_NULL_VOID(eventHub);
-    eventHub->FireOnChange(textEditingValue_.text);
+    eventHub->FireOnChange(textEditingValue_.GetText());
 }
 
 bool TextFieldPattern::IsDisabled()
@@ -1989,7 +2004,7 @@ void TextFieldPattern::ProcessOverlay()
     if (renderContext) {
         AnimatePressAndHover(renderContext, 0.0f);
     }
-    if (textEditingValue_.text.empty()) {
+    if (textEditingValue_.GetText().empty()) {
         CreateSingleHandle();
         return;
     }
@@ -2070,11 +2085,11 @@ void TextFieldPattern::ShowSelectOverlay(
         selectInfo.isUsingMouse = pattern->IsUsingMouse();
         selectInfo.rightClickOffset = pattern->GetRightClickOffset();
         selectInfo.singleLineHeight = pattern->PreferredLineHeight();
-        selectInfo.menuInfo.showCopy = !pattern->GetEditingValue().text.empty() && pattern->AllowCopy();
-        selectInfo.menuInfo.showCut = selectInfo.menuInfo.showCopy && !pattern->GetEditingValue().text.empty();
-        selectInfo.menuInfo.showCopyAll = !pattern->GetEditingValue().text.empty();
+        selectInfo.menuInfo.showCopy = !pattern->GetEditingValue().GetText().empty() && pattern->AllowCopy();
+        selectInfo.menuInfo.showCut = selectInfo.menuInfo.showCopy && !pattern->GetEditingValue().GetText().empty();
+        selectInfo.menuInfo.showCopyAll = !pattern->GetEditingValue().GetText().empty();
         selectInfo.menuInfo.showPaste = hasData;
-        selectInfo.menuInfo.menuIsShow = !pattern->GetEditingValue().text.empty() || hasData;
+        selectInfo.menuInfo.menuIsShow = !pattern->GetEditingValue().GetText().empty() || hasData;
         selectInfo.menuCallback.onCopy = [weak]() {
             auto pattern = weak.Upgrade();
             CHECK_NULL_VOID(pattern);
@@ -2132,11 +2147,41 @@ bool TextFieldPattern::AllowCopy()
            layoutProperty->GetTextInputTypeValue(TextInputType::UNSPECIFIED) != TextInputType::VISIBLE_PASSWORD;
 }
 
-void TextFieldPattern::OnDetachFromFrameNode(FrameNode* /*node*/)
+void TextFieldPattern::RegisterFontLoadedCallback()
+{
+    auto host = GetHost();
+    CHECK_NULL_VOID(host);
+    auto pipeline = host->GetContext();
+    CHECK_NULL_VOID(pipeline);
+    auto fontManager = pipeline->GetFontManager();
+    CHECK_NULL_VOID_NOLOG(fontManager);
+    auto layoutProperty = host->GetLayoutProperty<TextFieldLayoutProperty>();
+    CHECK_NULL_VOID(layoutProperty);
+    // paragraphs of the text field are built again when the font generation of ParagraphCache changes.
+    auto callback = [weak = WeakClaim(this)]() {
+        auto pattern = weak.Upgrade();
+        CHECK_NULL_VOID(pattern);
+        auto host = pattern->GetHost();
+        CHECK_NULL_VOID(host);
+        host->MarkDirtyNode(PROPERTY_UPDATE_MEASURE);
+    };
+    for (const auto& fontFamily : layoutProperty->GetFontFamilyValue({})) {
+        fontManager->RegisterCallbackNG(WeakPtr<UINode>(host), fontFamily, callback);
+    }
+    for (const auto& fontFamily : layoutProperty->GetPlaceholderFontFamilyValue({})) {
+        fontManager->RegisterCallbackNG(WeakPtr<UINode>(host), fontFamily, callback);
+    }
+}
+
+void TextFieldPattern::OnDetachFromFrameNode(FrameNode* node)
 {
     CloseSelectOverlay();
     auto pipeline = PipelineContext::GetCurrentContext();
     CHECK_NULL_VOID(pipeline);
+    auto fontManager = pipeline->GetFontManager();
+    if (fontManager) {
+        fontManager->UnRegisterCallbackNG(WeakClaim(node));
+    }
     if (HasSurfaceChangedCallback()) {
         LOGD("Unregister surface change callback with id %{public}d", surfaceChangedCallbackId_.value_or(-1));
         pipeline->UnregisterSurfaceChangedCallback(surfaceChangedCallbackId_.value_or(-1));
@@ -2282,9 +2327,9 @@ void TextFieldPattern::SetHandlerOnMoveDone()
 
 void TextFieldPattern::InitEditingValueText(std::string content)
 {
-    textEditingValue_.text = std::move(content);
+    textEditingValue_.SetText(std::move(content));
     textEditingValue_.caretPosition = textEditingValue_.GetWideText().length();
-    SetEditingValueToProperty(textEditingValue_.text);
+    SetEditingValueToProperty(textEditingValue_.GetText());
     auto layoutProperty = GetLayoutProperty<TextFieldLayoutProperty>();
     CHECK_NULL_VOID(layoutProperty);
     layoutProperty->UpdateNeedFireOnChangeWhenCreate(true);
@@ -2529,7 +2574,7 @@ bool TextFieldPattern::RequestKeyboard(bool isFocusViewChanged, bool needStartTw
                 return false;
             }
             TextEditingValue value;
-            value.text = textEditingValue_.text;
+            value.text = textEditingValue_.GetText();
             value.hint = GetPlaceHolder();
             value.selection.Update(textSelector_.baseOffset, textSelector_.destinationOffset);
             connection_->SetEditingState(value, GetInstanceId());
@@ -2734,7 +2779,7 @@ void TextFieldPattern::InsertValue(const std::string& insertValue)
     } else {
         valueToUpdate = insertValue;
     }
-    std::string oldText = textEditingValue_.text;
+    std::string oldText = textEditingValue_.GetText();
     auto caretStart = 0;
     std::string result;
     auto textFieldLayoutProperty = GetHost()->GetLayoutProperty<TextFieldLayoutProperty>();
@@ -2753,14 +2798,12 @@ void TextFieldPattern::InsertValue(const std::string& insertValue)
         return;
     }
     if (InSelectMode()) {
-        textEditingValue_.text =
-            textEditingValue_.GetValueBeforePosition(start) + result + textEditingValue_.GetValueAfterPosition(end);
+        textEditingValue_.Replace(start, end, result);
     } else {
-        textEditingValue_.text =
-            textEditingValue_.GetValueBeforeCursor() + result + textEditingValue_.GetValueAfterCursor();
+        textEditingValue_.Replace(caretStart, caretStart, result);
     }
     textEditingValue_.CursorMoveToPosition(caretStart + static_cast<int32_t>(StringUtils::ToWstring(result).length()));
-    SetEditingValueToProperty(textEditingValue_.text);
+    SetEditingValueToProperty(textEditingValue_.GetText());
     UpdateEditingValueToRecord();
     caretUpdateType_ = CaretUpdateType::INPUT;
     selectionMode_ = SelectionMode::NONE;
@@ -2772,14 +2815,14 @@ void TextFieldPattern::InsertValue(const std::string& insertValue)
         auto parentFrameNode = AceType::DynamicCast<FrameNode>(host->GetParent());
         auto eventHub = parentFrameNode->GetEventHub<SearchEventHub>();
         CHECK_NULL_VOID(eventHub);
-        eventHub->UpdateChangeEvent(textEditingValue_.text);
+        eventHub->UpdateChangeEvent(textEditingValue_.GetText());
         parentFrameNode->MarkDirtyNode(PROPERTY_UPDATE_MEASURE);
         return;
     }
 
     auto eventHub = host->GetEventHub<TextFieldEventHub>();
     CHECK_NULL_VOID(eventHub);
-    eventHub->FireOnChange(textEditingValue_.text);
+    eventHub->FireOnChange(textEditingValue_.GetText());
     auto layoutProperty = GetHost()->GetLayoutProperty<TextFieldLayoutProperty>();
     CHECK_NULL_VOID(layoutProperty);
     host->MarkDirtyNode(layoutProperty->GetMaxLinesValue(Infinity<float>()) <= 1 ? PROPERTY_UPDATE_MEASURE_SELF
@@ -2795,7 +2838,22 @@ void TextFieldPattern::UpdateEditingValueToRecord()
         }
         operationRecords_.erase(operationRecords_.begin());
     }
-    operationRecords_.emplace_back(textEditingValue_);
+    auto record = TextEditRecordNG::Make(recordedText_, textEditingValue_.GetText());
+    record.caretBefore = recordedCaret_;
+    record.caretAfter = textEditingValue_.caretPosition;
+    record.Apply(recordedText_);
+    recordedCaret_ = textEditingValue_.caretPosition;
+    operationRecords_.emplace_back(std::move(record));
+    // records to redo are changes of the text before this one
+    redoOperationRecords_.clear();
+}
+
+void TextFieldPattern::ClearOperationRecords()
+{
+    operationRecords_.clear();
+    redoOperationRecords_.clear();
+    recordedText_ = textEditingValue_.GetText();
+    recordedCaret_ = textEditingValue_.caretPosition;
 }
 
 bool TextFieldPattern::FilterWithRegex(
@@ -2905,7 +2963,8 @@ float TextFieldPattern::PreferredTextHeight(bool isPlaceholder)
         textContent = "b";
     }
     RSParagraphStyle paraStyle;
-    paraStyle.textDirection_ = ToRSTextDirection(TextFieldLayoutAlgorithm::GetTextDirection(textEditingValue_.text));
+    paraStyle.textDirection_ =
+        ToRSTextDirection(TextFieldLayoutAlgorithm::GetTextDirection(textEditingValue_.GetText()));
     paraStyle.textAlign_ = ToRSTextAlign(textStyle.GetTextAlign());
     paraStyle.maxLines_ = textStyle.GetMaxLines();
     paraStyle.locale_ = Localization::GetInstance()->GetFontLocale();
@@ -2916,7 +2975,9 @@ float TextFieldPattern::PreferredTextHeight(bool isPlaceholder)
     }
     auto builder = RSParagraphBuilder::CreateRosenBuilder(paraStyle, RSFontCollection::GetInstance(false));
     builder->PushStyle(ToRSTextStyle(PipelineContext::GetCurrentContext(), textStyle));
-    StringUtils::TransformStrCase(textEditingValue_.text, static_cast<int32_t>(textStyle.GetTextCase()));
+    auto editingText = textEditingValue_.GetText();
+    StringUtils::TransformStrCase(editingText, static_cast<int32_t>(textStyle.GetTextCase()));
+    textEditingValue_.SetText(std::move(editingText));
     builder->AddText(StringUtils::Str8ToStr16(textContent));
     builder->Pop();
     if (!isPlaceholder) {
@@ -2933,7 +2994,7 @@ float TextFieldPattern::PreferredTextHeight(bool isPlaceholder)
 
 float TextFieldPattern::PreferredLineHeight()
 {
-    return PreferredTextHeight(textEditingValue_.text.empty());
+    return PreferredTextHeight(textEditingValue_.GetText().empty());
 }
 
 void TextFieldPattern::OnCursorMoveDone()
@@ -3026,11 +3087,10 @@ void TextFieldPattern::Delete(int32_t start, int32_t end)
 {
     SwapIfLarger(start, end);
     LOGI("Handle Delete within [%{public}d, %{public}d]", start, end);
-    textEditingValue_.text =
-        textEditingValue_.GetValueBeforePosition(start) + textEditingValue_.GetValueAfterPosition(end);
+    textEditingValue_.Replace(start, end, "");
     UpdateCaretPositionWithClamp(start);
-    SetEditingValueToProperty(textEditingValue_.text);
-    FireEventHubOnChange(GetEditingValue().text);
+    SetEditingValueToProperty(textEditingValue_.GetText());
+    FireEventHubOnChange(GetEditingValue().GetText());
     selectionMode_ = SelectionMode::NONE;
     caretUpdateType_ = CaretUpdateType::DEL;
     CloseSelectOverlay();
@@ -3075,7 +3135,7 @@ void TextFieldPattern::PerformAction(TextInputAction action, bool forceCloseKeyb
         auto parentFrameNode = AceType::DynamicCast<FrameNode>(host->GetParent());
         auto eventHub = parentFrameNode->GetEventHub<SearchEventHub>();
         CHECK_NULL_VOID(eventHub);
-        eventHub->UpdateSubmitEvent(textEditingValue_.text);
+        eventHub->UpdateSubmitEvent(textEditingValue_.GetText());
         CloseKeyboard(forceCloseKeyboard);
         return;
     }
@@ -3093,9 +3153,9 @@ void TextFieldPattern::PerformAction(TextInputAction action, bool forceCloseKeyb
 
 void TextFieldPattern::UpdateEditingValue(const std::shared_ptr<TextEditingValue>& value, bool needFireChangeEvent)
 {
-    textEditingValue_.text = value->text;
+    textEditingValue_.SetText(value->text);
     textEditingValue_.caretPosition = value->selection.baseOffset;
-    SetEditingValueToProperty(textEditingValue_.text);
+    SetEditingValueToProperty(textEditingValue_.GetText());
     UpdateEditingValueToRecord();
     caretUpdateType_ = CaretUpdateType::INPUT;
     selectionMode_ = SelectionMode::NONE;
@@ -3107,7 +3167,7 @@ void TextFieldPattern::UpdateEditingValue(const std::shared_ptr<TextEditingValue
         auto parentFrameNode = AceType::DynamicCast<FrameNode>(host->GetParent());
         auto eventHub = parentFrameNode->GetEventHub<SearchEventHub>();
         CHECK_NULL_VOID(eventHub);
-        eventHub->UpdateChangeEvent(textEditingValue_.text);
+        eventHub->UpdateChangeEvent(textEditingValue_.GetText());
         parentFrameNode->MarkDirtyNode(PROPERTY_UPDATE_MEASURE);
         return;
     }
@@ -3115,7 +3175,7 @@ void TextFieldPattern::UpdateEditingValue(const std::shared_ptr<TextEditingValue
     if (needFireChangeEvent) {
         auto eventHub = host->GetEventHub<TextFieldEventHub>();
         CHECK_NULL_VOID(eventHub);
-        eventHub->FireOnChange(textEditingValue_.text);
+        eventHub->FireOnChange(textEditingValue_.GetText());
     }
 
     auto layoutProperty = GetHost()->GetLayoutProperty<TextFieldLayoutProperty>();
@@ -3246,11 +3306,10 @@ void TextFieldPattern::DeleteBackward(int32_t length)
     auto start = std::max(textEditingValue_.caretPosition - length, 0);
     auto end =
         std::min(textEditingValue_.caretPosition, static_cast<int32_t>(textEditingValue_.GetWideText().length()));
-    textEditingValue_.text =
-        textEditingValue_.GetValueBeforePosition(start) + textEditingValue_.GetValueAfterPosition(end);
+    textEditingValue_.Replace(start, end, "");
     textEditingValue_.CursorMoveToPosition(textEditingValue_.caretPosition - length);
-    SetEditingValueToProperty(textEditingValue_.text);
-    FireEventHubOnChange(GetEditingValue().text);
+    SetEditingValueToProperty(textEditingValue_.GetText());
+    FireEventHubOnChange(GetEditingValue().GetText());
     selectionMode_ = SelectionMode::NONE;
     caretUpdateType_ = CaretUpdateType::DEL;
     CloseSelectOverlay();
@@ -3272,10 +3331,9 @@ void TextFieldPattern::DeleteForward(int32_t length)
         LOGW("Caret position at the end , cannot DeleteForward");
         return;
     }
-    textEditingValue_.text = textEditingValue_.GetValueBeforePosition(textEditingValue_.caretPosition) +
-                             textEditingValue_.GetValueAfterPosition(textEditingValue_.caretPosition + length);
-    SetEditingValueToProperty(textEditingValue_.text);
-    FireEventHubOnChange(GetEditingValue().text);
+    textEditingValue_.Replace(textEditingValue_.caretPosition, textEditingValue_.caretPosition + length, "");
+    SetEditingValueToProperty(textEditingValue_.GetText());
+    FireEventHubOnChange(GetEditingValue().GetText());
     selectionMode_ = SelectionMode::NONE;
     caretUpdateType_ = CaretUpdateType::INPUT;
     CloseSelectOverlay();
@@ -3476,7 +3534,7 @@ void TextFieldPattern::CaretMoveToLastNewLineChar()
 {
     while (textEditingValue_.caretPosition > 0) {
         textEditingValue_.caretPosition -= 1;
-        if (textEditingValue_.text.substr(textEditingValue_.caretPosition, 1) == "\n") {
+        if (textEditingValue_.GetText().substr(textEditingValue_.caretPosition, 1) == "\n") {
             break;
         }
     }
@@ -3750,7 +3808,7 @@ std::string TextFieldPattern::GetCopyOptionString() const
 
 void TextFieldPattern::UpdateScrollBarOffset()
 {
-    if (textEditingValue_.text.empty()) {
+    if (textEditingValue_.GetText().empty()) {
         return;
     }
     if (!GetScrollBar() && !GetScrollBarProxy()) {
@@ -3783,7 +3841,7 @@ void TextFieldPattern::CheckScrollable()
     auto layoutProperty = host->GetLayoutProperty<TextFieldLayoutProperty>();
     CHECK_NULL_VOID(layoutProperty);
 
-    if (textEditingValue_.text.empty()) {
+    if (textEditingValue_.GetText().empty()) {
         scrollable_ = false;
     } else {
         if (layoutProperty->GetShowCounterValue(false) && counterParagraph_) {
@@ -3849,7 +3907,7 @@ void TextFieldPattern::SaveUnderlineStates()
 void TextFieldPattern::ToJsonValue(std::unique_ptr<JsonValue>& json) const
 {
     json->Put("placeholder", GetPlaceHolder().c_str());
-    json->Put("text", textEditingValue_.text.c_str());
+    json->Put("text", textEditingValue_.GetText().c_str());
     json->Put("fontSize", GetFontSize().c_str());
     json->Put("fontColor", GetTextColor().c_str());
     json->Put("fontStyle", GetItalicFontStyle() == Ace::FontStyle::NORMAL ? "FontStyle.Normal" : "FontStyle.Italic");
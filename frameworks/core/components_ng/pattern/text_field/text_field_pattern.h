@@ -49,6 +49,7 @@
 #include "core/components_ng/pattern/text_field/text_field_layout_property.h"
 #include "core/components_ng/pattern/text_field/text_field_paint_method.h"
 #include "core/components_ng/pattern/text_field/text_field_paint_property.h"
+#include "core/components_ng/pattern/text_field/text_field_paragraph.h"
 #include "core/components_ng/pattern/text_field/text_selector.h"
 #include "core/components_ng/property/property.h"
 #include "core/gestures/gesture_info.h"
@@ -216,7 +217,7 @@ public:
 
     void UpdateEditingValue(std::string value, int32_t caretPosition)
     {
-        textEditingValue_.text = std::move(value);
+        textEditingValue_.SetText(std::move(value));
         textEditingValue_.caretPosition = caretPosition;
     }
     void SetEditingValueToProperty(const std::string& newValueText);
@@ -251,11 +252,16 @@ public:
         return baselineOffset_;
     }
 
-    const std::shared_ptr<RSParagraph>& GetParagraph() const
+    const std::shared_ptr<TextFieldParagraph>& GetParagraph() const
     {
         return paragraph_;
     }
 
+    const std::optional<TextFieldParagraphKey>& GetParagraphKey() const
+    {
+        return paragraphKey_;
+    }
+
     const std::shared_ptr<RSParagraph>& GetCounterParagraph() const
     {
         return counterParagraph_;
@@ -613,10 +619,7 @@ public:
         return contentRect_;
     }
 
-    ParagraphT GetDragParagraph() const override
-    {
-        return { dragParagraph_ };
-    }
+    ParagraphT GetDragParagraph() const override;
 
     const RefPtr<FrameNode>& GetDragNode() const override
     {
@@ -690,6 +693,7 @@ public:
 
     void HandleOnUndoAction();
     void HandleOnRedoAction();
+    void ClearOperationRecords();
     void HandleOnSelectAll();
     void HandleOnCopy();
     void HandleOnPaste();
@@ -785,6 +789,7 @@ private:
     void OnHandleMove(const RectF& handleRect, bool isFirstHandle);
     void OnHandleMoveDone(const RectF& handleRect, bool isFirstHandle);
     void SetHandlerOnMoveDone();
+    void RegisterFontLoadedCallback();
     void OnDetachFromFrameNode(FrameNode* node) override;
     bool UpdateCaretByPressOrLongPress();
     void UpdateTextSelectorByHandleMove(bool isMovingBase, int32_t position, OffsetF& offsetToParagraphBeginning);
@@ -845,9 +850,11 @@ private:
     RectF contentRect_;
     RectF textRect_;
     RectF imageRect_;
-    std::shared_ptr<RSParagraph> paragraph_;
+    std::shared_ptr<TextFieldParagraph> paragraph_;
+    // inputs of [paragraph_], see TextFieldParagraphKey
+    std::optional<TextFieldParagraphKey> paragraphKey_;
     std::shared_ptr<RSParagraph> counterParagraph_;
-    std::shared_ptr<RSParagraph> dragParagraph_;
+    std::shared_ptr<TextFieldParagraph> dragParagraph_;
     std::shared_ptr<RSParagraph> textLineHeightUtilParagraph_;
     std::shared_ptr<RSParagraph> placeholderLineHeightUtilParagraph_;
     TextStyle nextLineUtilTextStyle_;
@@ -940,8 +947,11 @@ private:
     DragStatus dragStatus_ = DragStatus::NONE;
     std::vector<std::string> dragContents_;
     RefPtr<Clipboard> clipboard_;
-    std::vector<TextEditingValueNG> operationRecords_;
-    std::vector<TextEditingValueNG> redoOperationRecords_;
+    std::vector<TextEditRecordNG> operationRecords_;
+    std::vector<TextEditRecordNG> redoOperationRecords_;
+    // text and caret position after the last record, records are applied to it on undo and redo.
+    std::string recordedText_;
+    int32_t recordedCaret_ = 0;
     std::vector<TextSelector> textSelectorRecords_;
     std::vector<TextSelector> redoTextSelectorRecords_;
     std::vector<MenuOptionsParam> menuOptionItems_;
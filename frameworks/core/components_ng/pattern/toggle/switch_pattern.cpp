@@ -88,7 +88,7 @@ void SwitchPattern::OnModifyDone()
     margin.right = CalcLength(switchTheme->GetHotZoneHorizontalPadding().Value());
     margin.top = CalcLength(switchTheme->GetHotZoneVerticalPadding().Value());
     margin.bottom = CalcLength(switchTheme->GetHotZoneVerticalPadding().Value());
-    auto& setMargin = layoutProperty->GetMarginProperty();
+    const auto& setMargin = layoutProperty->GetMarginProperty();
     if (setMargin) {
         if (setMargin->left.has_value()) {
             margin.left = setMargin->left;
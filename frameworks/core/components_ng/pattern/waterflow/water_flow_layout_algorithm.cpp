@@ -109,8 +109,10 @@ void WaterFlowLayoutAlgorithm::Measure(LayoutWrapper* layoutWrapper)
     layoutWrapper->GetGeometryNode()->SetFrameSize(idealSize);
     MinusPaddingToSize(layoutProperty->CreatePaddingAndBorder(), idealSize);
 
-    if (layoutWrapper->GetHostNode()->GetChildrenUpdated() != -1) {
-        layoutInfo_.Reset();
+    auto updatedIndex = layoutWrapper->GetHostNode()->GetChildrenUpdated();
+    if (updatedIndex != -1) {
+        // items before the first updated child keep their positions.
+        layoutInfo_.Reset(std::max(updatedIndex - layoutInfo_.footerIndex_ - 1, 0));
         layoutWrapper->GetHostNode()->ChildrenUpdatedFrom(-1);
     }
 
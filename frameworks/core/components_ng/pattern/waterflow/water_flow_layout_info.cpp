@@ -156,4 +156,24 @@ void WaterFlowLayoutInfo::Reset()
     endIndex_ = 0;
     waterFlowItems_.clear();
 }
+
+void WaterFlowLayoutInfo::Reset(int32_t resetFrom)
+{
+    if (resetFrom <= 0) {
+        Reset();
+        return;
+    }
+    itemEnd_ = false;
+    itemStart_ = false;
+    offsetEnd_ = false;
+
+    jumpIndex_ = -1;
+
+    for (auto& crossItems : waterFlowItems_) {
+        crossItems.second.erase(crossItems.second.lower_bound(resetFrom), crossItems.second.end());
+    }
+    // items from [resetFrom] are placed again, even if they are above viewport.
+    startIndex_ = std::min(startIndex_, resetFrom);
+    endIndex_ = std::min(endIndex_, resetFrom);
+}
 } // namespace OHOS::Ace::NG
\ No newline at end of file
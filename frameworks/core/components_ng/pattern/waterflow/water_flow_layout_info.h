@@ -37,6 +37,8 @@ public:
     FlowItemPosition GetCrossIndexForNextItem() const;
     float GetMainHeight(int32_t crossIndex, int32_t itemIndex);
     void Reset();
+    // drop the items from [resetFrom], the items before it keep their positions.
+    void Reset(int32_t resetFrom);
     float currentOffset_ = 0.0f;
     float prevOffset_ = 0.0f;
 
@@ -111,6 +111,12 @@ SizeF ConstrainSize(const SizeF& size, const SizeF& minSize, const SizeF& maxSiz
 
 PaddingPropertyF ConvertToPaddingPropertyF(
     const std::unique_ptr<PaddingProperty>& padding, const ScaleProperty& scaleProperty, float percentReference)
+{
+    return ConvertToPaddingPropertyF(padding.get(), scaleProperty, percentReference);
+}
+
+PaddingPropertyF ConvertToPaddingPropertyF(
+    const PaddingProperty* padding, const ScaleProperty& scaleProperty, float percentReference)
 {
     if (!padding) {
         return {};
@@ -134,6 +140,12 @@ MarginPropertyF ConvertToMarginPropertyF(
     return ConvertToPaddingPropertyF(margin, scaleProperty, percentReference);
 }
 
+MarginPropertyF ConvertToMarginPropertyF(
+    const MarginProperty* margin, const ScaleProperty& scaleProperty, float percentReference)
+{
+    return ConvertToPaddingPropertyF(margin, scaleProperty, percentReference);
+}
+
 MarginPropertyF ConvertToMarginPropertyF(
     const MarginProperty& margin, const ScaleProperty& scaleProperty, float percentReference)
 {
@@ -142,6 +154,12 @@ MarginPropertyF ConvertToMarginPropertyF(
 
 BorderWidthPropertyF ConvertToBorderWidthPropertyF(
     const std::unique_ptr<BorderWidthProperty>& borderWidth, const ScaleProperty& scaleProperty, float percentReference)
+{
+    return ConvertToBorderWidthPropertyF(borderWidth.get(), scaleProperty, percentReference);
+}
+
+BorderWidthPropertyF ConvertToBorderWidthPropertyF(
+    const BorderWidthProperty* borderWidth, const ScaleProperty& scaleProperty, float percentReference)
 {
     if (!borderWidth) {
         return {};
@@ -46,18 +46,27 @@ SizeF ConstrainSize(const SizeF& size, const SizeF& minSize, const SizeF& maxSiz
 PaddingPropertyF ConvertToPaddingPropertyF(const std::unique_ptr<PaddingProperty>& padding,
     const ScaleProperty& scaleProperty, float percentReference = -1.0f);
 
+PaddingPropertyF ConvertToPaddingPropertyF(
+    const PaddingProperty* padding, const ScaleProperty& scaleProperty, float percentReference = -1.0f);
+
 PaddingPropertyF ConvertToPaddingPropertyF(
     const PaddingProperty& padding, const ScaleProperty& scaleProperty, float percentReference = -1.0f);
 
 MarginPropertyF ConvertToMarginPropertyF(
     const std::unique_ptr<MarginProperty>& margin, const ScaleProperty& scaleProperty, float percentReference = -1.0f);
 
+MarginPropertyF ConvertToMarginPropertyF(
+    const MarginProperty* margin, const ScaleProperty& scaleProperty, float percentReference = -1.0f);
+
 MarginPropertyF ConvertToMarginPropertyF(
     const MarginProperty& margin, const ScaleProperty& scaleProperty, float percentReference = -1.0f);
 
 BorderWidthPropertyF ConvertToBorderWidthPropertyF(const std::unique_ptr<BorderWidthProperty>& borderWidth,
     const ScaleProperty& scaleProperty, float percentReference = -1.0f);
 
+BorderWidthPropertyF ConvertToBorderWidthPropertyF(
+    const BorderWidthProperty* borderWidth, const ScaleProperty& scaleProperty, float percentReference = -1.0f);
+
 BorderWidthPropertyF ConvertToBorderWidthPropertyF(
     const BorderWidthProperty& borderWidth, const ScaleProperty& scaleProperty, float percentReference = -1.0f);
 
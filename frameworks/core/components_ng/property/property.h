@@ -103,6 +103,25 @@ public:                                                     \
 protected:                                                  \
     std::unique_ptr<type> prop##group##_;
 
+// For a group stored at the index of a PropertyGroupBlock, see property_group_block.h. The pointers returned are
+// invalidated by the next update of the block.
+#define ACE_DEFINE_PROPERTY_GROUP_IN_BLOCK(block, index, group, type) \
+public:                                                               \
+    const type* Get##group() const                                    \
+    {                                                                 \
+        return block.Get<index>();                                    \
+    }                                                                 \
+                                                                      \
+protected:                                                            \
+    type* GetOrCreate##group()                                        \
+    {                                                                 \
+        return block.GetOrCreate<index>();                            \
+    }                                                                 \
+    void Reset##group()                                               \
+    {                                                                 \
+        block.Reset<index>();                                         \
+    }
+
 #define ACE_DEFINE_PROPERTY_ITEM_WITH_GROUP_GET(group, name, type) \
 public:                                                            \
     std::optional<type> Get##name() const                          \
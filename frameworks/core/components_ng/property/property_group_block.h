@@ -0,0 +1,286 @@
+/*
+ * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_PROPERTY_PROPERTY_GROUP_BLOCK_H
+#define FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_PROPERTY_PROPERTY_GROUP_BLOCK_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <tuple>
+#include <utility>
+
+namespace OHOS::Ace::NG {
+
+// Property groups of a node in a single allocation. Only the groups in use are laid out after the header, in the
+// order of the template arguments, and are located by the bit mask of the groups in use. Copies share the block until
+// one of them updates a group (copy on write), so cloning the properties does not allocate.
+// Groups are declared to the owner with ACE_DEFINE_PROPERTY_GROUP_IN_BLOCK.
+// The groups are moved to a new block when the groups in use change or a shared block is updated, so a pointer from
+// Get or GetOrCreate is invalidated by the next GetOrCreate, Reset or Clear of the block or of the block it is copied
+// to. Read the group again after updating the block instead of keeping the pointer.
+template<typename... Groups>
+class PropertyGroupBlock final {
+public:
+    static constexpr size_t GROUP_COUNT = sizeof...(Groups);
+    static_assert(GROUP_COUNT > 0 && GROUP_COUNT <= 32, "a block holds 1 to 32 groups");
+
+    template<size_t I>
+    using GroupType = std::tuple_element_t<I, std::tuple<Groups...>>;
+
+    PropertyGroupBlock() = default;
+
+    ~PropertyGroupBlock()
+    {
+        Release();
+    }
+
+    PropertyGroupBlock(const PropertyGroupBlock& other) : header_(other.header_)
+    {
+        if (header_) {
+            header_->refCount.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    PropertyGroupBlock(PropertyGroupBlock&& other) noexcept : header_(other.header_)
+    {
+        other.header_ = nullptr;
+    }
+
+    PropertyGroupBlock& operator=(const PropertyGroupBlock& other)
+    {
+        if (header_ != other.header_) {
+            PropertyGroupBlock(other).Swap(*this);
+        }
+        return *this;
+    }
+
+    PropertyGroupBlock& operator=(PropertyGroupBlock&& other) noexcept
+    {
+        PropertyGroupBlock(std::move(other)).Swap(*this);
+        return *this;
+    }
+
+    void Swap(PropertyGroupBlock& other) noexcept
+    {
+        std::swap(header_, other.header_);
+    }
+
+    template<size_t... I>
+    static constexpr uint32_t GetGroupMask()
+    {
+        return (GroupBit(I) | ... | 0u);
+    }
+
+    template<size_t I>
+    bool Has() const
+    {
+        return header_ && (header_->mask & GroupBit(I)) != 0;
+    }
+
+    template<size_t I>
+    const GroupType<I>* Get() const
+    {
+        if (!Has<I>()) {
+            return nullptr;
+        }
+        return static_cast<const GroupType<I>*>(GroupAddress(header_, I));
+    }
+
+    // The group to update, created when absent. The block is detached from its copies first.
+    template<size_t I>
+    GroupType<I>* GetOrCreate()
+    {
+        if (!Has<I>() || IsShared()) {
+            Rebuild(GetMask() | GroupBit(I));
+        }
+        return static_cast<GroupType<I>*>(GroupAddress(header_, I));
+    }
+
+    template<size_t I>
+    void Reset()
+    {
+        Reset(GroupBit(I));
+    }
+
+    // Removes the groups of [mask] with a single rebuild of the block.
+    void Reset(uint32_t mask)
+    {
+        auto oldMask = GetMask();
+        auto newMask = oldMask & ~mask;
+        if (newMask == oldMask) {
+            return;
+        }
+        if (newMask == 0) {
+            Release();
+            return;
+        }
+        Rebuild(newMask);
+    }
+
+    void Clear()
+    {
+        Release();
+    }
+
+    uint32_t GetMask() const
+    {
+        return header_ ? header_->mask : 0;
+    }
+
+    bool IsShared() const
+    {
+        return header_ && header_->refCount.load(std::memory_order_acquire) > 1;
+    }
+
+    bool IsSharedWith(const PropertyGroupBlock& other) const
+    {
+        return header_ && header_ == other.header_;
+    }
+
+    // Bytes allocated for the block, which are shared by its copies.
+    size_t GetAllocatedSize() const
+    {
+        return header_ ? BlockSize(header_->mask) : 0;
+    }
+
+private:
+    struct Header {
+        std::atomic<uint32_t> refCount { 1 };
+        uint32_t mask = 0;
+    };
+
+    template<typename T>
+    static void Construct(void* target)
+    {
+        new (target) T();
+    }
+
+    template<typename T>
+    static void CopyConstruct(void* target, void* source)
+    {
+        new (target) T(*static_cast<const T*>(source));
+    }
+
+    template<typename T>
+    static void MoveConstruct(void* target, void* source)
+    {
+        new (target) T(std::move(*static_cast<T*>(source)));
+    }
+
+    template<typename T>
+    static void Destroy(void* target)
+    {
+        static_cast<T*>(target)->~T();
+    }
+
+    using ConstructFunc = void (*)(void*);
+    using TransferFunc = void (*)(void*, void*);
+    using DestroyFunc = void (*)(void*);
+
+    static constexpr size_t ALIGNMENT = std::max({ alignof(Header), alignof(Groups)... });
+    static_assert(ALIGNMENT <= alignof(std::max_align_t), "over-aligned groups are not supported");
+    static constexpr size_t SIZES[] = { sizeof(Groups)... };
+    static constexpr size_t ALIGNMENTS[] = { alignof(Groups)... };
+    static constexpr ConstructFunc CONSTRUCTORS[] = { &Construct<Groups>... };
+    static constexpr TransferFunc COPIERS[] = { &CopyConstruct<Groups>... };
+    static constexpr TransferFunc MOVERS[] = { &MoveConstruct<Groups>... };
+    static constexpr DestroyFunc DESTRUCTORS[] = { &Destroy<Groups>... };
+
+    static constexpr uint32_t GroupBit(size_t index)
+    {
+        return 1u << index;
+    }
+
+    static constexpr size_t AlignUp(size_t value, size_t alignment)
+    {
+        return (value + alignment - 1) / alignment * alignment;
+    }
+
+    static size_t GroupOffset(uint32_t mask, size_t index)
+    {
+        size_t offset = AlignUp(sizeof(Header), ALIGNMENT);
+        for (size_t i = 0; i < index; ++i) {
+            if ((mask & GroupBit(i)) != 0) {
+                offset = AlignUp(offset, ALIGNMENTS[i]) + SIZES[i];
+            }
+        }
+        return AlignUp(offset, ALIGNMENTS[index]);
+    }
+
+    static size_t BlockSize(uint32_t mask)
+    {
+        size_t size = AlignUp(sizeof(Header), ALIGNMENT);
+        for (size_t i = 0; i < GROUP_COUNT; ++i) {
+            if ((mask & GroupBit(i)) != 0) {
+                size = AlignUp(size, ALIGNMENTS[i]) + SIZES[i];
+            }
+        }
+        return size;
+    }
+
+    static void* GroupAddress(Header* header, size_t index)
+    {
+        return reinterpret_cast<uint8_t*>(header) + GroupOffset(header->mask, index);
+    }
+
+    // lays out the groups of the mask in a new block, keeping the values of the groups already present.
+    void Rebuild(uint32_t mask)
+    {
+        auto* header = new (::operator new(BlockSize(mask))) Header();
+        header->mask = mask;
+        // the groups of a block owned only by this copy are moved instead of copied.
+        bool canMove = header_ && !IsShared();
+        for (size_t i = 0; i < GROUP_COUNT; ++i) {
+            if ((mask & GroupBit(i)) == 0) {
+                continue;
+            }
+            auto* target = GroupAddress(header, i);
+            if (header_ && (header_->mask & GroupBit(i)) != 0) {
+                auto* source = GroupAddress(header_, i);
+                canMove ? MOVERS[i](target, source) : COPIERS[i](target, source);
+            } else {
+                CONSTRUCTORS[i](target);
+            }
+        }
+        Release();
+        header_ = header;
+    }
+
+    void Release()
+    {
+        if (!header_) {
+            return;
+        }
+        if (header_->refCount.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            for (size_t i = 0; i < GROUP_COUNT; ++i) {
+                if ((header_->mask & GroupBit(i)) != 0) {
+                    DESTRUCTORS[i](GroupAddress(header_, i));
+                }
+            }
+            header_->~Header();
+            ::operator delete(header_);
+        }
+        header_ = nullptr;
+    }
+
+    Header* header_ = nullptr;
+};
+
+} // namespace OHOS::Ace::NG
+
+#endif // FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_PROPERTY_PROPERTY_GROUP_BLOCK_H
@@ -21,16 +21,18 @@
 #include "core/animation/picture_animation.h"
 #include "core/components_ng/image_provider/adapter/skia_image_data.h"
 #include "core/components_ng/image_provider/image_utils.h"
-#include "core/image/flutter_image_cache.h"
+#include "core/image/animated_frame_cache.h"
 #include "core/pipeline_ng/pipeline_context.h"
 namespace OHOS::Ace::NG {
 namespace {
 constexpr int32_t STANDARD_FRAME_DURATION = 100;
 constexpr int32_t FORM_REPEAT_COUNT = 1;
+// number of frames decoded ahead of the animation
+constexpr uint32_t PRE_DECODE_COUNT = 3;
 } // namespace
 
 AnimatedImage::AnimatedImage(std::unique_ptr<SkCodec> codec, const SizeF& size, const std::string& url)
-    : codec_(std::move(codec)), cacheKey_(url + size.ToString()), size_(size)
+    : codec_(std::move(codec)), frameCount_(codec_->getFrameCount()), cacheKey_(url + size.ToString()), size_(size)
 {
     // set up animator
     int32_t totalDuration = 0;
@@ -86,108 +88,115 @@ RefPtr<CanvasImage> AnimatedImage::Create(const RefPtr<ImageData>& data, const S
 
 void AnimatedImage::RenderFrame(uint32_t idx)
 {
-    if (GetCachedFrame(idx)) {
+    currentIdx_ = idx;
+    auto& cache = AnimatedFrameCache::GetInstance();
+    auto frame = cache.Get(cacheKey_, idx);
+    if (frame) {
+        {
+            std::scoped_lock<std::mutex> lock(frameMtx_);
+            currentFrame_ = frame;
+        }
+        LOGD("frame cache found src = %{public}s, frame = %{public}d", cacheKey_.c_str(), idx);
+        if (redraw_) {
+            redraw_();
+        }
+        // keep the pre-decoded frames ahead of the animation
+        if (cache.Contains(cacheKey_, (idx + PRE_DECODE_COUNT) % frameCount_)) {
+            return;
+        }
+    }
+    // frames requested while decoding are handled by the running task or the next tick
+    if (decoding_.exchange(true)) {
         return;
     }
     ImageUtils::PostToBg([weak = WeakClaim(this), idx] {
         auto self = weak.Upgrade();
         CHECK_NULL_VOID(self);
-        self->DecodeFrame(idx);
+        self->DecodeFrames(idx);
     });
 }
 
 // Background thread
-void AnimatedImage::DecodeFrame(uint32_t idx)
+void AnimatedImage::DecodeFrames(uint32_t idx)
 {
-    ACE_SCOPED_TRACE("decode frame %d", idx);
     std::scoped_lock<std::mutex> lock(decodeMtx_);
+    auto& cache = AnimatedFrameCache::GetInstance();
+    // decode the requested frame and the next few ones, so they are in cache when the animator reaches them
+    for (uint32_t i = 0; i <= PRE_DECODE_COUNT && i < frameCount_; ++i) {
+        auto frameIdx = (idx + i) % frameCount_;
+        // skip frames already cached or being decoded by another image of the same source
+        if (!cache.BeginDecode(cacheKey_, frameIdx)) {
+            continue;
+        }
+        auto frame = DecodeFrame(frameIdx);
+        if (frame) {
+            cache.Put(cacheKey_, frameIdx, frame);
+        }
+        cache.EndDecode(cacheKey_, frameIdx);
+        if (!frame) {
+            break;
+        }
+        if (frameIdx != currentIdx_) {
+            continue;
+        }
+        // save current frame, notify redraw
+        {
+            std::scoped_lock<std::mutex> lock(frameMtx_);
+            currentFrame_ = frame;
+        }
+        ImageUtils::PostToUI([weak = WeakClaim(this)] {
+            auto self = weak.Upgrade();
+            CHECK_NULL_VOID(self && self->redraw_);
+            self->redraw_();
+        });
+    }
+    decoding_ = false;
+}
 
+sk_sp<SkImage> AnimatedImage::DecodeFrame(uint32_t idx)
+{
+    ACE_SCOPED_TRACE("decode frame %d", idx);
     SkImageInfo imageInfo = codec_->getInfo();
-    imageInfo.makeWH(size_.Width(), size_.Height());
-
     SkBitmap bitmap;
+    CHECK_NULL_RETURN(bitmap.tryAllocPixels(imageInfo), nullptr);
 
     SkCodec::Options options;
     options.fFrameIndex = idx;
 
     SkCodec::FrameInfo info {};
     codec_->getFrameInfo(idx, &info);
-    if (info.fRequiredFrame != SkCodec::kNoFrame) {
+    if (info.fRequiredFrame != SkCodec::kNoFrame && CopyRequiredFrame(info.fRequiredFrame, bitmap)) {
         // frame requires a previous frame as background layer
         options.fPriorFrame = info.fRequiredFrame;
-        bitmap = requiredFrame_;
     } else {
-        // create from empty layer
-        bitmap.allocPixels(imageInfo);
+        // create from empty layer, codec decodes the frames it requires by itself
+        bitmap.eraseColor(SK_ColorTRANSPARENT);
     }
 
     // decode pixels from codec
     auto res = codec_->getPixels(imageInfo, bitmap.getPixels(), bitmap.rowBytes(), &options);
-    CHECK_NULL_VOID(res == SkCodec::kSuccess);
+    CHECK_NULL_RETURN(res == SkCodec::kSuccess, nullptr);
 
     // next frame will be drawn on top of this one
     if (info.fDisposalMethod != SkCodecAnimation::DisposalMethod::kRestorePrevious) {
         requiredFrame_ = bitmap;
+        requiredFrameIdx_ = static_cast<int32_t>(idx);
     }
-
-    // save current frame, notify redraw
-    {
-        std::scoped_lock<std::mutex> lock(frameMtx_);
-        currentFrame_ = SkImage::MakeFromBitmap(bitmap);
-    }
-    ImageUtils::PostToUI([weak = WeakClaim(this)] {
-        auto self = weak.Upgrade();
-        CHECK_NULL_VOID(self && self->redraw_);
-        self->redraw_();
-    });
-
-    CacheFrame(idx);
-}
-
-void AnimatedImage::ControlAnimation(bool play)
-{
-    (play) ? animator_->Play() : animator_->Pause();
+    return SkImage::MakeFromBitmap(bitmap);
 }
 
-void AnimatedImage::CacheFrame(uint32_t idx)
+bool AnimatedImage::CopyRequiredFrame(uint32_t requiredIdx, SkBitmap& bitmap)
 {
-    auto ctx = PipelineContext::GetCurrentContext();
-    CHECK_NULL_VOID(ctx);
-    auto cache = ctx->GetImageCache();
-    CHECK_NULL_VOID(cache);
-    std::shared_ptr<CachedImage> cacheNode;
-    {
-        std::scoped_lock<std::mutex> lock(frameMtx_);
-        cacheNode = std::make_shared<CachedImage>(currentFrame_);
+    if (requiredFrameIdx_ == static_cast<int32_t>(requiredIdx)) {
+        return requiredFrame_.readPixels(bitmap.pixmap());
     }
-    cache->CacheImageNG(cacheKey_ + std::to_string(idx), cacheNode);
+    // frames are skipped when found in cache, take the required one from there
+    auto cached = AnimatedFrameCache::GetInstance().Get(cacheKey_, requiredIdx);
+    return cached && cached->readPixels(bitmap.pixmap(), 0, 0);
 }
 
-bool AnimatedImage::GetCachedFrame(uint32_t idx)
+void AnimatedImage::ControlAnimation(bool play)
 {
-    auto ctx = PipelineContext::GetCurrentContext();
-    CHECK_NULL_RETURN(ctx, false);
-    auto cache = ctx->GetImageCache();
-    CHECK_NULL_RETURN(cache, false);
-    auto image = cache->GetCacheImageNG(cacheKey_ + std::to_string(idx));
-    CHECK_NULL_RETURN_NOLOG(image && image->imagePtr, false);
-
-    if (!decodeMtx_.try_lock()) {
-        // last frame still decoding, skip this frame to avoid blocking UI thread
-        return true;
-    }
-
-    {
-        std::scoped_lock<std::mutex> lock(frameMtx_);
-        currentFrame_ = image->imagePtr;
-    }
-
-    decodeMtx_.unlock();
-    LOGD("frame cache found src = %{public}s, frame = %{public}d", cacheKey_.c_str(), idx);
-
-    if (redraw_) {
-        redraw_();
-    }
-    return true;
+    (play) ? animator_->Play() : animator_->Pause();
 }
 } // namespace OHOS::Ace::NG
@@ -16,6 +16,7 @@
 #ifndef FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_RENDER_ADAPTER_ANIMATED_IMAGE_H
 #define FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_RENDER_ADAPTER_ANIMATED_IMAGE_H
 
+#include <atomic>
 #include <memory>
 #include <utility>
 
@@ -55,22 +56,26 @@ public:
 
 private:
     void RenderFrame(uint32_t idx);
-    void DecodeFrame(uint32_t idx);
-
-    void CacheFrame(uint32_t idx);
-    bool GetCachedFrame(uint32_t idx);
+    void DecodeFrames(uint32_t idx);
+    sk_sp<SkImage> DecodeFrame(uint32_t idx);
+    bool CopyRequiredFrame(uint32_t requiredIdx, SkBitmap& bitmap);
 
     // ensure frames decode serially, protect bitmap
     std::mutex decodeMtx_;
     SkBitmap requiredFrame_;
+    int32_t requiredFrameIdx_ = -1;
 
     // protect currentFrame_
     mutable std::mutex frameMtx_;
     sk_sp<SkImage> currentFrame_;
+    // frame requested by animator
+    std::atomic<uint32_t> currentIdx_ = 0;
+    std::atomic<bool> decoding_ = false;
 
     std::function<void()> redraw_;
     RefPtr<Animator> animator_;
     std::unique_ptr<SkCodec> codec_;
+    uint32_t frameCount_ = 0;
 
     const std::string cacheKey_;
     const SizeF size_;
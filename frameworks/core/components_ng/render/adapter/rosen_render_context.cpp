@@ -976,10 +976,15 @@ void RosenRenderContext::PaintBorderImageGradient()
     CHECK_NULL_VOID(layoutProperty);
 
     auto borderImageProperty = *GetBdImage();
-    auto&& borderWidthProperty = layoutProperty->GetBorderWidthProperty();
-    auto paintTask = [paintSize, borderImageProperty, &borderWidthProperty, gradient](RSCanvas& rsCanvas) mutable {
+    // the task runs after the layout property may have been updated, keep a copy of the border width.
+    std::optional<BorderWidthProperty> borderWidthProperty;
+    if (layoutProperty->GetBorderWidthProperty()) {
+        borderWidthProperty = *layoutProperty->GetBorderWidthProperty();
+    }
+    auto paintTask = [paintSize, borderImageProperty, borderWidthProperty, gradient](RSCanvas& rsCanvas) mutable {
         auto rsImage = SkiaDecorationPainter::CreateBorderImageGradient(gradient, paintSize);
-        BorderImagePainter borderImagePainter(borderImageProperty, borderWidthProperty, paintSize, rsImage,
+        BorderImagePainter borderImagePainter(borderImageProperty,
+            borderWidthProperty ? &borderWidthProperty.value() : nullptr, paintSize, rsImage,
             PipelineBase::GetCurrentContext()->GetDipScale());
         borderImagePainter.PaintBorderImage(OffsetF(0.0, 0.0), rsCanvas);
     };
@@ -1046,7 +1051,7 @@ RectF RosenRenderContext::AdjustPaintRect()
         Dimension selfMarginLeft;
         Dimension selfMarginTop;
         if (frameNode->GetLayoutProperty() && frameNode->GetLayoutProperty()->GetMarginProperty()) {
-            auto& margin = frameNode->GetLayoutProperty()->GetMarginProperty();
+            const auto& margin = frameNode->GetLayoutProperty()->GetMarginProperty();
             if (margin->left.has_value()) {
                 selfMarginLeft = margin->left.value().GetDimension();
             }
@@ -20,9 +20,8 @@ constexpr double EXTRA_OFFSET = 1.0;
 } // namespace
 
 namespace OHOS::Ace::NG {
-BorderImagePainter::BorderImagePainter(BorderImageProperty bdImageProps,
-    const std::unique_ptr<BorderWidthProperty>& widthProp, const SizeF& paintSize, const RSImage& image,
-    double dipScale)
+BorderImagePainter::BorderImagePainter(BorderImageProperty bdImageProps, const BorderWidthProperty* widthProp,
+    const SizeF& paintSize, const RSImage& image, double dipScale)
     : hasWidthProp_(widthProp != nullptr), borderImageProperty_(std::move(bdImageProps)), paintSize_(paintSize),
       image_(image), dipScale_(dipScale)
 {
@@ -17,28 +17,16 @@
 
 #include <list>
 #include <type_traits>
+#include <vector>
 
 #include "base/log/ace_performance_check.h"
 #include "base/log/ace_trace.h"
+#include "base/utils/keyed_diff.h"
 #include "core/components_ng/base/ui_node.h"
 #include "core/components_ng/property/property.h"
 #include "core/pipeline/base/element_register.h"
 
 namespace OHOS::Ace::NG {
-namespace {
-void MakeNodeMapById(const std::list<RefPtr<UINode>>& nodes, const std::list<std::string>& ids,
-    std::map<std::string, RefPtr<UINode>>& result)
-{
-    ACE_DCHECK(ids.size() == nodes.size());
-    auto idsIter = ids.begin();
-    auto nodeIter = nodes.begin();
-    while (idsIter != ids.end() && nodeIter != nodes.end()) {
-        result.emplace(*idsIter, *nodeIter);
-        ++idsIter;
-        ++nodeIter;
-    }
-}
-} // namespace
 
 RefPtr<ForEachNode> ForEachNode::GetOrCreateForEachNode(int32_t nodeId)
 {
@@ -57,81 +45,109 @@ void ForEachNode::CreateTempItems()
     std::swap(ModifyChildren(), tempChildren_);
 }
 
-// same as foundation/arkui/ace_engine/frameworks/core/components_part_upd/foreach/foreach_element.cpp.
 void ForEachNode::CompareAndUpdateChildren()
 {
     ACE_SCOPED_TRACE("ForEachNode::CompareAndUpdateChildren");
     LOGD("Local update for ForEachNode nodeId: %{public}d ....", GetId());
 
-    // result of id gen function of most re-recent render
-    // create a map for quicker find/search
-    std::unordered_set<std::string> newIdsSet(ids_.begin(), ids_.end());
-
-    // result of id gen function of previous render/re-render
-    // create a map for quicker find/search
-    std::unordered_set<std::string> oldIdsSet(tempIds_.begin(), tempIds_.end());
-
     // ForEachNode only includes children for newly created_ array items
     // it does not include children of array items that were rendered on a previous
     // render
     std::list<RefPtr<UINode>> additionalChildComps;
     auto& children = ModifyChildren();
     std::swap(additionalChildComps, children);
+    // start from the children of previous render, only the changed items are touched
+    std::swap(children, tempChildren_);
 
-    // create map id -> Node
-    // old children
-    std::map<std::string, RefPtr<UINode>> oldNodeByIdMap;
-    MakeNodeMapById(tempChildren_, tempIds_, oldNodeByIdMap);
-
-    int32_t additionalChildIndex = 0;
-    for (const auto& newId : ids_) {
-        auto oldIdIt = oldIdsSet.find(newId);
-        if (oldIdIt == oldIdsSet.end()) {
-            // found a newly added ID
-            // insert new child item.
-            auto newCompsIter = additionalChildComps.begin();
-            std::advance(newCompsIter, additionalChildIndex++);
-            if (newCompsIter != additionalChildComps.end()) {
-                // Call AddChild to execute AttachToMainTree of new child.
-                AddChild(*newCompsIter);
-            }
-        } else {
-            auto iter = oldNodeByIdMap.find(newId);
-            // the ID was used before, only need to update the child position.
-            if (iter != oldNodeByIdMap.end() && iter->second) {
-                AddChild(iter->second, DEFAULT_NODE_SLOT, true);
-            }
-            oldIdsSet.erase(oldIdIt);
-        }
+    // match ids of most re-recent render against ids of previous render/re-render
+    auto diff = ComputeKeyedDiff<std::string>(tempIds_, ids_);
+    LOGD("ForEachNode diff: inserted %{public}d, removed %{public}d, moved %{public}d, changed from %{public}d",
+        diff.insertedCount, diff.removedCount, diff.movedCount, diff.firstChangedIndex);
+    tempIds_.clear();
+    if (diff.firstChangedIndex < 0) {
+        return;
     }
 
-    for (const auto& oldId : oldIdsSet) {
-        auto iter = oldNodeByIdMap.find(oldId);
-        if (iter != oldNodeByIdMap.end()) {
-            // Adding silently, so that upon removal
-            // node is a part the tree.
-            // OnDetachFromMainTree to be called while node
-            // still part of the tree, we need to find
-            // position in the tab tab for the tab.
-            AddChild(iter->second, DEFAULT_NODE_SLOT, true);
+    std::vector<std::list<RefPtr<UINode>>::iterator> oldChildIters;
+    oldChildIters.reserve(children.size());
+    for (auto iter = children.begin(); iter != children.end(); ++iter) {
+        oldChildIters.emplace_back(iter);
+    }
+    if (oldChildIters.size() != diff.removed.size()) {
+        LOGE("ForEachNode old ids: %{public}zu, old children: %{public}zu", diff.removed.size(), oldChildIters.size());
+    }
+    for (size_t oldIndex = 0; oldIndex < diff.removed.size() && oldIndex < oldChildIters.size(); ++oldIndex) {
+        if (diff.removed[oldIndex]) {
             // Remove and trigger all Detach callback.
-            RemoveChild(iter->second);
+            RemoveChild(*oldChildIters[oldIndex]);
         }
     }
 
-    if (IsOnMainTree()) {
-        for (const auto& newChild : additionalChildComps) {
-            newChild->AttachToMainTree();
+    // place the items from back to front, every item is put before the one following it. Stable items keep
+    // their position, the other kept items are moved and new items are inserted.
+    std::vector<std::list<RefPtr<UINode>>::iterator> newChildComps;
+    newChildComps.reserve(additionalChildComps.size());
+    for (auto iter = additionalChildComps.begin(); iter != additionalChildComps.end(); ++iter) {
+        newChildComps.emplace_back(iter);
+    }
+    auto newCompIndex = static_cast<int32_t>(diff.insertedCount) - 1;
+    if (diff.insertedCount != static_cast<int32_t>(newChildComps.size())) {
+        LOGE("ForEachNode new ids: %{public}d, new children: %{public}zu", diff.insertedCount, newChildComps.size());
+        newCompIndex = static_cast<int32_t>(newChildComps.size()) - 1;
+    }
+    auto anchor = children.end();
+    for (auto newIndex = static_cast<int32_t>(diff.oldIndexes.size()) - 1; newIndex >= 0; --newIndex) {
+        auto oldIndex = diff.oldIndexes[newIndex];
+        if (oldIndex < 0) {
+            if (newCompIndex < 0) {
+                continue;
+            }
+            auto newCompIter = newChildComps[newCompIndex--];
+            children.splice(anchor, additionalChildComps, newCompIter);
+            anchor = newCompIter;
+            continue;
+        }
+        if (oldIndex >= static_cast<int32_t>(oldChildIters.size())) {
+            continue;
+        }
+        auto oldChildIter = oldChildIters[oldIndex];
+        if (!diff.stable[newIndex]) {
+            // the ID was used before, only need to update the child position.
+            children.splice(anchor, children, oldChildIter);
         }
+        anchor = oldChildIter;
     }
 
+    // new children have been added to this node when created, attach them with their final position.
+    for (auto iter = newChildComps.begin(); iter != newChildComps.end() && IsOnMainTree(); ++iter) {
+        (**iter)->AttachToMainTree();
+    }
+    MarkNeedSyncRenderTree();
     tempChildren_.clear();
-    tempIds_.clear();
 
     auto parent = GetParent();
     if (parent) {
-        parent->ChildrenUpdatedFrom(0);
+        parent->ChildrenUpdatedFrom(GetFrameIndexInParent(parent, diff.firstChangedIndex));
+    }
+}
+
+int32_t ForEachNode::GetFrameIndexInParent(const RefPtr<UINode>& parent, int32_t childIndex) const
+{
+    // flat index of the first frame of [childIndex] child in parent
+    int32_t frameIndex = 0;
+    for (const auto& sibling : parent->GetChildren()) {
+        if (RawPtr(sibling) == this) {
+            break;
+        }
+        frameIndex += sibling->FrameCount();
+    }
+    for (const auto& child : GetChildren()) {
+        if (childIndex-- <= 0) {
+            break;
+        }
+        frameIndex += child->FrameCount();
     }
+    return frameIndex;
 }
 
 void ForEachNode::FlushUpdateAndMarkDirty()
@@ -58,6 +58,8 @@ public:
     }
 
 private:
+    int32_t GetFrameIndexInParent(const RefPtr<UINode>& parent, int32_t childIndex) const;
+
     std::list<std::string> ids_;
 
     // temp items use to compare each update.
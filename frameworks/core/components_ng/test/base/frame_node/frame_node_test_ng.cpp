@@ -250,17 +250,17 @@ HWTEST_F(FrameNodeTestNg, FrameNodeTestNg006, TestSize.Level1)
     frameNode.layoutProperty_->UpdatePadding(PaddingPropertyT<CalcLength>());
     frameNode.layoutProperty_->GetPaddingProperty();
     frameNode.DumpInfo();
-    EXPECT_EQ(layoutProperty.padding_, nullptr);
+    EXPECT_EQ(layoutProperty.GetPaddingProperty(), nullptr);
 
     frameNode.layoutProperty_->UpdateMargin(PaddingProperty());
     frameNode.layoutProperty_->GetMarginProperty();
     frameNode.DumpInfo();
-    EXPECT_EQ(layoutProperty.margin_, nullptr);
+    EXPECT_EQ(layoutProperty.GetMarginProperty(), nullptr);
 
     frameNode.layoutProperty_->UpdateBorderWidth(BorderWidthPropertyT<Dimension>());
     frameNode.layoutProperty_->GetBorderWidthProperty();
     frameNode.DumpInfo();
-    EXPECT_EQ(layoutProperty.borderWidth_, nullptr);
+    EXPECT_EQ(layoutProperty.GetBorderWidthProperty(), nullptr);
 }
 
 /**
@@ -721,7 +721,8 @@ HWTEST_F(FrameNodeTestNg, FrameNodeTestNg0028, TestSize.Level1)
     FRAME_NODE2->IsNeedRequestParentMeasure();
 
     FRAME_NODE2->layoutProperty_->propertyChangeFlag_ = PROPERTY_UPDATE_BY_CHILD_REQUEST;
-    FRAME_NODE2->layoutProperty_->calcLayoutConstraint_ = std::make_unique<MeasureProperty>();
+    FRAME_NODE2->layoutProperty_->ResetCalcLayoutConstraint();
+    FRAME_NODE2->layoutProperty_->GetOrCreateCalcLayoutConstraint();
     auto test1 = FRAME_NODE2->IsNeedRequestParentMeasure();
     EXPECT_TRUE(test1);
 }
@@ -1061,7 +1062,8 @@ HWTEST_F(FrameNodeTestNg, FrameNodeTestNg0048, TestSize.Level1)
      * @tc.expected: step1. expect The function is run ok.
      */
     OffsetF Offset = { 0, 0 };
-    FRAME_NODE2->layoutProperty_->positionProperty_ = std::make_unique<PositionProperty>();
+    FRAME_NODE2->layoutProperty_->ResetPositionProperty();
+    FRAME_NODE2->layoutProperty_->GetOrCreatePositionProperty();
     auto test = FRAME_NODE2->GetOffsetRelativeToWindow();
     FRAME_NODE2->SetParent(FRAME_NODE_PARENT);
     EXPECT_EQ(test, Offset);
@@ -1104,4 +1104,26 @@ HWTEST_F(UINodeTestNg, UINodeTestNg040, TestSize.Level1)
     ZERO->DoAddChild(it, TWO, true);
     EXPECT_EQ(ZERO->children_.size(), 2);
 }
+
+/**
+ * @tc.name: UINodeTestNg041
+ * @tc.desc: Test appending a new child which is disappearing
+ * @tc.type: FUNC
+ */
+HWTEST_F(UINodeTestNg, UINodeTestNg041, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. add a node without a parent to the disappearing children of a parent, then append it.
+     * @tc.expected: step1. it is a child and no longer disappearing, as with AddChild.
+     */
+    auto parent = FrameNode::CreateFrameNode("parent", 20, AceType::MakeRefPtr<Pattern>());
+    auto child = FrameNode::CreateFrameNode("child", 21, AceType::MakeRefPtr<Pattern>());
+    parent->AddDisappearingChild(child, 0);
+    EXPECT_TRUE(child->isDisappearing_);
+    parent->AppendNewChild(child);
+    EXPECT_FALSE(child->isDisappearing_);
+    EXPECT_TRUE(parent->disappearingChildren_.empty());
+    ASSERT_EQ(parent->children_.size(), 1);
+    EXPECT_EQ(parent->children_.front(), child);
+}
 } // namespace OHOS::Ace::NG
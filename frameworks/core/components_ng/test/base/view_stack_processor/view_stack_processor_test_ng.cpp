@@ -17,6 +17,7 @@
 #define protected public
 #define private public
 
+#include "core/components_ng/base/build_command_buffer.h"
 #include "core/components_ng/base/group_node.h"
 #include "core/components_ng/base/view_stack_processor.h"
 #include "core/components_ng/pattern/pattern.h"
@@ -34,6 +35,133 @@ const auto MOCK_PATTERN_CHILD = AceType::MakeRefPtr<Pattern>();
 const auto PATTERN_ROOT = AceType::MakeRefPtr<Pattern>();
 const auto FRAME_NODE_ROOT = FrameNode::CreateFrameNode(TAG_ROOT, 1, MOCK_PATTERN_ROOT, true);
 const auto FRAME_NODE_CHILD = FrameNode::CreateFrameNode(TAG_CHILD, 2, MOCK_PATTERN_ROOT, false);
+// a page of one column, PAGE_ROW_COUNT rows and PAGE_ROW_SIZE leaves in every row, 1001 nodes.
+constexpr int32_t PAGE_ROW_COUNT = 100;
+constexpr int32_t PAGE_ROW_SIZE = 9;
+constexpr int32_t PAGE_NODE_COUNT = 1 + PAGE_ROW_COUNT * (1 + PAGE_ROW_SIZE);
+// codes of the test handlers of build commands.
+constexpr uint16_t CODE_CONTAINER = 0;
+constexpr uint16_t CODE_LEAF = 1;
+constexpr uint16_t CODE_CHECK = 0;
+constexpr uint16_t CODE_UNKNOWN = 9;
+constexpr double CHECK_NUMBER = 5.0;
+const std::string CHECK_STRING = "check";
+
+class BatchTestPattern : public Pattern {
+    DECLARE_ACE_TYPE(BatchTestPattern, Pattern);
+
+public:
+    explicit BatchTestPattern(bool isAtomic) : isAtomic_(isAtomic) {}
+    ~BatchTestPattern() override = default;
+
+    bool IsAtomicNode() const override
+    {
+        return isAtomic_;
+    }
+
+    void OnModifyDone() override
+    {
+        ++modifyDoneCount_;
+    }
+
+    void OnMountToParentDone() override
+    {
+        ++mountDoneCount_;
+    }
+
+    bool isAtomic_ = true;
+    int32_t modifyDoneCount_ = 0;
+    int32_t mountDoneCount_ = 0;
+};
+
+RefPtr<FrameNode> CreateBatchTestNode(int32_t& nodeId, bool isAtomic)
+{
+    return FrameNode::CreateFrameNode(
+        isAtomic ? TAG_CHILD : TAG_ROOT, nodeId++, AceType::MakeRefPtr<BatchTestPattern>(isAtomic));
+}
+
+// state of the test handlers, which are plain functions like those of the frontend.
+int32_t g_handlerNodeId = 1;
+int32_t g_checkCount = 0;
+bool g_checkInBatch = false;
+bool g_checkArgs = false;
+
+const BuildCommandHandlers& GetTestHandlers()
+{
+    static const BuildCommandHandlers handlers = {
+        { [](const BuildCommandArgs& /* args */) {
+             ViewStackProcessor::GetInstance()->Push(CreateBatchTestNode(g_handlerNodeId, false));
+         },
+            [](const BuildCommandArgs& /* args */) {
+                ViewStackProcessor::GetInstance()->Push(CreateBatchTestNode(g_handlerNodeId, true));
+            } },
+        { [](const BuildCommandArgs& args) {
+            ++g_checkCount;
+            g_checkInBatch = ViewStackProcessor::GetInstance()->IsBatchBuilding();
+            g_checkArgs = args.GetCount() == 2 && NearEqual(args.GetNumber(0), CHECK_NUMBER) && !args.IsString(0) &&
+                          args.GetString(0).empty() && args.IsString(1) && args.GetString(1) == CHECK_STRING &&
+                          NearEqual(args.GetNumber(1, -1.0), -1.0) && !args.IsString(2);
+        } },
+    };
+    return handlers;
+}
+
+RefPtr<UINode> BuildPageByStack()
+{
+    int32_t nodeId = 1;
+    auto* stack = ViewStackProcessor::GetInstance();
+    stack->Push(CreateBatchTestNode(nodeId, false));
+    for (int32_t row = 0; row < PAGE_ROW_COUNT; ++row) {
+        stack->Push(CreateBatchTestNode(nodeId, false));
+        for (int32_t leaf = 0; leaf < PAGE_ROW_SIZE; ++leaf) {
+            stack->Push(CreateBatchTestNode(nodeId, true));
+        }
+        stack->PopContainer();
+    }
+    return stack->Finish();
+}
+
+RefPtr<UINode> BuildPageByCommands()
+{
+    g_handlerNodeId = 1;
+    BuildCommandBuffer buffer;
+    buffer.Reserve(PAGE_NODE_COUNT + PAGE_ROW_COUNT, 0);
+    buffer.Push(CreateBatchTestNode(g_handlerNodeId, false));
+    for (int32_t row = 0; row < PAGE_ROW_COUNT; ++row) {
+        buffer.Create(CODE_CONTAINER);
+        for (int32_t leaf = 0; leaf < PAGE_ROW_SIZE; ++leaf) {
+            buffer.Create(CODE_LEAF);
+        }
+        buffer.PopContainer();
+    }
+    ViewStackProcessor::GetInstance()->ExecuteBuildCommands(buffer, GetTestHandlers());
+    return ViewStackProcessor::GetInstance()->Finish();
+}
+
+// checks that both trees have the same nodes in the same order, that every node is mounted to its parent, and that
+// the modify done and mount done callbacks of the batch nodes ran once. Returns the count of nodes.
+int32_t CheckSameTree(const RefPtr<UINode>& stackNode, const RefPtr<UINode>& batchNode)
+{
+    EXPECT_EQ(stackNode->GetTag(), batchNode->GetTag());
+    EXPECT_EQ(stackNode->GetId(), batchNode->GetId());
+    auto pattern = AceType::DynamicCast<FrameNode>(batchNode)->GetPattern<BatchTestPattern>();
+    EXPECT_EQ(pattern->modifyDoneCount_, 1);
+    // the root isn't popped.
+    EXPECT_EQ(pattern->mountDoneCount_, batchNode->GetParent() ? 1 : 0);
+    const auto& stackChildren = stackNode->GetChildren();
+    const auto& batchChildren = batchNode->GetChildren();
+    EXPECT_EQ(stackChildren.size(), batchChildren.size());
+    if (stackChildren.size() != batchChildren.size()) {
+        return 1;
+    }
+    int32_t count = 1;
+    auto stackChild = stackChildren.begin();
+    for (const auto& batchChild : batchChildren) {
+        EXPECT_EQ(batchChild->GetParent(), batchNode);
+        count += CheckSameTree(*stackChild++, batchChild);
+    }
+    return count;
+}
 }; // namespace
 
 class ViewStackProcessorTestNg : public testing::Test {};
@@ -135,4 +263,124 @@ HWTEST_F(ViewStackProcessorTestNg, ViewStackProcessorTestNg004, TestSize.Level1)
     EXPECT_NE(scoped->instance_, nullptr);
     scoped = nullptr;
 }
+
+/**
+ * @tc.name: ViewStackProcessorTestNg005
+ * @tc.desc: Test building a subtree from a BuildCommandBuffer
+ * @tc.type: FUNC
+ */
+HWTEST_F(ViewStackProcessorTestNg, ViewStackProcessorTestNg005, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. record a container with two leaves, set an attribute of the second leaf with arguments, then
+     *                   set an attribute without a handler.
+     */
+    int32_t nodeId = 1;
+    auto container = CreateBatchTestNode(nodeId, false);
+    auto first = CreateBatchTestNode(nodeId, true);
+    auto firstPattern = first->GetPattern<BatchTestPattern>();
+    g_handlerNodeId = nodeId;
+    g_checkCount = 0;
+    BuildCommandBuffer buffer;
+    buffer.Push(container);
+    buffer.Push(first);
+    buffer.Create(CODE_LEAF);
+    buffer.SetAttribute(CODE_CHECK);
+    buffer.AddNumber(CHECK_NUMBER);
+    buffer.AddString(std::string(CHECK_STRING));
+    buffer.SetAttribute(CODE_UNKNOWN);
+    buffer.Pop();
+    EXPECT_EQ(buffer.GetSize(), 6);
+
+    /**
+     * @tc.steps: step2. execute the buffer.
+     * @tc.expected: step2. the handler gets its arguments, the command without a handler is skipped, the leaves are
+     *                      mounted in order and their callbacks are deferred to the end of the batch.
+     */
+    ViewStackProcessor::GetInstance()->ExecuteBuildCommands(buffer, GetTestHandlers());
+    EXPECT_FALSE(ViewStackProcessor::GetInstance()->IsBatchBuilding());
+    EXPECT_EQ(g_checkCount, 1);
+    EXPECT_TRUE(g_checkInBatch);
+    EXPECT_TRUE(g_checkArgs);
+    EXPECT_EQ(firstPattern->modifyDoneCount_, 1);
+    EXPECT_EQ(firstPattern->mountDoneCount_, 1);
+    auto root = ViewStackProcessor::GetInstance()->Finish();
+    EXPECT_EQ(root, container);
+    ASSERT_EQ(container->GetChildren().size(), 2);
+    EXPECT_EQ(container->GetChildren().front(), first);
+    auto second = AceType::DynamicCast<FrameNode>(container->GetChildren().back());
+    ASSERT_NE(second, nullptr);
+    EXPECT_EQ(second->GetId(), nodeId);
+    EXPECT_EQ(second->GetPattern<BatchTestPattern>()->mountDoneCount_, 1);
+    EXPECT_EQ(first->GetParent(), container);
+
+    /**
+     * @tc.steps: step3. clear the buffer.
+     */
+    buffer.Clear();
+    EXPECT_TRUE(buffer.IsEmpty());
+}
+
+/**
+ * @tc.name: ViewStackProcessorTestNg006
+ * @tc.desc: Test building a page of 1000 nodes by BuildCommandBuffer is the same as by stack
+ * @tc.type: FUNC
+ */
+HWTEST_F(ViewStackProcessorTestNg, ViewStackProcessorTestNg006, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. build the page with Push and Pop, then with a BuildCommandBuffer.
+     * @tc.expected: step1. both build the page of all the nodes.
+     */
+    auto stackPage = BuildPageByStack();
+    auto batchPage = BuildPageByCommands();
+    ASSERT_NE(stackPage, nullptr);
+    ASSERT_NE(batchPage, nullptr);
+    EXPECT_EQ(g_handlerNodeId - 1, PAGE_NODE_COUNT);
+    ASSERT_EQ(batchPage->GetChildren().size(), PAGE_ROW_COUNT);
+    EXPECT_EQ(batchPage->GetChildren().back()->GetChildren().size(), PAGE_ROW_SIZE);
+
+    /**
+     * @tc.steps: step2. compare the pages node by node.
+     * @tc.expected: step2. they have the same nodes in the same order, every batch node is mounted to its parent and
+     *                      its callbacks ran once, as on the stack page.
+     */
+    EXPECT_EQ(CheckSameTree(stackPage, batchPage), PAGE_NODE_COUNT);
+    EXPECT_FALSE(ViewStackProcessor::GetInstance()->IsBatchBuilding());
+    EXPECT_TRUE(ViewStackProcessor::GetInstance()->batchTasks_.empty());
+}
+
+/**
+ * @tc.name: ViewStackProcessorTestNg007
+ * @tc.desc: Test a BuildCommandBuffer with a component code without creator builds nothing
+ * @tc.type: FUNC
+ */
+HWTEST_F(ViewStackProcessorTestNg, ViewStackProcessorTestNg007, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. record a container with a leaf and a component without creator.
+     */
+    int32_t nodeId = 1;
+    auto container = CreateBatchTestNode(nodeId, false);
+    auto containerPattern = container->GetPattern<BatchTestPattern>();
+    g_handlerNodeId = nodeId;
+    BuildCommandBuffer buffer;
+    buffer.Push(container);
+    buffer.Create(CODE_LEAF);
+    buffer.Create(CODE_UNKNOWN);
+    buffer.PopContainer();
+
+    /**
+     * @tc.steps: step2. execute the buffer.
+     * @tc.expected: step2. it fails before any command runs, no node is created, pushed or mounted.
+     */
+    ViewStackProcessor::GetInstance()->ClearStack();
+    EXPECT_FALSE(ViewStackProcessor::GetInstance()->ExecuteBuildCommands(buffer, GetTestHandlers()));
+    EXPECT_FALSE(ViewStackProcessor::GetInstance()->IsBatchBuilding());
+    EXPECT_EQ(g_handlerNodeId, nodeId);
+    EXPECT_EQ(ViewStackProcessor::GetInstance()->Finish(), nullptr);
+    EXPECT_TRUE(container->GetChildren().empty());
+    EXPECT_EQ(containerPattern->modifyDoneCount_, 0);
+    EXPECT_TRUE(ViewStackProcessor::GetInstance()->batchTasks_.empty());
+}
 } // namespace OHOS::Ace::NG
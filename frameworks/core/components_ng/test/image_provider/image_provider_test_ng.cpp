@@ -21,6 +21,7 @@
 
 #include "core/components_ng/image_provider/adapter/skia_image_data.h"
 #include "core/components_ng/image_provider/animated_image_object.h"
+#include "core/components_ng/image_provider/image_decode_scheduler.h"
 #include "core/components_ng/image_provider/image_loading_context.h"
 #include "core/components_ng/image_provider/image_provider.h"
 #include "core/components_ng/image_provider/image_state_manager.h"
@@ -242,4 +243,44 @@ HWTEST_F(ImageProviderTestNg, RoundUp001, TestSize.Level1)
     ctx->imageObj_ = AceType::MakeRefPtr<NG::StaticImageObject>(ImageSourceInfo(SRC_JPG), SizeF(0, 0), nullptr);
     EXPECT_EQ(ctx->RoundUp(LENGTH_128), -1);
 }
+
+/**
+ * @tc.name: DecodeJobQueue001
+ * @tc.desc: Test decode jobs run by priority and can be reprioritized or removed before running
+ * @tc.type: FUNC
+ */
+HWTEST_F(ImageProviderTestNg, DecodeJobQueue001, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. push jobs with different priorities.
+     * @tc.expected: jobs pop with the lowest priority first, equal priorities in posting order.
+     */
+    std::vector<std::string> order;
+    auto makeTask = [&order](const std::string& key) { return [&order, key]() { order.emplace_back(key); }; };
+    DecodeJobQueue queue;
+    queue.Push("far", makeTask("far"), 500.0f, 1);
+    queue.Push("visible1", makeTask("visible1"), 0.0f, 2);
+    queue.Push("near", makeTask("near"), 100.0f, 3);
+    queue.Push("visible2", makeTask("visible2"), 0.0f, 4);
+    EXPECT_EQ(queue.Size(), 4u);
+
+    /**
+     * @tc.steps: step2. move "far" into view and remove "near".
+     * @tc.expected: "far" runs after the jobs already visible, "near" never runs.
+     */
+    EXPECT_TRUE(queue.UpdatePriority("far", 0.0f));
+    EXPECT_TRUE(queue.Remove("near"));
+    EXPECT_FALSE(queue.Remove("near"));
+    EXPECT_FALSE(queue.UpdatePriority("near", 0.0f));
+
+    std::function<void()> task;
+    int64_t postTime = 0;
+    while (queue.Pop(task, postTime)) {
+        task();
+    }
+    std::vector<std::string> expected = { "visible1", "visible2", "far" };
+    EXPECT_EQ(order, expected);
+    EXPECT_EQ(queue.Size(), 0u);
+    EXPECT_EQ(postTime, 1);
+}
 } // namespace OHOS::Ace::NG
@@ -442,9 +442,10 @@ HWTEST_F(BoxLayoutAlgorithmTestNg, BoxLayoutAlgorithmTest007, TestSize.Level1)
      */
     layoutWrapper->AppendChild(firstLayoutWrapper);
     BoxLayoutAlgorithm boxLayoutAlgorithm;
-    rowFrameNode->layoutProperty_->positionProperty_ = std::make_unique<PositionProperty>();
+    rowFrameNode->layoutProperty_->ResetPositionProperty();
+    rowFrameNode->layoutProperty_->GetOrCreatePositionProperty();
     boxLayoutAlgorithm.Layout(AccessibilityManager::RawPtr(layoutWrapper));
-    EXPECT_NE(rowFrameNode->layoutProperty_->positionProperty_, nullptr);
+    EXPECT_NE(rowFrameNode->layoutProperty_->GetPositionProperty(), nullptr);
 }
 
 /**
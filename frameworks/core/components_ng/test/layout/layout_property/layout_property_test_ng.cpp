@@ -69,14 +69,14 @@ float borderVerticalDefault = 4.0f;
 
 void MakeProperty(LayoutProperty& layoutProperty)
 {
-    layoutProperty.calcLayoutConstraint_ = std::make_unique<MeasureProperty>();
-    layoutProperty.positionProperty_ = std::make_unique<PositionProperty>();
-    layoutProperty.magicItemProperty_ = std::make_unique<MagicItemProperty>();
-    layoutProperty.flexItemProperty_ = std::make_unique<FlexItemProperty>();
-    layoutProperty.borderWidth_ = std::make_unique<BorderWidthProperty>();
+    *layoutProperty.GetOrCreateCalcLayoutConstraint() = MeasureProperty();
+    *layoutProperty.GetOrCreatePositionProperty() = PositionProperty();
+    *layoutProperty.GetOrCreateMagicItemProperty() = MagicItemProperty();
+    *layoutProperty.GetOrCreateFlexItemProperty() = FlexItemProperty();
+    *layoutProperty.GetOrCreateBorderWidthProperty() = BorderWidthProperty();
     layoutProperty.gridProperty_ = std::make_unique<GridProperty>();
-    layoutProperty.padding_ = std::make_unique<PaddingProperty>();
-    layoutProperty.margin_ = std::make_unique<MarginProperty>();
+    *layoutProperty.GetOrCreatePaddingProperty() = PaddingProperty();
+    *layoutProperty.GetOrCreateMarginProperty() = MarginProperty();
 }
 } // namespace
 
@@ -144,7 +144,7 @@ HWTEST_F(LayoutPropertyTestNg, LayoutPropertyTest002, TestSize.Level1)
     paddingPropertyT.bottom = {CalcLength(BOTTOMONE)};
 
     MakeProperty(layoutProperty);
-    layoutProperty.padding_ = std::make_unique<PaddingProperty>(paddingPropertyT);
+    *layoutProperty.GetOrCreatePaddingProperty() = PaddingProperty(paddingPropertyT);
     layoutProperty.layoutDirection_ = TextDirection::LTR;
     layoutProperty.propVisibility_ = VisibleType::VISIBLE;
     layoutProperty.ToJsonValue(json);
@@ -182,7 +182,7 @@ HWTEST_F(LayoutPropertyTestNg, LayoutPropertyTest003, TestSize.Level1)
     paddingPropertyT.bottom = {CalcLength(BOTTOMONE)};
 
     MakeProperty(layoutProperty);
-    layoutProperty.margin_ = std::make_unique<MarginProperty>(paddingPropertyT);
+    *layoutProperty.GetOrCreateMarginProperty() = MarginProperty(paddingPropertyT);
     layoutProperty.layoutDirection_ = TextDirection::INHERIT;
     layoutProperty.propVisibility_ = VisibleType::INVISIBLE;
     layoutProperty.ToJsonValue(json);
@@ -332,7 +332,7 @@ HWTEST_F(LayoutPropertyTestNg, LayoutPropertyTest009, TestSize.Level1)
      * @tc.expected: Return expected results..
      */
     layoutProperty.UpdateCalcLayoutProperty(std::move(constraint));
-    EXPECT_EQ(layoutProperty.calcLayoutConstraint_->maxSize, calcSize);
+    EXPECT_EQ(layoutProperty.GetCalcLayoutConstraint()->maxSize, calcSize);
     EXPECT_EQ(layoutProperty.propertyChangeFlag_, PROPERTY_UPDATE_MEASURE);
 }
 
@@ -405,7 +405,7 @@ HWTEST_F(LayoutPropertyTestNg, LayoutPropertyTest012, TestSize.Level1)
     constraint.minSize = calcSize;
     constraint.selfIdealSize = calcSize;
     MakeProperty(layoutProperty);
-    layoutProperty.calcLayoutConstraint_ = std::make_unique<MeasureProperty>(constraint);
+    *layoutProperty.GetOrCreateCalcLayoutConstraint() = MeasureProperty(constraint);
     layoutProperty.UpdateLayoutConstraint(std::move(parentConstraint));
     EXPECT_EQ(property.propertyChangeFlag_, 0);
     EXPECT_EQ(layoutProperty.measureType_, std::nullopt);
@@ -432,10 +432,10 @@ HWTEST_F(LayoutPropertyTestNg, LayoutPropertyTest013, TestSize.Level1)
     constraint.maxSize = calcSize;
     constraint.minSize = calcSize;
     constraint.selfIdealSize = calcSize;
-    layoutProperty.calcLayoutConstraint_ = std::make_unique<MeasureProperty>(constraint);
+    *layoutProperty.GetOrCreateCalcLayoutConstraint() = MeasureProperty(constraint);
     layoutProperty.measureType_ = MeasureType::MATCH_PARENT;
     layoutProperty.CheckSelfIdealSize();
-    EXPECT_EQ(layoutProperty.calcLayoutConstraint_->maxSize, calcSize);
+    EXPECT_EQ(layoutProperty.GetCalcLayoutConstraint()->maxSize, calcSize);
 }
 
 /**
@@ -526,7 +526,7 @@ HWTEST_F(LayoutPropertyTestNg, LayoutPropertyTest016, TestSize.Level1)
     magicItemProperty.UpdateLayoutWeight(1.0);
     MakeProperty(layoutProperty);
 
-    layoutProperty.magicItemProperty_ = std::make_unique<MagicItemProperty>(magicItemProperty);
+    *layoutProperty.GetOrCreateMagicItemProperty() = MagicItemProperty(magicItemProperty);
     layoutProperty.CheckAspectRatio();
 
     /**
@@ -560,7 +560,7 @@ HWTEST_F(LayoutPropertyTestNg, LayoutPropertyTest017, TestSize.Level1)
     magicItemProperty.UpdateLayoutWeight(1.0);
     MakeProperty(layoutProperty);
 
-    layoutProperty.magicItemProperty_ = std::make_unique<MagicItemProperty>(magicItemProperty);
+    *layoutProperty.GetOrCreateMagicItemProperty() = MagicItemProperty(magicItemProperty);
     layoutProperty.CheckAspectRatio();
 
     /**
@@ -594,7 +594,7 @@ HWTEST_F(LayoutPropertyTestNg, LayoutPropertyTest018, TestSize.Level1)
     magicItemProperty.UpdateAspectRatio(1.0);
     magicItemProperty.UpdateLayoutWeight(1.0);
     MakeProperty(layoutProperty);
-    layoutProperty.magicItemProperty_ = std::make_unique<MagicItemProperty>(magicItemProperty);
+    *layoutProperty.GetOrCreateMagicItemProperty() = MagicItemProperty(magicItemProperty);
     layoutProperty.CheckAspectRatio();
 
     /**
@@ -679,7 +679,7 @@ HWTEST_F(LayoutPropertyTestNg, LayoutPropertyTest021, TestSize.Level1)
     magicItemProperty.UpdateAspectRatio(0.5);
     magicItemProperty.UpdateLayoutWeight(1.0);
     MakeProperty(layoutProperty);
-    layoutProperty.magicItemProperty_ = std::make_unique<MagicItemProperty>(magicItemProperty);
+    *layoutProperty.GetOrCreateMagicItemProperty() = MagicItemProperty(magicItemProperty);
     layoutProperty.CheckAspectRatio();
 
     /**
@@ -713,7 +713,7 @@ HWTEST_F(LayoutPropertyTestNg, LayoutPropertyTest022, TestSize.Level1)
     magicItemProperty.UpdateLayoutWeight(1.0);
     MakeProperty(layoutProperty);
 
-    layoutProperty.magicItemProperty_ = std::make_unique<MagicItemProperty>(magicItemProperty);
+    *layoutProperty.GetOrCreateMagicItemProperty() = MagicItemProperty(magicItemProperty);
     layoutProperty.CheckAspectRatio();
 
     /**
@@ -1031,8 +1031,8 @@ HWTEST_F(LayoutPropertyTestNg, LayoutPropertyTest032, TestSize.Level1)
     paddingPropertyT.top = {CalcLength(TOPONE)};
     paddingPropertyT.bottom = {CalcLength(BOTTOMONE)};
 
-    layoutProperty.padding_ = std::make_unique<PaddingProperty>(paddingPropertyT);
-    layoutProperty.margin_ = std::make_unique<MarginProperty>();
+    *layoutProperty.GetOrCreatePaddingProperty() = PaddingProperty(paddingPropertyT);
+    *layoutProperty.GetOrCreateMarginProperty() = MarginProperty();
     layoutConstraintF.minSize = {1, 1};
     layoutConstraintF.minSize = {10, 10};
     layoutConstraintF.percentReference = {5, 5};
@@ -1342,4 +1342,169 @@ HWTEST_F(LayoutPropertyTestNg, LayoutPropertyTest041, TestSize.Level1)
     auto parent = layoutProperty.GetHost()->GetAncestorNodeOfFrame();
     ASSERT_NE(parent, nullptr);
 }
+
+/**
+ * @tc.name: LayoutPropertyTest042
+ * @tc.desc: Test the property groups shared by a clone until an update.
+ * @tc.type: FUNC
+ */
+HWTEST_F(LayoutPropertyTestNg, LayoutPropertyTest042, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. Build a layoutProperty with padding and margin, then clone it.
+     * @tc.expected: The clone shares the groups without allocating.
+     */
+    auto layoutProperty = AceType::MakeRefPtr<LayoutProperty>();
+    PaddingProperty padding;
+    padding.left = CalcLength(TESTLEFT);
+    layoutProperty->UpdatePadding(padding);
+    MarginProperty margin;
+    margin.left = CalcLength(TESTRIGHT);
+    layoutProperty->UpdateMargin(margin);
+    auto clone = layoutProperty->Clone();
+    ASSERT_NE(clone, nullptr);
+    EXPECT_TRUE(clone->groups_.IsSharedWith(layoutProperty->groups_));
+    EXPECT_EQ(clone->GetPaddingProperty(), layoutProperty->GetPaddingProperty());
+    EXPECT_EQ(clone->GetBorderWidthProperty(), nullptr);
+
+    /**
+     * @tc.steps: step2. Update the padding of the clone.
+     * @tc.expected: The clone is detached and the source keeps its padding.
+     */
+    PaddingProperty clonePadding;
+    clonePadding.left = CalcLength(TESTRIGHT);
+    clone->UpdatePadding(clonePadding);
+    EXPECT_FALSE(clone->groups_.IsSharedWith(layoutProperty->groups_));
+    EXPECT_FALSE(layoutProperty->groups_.IsShared());
+    ASSERT_NE(clone->GetPaddingProperty(), nullptr);
+    EXPECT_EQ(clone->GetPaddingProperty()->left, CalcLength(TESTRIGHT));
+    ASSERT_NE(layoutProperty->GetPaddingProperty(), nullptr);
+    EXPECT_EQ(layoutProperty->GetPaddingProperty()->left, CalcLength(TESTLEFT));
+    ASSERT_NE(clone->GetMarginProperty(), nullptr);
+
+    /**
+     * @tc.steps: step3. Reset the groups of the source.
+     * @tc.expected: The groups are released and the clone keeps its own.
+     */
+    layoutProperty->Reset();
+    EXPECT_EQ(layoutProperty->GetPaddingProperty(), nullptr);
+    EXPECT_EQ(layoutProperty->GetMarginProperty(), nullptr);
+    EXPECT_EQ(layoutProperty->groups_.GetMask(), 0u);
+    ASSERT_NE(clone->GetMarginProperty(), nullptr);
+}
+
+/**
+ * @tc.name: LayoutPropertyTest043
+ * @tc.desc: Test the memory of the property groups.
+ * @tc.type: FUNC
+ */
+HWTEST_F(LayoutPropertyTestNg, LayoutPropertyTest043, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. Build a layoutProperty with every group.
+     * @tc.expected: The block is not larger than the groups allocated one by one.
+     */
+    LayoutProperty layoutProperty;
+    MakeProperty(layoutProperty);
+    size_t separateSize = sizeof(MeasureProperty) + sizeof(PaddingProperty) + sizeof(MarginProperty) +
+                          sizeof(BorderWidthProperty) + sizeof(MagicItemProperty) + sizeof(PositionProperty) +
+                          sizeof(FlexItemProperty);
+    EXPECT_LE(layoutProperty.groups_.GetAllocatedSize(), separateSize + 2 * sizeof(uint32_t));
+    EXPECT_EQ(layoutProperty.groups_.GetMask(), (1u << LayoutPropertyGroups::GROUP_COUNT) - 1);
+
+    /**
+     * @tc.steps: step2. Clone the layoutProperty many times, as the layout wrappers do.
+     * @tc.expected: Every clone shares the block of the source.
+     */
+    constexpr int32_t cloneCount = 1000;
+    std::vector<RefPtr<LayoutProperty>> clones;
+    clones.reserve(cloneCount);
+    for (int32_t i = 0; i < cloneCount; ++i) {
+        clones.emplace_back(layoutProperty.Clone());
+    }
+    for (const auto& clone : clones) {
+        EXPECT_TRUE(clone->groups_.IsSharedWith(layoutProperty.groups_));
+    }
+
+    /**
+     * @tc.steps: step3. Release the clones.
+     * @tc.expected: The source owns the block again.
+     */
+    clones.clear();
+    EXPECT_FALSE(layoutProperty.groups_.IsShared());
+    EXPECT_NE(layoutProperty.GetCalcLayoutConstraint(), nullptr);
+}
+
+/**
+ * @tc.name: LayoutPropertyTest044
+ * @tc.desc: Test Reset removes the groups of the layoutProperty together.
+ * @tc.type: FUNC
+ */
+HWTEST_F(LayoutPropertyTestNg, LayoutPropertyTest044, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. Build a layoutProperty with every group and reset it.
+     * @tc.expected: Only the flex item group, which Reset keeps, is left in the block.
+     */
+    LayoutProperty layoutProperty;
+    MakeProperty(layoutProperty);
+    layoutProperty.Reset();
+    EXPECT_EQ(layoutProperty.groups_.GetMask(), LayoutPropertyGroups::GetGroupMask<FLEX_ITEM_GROUP>());
+    EXPECT_EQ(layoutProperty.GetPaddingProperty(), nullptr);
+    EXPECT_EQ(layoutProperty.GetCalcLayoutConstraint(), nullptr);
+    EXPECT_EQ(layoutProperty.GetPositionProperty(), nullptr);
+    EXPECT_NE(layoutProperty.GetFlexItemProperty(), nullptr);
+
+    /**
+     * @tc.steps: step2. Reset groups the block doesn't hold.
+     * @tc.expected: The block is kept as it is.
+     */
+    const auto* flexItemProperty = layoutProperty.GetFlexItemProperty();
+    layoutProperty.groups_.Reset(LayoutPropertyGroups::GetGroupMask<PADDING_GROUP, MARGIN_GROUP>());
+    EXPECT_EQ(layoutProperty.GetFlexItemProperty(), flexItemProperty);
+}
+/**
+ * @tc.name: LayoutPropertyTest045
+ * @tc.desc: Test updating the groups of a clone to the values they have.
+ * @tc.type: FUNC
+ */
+HWTEST_F(LayoutPropertyTestNg, LayoutPropertyTest045, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. Build a layoutProperty with padding, flex grow and ideal width, then clone it.
+     */
+    auto layoutProperty = AceType::MakeRefPtr<LayoutProperty>();
+    PaddingProperty padding;
+    padding.left = CalcLength(TESTLEFT);
+    layoutProperty->UpdatePadding(padding);
+    layoutProperty->UpdateFlexGrow(1.0f);
+    layoutProperty->UpdateUserDefinedIdealSize(CalcSize(CalcLength(TESTLEFT), std::nullopt));
+    auto clone = layoutProperty->Clone();
+    ASSERT_NE(clone, nullptr);
+    clone->CleanDirty();
+
+    /**
+     * @tc.steps: step2. Update the clone to the same values, clear the ideal height it doesn't have and update the
+     *                   margin of the clone to the empty value.
+     * @tc.expected: The clone still shares the groups, no group is created and nothing is marked dirty.
+     */
+    clone->UpdatePadding(padding);
+    clone->UpdateFlexGrow(1.0f);
+    clone->UpdateUserDefinedIdealSize(CalcSize(CalcLength(TESTLEFT), std::nullopt));
+    clone->ClearUserDefinedIdealSize(false, true);
+    clone->UpdateMargin(MarginProperty());
+    EXPECT_TRUE(clone->groups_.IsSharedWith(layoutProperty->groups_));
+    EXPECT_EQ(clone->GetMarginProperty(), nullptr);
+    EXPECT_EQ(clone->GetPropertyChangeFlag(), PROPERTY_UPDATE_NORMAL);
+
+    /**
+     * @tc.steps: step3. Clear the ideal width of the clone.
+     * @tc.expected: The clone is detached and marked to measure, the source keeps its ideal width.
+     */
+    clone->ClearUserDefinedIdealSize(true, false);
+    EXPECT_FALSE(clone->groups_.IsSharedWith(layoutProperty->groups_));
+    EXPECT_EQ(clone->GetPropertyChangeFlag() & PROPERTY_UPDATE_MEASURE, PROPERTY_UPDATE_MEASURE);
+    ASSERT_NE(layoutProperty->GetCalcLayoutConstraint(), nullptr);
+    EXPECT_TRUE(layoutProperty->GetCalcLayoutConstraint()->selfIdealSize->Width().has_value());
+}
 }
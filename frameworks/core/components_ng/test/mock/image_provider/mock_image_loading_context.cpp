@@ -149,4 +149,14 @@ const std::optional<Color>& ImageLoadingContext::GetSvgFillColor() const
 
 void ImageLoadingContext::ResetLoading() {}
 void ImageLoadingContext::ResumeLoading() {}
+
+void ImageLoadingContext::SetDecodePriority(float priority)
+{
+    decodePriority_ = priority;
+}
+
+bool ImageLoadingContext::IsMakingCanvasImage() const
+{
+    return false;
+}
 } // namespace OHOS::Ace::NG
\ No newline at end of file
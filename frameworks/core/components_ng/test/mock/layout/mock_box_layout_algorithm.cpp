@@ -26,6 +26,16 @@ std::optional<SizeF> BoxLayoutAlgorithm::MeasureContent(
     return std::optional<SizeF>();
 }
 
+RefPtr<LayoutAlgorithm> BoxLayoutAlgorithm::CreateRemeasureAlgorithm() const
+{
+    return nullptr;
+}
+
+bool BoxLayoutAlgorithm::CanMeasureInParallel() const
+{
+    return false;
+}
+
 void BoxLayoutAlgorithm::PerformMeasureSelf(LayoutWrapper* layoutWrapper) {}
 void BoxLayoutAlgorithm::PerformLayout(LayoutWrapper* layoutWrapper) {}
 } // namespace OHOS::Ace::NG
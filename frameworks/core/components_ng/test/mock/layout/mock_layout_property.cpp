@@ -33,17 +33,13 @@ void LayoutProperty::Clone(RefPtr<LayoutProperty> layoutProperty) const {}
 
 void LayoutProperty::UpdateCalcLayoutProperty(const MeasureProperty& constraint)
 {
-    if (!calcLayoutConstraint_) {
-        calcLayoutConstraint_ = std::make_unique<MeasureProperty>(constraint);
-        propertyChangeFlag_ = propertyChangeFlag_ | PROPERTY_UPDATE_MEASURE;
+    if (GetCalcLayoutConstraint() && *GetCalcLayoutConstraint() == constraint) {
         return;
     }
-    if (*calcLayoutConstraint_ == constraint) {
-        return;
-    }
-    calcLayoutConstraint_->selfIdealSize = constraint.selfIdealSize;
-    calcLayoutConstraint_->maxSize = constraint.maxSize;
-    calcLayoutConstraint_->minSize = constraint.minSize;
+    auto calcLayoutConstraint = GetOrCreateCalcLayoutConstraint();
+    calcLayoutConstraint->selfIdealSize = constraint.selfIdealSize;
+    calcLayoutConstraint->maxSize = constraint.maxSize;
+    calcLayoutConstraint->minSize = constraint.minSize;
     propertyChangeFlag_ = propertyChangeFlag_ | PROPERTY_UPDATE_MEASURE;
 }
 
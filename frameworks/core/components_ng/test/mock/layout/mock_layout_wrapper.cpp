@@ -245,6 +245,40 @@ void LayoutWrapper::Layout()
         host->GetDepth(), geometryNode_->GetFrameOffset().ToString().c_str());
 }
 
+void LayoutWrapper::InvalidateMeasureCache()
+{
+    measureCache_.clear();
+}
+
+MeasureCacheStats LayoutWrapper::GetMeasureCacheStats()
+{
+    return {};
+}
+
+void LayoutWrapper::ResetMeasureCacheStats() {}
+
+bool LayoutWrapper::PrepareParallelMeasure()
+{
+    return false;
+}
+
+bool LayoutWrapper::IsMeasuringInParallel()
+{
+    return false;
+}
+
+bool LayoutWrapper::IsLayoutFullScreenWindow() const
+{
+    auto pipeline = PipelineBase::GetCurrentContext();
+    return pipeline && pipeline->GetIsAppWindow() && pipeline->GetIsLayoutFullScreen();
+}
+
+bool LayoutWrapper::IsHostAtomicNode() const
+{
+    auto host = GetHostNode();
+    return host && host->IsAtomicNode();
+}
+
 bool LayoutWrapper::SkipMeasureContent() const
 {
     return (skipMeasureContent_ == true) || layoutAlgorithm_->SkipMeasure();
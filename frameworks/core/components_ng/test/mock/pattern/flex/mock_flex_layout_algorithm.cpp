@@ -19,4 +19,14 @@ namespace OHOS::Ace::NG {
 void FlexLayoutAlgorithm::Measure(LayoutWrapper* layoutWrapper) {}
 
 void FlexLayoutAlgorithm::Layout(LayoutWrapper* layoutWrapper) {}
+
+RefPtr<LayoutAlgorithm> FlexLayoutAlgorithm::CreateRemeasureAlgorithm() const
+{
+    return nullptr;
+}
+
+bool FlexLayoutAlgorithm::CanMeasureInParallel() const
+{
+    return false;
+}
 } // namespace OHOS::Ace::NG
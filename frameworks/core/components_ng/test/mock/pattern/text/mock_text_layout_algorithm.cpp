@@ -88,4 +88,14 @@ std::optional<TextStyle> TextLayoutAlgorithm::GetTextStyle() const
 }
 
 void TextLayoutAlgorithm::Layout(LayoutWrapper* layoutWrapper) {}
+
+bool TextLayoutAlgorithm::CanMeasureInParallel() const
+{
+    return false;
+}
+
+bool TextLayoutAlgorithm::PrepareParallelMeasure(LayoutWrapper* layoutWrapper)
+{
+    return false;
+}
 } // namespace OHOS::Ace::NG
@@ -67,4 +67,13 @@ bool TextPattern::BetweenSelectedPosition(const Offset& globalOffset)
     return {};
 }
 
+size_t TextPattern::GetHibernationSize() const
+{
+    return 0;
+}
+
+void TextPattern::OnHibernate() {}
+
+void TextPattern::OnRehydrate() {}
+
 } // namespace OHOS::Ace::NG
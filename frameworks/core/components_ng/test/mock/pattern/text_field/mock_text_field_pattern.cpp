@@ -26,6 +26,11 @@ TextFieldPattern::~TextFieldPattern() {}
 
 void TextFieldPattern::SetCaretPosition(int32_t position) {}
 
+ParagraphT TextFieldPattern::GetDragParagraph() const
+{
+    return { std::shared_ptr<RSParagraph>() };
+}
+
 const TextEditingValueNG& TextFieldPattern::GetEditingValue() const
 {
     return textEditingValue_;
@@ -33,7 +38,7 @@ const TextEditingValueNG& TextFieldPattern::GetEditingValue() const
 
 void TextFieldPattern::InitEditingValueText(std::string content)
 {
-    textEditingValue_.text = std::move(content);
+    textEditingValue_.SetText(std::move(content));
     textEditingValue_.caretPosition = textEditingValue_.GetWideText().length();
 }
 
@@ -547,7 +547,7 @@ HWTEST_F(ButtonPatternTestNg, ButtonPatternTest008, TestSize.Level1)
     EXPECT_EQ(layoutWrapper->GetGeometryNode()->GetFrameOffset(), OffsetF());
 
     parentLayoutConstraint.selfIdealSize.Reset();
-    layoutWrapper->GetLayoutProperty()->calcLayoutConstraint_->Reset();
+    layoutWrapper->GetLayoutProperty()->GetOrCreateCalcLayoutConstraint()->Reset();
     layoutWrapper->GetLayoutProperty()->UpdateLayoutConstraint(parentLayoutConstraint);
     layoutWrapper->GetLayoutProperty()->UpdateContentConstraint();
     auto layoutProperty = AccessibilityManager::DynamicCast<ButtonLayoutProperty>(layoutWrapper->GetLayoutProperty());
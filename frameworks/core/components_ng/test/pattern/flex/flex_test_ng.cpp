@@ -13,15 +13,23 @@
  * limitations under the License.
  */
 
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
 #include "gtest/gtest.h"
 
 #include "base/geometry/ng/offset_t.h"
 #include "base/geometry/ng/size_t.h"
 
 #define private public
-#define protectd public
+#define protected public
 #include "base/memory/ace_type.h"
 #include "base/memory/referenced.h"
+#include "base/thread/task_executor.h"
 #include "core/components/common/layout/constants.h"
 #include "core/components_ng/base/view_abstract.h"
 #include "core/components_ng/base/view_stack_processor.h"
@@ -92,6 +100,147 @@ const OffsetF OFFSET_BOTTOM_RIGHT = OffsetF(RK356_WIDTH, RK356_HEIGHT);
 const float NOPADDING = 0.0f;
 const float PADDING_FIVE = 5.0f;
 const float DOUBLE = 2.0f;
+
+const int32_t CARD_COUNT = 8;
+const int32_t CARD_ITEM_COUNT = 40;
+const float CARD_WIDTH = 80.0f;
+const float CARD_ITEM_HEIGHT = 20.0f;
+// the time an item of the benchmark takes to measure, about what shaping a short text takes.
+constexpr std::chrono::microseconds CARD_ITEM_MEASURE_COST(20);
+constexpr int32_t BENCHMARK_ROUND_COUNT = 3;
+
+RefPtr<LayoutWrapper> CreateLayoutWrapper(const RefPtr<FrameNode>& frameNode)
+{
+    auto layoutWrapper =
+        AceType::MakeRefPtr<LayoutWrapper>(frameNode, AceType::MakeRefPtr<GeometryNode>(), frameNode->GetLayoutProperty());
+    layoutWrapper->SetLayoutAlgorithm(
+        AceType::MakeRefPtr<LayoutAlgorithmWrapper>(frameNode->GetPattern()->CreateLayoutAlgorithm()));
+    return layoutWrapper;
+}
+
+// a row of columns, each a card of fixed width holding items of fixed height.
+RefPtr<LayoutWrapper> CreateCardRowLayoutWrapper(int32_t& nodeId)
+{
+    auto rowFrameNode =
+        FrameNode::CreateFrameNode(V2::ROW_ETS_TAG, nodeId++, AceType::MakeRefPtr<LinearLayoutPattern>(false));
+    auto rowLayoutWrapper = CreateLayoutWrapper(rowFrameNode);
+    for (int32_t i = 0; i < CARD_COUNT; ++i) {
+        auto cardFrameNode =
+            FrameNode::CreateFrameNode(V2::COLUMN_ETS_TAG, nodeId++, AceType::MakeRefPtr<LinearLayoutPattern>(true));
+        cardFrameNode->GetLayoutProperty()->UpdateUserDefinedIdealSize(CalcSize(CalcLength(CARD_WIDTH), std::nullopt));
+        auto cardLayoutWrapper = CreateLayoutWrapper(cardFrameNode);
+        for (int32_t j = 0; j < CARD_ITEM_COUNT; ++j) {
+            auto itemFrameNode =
+                FrameNode::CreateFrameNode(V2::BLANK_ETS_TAG, nodeId++, AceType::MakeRefPtr<Pattern>());
+            itemFrameNode->GetLayoutProperty()->UpdateUserDefinedIdealSize(
+                CalcSize(CalcLength(CARD_WIDTH), CalcLength(CARD_ITEM_HEIGHT)));
+            cardFrameNode->AddChild(itemFrameNode);
+            cardLayoutWrapper->AppendChild(CreateLayoutWrapper(itemFrameNode));
+        }
+        rowFrameNode->AddChild(cardFrameNode);
+        rowLayoutWrapper->AppendChild(cardLayoutWrapper);
+    }
+    return rowLayoutWrapper;
+}
+
+// a box whose measure takes a fixed time, standing in for the items of a real card.
+class CostlyLayoutAlgorithm : public BoxLayoutAlgorithm {
+    DECLARE_ACE_TYPE(CostlyLayoutAlgorithm, BoxLayoutAlgorithm);
+
+public:
+    CostlyLayoutAlgorithm() = default;
+    ~CostlyLayoutAlgorithm() override = default;
+
+    void Measure(LayoutWrapper* layoutWrapper) override
+    {
+        auto endTime = std::chrono::steady_clock::now() + CARD_ITEM_MEASURE_COST;
+        while (std::chrono::steady_clock::now() < endTime) {}
+        BoxLayoutAlgorithm::Measure(layoutWrapper);
+    }
+
+    bool CanMeasureInParallel() const override
+    {
+        return true;
+    }
+};
+
+RefPtr<LayoutWrapper> CreateCostlyCardRowLayoutWrapper(int32_t& nodeId)
+{
+    auto rowLayoutWrapper = CreateCardRowLayoutWrapper(nodeId);
+    for (const auto& card : rowLayoutWrapper->GetAllChildrenWithBuild()) {
+        for (const auto& item : card->GetAllChildrenWithBuild()) {
+            item->SetLayoutAlgorithm(
+                AceType::MakeRefPtr<LayoutAlgorithmWrapper>(AceType::MakeRefPtr<CostlyLayoutAlgorithm>()));
+        }
+    }
+    return rowLayoutWrapper;
+}
+
+// runs every background task on a thread of its own, so that parallel measure has workers.
+class ThreadTaskExecutor : public TaskExecutor {
+public:
+    ThreadTaskExecutor() = default;
+    ~ThreadTaskExecutor() override
+    {
+        Join();
+    }
+
+    void AddTaskObserver(Task&& callback) override {}
+    void RemoveTaskObserver() override {}
+
+    bool WillRunOnCurrentThread(TaskType type) const override
+    {
+        return type != TaskType::BACKGROUND;
+    }
+
+    void Join()
+    {
+        std::vector<std::thread> threads;
+        {
+            std::scoped_lock<std::mutex> lock(mutex_);
+            threads.swap(threads_);
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+    }
+
+protected:
+    bool OnPostTask(Task&& task, TaskType type, uint32_t delayTime) const override
+    {
+        if (type != TaskType::BACKGROUND) {
+            task();
+            return true;
+        }
+        std::scoped_lock<std::mutex> lock(mutex_);
+        threads_.emplace_back(std::move(task));
+        return true;
+    }
+
+    Task WrapTaskWithTraceId(Task&& task, int32_t id) const override
+    {
+        return std::move(task);
+    }
+
+private:
+    mutable std::mutex mutex_;
+    mutable std::vector<std::thread> threads_;
+};
+
+// the shortest time of the rounds, which is the least disturbed by the other processes.
+std::chrono::microseconds MeasureBestTime(const std::function<RefPtr<LayoutWrapper>()>& createRow,
+    const LayoutConstraintF& layoutConstraint)
+{
+    auto bestTime = std::chrono::microseconds::max();
+    for (int32_t i = 0; i < BENCHMARK_ROUND_COUNT; ++i) {
+        auto row = createRow();
+        auto startTime = std::chrono::steady_clock::now();
+        row->Measure(layoutConstraint);
+        auto time = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - startTime);
+        bestTime = std::min(bestTime, time);
+    }
+    return bestTime;
+}
 } // namespace
 class FlexTestNg : public testing::Test {
 public:
@@ -3748,4 +3897,244 @@ HWTEST_F(FlexTestNg, FlexRowLayoutTest013, TestSize.Level1)
     EXPECT_EQ(secondLayoutWrapper->GetGeometryNode()->GetFrameOffset(),
         OffsetF(CONTAINER_SIZE.Width() - PADDING_FIVE - SMALL_ITEM_WIDTH, PADDING_FIVE));
 }
+
+/**
+ * @tc.name: FlexMeasureCacheTest001
+ * @tc.desc: Measure a row with alternating constraints, the results of a constraint are reused in the layout pass
+ * @tc.type: FUNC
+ */
+HWTEST_F(FlexTestNg, FlexMeasureCacheTest001, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. create a row with a weighted child and a fixed child.
+     */
+    auto rowFrameNode = FrameNode::CreateFrameNode(V2::ROW_ETS_TAG, 0, AceType::MakeRefPtr<LinearLayoutPattern>(false));
+    ASSERT_NE(rowFrameNode, nullptr);
+    auto rowLayoutPattern = rowFrameNode->GetPattern<LinearLayoutPattern>();
+    ASSERT_NE(rowLayoutPattern, nullptr);
+    RefPtr<LayoutWrapper> layoutWrapper = AceType::MakeRefPtr<LayoutWrapper>(
+        rowFrameNode, AceType::MakeRefPtr<GeometryNode>(), rowFrameNode->GetLayoutProperty());
+    layoutWrapper->SetLayoutAlgorithm(
+        AceType::MakeRefPtr<LayoutAlgorithmWrapper>(rowLayoutPattern->CreateLayoutAlgorithm()));
+    layoutWrapper->GetLayoutProperty()->UpdateUserDefinedIdealSize(
+        CalcSize(CalcLength(Dimension(1.0, DimensionUnit::PERCENT)), CalcLength(ROW_HEIGHT)));
+
+    auto firstFrameNode = FrameNode::CreateFrameNode(V2::BLANK_ETS_TAG, 1, AceType::MakeRefPtr<Pattern>());
+    auto firstLayoutProperty = firstFrameNode->GetLayoutProperty();
+    firstLayoutProperty->UpdateLayoutWeight(LAYOUT_WEIGHT_ONE);
+    firstLayoutProperty->UpdateUserDefinedIdealSize(CalcSize(std::nullopt, CalcLength(SMALL_ITEM_HEIGHT)));
+    RefPtr<LayoutWrapper> firstLayoutWrapper =
+        AceType::MakeRefPtr<LayoutWrapper>(firstFrameNode, AceType::MakeRefPtr<GeometryNode>(), firstLayoutProperty);
+    firstLayoutWrapper->SetLayoutAlgorithm(
+        AceType::MakeRefPtr<LayoutAlgorithmWrapper>(firstFrameNode->GetPattern()->CreateLayoutAlgorithm()));
+    rowFrameNode->AddChild(firstFrameNode);
+    layoutWrapper->AppendChild(firstLayoutWrapper);
+
+    auto secondFrameNode = FrameNode::CreateFrameNode(V2::BLANK_ETS_TAG, 2, AceType::MakeRefPtr<Pattern>());
+    auto secondLayoutProperty = secondFrameNode->GetLayoutProperty();
+    secondLayoutProperty->UpdateUserDefinedIdealSize(
+        CalcSize(CalcLength(SMALL_ITEM_WIDTH), CalcLength(SMALL_ITEM_HEIGHT)));
+    RefPtr<LayoutWrapper> secondLayoutWrapper =
+        AceType::MakeRefPtr<LayoutWrapper>(secondFrameNode, AceType::MakeRefPtr<GeometryNode>(), secondLayoutProperty);
+    secondLayoutWrapper->SetLayoutAlgorithm(
+        AceType::MakeRefPtr<LayoutAlgorithmWrapper>(secondFrameNode->GetPattern()->CreateLayoutAlgorithm()));
+    rowFrameNode->AddChild(secondFrameNode);
+    layoutWrapper->AppendChild(secondLayoutWrapper);
+
+    /**
+     * @tc.steps: step2. measure the row with a wide then a narrow constraint.
+     * @tc.expected: step2. both constraints are measured.
+     */
+    LayoutConstraintF wideConstraint;
+    wideConstraint.maxSize = CONTAINER_SIZE;
+    wideConstraint.percentReference = CONTAINER_SIZE;
+    LayoutConstraintF narrowConstraint = wideConstraint;
+    narrowConstraint.maxSize = SizeF(HALF_PERCENT_WIDTH, RK356_HEIGHT);
+    narrowConstraint.percentReference = narrowConstraint.maxSize;
+    LayoutWrapper::ResetMeasureCacheStats();
+    layoutWrapper->Measure(wideConstraint);
+    auto wideRowSize = layoutWrapper->GetGeometryNode()->GetFrameSize();
+    auto wideFirstSize = firstLayoutWrapper->GetGeometryNode()->GetFrameSize();
+    EXPECT_EQ(layoutWrapper->GetMeasureCacheSize(), 0u);
+    EXPECT_EQ(secondLayoutWrapper->GetMeasureCacheSize(), 0u);
+    layoutWrapper->Measure(narrowConstraint);
+    auto narrowFirstSize = firstLayoutWrapper->GetGeometryNode()->GetFrameSize();
+    EXPECT_EQ(wideFirstSize, SizeF(RK356_WIDTH - SMALL_ITEM_WIDTH, SMALL_ITEM_HEIGHT));
+    EXPECT_EQ(narrowFirstSize, SizeF(HALF_PERCENT_WIDTH - SMALL_ITEM_WIDTH, SMALL_ITEM_HEIGHT));
+    auto stats = LayoutWrapper::GetMeasureCacheStats();
+    EXPECT_EQ(stats.cacheHitCount, 0u);
+    EXPECT_EQ(layoutWrapper->GetMeasureCacheSize(), 1u);
+
+    /**
+     * @tc.steps: step3. measure the row with the wide constraint again.
+     * @tc.expected: step3. the results of the wide constraint come back without measuring, and the results of the
+     *                      narrow constraint are saved.
+     */
+    layoutWrapper->Measure(wideConstraint);
+    auto cachedStats = LayoutWrapper::GetMeasureCacheStats();
+    EXPECT_EQ(cachedStats.measureCount, stats.measureCount);
+    EXPECT_GT(cachedStats.cacheHitCount, 0u);
+    EXPECT_EQ(layoutWrapper->GetMeasureCacheSize(), 2u);
+    EXPECT_EQ(layoutWrapper->GetGeometryNode()->GetFrameSize(), wideRowSize);
+    EXPECT_EQ(firstLayoutWrapper->GetGeometryNode()->GetFrameSize(), wideFirstSize);
+    EXPECT_EQ(secondLayoutWrapper->GetGeometryNode()->GetFrameSize(), SMALL_ITEM_SIZE);
+
+    /**
+     * @tc.steps: step4. update a property of the row during the layout pass.
+     * @tc.expected: step4. the results are dropped and the row is measured again.
+     */
+    layoutWrapper->GetLayoutProperty()->UpdatePropertyChangeFlag(PROPERTY_UPDATE_LAYOUT);
+    layoutWrapper->Measure(narrowConstraint);
+    EXPECT_GT(LayoutWrapper::GetMeasureCacheStats().measureCount, cachedStats.measureCount);
+    EXPECT_EQ(layoutWrapper->GetMeasureCacheSize(), 0u);
+}
+
+/**
+ * @tc.name: FlexMeasureCacheTest002
+ * @tc.desc: Measure a node whose algorithm can't measure again apart from its last result, nothing is saved
+ * @tc.type: FUNC
+ */
+HWTEST_F(FlexTestNg, FlexMeasureCacheTest002, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. create a node with an algorithm without CreateRemeasureAlgorithm.
+     */
+    auto frameNode = FrameNode::CreateFrameNode(V2::BLANK_ETS_TAG, 0, AceType::MakeRefPtr<Pattern>());
+    ASSERT_NE(frameNode, nullptr);
+    RefPtr<LayoutWrapper> layoutWrapper = AceType::MakeRefPtr<LayoutWrapper>(
+        frameNode, AceType::MakeRefPtr<GeometryNode>(), frameNode->GetLayoutProperty());
+    layoutWrapper->SetLayoutAlgorithm(
+        AceType::MakeRefPtr<LayoutAlgorithmWrapper>(AceType::MakeRefPtr<LayoutAlgorithm>()));
+
+    /**
+     * @tc.steps: step2. measure the node with a wide, a narrow and the wide constraint again.
+     * @tc.expected: step2. every constraint is measured and no result is saved.
+     */
+    LayoutConstraintF wideConstraint;
+    wideConstraint.maxSize = CONTAINER_SIZE;
+    wideConstraint.percentReference = CONTAINER_SIZE;
+    LayoutConstraintF narrowConstraint = wideConstraint;
+    narrowConstraint.maxSize = SizeF(HALF_PERCENT_WIDTH, RK356_HEIGHT);
+    narrowConstraint.percentReference = narrowConstraint.maxSize;
+    LayoutWrapper::ResetMeasureCacheStats();
+    layoutWrapper->Measure(wideConstraint);
+    layoutWrapper->Measure(narrowConstraint);
+    layoutWrapper->Measure(wideConstraint);
+    auto stats = LayoutWrapper::GetMeasureCacheStats();
+    EXPECT_EQ(stats.measureCount, 3u);
+    EXPECT_EQ(stats.cacheHitCount, 0u);
+    EXPECT_EQ(layoutWrapper->GetMeasureCacheSize(), 0u);
+
+    /**
+     * @tc.steps: step3. measure the node with the constraint of the result it holds.
+     * @tc.expected: step3. the result is reused without measuring.
+     */
+    layoutWrapper->Measure(wideConstraint);
+    EXPECT_EQ(LayoutWrapper::GetMeasureCacheStats().measureCount, stats.measureCount);
+    EXPECT_EQ(LayoutWrapper::GetMeasureCacheStats().cacheHitCount, 1u);
+}
+
+/**
+ * @tc.name: FlexParallelMeasureTest001
+ * @tc.desc: Measure a row of cards sequentially and in parallel, and compare the results
+ * @tc.type: FUNC
+ */
+HWTEST_F(FlexTestNg, FlexParallelMeasureTest001, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. measure a row of cards with parallel measure disabled.
+     */
+    LayoutConstraintF layoutConstraint;
+    layoutConstraint.maxSize = CONTAINER_SIZE;
+    layoutConstraint.percentReference = CONTAINER_SIZE;
+    int32_t nodeId = 0;
+    auto sequentialRow = CreateCardRowLayoutWrapper(nodeId);
+    LayoutWrapper::SetParallelMeasureEnabled(false);
+    LayoutWrapper::ResetParallelMeasureStats();
+    sequentialRow->Measure(layoutConstraint);
+    EXPECT_EQ(LayoutWrapper::GetParallelMeasureStats().dispatchCount, 0u);
+
+    /**
+     * @tc.steps: step2. measure the same row with parallel measure enabled.
+     * @tc.expected: step2. every card is dispatched with the state of its nodes copied to its layout wrappers, and
+     *                  the cards measure to the same sizes as in step1.
+     */
+    auto parallelRow = CreateCardRowLayoutWrapper(nodeId);
+    EXPECT_EQ(parallelRow->GetAllChildrenWithBuild().front()->GetParallelMeasureNodeCount(), CARD_ITEM_COUNT + 1);
+    LayoutWrapper::SetParallelMeasureEnabled(true);
+    LayoutWrapper::SetParallelMeasureMinNodeCount(CARD_ITEM_COUNT);
+    parallelRow->Measure(layoutConstraint);
+    LayoutWrapper::SetParallelMeasureEnabled(false);
+    EXPECT_EQ(LayoutWrapper::GetParallelMeasureStats().dispatchCount, static_cast<uint64_t>(CARD_COUNT));
+    EXPECT_FALSE(LayoutWrapper::IsMeasuringInParallel());
+    for (const auto& item : parallelRow->GetAllChildrenWithBuild().front()->GetAllChildrenWithBuild()) {
+        ASSERT_TRUE(item->parallelMeasureState_.has_value());
+        EXPECT_EQ(item->IsHostAtomicNode(), item->GetHostNode()->IsAtomicNode());
+    }
+    EXPECT_FALSE(sequentialRow->GetAllChildrenWithBuild().front()->parallelMeasureState_.has_value());
+    EXPECT_EQ(parallelRow->GetGeometryNode()->GetFrameSize(), sequentialRow->GetGeometryNode()->GetFrameSize());
+    const auto& sequentialCards = sequentialRow->GetAllChildrenWithBuild();
+    const auto& parallelCards = parallelRow->GetAllChildrenWithBuild();
+    ASSERT_EQ(sequentialCards.size(), parallelCards.size());
+    for (auto sequentialIter = sequentialCards.begin(), parallelIter = parallelCards.begin();
+         sequentialIter != sequentialCards.end(); ++sequentialIter, ++parallelIter) {
+        EXPECT_EQ((*parallelIter)->GetGeometryNode()->GetFrameSize(),
+            (*sequentialIter)->GetGeometryNode()->GetFrameSize());
+    }
+    EXPECT_EQ(parallelCards.front()->GetGeometryNode()->GetFrameSize(),
+        SizeF(CARD_WIDTH, CARD_ITEM_HEIGHT * CARD_ITEM_COUNT));
+
+    /**
+     * @tc.steps: step3. make the cards smaller than the minimum node count.
+     * @tc.expected: step3. nothing is dispatched.
+     */
+    LayoutWrapper::ResetParallelMeasureStats();
+    LayoutWrapper::SetParallelMeasureEnabled(true);
+    LayoutWrapper::SetParallelMeasureMinNodeCount(CARD_ITEM_COUNT + 2);
+    CreateCardRowLayoutWrapper(nodeId)->Measure(layoutConstraint);
+    LayoutWrapper::SetParallelMeasureEnabled(false);
+    EXPECT_EQ(LayoutWrapper::GetParallelMeasureStats().dispatchCount, 0u);
+}
+
+/**
+ * @tc.name: FlexParallelMeasureTest002
+ * @tc.desc: Benchmark measuring a row of costly cards sequentially and in parallel on worker threads
+ * @tc.type: FUNC
+ */
+HWTEST_F(FlexTestNg, FlexParallelMeasureTest002, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. give the pipeline a task executor running the background tasks on threads.
+     */
+    auto pipeline = MockPipelineBase::GetCurrent();
+    ASSERT_NE(pipeline, nullptr);
+    auto taskExecutor = AceType::MakeRefPtr<ThreadTaskExecutor>();
+    pipeline->taskExecutor_ = taskExecutor;
+    LayoutConstraintF layoutConstraint;
+    layoutConstraint.maxSize = CONTAINER_SIZE;
+    layoutConstraint.percentReference = CONTAINER_SIZE;
+    int32_t nodeId = 0;
+    auto createRow = [&nodeId]() { return CreateCostlyCardRowLayoutWrapper(nodeId); };
+
+    /**
+     * @tc.steps: step2. measure rows of costly cards with parallel measure disabled, then enabled.
+     * @tc.expected: step2. every card is dispatched, the times depend on the machine and are only logged.
+     */
+    LayoutWrapper::SetParallelMeasureEnabled(false);
+    auto sequentialTime = MeasureBestTime(createRow, layoutConstraint);
+    LayoutWrapper::ResetParallelMeasureStats();
+    LayoutWrapper::SetParallelMeasureEnabled(true);
+    LayoutWrapper::SetParallelMeasureMinNodeCount(CARD_ITEM_COUNT);
+    auto parallelTime = MeasureBestTime(createRow, layoutConstraint);
+    LayoutWrapper::SetParallelMeasureEnabled(false);
+    taskExecutor->Join();
+    pipeline->taskExecutor_ = nullptr;
+    auto stats = LayoutWrapper::GetParallelMeasureStats();
+    EXPECT_EQ(stats.dispatchCount, static_cast<uint64_t>(CARD_COUNT * BENCHMARK_ROUND_COUNT));
+    LOGI("measure %{public}d cards of %{public}d items, sequential: %{public}lld us, parallel: %{public}lld us, "
+         "%{public}llu of %{public}llu cards on workers",
+        CARD_COUNT, CARD_ITEM_COUNT, static_cast<long long>(sequentialTime.count()),
+        static_cast<long long>(parallelTime.count()), static_cast<unsigned long long>(stats.workerCount),
+        static_cast<unsigned long long>(stats.dispatchCount));
+}
 } // namespace OHOS::Ace::NG
@@ -771,6 +771,56 @@ HWTEST_F(GridTestNg, GridTest012, TestSize.Level1)
     EXPECT_TRUE(layoutWrapper->GetOrCreateChildByIndex(0, false)->IsActive());
 }
 
+/**
+ * @tc.name: GridTest013
+ * @tc.desc: grid with fixed column, children appended after viewport
+ * @tc.type: FUNC
+ */
+HWTEST_F(GridTestNg, GridTest013, TestSize.Level1)
+{
+    GridModelNG gridModelNG;
+    gridModelNG.Create(nullptr, nullptr);
+    gridModelNG.SetColumnsTemplate("1fr 1fr 1fr");
+    CreateGridItem(9);
+    GetInstance();
+
+    RefPtr<LayoutWrapper> layoutWrapper = RunMeasureAndLayout(DEFAULT_ROOT_WIDTH, 200.f);
+    pattern_->UpdateCurrentOffset(-100.f, SCROLL_FROM_UPDATE);
+    RunMeasureAndLayout(DEFAULT_ROOT_WIDTH, 200.f);
+    pattern_->UpdateCurrentOffset(100.f, SCROLL_FROM_UPDATE);
+    RunMeasureAndLayout(DEFAULT_ROOT_WIDTH, 200.f);
+
+    /**
+     * @tc.steps: step1. append three items, the first updated child is after viewport.
+     * @tc.expected: step1. the lines in viewport are kept and the lines after it are dropped.
+     */
+    for (int32_t i = 0; i < 3; i++) {
+        auto item = FrameNode::CreateFrameNode(V2::GRID_ITEM_ETS_TAG, ElementRegister::GetInstance()->MakeUniqueId(),
+            AceType::MakeRefPtr<GridItemPattern>(nullptr));
+        item->GetLayoutProperty()->UpdateUserDefinedIdealSize(
+            CalcSize(std::nullopt, CalcLength(Dimension(DEFAULT_ITEM_HEIGHT))));
+        frameNode_->AddChild(item);
+    }
+    frameNode_->ChildrenUpdatedFrom(9);
+    layoutWrapper = RunMeasureAndLayout(DEFAULT_ROOT_WIDTH, 200.f);
+    EXPECT_EQ(frameNode_->GetChildrenUpdated(), -1);
+    EXPECT_EQ(pattern_->gridLayoutInfo_.startIndex_, 0);
+    EXPECT_EQ(pattern_->gridLayoutInfo_.endIndex_, 5);
+    EXPECT_EQ(pattern_->gridLayoutInfo_.gridMatrix_.count(2), 0);
+    for (int32_t i = 0; i < 6; ++i) {
+        EXPECT_TRUE(layoutWrapper->GetOrCreateChildByIndex(i, false)->IsActive());
+    }
+
+    /**
+     * @tc.steps: step2. scroll to end.
+     * @tc.expected: step2. the appended items are filled in a new line.
+     */
+    pattern_->UpdateCurrentOffset(-200.f, SCROLL_FROM_UPDATE);
+    layoutWrapper = RunMeasureAndLayout(DEFAULT_ROOT_WIDTH, 200.f);
+    EXPECT_EQ(pattern_->gridLayoutInfo_.endIndex_, 11);
+    EXPECT_TRUE(layoutWrapper->GetOrCreateChildByIndex(11, false)->IsActive());
+}
+
 /**
  * @tc.name: EventHub001
  * @tc.desc: Test GetInsertPosition func
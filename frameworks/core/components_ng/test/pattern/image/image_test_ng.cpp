@@ -1387,4 +1387,53 @@ HWTEST_F(ImageTestNg, CopyOption001, TestSize.Level1)
     frameNode->MarkModifyDone();
     EXPECT_TRUE(gestureHub->longPressEventActuator_->longPressEvent_);
 }
+
+/**
+ * @tc.name: ImageHibernate001
+ * @tc.desc: Test image releases its decoded images on hibernate and loads them again on rehydrate.
+ * @tc.type: FUNC
+ */
+HWTEST_F(ImageTestNg, ImageHibernate001, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. create image frameNode with a decoded image and alt image.
+     * @tc.expected: the hibernation size is the RGBA size of both images.
+     */
+    auto frameNode = ImageTestNg::CreateImageNode(IMAGE_SRC_URL, ALT_SRC_URL);
+    ASSERT_NE(frameNode, nullptr);
+    auto imagePattern = frameNode->GetPattern<ImagePattern>();
+    ASSERT_NE(imagePattern, nullptr);
+    EXPECT_EQ(imagePattern->GetHibernationSize(), 0);
+    auto image = AceType::MakeRefPtr<MockCanvasImage>();
+    EXPECT_CALL(*image, GetWidth()).WillRepeatedly(Return(static_cast<int32_t>(IMAGE_SOURCESIZE_WIDTH)));
+    EXPECT_CALL(*image, GetHeight()).WillRepeatedly(Return(static_cast<int32_t>(IMAGE_SOURCESIZE_HEIGHT)));
+    auto altImage = AceType::MakeRefPtr<MockCanvasImage>();
+    EXPECT_CALL(*altImage, GetWidth()).WillRepeatedly(Return(static_cast<int32_t>(ALT_SOURCESIZE_WIDTH)));
+    EXPECT_CALL(*altImage, GetHeight()).WillRepeatedly(Return(static_cast<int32_t>(ALT_SOURCESIZE_HEIGHT)));
+    imagePattern->image_ = image;
+    imagePattern->altImage_ = altImage;
+    constexpr size_t BYTES_PER_PIXEL = 4;
+    auto imageSize = static_cast<size_t>(IMAGE_SOURCESIZE_WIDTH * IMAGE_SOURCESIZE_HEIGHT) * BYTES_PER_PIXEL;
+    auto altImageSize = static_cast<size_t>(ALT_SOURCESIZE_WIDTH * ALT_SOURCESIZE_HEIGHT) * BYTES_PER_PIXEL;
+    EXPECT_EQ(imagePattern->GetHibernationSize(), imageSize + altImageSize);
+
+    /**
+     * @tc.steps: step2. call OnHibernate.
+     * @tc.expected: the images and loading contexts are released and nothing is left to release.
+     */
+    imagePattern->OnHibernate();
+    EXPECT_EQ(imagePattern->image_, nullptr);
+    EXPECT_EQ(imagePattern->altImage_, nullptr);
+    EXPECT_EQ(imagePattern->loadingCtx_, nullptr);
+    EXPECT_EQ(imagePattern->altLoadingCtx_, nullptr);
+    EXPECT_EQ(imagePattern->GetHibernationSize(), 0);
+
+    /**
+     * @tc.steps: step3. call OnRehydrate.
+     * @tc.expected: the image is loaded again from its source info.
+     */
+    imagePattern->OnRehydrate();
+    ASSERT_NE(imagePattern->loadingCtx_, nullptr);
+    EXPECT_EQ(imagePattern->loadingCtx_->GetSourceInfo().GetSrc(), IMAGE_SRC_URL);
+}
 } // namespace OHOS::Ace::NG
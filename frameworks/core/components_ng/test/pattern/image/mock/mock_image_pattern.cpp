@@ -46,6 +46,12 @@ void ImagePattern::OnNotifyMemoryLevel(int32_t level) {}
 void ImagePattern::OnWindowHide() {}
 void ImagePattern::OnWindowShow() {}
 void ImagePattern::OnVisibleChange(bool isVisible) {}
+size_t ImagePattern::GetHibernationSize() const
+{
+    return 0;
+}
+void ImagePattern::OnHibernate() {}
+void ImagePattern::OnRehydrate() {}
 
 void ImagePattern::ToJsonValue(std::unique_ptr<JsonValue>& json) const {}
 void ImagePattern::DumpInfo() {}
@@ -668,10 +668,10 @@ HWTEST_F(IndexerTestNg, IndexerUpdateBubble001, TestSize.Level1)
     ASSERT_NE(pattern_->popupNode_, nullptr);
     auto columnLayoutProperty = pattern_->popupNode_->GetLayoutProperty<LinearLayoutProperty>();
     ASSERT_NE(columnLayoutProperty, nullptr);
-    ASSERT_NE(columnLayoutProperty->calcLayoutConstraint_, nullptr);
+    ASSERT_NE(columnLayoutProperty->GetCalcLayoutConstraint(), nullptr);
     auto bubbleSize = Dimension(BUBBLE_BOX_SIZE, DimensionUnit::VP).ConvertToPx();
     auto columnCalcSize = CalcSize(CalcLength(bubbleSize), CalcLength(bubbleSize * 3));
-    EXPECT_EQ(columnLayoutProperty->calcLayoutConstraint_->selfIdealSize, columnCalcSize);
+    EXPECT_EQ(columnLayoutProperty->GetCalcLayoutConstraint()->selfIdealSize, columnCalcSize);
 }
 
 /**
@@ -697,10 +697,10 @@ HWTEST_F(IndexerTestNg, IndexerUpdateBubble002, TestSize.Level1)
     ASSERT_NE(pattern_->popupNode_, nullptr);
     auto columnLayoutProperty = pattern_->popupNode_->GetLayoutProperty<LinearLayoutProperty>();
     ASSERT_NE(columnLayoutProperty, nullptr);
-    ASSERT_NE(columnLayoutProperty->calcLayoutConstraint_, nullptr);
+    ASSERT_NE(columnLayoutProperty->GetCalcLayoutConstraint(), nullptr);
     auto bubbleSize = Dimension(BUBBLE_BOX_SIZE, DimensionUnit::VP).ConvertToPx();
     auto columnCalcSize = CalcSize(CalcLength(bubbleSize), CalcLength(bubbleSize * 3));
-    EXPECT_EQ(columnLayoutProperty->calcLayoutConstraint_->selfIdealSize, columnCalcSize);
+    EXPECT_EQ(columnLayoutProperty->GetCalcLayoutConstraint()->selfIdealSize, columnCalcSize);
 }
 
 /**
@@ -726,10 +726,10 @@ HWTEST_F(IndexerTestNg, IndexerUpdateBubble003, TestSize.Level1)
     ASSERT_NE(pattern_->popupNode_, nullptr);
     auto columnLayoutProperty = pattern_->popupNode_->GetLayoutProperty<LinearLayoutProperty>();
     ASSERT_NE(columnLayoutProperty, nullptr);
-    ASSERT_NE(columnLayoutProperty->calcLayoutConstraint_, nullptr);
+    ASSERT_NE(columnLayoutProperty->GetCalcLayoutConstraint(), nullptr);
     auto bubbleSize = Dimension(BUBBLE_BOX_SIZE, DimensionUnit::VP).ConvertToPx();
     auto columnCalcSize = CalcSize(CalcLength(bubbleSize), CalcLength(bubbleSize * 6));
-    EXPECT_EQ(columnLayoutProperty->calcLayoutConstraint_->selfIdealSize, columnCalcSize);
+    EXPECT_EQ(columnLayoutProperty->GetCalcLayoutConstraint()->selfIdealSize, columnCalcSize);
 }
 
 /**
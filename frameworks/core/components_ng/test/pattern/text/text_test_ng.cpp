@@ -30,7 +30,9 @@
 #include "core/components_ng/base/view_stack_processor.h"
 #include "core/components_ng/layout/layout_property.h"
 #include "core/components_ng/pattern/image/image_pattern.h"
+#include "core/components_ng/pattern/linear_layout/linear_layout_pattern.h"
 #include "core/components_ng/pattern/pattern.h"
+#include "core/components_ng/pattern/text/paragraph_cache.h"
 #include "core/components_ng/pattern/text/text_accessibility_property.h"
 #include "core/components_ng/pattern/text/text_content_modifier.h"
 #include "core/components_ng/pattern/text/text_layout_property.h"
@@ -110,9 +112,17 @@ const Ace::TextCase TEXT_CASE_VALUE = Ace::TextCase::LOWERCASE;
 const Dimension ADAPT_MAX_FONT_SIZE_VALUE = Dimension(200, DimensionUnit::PX);
 const Dimension LETTER_SPACING = Dimension(10, DimensionUnit::PX);
 const Dimension ADAPT_UPDATE_FONTSIZE_VALUE = Dimension(50, DimensionUnit::PX);
+constexpr Dimension ADAPT_FINE_FONT_SIZE_STEP_VALUE = Dimension(1, DimensionUnit::PX);
+constexpr int32_t ADAPT_MAX_BUILD_COUNT = 9;
 const std::string ROOT_TAG("root");
 constexpr int32_t NODE_ID = 143;
 const Color FOREGROUND_COLOR_VALUE = Color::FOREGROUND;
+constexpr int32_t CARD_COUNT = 4;
+constexpr int32_t CARD_ITEM_COUNT = 10;
+constexpr float CARD_WIDTH = 80.0f;
+constexpr Dimension CARD_IMAGE_WIDTH = Dimension(40, DimensionUnit::PX);
+constexpr Dimension CARD_IMAGE_HEIGHT = Dimension(20, DimensionUnit::PX);
+const std::string CARD_IMAGE_SRC = "file://data/data/com.example.test/res/example.jpg";
 
 using OnClickCallback = std::function<void(const BaseEventInfo* info)>;
 using DragDropBaseCallback = std::function<DragDropBaseInfo(const RefPtr<OHOS::Ace::DragEvent>&, const std::string&)>;
@@ -145,6 +155,47 @@ void TestUpdateScenario(const RefPtr<TextPattern>& pattern)
         }
     }
 }
+
+RefPtr<LayoutWrapper> CreateLayoutWrapper(const RefPtr<FrameNode>& frameNode)
+{
+    auto layoutWrapper = AceType::MakeRefPtr<LayoutWrapper>(
+        frameNode, AceType::MakeRefPtr<GeometryNode>(), frameNode->GetLayoutProperty());
+    layoutWrapper->SetLayoutAlgorithm(
+        AceType::MakeRefPtr<LayoutAlgorithmWrapper>(frameNode->GetPattern()->CreateLayoutAlgorithm()));
+    return layoutWrapper;
+}
+
+// a row of columns, each a card of fixed width holding texts and images.
+RefPtr<LayoutWrapper> CreateCardRowLayoutWrapper(int32_t& nodeId)
+{
+    auto rowFrameNode =
+        FrameNode::CreateFrameNode(V2::ROW_ETS_TAG, nodeId++, AceType::MakeRefPtr<LinearLayoutPattern>(false));
+    auto rowLayoutWrapper = CreateLayoutWrapper(rowFrameNode);
+    for (int32_t i = 0; i < CARD_COUNT; ++i) {
+        auto cardFrameNode =
+            FrameNode::CreateFrameNode(V2::COLUMN_ETS_TAG, nodeId++, AceType::MakeRefPtr<LinearLayoutPattern>(true));
+        cardFrameNode->GetLayoutProperty()->UpdateUserDefinedIdealSize(CalcSize(CalcLength(CARD_WIDTH), std::nullopt));
+        auto cardLayoutWrapper = CreateLayoutWrapper(cardFrameNode);
+        for (int32_t j = 0; j < CARD_ITEM_COUNT; ++j) {
+            auto textFrameNode =
+                FrameNode::CreateFrameNode(V2::TEXT_ETS_TAG, nodeId++, AceType::MakeRefPtr<TextPattern>());
+            textFrameNode->GetLayoutProperty<TextLayoutProperty>()->UpdateContent(CREATE_VALUE);
+            cardFrameNode->AddChild(textFrameNode);
+            cardLayoutWrapper->AppendChild(CreateLayoutWrapper(textFrameNode));
+
+            auto imageFrameNode =
+                FrameNode::CreateFrameNode(V2::IMAGE_ETS_TAG, nodeId++, AceType::MakeRefPtr<ImagePattern>());
+            imageFrameNode->GetPattern<ImagePattern>()->loadingCtx_ = AceType::MakeRefPtr<ImageLoadingContext>(
+                ImageSourceInfo(CARD_IMAGE_SRC, CARD_IMAGE_WIDTH, CARD_IMAGE_HEIGHT),
+                LoadNotifier(nullptr, nullptr, nullptr));
+            cardFrameNode->AddChild(imageFrameNode);
+            cardLayoutWrapper->AppendChild(CreateLayoutWrapper(imageFrameNode));
+        }
+        rowFrameNode->AddChild(cardFrameNode);
+        rowLayoutWrapper->AppendChild(cardLayoutWrapper);
+    }
+    return rowLayoutWrapper;
+}
 } // namespace
 
 struct TestProperty {
@@ -190,6 +241,7 @@ void TextTestNg::TearDown()
 {
     MockPipelineBase::TearDown();
     MockTxtParagraph::SetCanConstruct();
+    ParagraphCache::GetInstance().Clear();
 }
 
 void TextTestNg::InitTextObject() {}
@@ -2912,4 +2964,292 @@ HWTEST_F(TextTestNg, UpdateChildProperty002, TestSize.Level1)
      */
     TestUpdateScenario(pattern);
 }
+
+/**
+ * @tc.name: ParagraphCache001
+ * @tc.desc: test paragraph cache hit, miss and eviction.
+ * @tc.type: FUNC
+ */
+HWTEST_F(TextTestNg, ParagraphCache001, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. put a paragraph into the cache and get it with the same content, style and constraint.
+     * @tc.expected: the same paragraph is returned.
+     */
+    auto& cache = ParagraphCache::GetInstance();
+    auto oldStats = cache.GetStats();
+    ParagraphStyle paragraphStyle;
+    RefPtr<Paragraph> paragraph = Paragraph::Create(paragraphStyle, FontCollection::Current());
+    ASSERT_NE(paragraph, nullptr);
+    TextStyle textStyle;
+    LayoutConstraintF constraint;
+    constraint.maxSize = SizeF(CONTEXT_WIDTH_VALUE, CONTEXT_HEIGHT_VALUE);
+    cache.Put(CREATE_VALUE, textStyle, constraint, paragraph);
+    EXPECT_EQ(cache.Get(CREATE_VALUE, textStyle, constraint), paragraph);
+
+    /**
+     * @tc.steps: step2. get paragraphs with another content, style or width constraint.
+     * @tc.expected: nothing is returned, and the hit and miss counts are updated.
+     */
+    EXPECT_EQ(cache.Get("other", textStyle, constraint), nullptr);
+    LayoutConstraintF otherConstraint = constraint;
+    otherConstraint.maxSize = SizeF(CONTEXT_LARGE_WIDTH_VALUE, CONTEXT_HEIGHT_VALUE);
+    EXPECT_EQ(cache.Get(CREATE_VALUE, textStyle, otherConstraint), nullptr);
+    TextStyle otherStyle;
+    otherStyle.SetMaxLines(1);
+    EXPECT_EQ(cache.Get(CREATE_VALUE, otherStyle, constraint), nullptr);
+    TextStyle otherWhiteSpaceStyle;
+    otherWhiteSpaceStyle.SetWhiteSpace(WhiteSpace::NORMAL);
+    EXPECT_EQ(cache.Get(CREATE_VALUE, otherWhiteSpaceStyle, constraint), nullptr);
+    auto stats = cache.GetStats();
+    EXPECT_EQ(stats.hitCount - oldStats.hitCount, 1);
+    EXPECT_EQ(stats.missCount - oldStats.missCount, 4);
+
+    /**
+     * @tc.steps: step3. limit the capacity to one entry and put another paragraph.
+     * @tc.expected: the least recently used paragraph is evicted.
+     */
+    cache.SetCapacity(1);
+    cache.Put("other", textStyle, constraint, paragraph);
+    EXPECT_EQ(cache.Size(), 1);
+    EXPECT_EQ(cache.Get(CREATE_VALUE, textStyle, constraint), nullptr);
+    EXPECT_EQ(cache.Get("other", textStyle, constraint), paragraph);
+    cache.SetCapacity(ParagraphCache::DEFAULT_CAPACITY);
+
+    /**
+     * @tc.steps: step4. put the paragraph for another content, then remove it.
+     * @tc.expected: the paragraph is kept by its last entry only, and it is found until it is removed.
+     */
+    cache.Put(CREATE_VALUE, textStyle, constraint, paragraph);
+    EXPECT_EQ(cache.Size(), 1);
+    EXPECT_EQ(cache.Get("other", textStyle, constraint), nullptr);
+    EXPECT_TRUE(cache.Contains(paragraph));
+    cache.Remove(paragraph);
+    EXPECT_FALSE(cache.Contains(paragraph));
+    EXPECT_EQ(cache.Size(), 0);
+}
+
+/**
+ * @tc.name: TextHibernate001
+ * @tc.desc: test text releases its paragraph on hibernate unless it is shared, and relayouts on rehydrate.
+ * @tc.type: FUNC
+ */
+HWTEST_F(TextTestNg, TextHibernate001, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. create a text node whose paragraph is held by the node and ParagraphCache only.
+     * @tc.expected: the paragraph is counted in the hibernation size.
+     */
+    auto textFrameNode = FrameNode::CreateFrameNode(V2::TEXT_ETS_TAG, 0, AceType::MakeRefPtr<TextPattern>());
+    ASSERT_NE(textFrameNode, nullptr);
+    auto pattern = textFrameNode->GetPattern<TextPattern>();
+    ASSERT_NE(pattern, nullptr);
+    EXPECT_EQ(pattern->GetHibernationSize(), 0);
+    auto& cache = ParagraphCache::GetInstance();
+    ParagraphStyle paragraphStyle;
+    TextStyle textStyle;
+    LayoutConstraintF constraint;
+    constraint.maxSize = SizeF(CONTEXT_WIDTH_VALUE, CONTEXT_HEIGHT_VALUE);
+    pattern->paragraph_ = Paragraph::Create(paragraphStyle, FontCollection::Current());
+    ASSERT_NE(pattern->paragraph_, nullptr);
+    pattern->textForDisplay_ = CREATE_VALUE;
+    cache.Put(CREATE_VALUE, textStyle, constraint, pattern->paragraph_);
+    EXPECT_GT(pattern->GetHibernationSize(), 0);
+
+    /**
+     * @tc.steps: step2. share the paragraph with another text node, then hibernate the other node.
+     * @tc.expected: the shared paragraph isn't counted, and it stays in the cache after hibernate.
+     */
+    auto otherPattern = AceType::MakeRefPtr<TextPattern>();
+    otherPattern->paragraph_ = pattern->paragraph_;
+    otherPattern->textForDisplay_ = CREATE_VALUE;
+    EXPECT_EQ(pattern->GetHibernationSize(), 0);
+    EXPECT_EQ(otherPattern->GetHibernationSize(), 0);
+    otherPattern->OnHibernate();
+    EXPECT_EQ(otherPattern->paragraph_, nullptr);
+    EXPECT_EQ(cache.Size(), 1);
+
+    /**
+     * @tc.steps: step3. hibernate the text node, which holds the paragraph alone again.
+     * @tc.expected: the paragraph is released and evicted from the cache.
+     */
+    EXPECT_GT(pattern->GetHibernationSize(), 0);
+    pattern->OnHibernate();
+    EXPECT_EQ(pattern->paragraph_, nullptr);
+    EXPECT_EQ(pattern->GetHibernationSize(), 0);
+    EXPECT_EQ(cache.Size(), 0);
+
+    /**
+     * @tc.steps: step4. rehydrate the text node.
+     * @tc.expected: the node is marked to measure again, which shapes a new paragraph.
+     */
+    auto layoutProperty = textFrameNode->GetLayoutProperty();
+    ASSERT_NE(layoutProperty, nullptr);
+    layoutProperty->CleanDirty();
+    pattern->OnRehydrate();
+    EXPECT_EQ(layoutProperty->GetPropertyChangeFlag() & PROPERTY_UPDATE_MEASURE, PROPERTY_UPDATE_MEASURE);
+}
+
+/**
+ * @tc.name: ParagraphCacheTrim001
+ * @tc.desc: test paragraph cache trims the paragraphs no text node holds.
+ * @tc.type: FUNC
+ */
+HWTEST_F(TextTestNg, ParagraphCacheTrim001, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. put a paragraph held by a text node and a paragraph held by the cache only.
+     */
+    auto& cache = ParagraphCache::GetInstance();
+    ParagraphStyle paragraphStyle;
+    TextStyle textStyle;
+    LayoutConstraintF constraint;
+    constraint.maxSize = SizeF(CONTEXT_WIDTH_VALUE, CONTEXT_HEIGHT_VALUE);
+    auto pattern = AceType::MakeRefPtr<TextPattern>();
+    pattern->paragraph_ = Paragraph::Create(paragraphStyle, FontCollection::Current());
+    ASSERT_NE(pattern->paragraph_, nullptr);
+    cache.Put(CREATE_VALUE, textStyle, constraint, pattern->paragraph_);
+    cache.Put("other", textStyle, constraint, Paragraph::Create(paragraphStyle, FontCollection::Current()));
+    EXPECT_EQ(cache.Size(), 2);
+
+    /**
+     * @tc.steps: step2. call TrimUnused.
+     * @tc.expected: only the paragraph held by the text node is kept.
+     */
+    auto oldStats = cache.GetStats();
+    cache.TrimUnused();
+    EXPECT_EQ(cache.Size(), 1);
+    EXPECT_TRUE(cache.Contains(pattern->paragraph_));
+    EXPECT_EQ(cache.GetStats().evictCount - oldStats.evictCount, 1);
+}
+
+/**
+ * @tc.name: AdaptFontSizeSearch001
+ * @tc.desc: test adaptive font size binary searches the candidate font sizes.
+ * @tc.type: FUNC
+ */
+HWTEST_F(TextTestNg, AdaptFontSizeSearch001, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. create textFrameNode and textStyle with 151 candidate font sizes from 50px to 200px.
+     */
+    auto textFrameNode = FrameNode::CreateFrameNode(V2::TOAST_ETS_TAG, 0, AceType::MakeRefPtr<TextPattern>());
+    ASSERT_NE(textFrameNode, nullptr);
+    auto pipeline = textFrameNode->GetContext();
+    TextStyle textStyle;
+    textStyle.SetAdaptTextSize(ADAPT_MAX_FONT_SIZE_VALUE, ADAPT_MIN_FONT_SIZE_VALUE, ADAPT_FINE_FONT_SIZE_STEP_VALUE);
+    LayoutConstraintF parentLayoutConstraint;
+    parentLayoutConstraint.maxSize = CONTAINER_SIZE;
+    auto textLayoutAlgorithm = AceType::MakeRefPtr<TextLayoutAlgorithm>();
+
+    /**
+     * @tc.steps: step2. call AdaptMinTextSize while no font size fits.
+     * @tc.expected: the min font size is used after a logarithmic count of paragraph builds.
+     */
+    MockTxtParagraph::SetDidExceedMaxLines({});
+    EXPECT_TRUE(
+        textLayoutAlgorithm->AdaptMinTextSize(textStyle, CREATE_VALUE, parentLayoutConstraint, pipeline, nullptr));
+    EXPECT_EQ(textStyle.GetFontSize(), ADAPT_MIN_FONT_SIZE_VALUE);
+    EXPECT_LE(textLayoutAlgorithm->GetAdaptBuildCount(), ADAPT_MAX_BUILD_COUNT);
+
+    /**
+     * @tc.steps: step3. call AdaptMinTextSize while the max font size fits.
+     * @tc.expected: the max font size is used after one paragraph build.
+     */
+    MockTxtParagraph::SetDidExceedMaxLines({ false });
+    parentLayoutConstraint.maxSize = LARGE_SIZE;
+    EXPECT_TRUE(
+        textLayoutAlgorithm->AdaptMinTextSize(textStyle, CREATE_VALUE, parentLayoutConstraint, pipeline, nullptr));
+    EXPECT_EQ(textStyle.GetFontSize(), ADAPT_MAX_FONT_SIZE_VALUE);
+    EXPECT_EQ(textLayoutAlgorithm->GetAdaptBuildCount(), 1);
+}
+
+/**
+ * @tc.name: TextParallelMeasure001
+ * @tc.desc: test cards of texts and images measure in parallel with the state copied to them before dispatch.
+ * @tc.type: FUNC
+ */
+HWTEST_F(TextTestNg, TextParallelMeasure001, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. create two rows of cards, each card a column of texts and images.
+     * @tc.expected: the cards qualify for parallel measure.
+     */
+    int32_t nodeId = 0;
+    auto sequentialRow = CreateCardRowLayoutWrapper(nodeId);
+    auto parallelRow = CreateCardRowLayoutWrapper(nodeId);
+    const auto& parallelCards = parallelRow->GetAllChildrenWithBuild();
+    EXPECT_EQ(parallelCards.front()->GetParallelMeasureNodeCount(), CARD_ITEM_COUNT * 2 + 1);
+
+    /**
+     * @tc.steps: step2. measure the first row with parallel measure disabled, the second row with it enabled.
+     * @tc.expected: every card is dispatched, and the items measure to the same sizes in both rows.
+     */
+    LayoutConstraintF layoutConstraint;
+    layoutConstraint.maxSize = CONTAINER_SIZE;
+    layoutConstraint.percentReference = CONTAINER_SIZE;
+    LayoutWrapper::SetParallelMeasureEnabled(false);
+    sequentialRow->Measure(layoutConstraint);
+    LayoutWrapper::ResetParallelMeasureStats();
+    LayoutWrapper::SetParallelMeasureEnabled(true);
+    LayoutWrapper::SetParallelMeasureMinNodeCount(CARD_ITEM_COUNT);
+    parallelRow->Measure(layoutConstraint);
+    LayoutWrapper::SetParallelMeasureEnabled(false);
+    EXPECT_EQ(LayoutWrapper::GetParallelMeasureStats().dispatchCount, static_cast<uint64_t>(CARD_COUNT));
+    EXPECT_FALSE(LayoutWrapper::IsMeasuringInParallel());
+    const auto& sequentialCards = sequentialRow->GetAllChildrenWithBuild();
+    ASSERT_EQ(sequentialCards.size(), parallelCards.size());
+    for (auto sequentialCard = sequentialCards.begin(), parallelCard = parallelCards.begin();
+         sequentialCard != sequentialCards.end(); ++sequentialCard, ++parallelCard) {
+        const auto& sequentialItems = (*sequentialCard)->GetAllChildrenWithBuild();
+        const auto& parallelItems = (*parallelCard)->GetAllChildrenWithBuild();
+        ASSERT_EQ(sequentialItems.size(), parallelItems.size());
+        for (auto sequentialItem = sequentialItems.begin(), parallelItem = parallelItems.begin();
+             sequentialItem != sequentialItems.end(); ++sequentialItem, ++parallelItem) {
+            EXPECT_EQ((*parallelItem)->GetGeometryNode()->GetFrameSize(),
+                (*sequentialItem)->GetGeometryNode()->GetFrameSize());
+        }
+    }
+
+    /**
+     * @tc.steps: step3. check the state copied to the items of a dispatched card.
+     * @tc.expected: the items hold the state of their nodes, the texts the text style and the pipeline scales,
+     *               the images the size of their source.
+     */
+    auto pipeline = PipelineContext::GetCurrentContext();
+    ASSERT_NE(pipeline, nullptr);
+    for (const auto& item : parallelCards.front()->GetAllChildrenWithBuild()) {
+        ASSERT_TRUE(item->parallelMeasureState_.has_value());
+        EXPECT_EQ(item->IsHostAtomicNode(), item->GetHostNode()->IsAtomicNode());
+        const auto& layoutAlgorithm = item->GetLayoutAlgorithm()->GetLayoutAlgorithm();
+        auto textLayoutAlgorithm = AceType::DynamicCast<TextLayoutAlgorithm>(layoutAlgorithm);
+        if (textLayoutAlgorithm) {
+            ASSERT_TRUE(textLayoutAlgorithm->parallelMeasureInputs_.has_value());
+            EXPECT_EQ(textLayoutAlgorithm->parallelMeasureInputs_->dipScale, pipeline->GetDipScale());
+            EXPECT_EQ(textLayoutAlgorithm->parallelMeasureInputs_->fontScale, pipeline->GetFontScale());
+            EXPECT_EQ(textLayoutAlgorithm->GetTextStyle(), textLayoutAlgorithm->parallelMeasureInputs_->textStyle);
+            continue;
+        }
+        auto imageLayoutAlgorithm = AceType::DynamicCast<ImageLayoutAlgorithm>(layoutAlgorithm);
+        ASSERT_NE(imageLayoutAlgorithm, nullptr);
+        ASSERT_TRUE(imageLayoutAlgorithm->parallelMeasureInputs_.has_value());
+        EXPECT_EQ(imageLayoutAlgorithm->parallelMeasureInputs_->imageSize,
+            SizeF(CARD_IMAGE_WIDTH.Value(), CARD_IMAGE_HEIGHT.Value()));
+    }
+
+    /**
+     * @tc.steps: step4. make a text of the first card a marquee, which reads the pipeline to build its paragraph.
+     * @tc.expected: the first card stays on the main thread, the other cards are dispatched.
+     */
+    auto marqueeRow = CreateCardRowLayoutWrapper(nodeId);
+    auto marqueeText = marqueeRow->GetAllChildrenWithBuild().front()->GetAllChildrenWithBuild().front();
+    auto marqueeProperty = AceType::DynamicCast<TextLayoutProperty>(marqueeText->GetHostNode()->GetLayoutProperty());
+    ASSERT_NE(marqueeProperty, nullptr);
+    marqueeProperty->UpdateTextOverflow(TextOverflow::MARQUEE);
+    LayoutWrapper::ResetParallelMeasureStats();
+    LayoutWrapper::SetParallelMeasureEnabled(true);
+    marqueeRow->Measure(layoutConstraint);
+    LayoutWrapper::SetParallelMeasureEnabled(false);
+    EXPECT_EQ(LayoutWrapper::GetParallelMeasureStats().dispatchCount, static_cast<uint64_t>(CARD_COUNT - 1));
+}
 } // namespace OHOS::Ace::NG
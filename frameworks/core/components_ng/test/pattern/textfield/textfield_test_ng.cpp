@@ -158,7 +158,7 @@ HWTEST_F(TextFieldPatternTestNg, TextFieldInsertValue001, TestSize.Level1)
     ViewStackProcessor::GetInstance()->Push(frameNode);
     auto pattern = frameNode->GetPattern<TextFieldPattern>();
     pattern->InsertValue(INSERT_VALUE_SINGLE_CHAR);
-    EXPECT_EQ(pattern->GetEditingValue().text, INSERT_VALUE_SINGLE_CHAR);
+    EXPECT_EQ(pattern->GetEditingValue().GetText(), INSERT_VALUE_SINGLE_CHAR);
     EXPECT_EQ(pattern->GetEditingValue().caretPosition, INSERT_VALUE_SINGLE_CHAR.size());
 }
 
@@ -178,13 +178,13 @@ HWTEST_F(TextFieldPatternTestNg, TextFieldInsertValue002, TestSize.Level1)
     auto pattern = frameNode->GetPattern<TextFieldPattern>();
     ASSERT_NE(pattern, nullptr);
     pattern->InsertValue(INSERT_VALUE_SINGLE_CHAR);
-    EXPECT_EQ(pattern->GetEditingValue().text, INSERT_VALUE_SINGLE_CHAR);
+    EXPECT_EQ(pattern->GetEditingValue().GetText(), INSERT_VALUE_SINGLE_CHAR);
     EXPECT_EQ(pattern->GetEditingValue().caretPosition, INSERT_VALUE_SINGLE_CHAR.size());
     auto secNode = ViewStackProcessor::GetInstance()->GetMainFrameNode();
     textFieldModelNG.SetType(TextInputType::NUMBER);
     pattern = frameNode->GetPattern<TextFieldPattern>();
     pattern->ClearEditingValue();
-    EXPECT_EQ(pattern->GetEditingValue().text.length(), 0);
+    EXPECT_EQ(pattern->GetEditingValue().GetText().length(), 0);
 }
 
 /**
@@ -201,10 +201,10 @@ HWTEST_F(TextFieldPatternTestNg, TextFieldDeleteForwardValue001, TestSize.Level1
     ViewStackProcessor::GetInstance()->Push(frameNode);
     auto pattern = frameNode->GetPattern<TextFieldPattern>();
     pattern->InsertValue(TEXT_VALUE);
-    EXPECT_EQ(pattern->GetEditingValue().text, TEXT_VALUE);
+    EXPECT_EQ(pattern->GetEditingValue().GetText(), TEXT_VALUE);
     EXPECT_EQ(pattern->GetEditingValue().caretPosition, static_cast<int32_t>(TEXT_VALUE.size()));
     pattern->DeleteForward(DELETE_LENGTH_1);
-    EXPECT_EQ(pattern->GetEditingValue().text, TEXT_VALUE.substr(0, TEXT_VALUE.size()));
+    EXPECT_EQ(pattern->GetEditingValue().GetText(), TEXT_VALUE.substr(0, TEXT_VALUE.size()));
     EXPECT_EQ(pattern->GetEditingValue().caretPosition, TEXT_VALUE.size());
 }
 
@@ -222,7 +222,7 @@ HWTEST_F(TextFieldPatternTestNg, TextFieldMoveCaret001, TestSize.Level1)
     ViewStackProcessor::GetInstance()->Push(frameNode);
     auto pattern = frameNode->GetPattern<TextFieldPattern>();
     pattern->InsertValue(TEXT_VALUE);
-    EXPECT_EQ(pattern->GetEditingValue().text, TEXT_VALUE);
+    EXPECT_EQ(pattern->GetEditingValue().GetText(), TEXT_VALUE);
     pattern->SetCaretPosition(CARET_POSITION_1);
     // inserting text value length larger than caret position
     EXPECT_EQ(pattern->GetEditingValue().caretPosition, CARET_POSITION_1);
@@ -245,7 +245,7 @@ HWTEST_F(TextFieldPatternTestNg, TextFieldFilter001, TestSize.Level1)
     ASSERT_NE(layoutProperty, nullptr);
     layoutProperty->UpdateInputFilter(LOWERCASE_FILTER);
     pattern->InsertValue(INSERT_VALUE_SINGLE_CHAR);
-    EXPECT_EQ(pattern->GetEditingValue().text, EMPTY_TEXT_VALUE);
+    EXPECT_EQ(pattern->GetEditingValue().GetText(), EMPTY_TEXT_VALUE);
     EXPECT_EQ(pattern->GetEditingValue().caretPosition, EMPTY_TEXT_VALUE.size());
 }
 
@@ -266,7 +266,7 @@ HWTEST_F(TextFieldPatternTestNg, TextFieldFilter002, TestSize.Level1)
     ASSERT_NE(layoutProperty, nullptr);
     layoutProperty->UpdateInputFilter(NUMBER_FILTER);
     pattern->InsertValue(INSERT_VALUE_SINGLE_NUMBER);
-    EXPECT_EQ(pattern->GetEditingValue().text, INSERT_VALUE_SINGLE_NUMBER);
+    EXPECT_EQ(pattern->GetEditingValue().GetText(), INSERT_VALUE_SINGLE_NUMBER);
     EXPECT_EQ(pattern->GetEditingValue().caretPosition, INSERT_VALUE_SINGLE_NUMBER.size());
 }
 
@@ -286,7 +286,7 @@ HWTEST_F(TextFieldPatternTestNg, TextareaMoveCaret001, TestSize.Level1)
     ViewStackProcessor::GetInstance()->Push(frameNode);
     auto pattern = frameNode->GetPattern<TextFieldPattern>();
     pattern->InsertValue(TEXT_VALUE);
-    EXPECT_EQ(pattern->GetEditingValue().text, TEXT_VALUE);
+    EXPECT_EQ(pattern->GetEditingValue().GetText(), TEXT_VALUE);
     controller->CaretPosition(CARET_POSITION_1);
     // inserting text value length larger than caret position
     EXPECT_EQ(pattern->GetEditingValue().caretPosition, CARET_POSITION_2);
@@ -701,7 +701,7 @@ HWTEST_F(TextFieldPatternTestNg, CaretPosition005, TestSize.Level1)
     auto layoutProperty = frameNode->GetLayoutProperty<TextFieldLayoutProperty>();
     ASSERT_NE(layoutProperty, nullptr);
     layoutProperty->UpdateCaretPosition(CARET_POSITION);
-    textFieldPattern->textEditingValue_.text = "text";
+    textFieldPattern->textEditingValue_.SetText("text");
     textFieldPattern->UpdateCaretPositionByPressOffset();
     EXPECT_EQ(textFieldPattern->GetTextEditingValue().caretPosition, CARET_POSITION);
 }
@@ -750,7 +750,7 @@ HWTEST_F(TextFieldPatternTestNg, CheckScrollable001, TestSize.Level1)
 {
     auto textFieldPattern = GetPattern();
     ASSERT_NE(textFieldPattern, nullptr);
-    textFieldPattern->textEditingValue_.text = "";
+    textFieldPattern->textEditingValue_.SetText("");
     EXPECT_TRUE(textFieldPattern->scrollable_);
     textFieldPattern->CheckScrollable();
     EXPECT_FALSE(textFieldPattern->scrollable_);
@@ -765,7 +765,7 @@ HWTEST_F(TextFieldPatternTestNg, CheckScrollable002, TestSize.Level1)
 {
     auto textFieldPattern = GetPattern();
     ASSERT_NE(textFieldPattern, nullptr);
-    textFieldPattern->textEditingValue_.text = "checkScrollable";
+    textFieldPattern->textEditingValue_.SetText("checkScrollable");
     textFieldPattern->textRect_.SetHeight(1.0);
     textFieldPattern->contentRect_.SetHeight(0.0);
     textFieldPattern->scrollable_ = false;
@@ -782,7 +782,7 @@ HWTEST_F(TextFieldPatternTestNg, CheckScrollable003, TestSize.Level1)
 {
     auto textFieldPattern = GetPattern();
     ASSERT_NE(textFieldPattern, nullptr);
-    textFieldPattern->textEditingValue_.text = "checkScrollable";
+    textFieldPattern->textEditingValue_.SetText("checkScrollable");
     textFieldPattern->textRect_.SetHeight(0.0);
     textFieldPattern->contentRect_.SetHeight(0.0);
     EXPECT_TRUE(textFieldPattern->scrollable_);
@@ -799,7 +799,7 @@ HWTEST_F(TextFieldPatternTestNg, CheckScrollable004, TestSize.Level1)
 {
     auto textFieldPattern = GetPattern();
     ASSERT_NE(textFieldPattern, nullptr);
-    textFieldPattern->textEditingValue_.text = "checkScrollable";
+    textFieldPattern->textEditingValue_.SetText("checkScrollable");
     textFieldPattern->textRect_.SetHeight(0.0);
     textFieldPattern->contentRect_.SetHeight(1.0);
     EXPECT_FALSE(textFieldPattern->scrollable_);
@@ -1066,7 +1066,7 @@ HWTEST_F(TextFieldPatternTestNg, TextFieldPatternUpdateScrollBarOffset001, TestS
     auto pattern = frameNode->GetPattern<TextFieldPattern>();
     ASSERT_NE(pattern, nullptr);
     pattern->UpdateScrollBarOffset();
-    EXPECT_EQ(pattern->textEditingValue_.text, "checkScrollable");
+    EXPECT_EQ(pattern->textEditingValue_.GetText(), "checkScrollable");
 }
 
 /**
@@ -1082,8 +1082,8 @@ HWTEST_F(TextFieldPatternTestNg, TextFieldPatternUpdateScrollBarOffset002, TestS
     ASSERT_NE(pattern, nullptr);
     pattern->textEditingValue_.Reset();
     pattern->UpdateScrollBarOffset();
-    EXPECT_TRUE(pattern->textEditingValue_.text.empty());
-    pattern->textEditingValue_.text = "updateScrollBarOffset";
+    EXPECT_TRUE(pattern->textEditingValue_.GetText().empty());
+    pattern->textEditingValue_.SetText("updateScrollBarOffset");
     pattern->UpdateScrollBarOffset();
     EXPECT_EQ(pattern->GetScrollBar(), nullptr);
     auto scrollBar = AceType::MakeRefPtr<ScrollBar>();
@@ -1321,7 +1321,7 @@ HWTEST_F(TextFieldPatternTestNg, PaintCursor001, TestSize.Level1)
     auto pattern = frameNode->GetPattern<TextFieldPattern>();
     ASSERT_NE(pattern, nullptr);
     pattern->selectionMode_ = SelectionMode::NONE;
-    pattern->paragraph_ = std::make_shared<RSParagraph>();
+    pattern->paragraph_ = std::make_shared<TextFieldParagraph>(std::make_shared<RSParagraph>());
     auto scrollBar = AceType::MakeRefPtr<ScrollBar>();
     EdgeEffect edgeEffect;
     auto scrollEdgeEffect = AceType::MakeRefPtr<ScrollEdgeEffect>(edgeEffect);
@@ -1952,7 +1952,7 @@ HWTEST_F(TextFieldPatternTestNg, onDraw003, TestSize.Level1)
     /**
      * @tc.steps: step2. paragraph_ Pointer instantiation.
      */
-    pattern->paragraph_ = std::make_shared<RSParagraph>();
+    pattern->paragraph_ = std::make_shared<TextFieldParagraph>(std::make_shared<RSParagraph>());
     auto textFieldContentModifier = AceType::MakeRefPtr<TextFieldContentModifier>(pattern);
     textFieldContentModifier->contentOffset_ = AceType::MakeRefPtr<PropertyOffsetF>(OffsetF());
     textFieldContentModifier->contentSize_ = AceType::MakeRefPtr<PropertySizeF>(SizeF());
@@ -2628,4 +2628,171 @@ HWTEST_F(TextFieldPatternTestNg, GetUnitWidth, TestSize.Level1)
     textFieldPattern->unitWidth_ = unitWidth;
     EXPECT_EQ(textFieldPattern->GetUnitWidth(), unitWidth);
 }
+/**
+ * @tc.name: TextFieldUndoRedo001
+ * @tc.desc: Test undo and redo of textfield by changes of the text.
+ * @tc.type: FUNC
+ */
+HWTEST_F(TextFieldPatternTestNg, TextFieldUndoRedo001, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. create textfield and insert values.
+     * @tc.expected: the last record keeps the inserted value only.
+     */
+    TextFieldModelNG textFieldModelNG;
+    textFieldModelNG.CreateTextInput(PLACEHOLDER, EMPTY_TEXT_VALUE);
+    auto frameNode = CreatTextFieldNode();
+    ASSERT_NE(frameNode, nullptr);
+    ViewStackProcessor::GetInstance()->Push(frameNode);
+    auto pattern = frameNode->GetPattern<TextFieldPattern>();
+    ASSERT_NE(pattern, nullptr);
+    pattern->InsertValue(TEXT_VALUE);
+    pattern->InsertValue(INSERT_VALUE_SINGLE_CHAR);
+    EXPECT_EQ(pattern->GetEditingValue().GetText(), TEXT_VALUE + INSERT_VALUE_SINGLE_CHAR);
+    ASSERT_FALSE(pattern->operationRecords_.empty());
+    EXPECT_EQ(pattern->operationRecords_.back().insertedText, INSERT_VALUE_SINGLE_CHAR);
+    EXPECT_TRUE(pattern->operationRecords_.back().removedText.empty());
+
+    /**
+     * @tc.steps: step2. undo and redo the last insertion.
+     * @tc.expected: the text and caret position are restored.
+     */
+    pattern->HandleOnUndoAction();
+    EXPECT_EQ(pattern->GetEditingValue().GetText(), TEXT_VALUE);
+    EXPECT_EQ(pattern->GetEditingValue().caretPosition, static_cast<int32_t>(TEXT_VALUE.size()));
+    pattern->HandleOnRedoAction();
+    EXPECT_EQ(pattern->GetEditingValue().GetText(), TEXT_VALUE + INSERT_VALUE_SINGLE_CHAR);
+    EXPECT_EQ(pattern->GetEditingValue().caretPosition, static_cast<int32_t>(TEXT_VALUE.size()) + 1);
+
+    /**
+     * @tc.steps: step3. undo all records, then redo.
+     * @tc.expected: the text is cleared, and the first insertion is redone.
+     */
+    pattern->HandleOnUndoAction();
+    pattern->HandleOnUndoAction();
+    EXPECT_TRUE(pattern->GetEditingValue().GetText().empty());
+    pattern->HandleOnRedoAction();
+    EXPECT_EQ(pattern->GetEditingValue().GetText(), TEXT_VALUE);
+
+    /**
+     * @tc.steps: step4. delete backward after undo.
+     * @tc.expected: the records to redo are dropped.
+     */
+    pattern->DeleteBackward(DELETE_LENGTH_1);
+    EXPECT_EQ(pattern->GetEditingValue().GetText(), TEXT_VALUE.substr(0, TEXT_VALUE.size() - DELETE_LENGTH_1));
+    EXPECT_TRUE(pattern->redoOperationRecords_.empty());
+}
+
+/**
+ * @tc.name: TextFieldParagraphKey001
+ * @tc.desc: Test paragraphs of textfield are reused only for the same inputs.
+ * @tc.type: FUNC
+ */
+HWTEST_F(TextFieldPatternTestNg, TextFieldParagraphKey001, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. create keys of the same inputs.
+     * @tc.expected: keys are equal.
+     */
+    TextStyle textStyle;
+    textStyle.SetFontSize(DEFAULT_FONT_SIZE);
+    TextFieldParagraphKey key { TEXT_VALUE, textStyle };
+    auto other = key;
+    EXPECT_TRUE(key == other);
+
+    /**
+     * @tc.steps: step2. change content, obscuring, style and font generation of the key.
+     * @tc.expected: keys are not equal.
+     */
+    other.content = TEXT_VALUE + INSERT_VALUE_SINGLE_CHAR;
+    EXPECT_FALSE(key == other);
+    other = key;
+    other.needObscureText = true;
+    EXPECT_FALSE(key == other);
+    other = key;
+    other.textStyle.SetMaxLines(1);
+    EXPECT_FALSE(key == other);
+    other = key;
+    ++other.fontGeneration;
+    EXPECT_FALSE(key == other);
+}
+
+/**
+ * @tc.name: TextFieldParagraph001
+ * @tc.desc: Test the paragraph of a text area split into lines.
+ * @tc.type: FUNC
+ */
+HWTEST_F(TextFieldPatternTestNg, TextFieldParagraph001, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. create a paragraph of four lines and lay it out.
+     * @tc.expected: every line is built, and the lines are stacked.
+     */
+    auto builder = [](const std::u16string& /* line */) { return std::make_shared<RSParagraph>(); };
+    auto paragraph = std::make_shared<TextFieldParagraph>(u"first\nsecond\n\nfourth", builder, nullptr);
+    EXPECT_TRUE(paragraph->IsSplit());
+    EXPECT_EQ(paragraph->GetLineParagraphCount(), 4u);
+    EXPECT_EQ(paragraph->GetBuiltLineParagraphCount(), 4u);
+    paragraph->Layout(CONTENT_RECT_WIDTH);
+    auto lineHeight = RSParagraph().GetHeight();
+    EXPECT_EQ(paragraph->GetHeight(), lineHeight * 4);
+    EXPECT_EQ(paragraph->GetMaxWidth(), CONTENT_RECT_WIDTH);
+
+    /**
+     * @tc.steps: step2. query positions and rects in the third line.
+     * @tc.expected: positions are offset by the start of the line, the empty line has the box of its line break.
+     */
+    auto glyphPosition = RSParagraph().GetGlyphPositionAtCoordinate(0.0, 0.0).pos_;
+    EXPECT_EQ(paragraph->GetGlyphPositionAtCoordinate(0.0, lineHeight * 2.5).pos_, glyphPosition + 13);
+    EXPECT_EQ(paragraph->GetRectsForRange(13, 14, RSTypographyProperties::RectHeightStyle::MAX,
+        RSTypographyProperties::RectWidthStyle::TIGHT).size(), 1u);
+
+    /**
+     * @tc.steps: step3. edit the second line.
+     * @tc.expected: only the second line is built again.
+     */
+    auto editedParagraph = std::make_shared<TextFieldParagraph>(u"first\nsecondX\n\nfourth", builder, paragraph);
+    EXPECT_EQ(editedParagraph->GetLineParagraphCount(), 4u);
+    EXPECT_EQ(editedParagraph->GetBuiltLineParagraphCount(), 1u);
+
+    /**
+     * @tc.steps: step4. insert a line break in the second line.
+     * @tc.expected: the two lines it becomes are built, the others are taken.
+     */
+    editedParagraph = std::make_shared<TextFieldParagraph>(u"first\nsec\nond\n\nfourth", builder, paragraph);
+    EXPECT_EQ(editedParagraph->GetLineParagraphCount(), 5u);
+    EXPECT_EQ(editedParagraph->GetBuiltLineParagraphCount(), 2u);
+    editedParagraph->Layout(CONTENT_RECT_WIDTH);
+    EXPECT_EQ(editedParagraph->GetHeight(), lineHeight * 5);
+    EXPECT_NE(editedParagraph->GetWholeParagraph(), nullptr);
+}
+
+/**
+ * @tc.name: TextEditingValueWideText001
+ * @tc.desc: Test the utf-16 text of the editing value is converted again only after the text is set.
+ * @tc.type: FUNC
+ */
+HWTEST_F(TextFieldPatternTestNg, TextEditingValueWideText001, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. set the text and replace a part of it.
+     * @tc.expected: the utf-16 text follows both edits.
+     */
+    TextEditingValueNG value;
+    value.SetText(TEXT_VALUE);
+    EXPECT_EQ(value.GetWideText(), StringUtils::ToWstring(TEXT_VALUE));
+    value.Replace(0, 1, INSERT_VALUE_SINGLE_CHAR);
+    auto replacedText = INSERT_VALUE_SINGLE_CHAR + TEXT_VALUE.substr(1);
+    EXPECT_EQ(value.GetText(), replacedText);
+    EXPECT_EQ(value.GetWideText(), StringUtils::ToWstring(replacedText));
+
+    /**
+     * @tc.steps: step2. set another text and reset the value.
+     * @tc.expected: the utf-16 text is converted from the new text.
+     */
+    value.SetText(INSERT_VALUE_SINGLE_NUMBER);
+    EXPECT_EQ(value.GetWideText(), StringUtils::ToWstring(INSERT_VALUE_SINGLE_NUMBER));
+    value.Reset();
+    EXPECT_TRUE(value.GetWideText().empty());
+}
 } // namespace OHOS::Ace::NG
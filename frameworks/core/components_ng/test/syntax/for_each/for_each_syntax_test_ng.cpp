@@ -37,6 +37,8 @@ const std::list<std::string> ID_ARRAY = { "0" };
 const std::list<std::string> FOR_EACH_ARRAY = { "0", "1", "2", "3" };
 const std::list<std::string> FOR_EACH_IDS = { "0", "1", "2", "3", "4", "5" };
 constexpr int32_t FOR_EACH_NODE_ID = 1;
+constexpr int32_t KEYED_FOR_EACH_NODE_ID = 2;
+constexpr int32_t KEYED_CHILD_ID_BASE = 100;
 } // namespace
 
 class ForEachSyntaxTestNg : public testing::Test {
@@ -218,4 +220,68 @@ HWTEST_F(ForEachSyntaxTestNg, ForEachSyntaxUpdateTest007, TestSize.Level1)
     auto tempIds = forEachNode->GetTempIds();
     EXPECT_TRUE(tempIds.empty());
 }
+
+/**
+ * @tc.name: ForEachSyntaxUpdateTest008
+ * @tc.desc: Update ForEach with inserted, removed and moved items.
+ * @tc.type: FUNC
+ */
+HWTEST_F(ForEachSyntaxTestNg, ForEachSyntaxUpdateTest008, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. Create ForEach with items a, b, c, d under a parent.
+     */
+    auto parent = AceType::MakeRefPtr<FrameNode>(NODE_TAG, -1, AceType::MakeRefPtr<Pattern>());
+    auto forEachNode = ForEachNode::GetOrCreateForEachNode(KEYED_FOR_EACH_NODE_ID);
+    parent->AddChild(forEachNode);
+    std::list<std::string> oldIds = { "a", "b", "c", "d" };
+    for (int32_t i = 0; i < static_cast<int32_t>(oldIds.size()); ++i) {
+        forEachNode->AddChild(
+            AceType::MakeRefPtr<FrameNode>(NODE_TAG, KEYED_CHILD_ID_BASE + i, AceType::MakeRefPtr<Pattern>()));
+    }
+    forEachNode->SetIds(std::move(oldIds));
+
+    /**
+     * @tc.steps: step2. Insert e at front, remove d and move b behind c.
+     * @tc.expected: old children are reused in the new order, parent is updated from the first item.
+     */
+    forEachNode->CreateTempItems();
+    constexpr int32_t newChildId = KEYED_CHILD_ID_BASE + 4;
+    forEachNode->AddChild(AceType::MakeRefPtr<FrameNode>(NODE_TAG, newChildId, AceType::MakeRefPtr<Pattern>()));
+    forEachNode->SetIds({ "e", "a", "c", "b" });
+    forEachNode->CompareAndUpdateChildren();
+    std::vector<int32_t> childIds;
+    for (const auto& child : forEachNode->GetChildren()) {
+        childIds.emplace_back(child->GetId());
+    }
+    std::vector<int32_t> expectedIds = { newChildId, KEYED_CHILD_ID_BASE, KEYED_CHILD_ID_BASE + 2,
+        KEYED_CHILD_ID_BASE + 1 };
+    EXPECT_EQ(childIds, expectedIds);
+    EXPECT_EQ(parent->GetChildrenUpdated(), 0);
+    EXPECT_TRUE(forEachNode->GetTempIds().empty());
+
+    /**
+     * @tc.steps: step3. Append f at the end.
+     * @tc.expected: parent is updated from the appended item only.
+     */
+    parent->ChildrenUpdatedFrom(-1);
+    forEachNode->CreateTempItems();
+    forEachNode->AddChild(AceType::MakeRefPtr<FrameNode>(NODE_TAG, newChildId + 1, AceType::MakeRefPtr<Pattern>()));
+    forEachNode->SetIds({ "e", "a", "c", "b", "f" });
+    forEachNode->CompareAndUpdateChildren();
+    EXPECT_EQ(forEachNode->GetChildren().size(), expectedIds.size() + 1);
+    EXPECT_EQ(forEachNode->GetChildren().back()->GetId(), newChildId + 1);
+    EXPECT_EQ(parent->GetChildrenUpdated(), static_cast<int32_t>(expectedIds.size()));
+
+    /**
+     * @tc.steps: step4. Update with same ids.
+     * @tc.expected: children are kept and parent is not updated.
+     */
+    parent->ChildrenUpdatedFrom(-1);
+    forEachNode->CreateTempItems();
+    forEachNode->SetIds({ "e", "a", "c", "b", "f" });
+    forEachNode->CompareAndUpdateChildren();
+    EXPECT_EQ(forEachNode->GetChildren().size(), expectedIds.size() + 1);
+    EXPECT_EQ(parent->GetChildrenUpdated(), -1);
+}
 } // namespace OHOS::Ace::NG
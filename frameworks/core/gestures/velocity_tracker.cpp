@@ -15,9 +15,140 @@
 
 #include "core/gestures/velocity_tracker.h"
 
+#include <algorithm>
 #include <chrono>
+#include <cmath>
+
+#include "base/utils/utils.h"
 
 namespace OHOS::Ace {
+namespace {
+
+constexpr size_t MIN_WINDOW_SIZE = 2;
+// time differences below this (in seconds) are treated as the same instant.
+constexpr double TIME_EPSILON = 1e-6;
+constexpr double DETERMINANT_EPSILON = 1e-9;
+
+// Slope of the linear least square fit of the points.
+double EstimateByLinearFit(const double* times, const double* values, size_t count)
+{
+    double sumT = 0.0;
+    double sumV = 0.0;
+    double sumTT = 0.0;
+    double sumTV = 0.0;
+    for (size_t i = 0; i < count; ++i) {
+        sumT += times[i];
+        sumV += values[i];
+        sumTT += times[i] * times[i];
+        sumTV += times[i] * values[i];
+    }
+    double denominator = count * sumTT - sumT * sumT;
+    if (NearZero(denominator, TIME_EPSILON * TIME_EPSILON)) {
+        return 0.0;
+    }
+    return (count * sumTV - sumT * sumV) / denominator;
+}
+
+// The times end with the last point at 0, so the velocity is the linear term a1 of a0 + a1 * t + a2 * t^2.
+double EstimateByLeastSquares(const double* times, const double* values, size_t count)
+{
+    if (count == MIN_WINDOW_SIZE) {
+        return (values[1] - values[0]) / (times[1] - times[0]);
+    }
+    // scale the times into [-1, 0] to keep the normal equations well conditioned.
+    double span = -times[0];
+    double s1 = 0.0;
+    double s2 = 0.0;
+    double s3 = 0.0;
+    double s4 = 0.0;
+    double v0 = 0.0;
+    double v1 = 0.0;
+    double v2 = 0.0;
+    for (size_t i = 0; i < count; ++i) {
+        double t = times[i] / span;
+        double tt = t * t;
+        s1 += t;
+        s2 += tt;
+        s3 += tt * t;
+        s4 += tt * tt;
+        v0 += values[i];
+        v1 += t * values[i];
+        v2 += tt * values[i];
+    }
+    double s0 = static_cast<double>(count);
+    // Cramer's rule on | s0 s1 s2 | s1 s2 s3 | s2 s3 s4 | * (a0, a1, a2) = (v0, v1, v2).
+    double determinant = s0 * (s2 * s4 - s3 * s3) - s1 * (s1 * s4 - s3 * s2) + s2 * (s1 * s3 - s2 * s2);
+    if (NearZero(determinant, DETERMINANT_EPSILON)) {
+        return EstimateByLinearFit(times, values, count);
+    }
+    double linear = s0 * (v1 * s4 - s3 * v2) - v0 * (s1 * s4 - s3 * s2) + s2 * (s1 * v2 - v1 * s2);
+    return linear / determinant / span;
+}
+
+double KineticEnergyToVelocity(double work)
+{
+    static const double sqrt2 = std::sqrt(2.0);
+    return std::copysign(sqrt2 * std::sqrt(std::abs(work)), work);
+}
+
+// Every stroke changes the kinetic energy of a unit mass, from the velocity it has so far to the stroke velocity.
+double EstimateByImpulse(const double* times, const double* values, size_t count)
+{
+    double work = 0.0;
+    bool isFirstStroke = true;
+    for (size_t i = 1; i < count; ++i) {
+        double duration = times[i] - times[i - 1];
+        if (duration < TIME_EPSILON) {
+            continue;
+        }
+        double previous = KineticEnergyToVelocity(work);
+        double current = (values[i] - values[i - 1]) / duration;
+        work += (current - previous) * std::abs(current);
+        if (isFirstStroke) {
+            // the content starts at rest, so the first stroke transfers half of its energy.
+            work *= 0.5;
+            isFirstStroke = false;
+        }
+    }
+    return KineticEnergyToVelocity(work);
+}
+
+double EstimateByWeightedRecent(const double* times, const double* values, size_t count)
+{
+    double weightedSum = 0.0;
+    double weightSum = 0.0;
+    for (size_t i = 1; i < count; ++i) {
+        double duration = times[i] - times[i - 1];
+        if (duration < TIME_EPSILON) {
+            continue;
+        }
+        auto weight = static_cast<double>(i);
+        weightedSum += weight * (values[i] - values[i - 1]) / duration;
+        weightSum += weight;
+    }
+    return NearZero(weightSum, TIME_EPSILON) ? 0.0 : weightedSum / weightSum;
+}
+
+double Estimate(VelocityEstimatorType type, const double* times, const double* values, size_t count)
+{
+    switch (type) {
+        case VelocityEstimatorType::IMPULSE:
+            return EstimateByImpulse(times, values, count);
+        case VelocityEstimatorType::WEIGHTED_RECENT:
+            return EstimateByWeightedRecent(times, values, count);
+        case VelocityEstimatorType::LEAST_SQUARES:
+        default:
+            return EstimateByLeastSquares(times, values, count);
+    }
+}
+
+} // namespace
+
+void VelocityTracker::SetWindowSize(size_t windowSize)
+{
+    windowSize_ = std::clamp(windowSize, MIN_WINDOW_SIZE, HISTORY_SIZE);
+    isVelocityDone_ = false;
+}
 
 void VelocityTracker::UpdateTouchPoint(const TouchEvent& event, bool end)
 {
@@ -40,9 +171,14 @@ void VelocityTracker::UpdateTouchPoint(const TouchEvent& event, bool end)
     }
     // nanoseconds duration to seconds.
     std::chrono::duration<double> duration = event.time - firstTrackPoint_.time;
-    auto seconds = duration.count();
-    xAxis_.UpdatePoint(seconds, event.x);
-    yAxis_.UpdatePoint(seconds, event.y);
+    AddTrackPoint(duration.count(), event.x, event.y);
+}
+
+void VelocityTracker::AddTrackPoint(double time, double x, double y)
+{
+    trackIndex_ = (trackCount_ == 0) ? 0 : (trackIndex_ + 1) % HISTORY_SIZE;
+    trackPoints_[trackIndex_] = { time, x, y };
+    trackCount_ = std::min(trackCount_ + 1, HISTORY_SIZE);
 }
 
 void VelocityTracker::UpdateVelocity()
@@ -50,24 +186,37 @@ void VelocityTracker::UpdateVelocity()
     if (isVelocityDone_) {
         return;
     }
-    // the least square method three params curve is 0 * x^3 + a2 * x^2 + a1 * x + a0
-    // the velocity is 2 * a2 * x + a1;
-    static const int32_t linearParam = 2;
-    std::vector<double> xAxis { 3, 0 };
-    auto xValue = xAxis_.GetXVals().back();
-    double xVelocity = 0.0;
-    if (xAxis_.GetLeastSquareParams(xAxis)) {
-        xVelocity = linearParam * xAxis[0] * xValue + xAxis[1];
+    isVelocityDone_ = true;
+    velocity_.Reset();
+    // gather the points in the window from the oldest one, with times relative to the last point.
+    const auto& last = trackPoints_[trackIndex_];
+    size_t count = 0;
+    size_t limit = std::min(trackCount_, windowSize_);
+    while (count < limit) {
+        const auto& point = trackPoints_[(trackIndex_ + HISTORY_SIZE - count) % HISTORY_SIZE];
+        if (last.time - point.time > horizon_) {
+            break;
+        }
+        ++count;
+    }
+    if (count < MIN_WINDOW_SIZE) {
+        return;
+    }
+    double times[HISTORY_SIZE];
+    double xVals[HISTORY_SIZE];
+    double yVals[HISTORY_SIZE];
+    for (size_t i = 0; i < count; ++i) {
+        const auto& point = trackPoints_[(trackIndex_ + HISTORY_SIZE - (count - 1 - i)) % HISTORY_SIZE];
+        times[i] = point.time - last.time;
+        xVals[i] = point.x;
+        yVals[i] = point.y;
     }
-    std::vector<double> yAxis { 3, 0 };
-    auto yValue = yAxis_.GetXVals().back();
-    double yVelocity = 0.0;
-    if (yAxis_.GetLeastSquareParams(yAxis)) {
-        yVelocity = linearParam * yAxis[0] * yValue + yAxis[1];
+    if (-times[0] < TIME_EPSILON) {
+        return;
     }
-
+    double xVelocity = Estimate(estimatorType_, times, xVals, count);
+    double yVelocity = Estimate(estimatorType_, times, yVals, count);
     velocity_.SetOffsetPerSecond({ xVelocity, yVelocity });
-    isVelocityDone_ = true;
 }
 
 } // namespace OHOS::Ace
@@ -16,18 +16,38 @@
 #ifndef FOUNDATION_ACE_FRAMEWORKS_CORE_GESTURES_VELOCITY_TRACKER_H
 #define FOUNDATION_ACE_FRAMEWORKS_CORE_GESTURES_VELOCITY_TRACKER_H
 
+#include <array>
+
 #include "base/geometry/axis.h"
-#include "base/geometry/least_square_impl.h"
 #include "base/geometry/offset.h"
 #include "core/event/touch_event.h"
 #include "core/gestures/velocity.h"
 
 namespace OHOS::Ace {
 
+enum class VelocityEstimatorType {
+    // Quadratic least square fit of the recent points, the velocity is its slope at the last point.
+    LEAST_SQUARES = 0,
+    // Kinetic energy the finger transferred to the content, stroke by stroke.
+    IMPULSE,
+    // Average velocity of the strokes, weighted linearly toward the last one.
+    WEIGHTED_RECENT,
+};
+
+// Tracks the touch points of one finger in a fixed ring buffer, so that no memory is allocated per touch point.
 class VelocityTracker final {
 public:
+    // Capacity of the ring buffer, the most points an estimator can use.
+    static constexpr size_t HISTORY_SIZE = 20;
+    static constexpr size_t DEFAULT_WINDOW_SIZE = 5;
+    // Points older than this (in seconds) relative to the last point are ignored.
+    static constexpr double DEFAULT_HORIZON = 0.1;
+
     VelocityTracker() = default;
     explicit VelocityTracker(Axis mainAxis) : mainAxis_(mainAxis) {}
+    VelocityTracker(Axis mainAxis, VelocityEstimatorType estimatorType)
+        : mainAxis_(mainAxis), estimatorType_(estimatorType)
+    {}
     ~VelocityTracker() = default;
 
     void Reset()
@@ -36,8 +56,9 @@ public:
         velocity_.Reset();
         delta_.Reset();
         isFirstPoint_ = true;
-        xAxis_.Reset();
-        yAxis_.Reset();
+        trackCount_ = 0;
+        trackIndex_ = 0;
+        isVelocityDone_ = false;
     }
 
     void UpdateTouchPoint(const TouchEvent& event, bool end = false);
@@ -73,6 +94,42 @@ public:
         mainAxis_ = axis;
     }
 
+    void SetEstimatorType(VelocityEstimatorType estimatorType)
+    {
+        estimatorType_ = estimatorType;
+        isVelocityDone_ = false;
+    }
+
+    VelocityEstimatorType GetEstimatorType() const
+    {
+        return estimatorType_;
+    }
+
+    // Set the number of recent points the estimator uses, in [2, HISTORY_SIZE].
+    void SetWindowSize(size_t windowSize);
+
+    size_t GetWindowSize() const
+    {
+        return windowSize_;
+    }
+
+    // Set the time range in seconds, ending at the last point, the estimator uses.
+    void SetHorizon(double horizon)
+    {
+        horizon_ = horizon;
+        isVelocityDone_ = false;
+    }
+
+    double GetHorizon() const
+    {
+        return horizon_;
+    }
+
+    size_t GetTrackCount() const
+    {
+        return trackCount_;
+    }
+
     double GetMainAxisPos() const
     {
         switch (mainAxis_) {
@@ -117,6 +174,14 @@ public:
     }
 
 private:
+    struct TrackPoint {
+        // seconds since the first track point.
+        double time = 0.0;
+        double x = 0.0;
+        double y = 0.0;
+    };
+
+    void AddTrackPoint(double time, double x, double y);
     void UpdateVelocity();
 
     Axis mainAxis_ { Axis::FREE };
@@ -128,8 +193,13 @@ private:
     Offset offset_;
     bool isFirstPoint_ = true;
     TimeStamp lastTimePoint_;
-    LeastSquareImpl xAxis_ { 3, 5 };
-    LeastSquareImpl yAxis_ { 3, 5 };
+    VelocityEstimatorType estimatorType_ = VelocityEstimatorType::LEAST_SQUARES;
+    size_t windowSize_ = DEFAULT_WINDOW_SIZE;
+    double horizon_ = DEFAULT_HORIZON;
+    std::array<TrackPoint, HISTORY_SIZE> trackPoints_;
+    // index of the last point in trackPoints_.
+    size_t trackIndex_ = 0;
+    size_t trackCount_ = 0;
     bool isVelocityDone_ = false;
 };
 
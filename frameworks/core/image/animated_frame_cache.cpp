@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "core/image/animated_frame_cache.h"
+
+#include "base/log/log.h"
+#include "base/utils/utils.h"
+
+namespace OHOS::Ace {
+
+AnimatedFrameCache& AnimatedFrameCache::GetInstance()
+{
+    static AnimatedFrameCache instance;
+    return instance;
+}
+
+sk_sp<SkImage> AnimatedFrameCache::Get(const std::string& key, uint32_t idx)
+{
+    std::scoped_lock<std::mutex> lock(mutex_);
+    auto iter = index_.find(MakeKey(key, idx));
+    if (iter == index_.end()) {
+        return nullptr;
+    }
+    // move to front
+    frames_.splice(frames_.begin(), frames_, iter->second);
+    return iter->second->image;
+}
+
+bool AnimatedFrameCache::Contains(const std::string& key, uint32_t idx) const
+{
+    std::scoped_lock<std::mutex> lock(mutex_);
+    return index_.find(MakeKey(key, idx)) != index_.end();
+}
+
+void AnimatedFrameCache::Put(const std::string& key, uint32_t idx, const sk_sp<SkImage>& frame)
+{
+    CHECK_NULL_VOID_NOLOG(frame);
+    auto bytes = frame->imageInfo().computeMinByteSize();
+    std::scoped_lock<std::mutex> lock(mutex_);
+    if (bytes > budget_) {
+        LOGD("frame of %{private}s is larger than cache budget, size = %{public}zu", key.c_str(), bytes);
+        return;
+    }
+    auto frameKey = MakeKey(key, idx);
+    auto iter = index_.find(frameKey);
+    if (iter != index_.end()) {
+        usedBytes_ -= iter->second->bytes;
+        frames_.erase(iter->second);
+        index_.erase(iter);
+    }
+    TrimLocked(budget_ - bytes);
+    frames_.push_front({ frameKey, frame, bytes });
+    index_[frameKey] = frames_.begin();
+    usedBytes_ += bytes;
+}
+
+bool AnimatedFrameCache::BeginDecode(const std::string& key, uint32_t idx)
+{
+    auto frameKey = MakeKey(key, idx);
+    std::scoped_lock<std::mutex> lock(mutex_);
+    if (index_.find(frameKey) != index_.end()) {
+        return false;
+    }
+    return decoding_.emplace(frameKey).second;
+}
+
+void AnimatedFrameCache::EndDecode(const std::string& key, uint32_t idx)
+{
+    std::scoped_lock<std::mutex> lock(mutex_);
+    decoding_.erase(MakeKey(key, idx));
+}
+
+void AnimatedFrameCache::SetBudget(size_t budget)
+{
+    std::scoped_lock<std::mutex> lock(mutex_);
+    budget_ = budget;
+    TrimLocked(budget_);
+}
+
+void AnimatedFrameCache::Trim(size_t bytes)
+{
+    std::scoped_lock<std::mutex> lock(mutex_);
+    TrimLocked(bytes);
+}
+
+void AnimatedFrameCache::Clear()
+{
+    std::scoped_lock<std::mutex> lock(mutex_);
+    LOGI("clear animated frame cache, frames = %{public}zu, size = %{public}zu", frames_.size(), usedBytes_);
+    frames_.clear();
+    index_.clear();
+    usedBytes_ = 0;
+}
+
+void AnimatedFrameCache::TrimLocked(size_t bytes)
+{
+    while (usedBytes_ > bytes && !frames_.empty()) {
+        auto& frame = frames_.back();
+        usedBytes_ -= frame.bytes;
+        index_.erase(frame.key);
+        frames_.pop_back();
+    }
+}
+
+} // namespace OHOS::Ace
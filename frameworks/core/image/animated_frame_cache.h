@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_ACE_FRAMEWORKS_CORE_IMAGE_ANIMATED_FRAME_CACHE_H
+#define FOUNDATION_ACE_FRAMEWORKS_CORE_IMAGE_ANIMATED_FRAME_CACHE_H
+
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "include/core/SkImage.h"
+
+#include "base/utils/noncopyable.h"
+
+namespace OHOS::Ace {
+
+// Decoded frames of animated images (gif / webp / apng) shared by every image showing the same source at the
+// same size, so repeated stickers decode each frame only once. Frames are evicted in LRU order when the
+// decoded bytes exceed the budget, and dropped entirely on memory pressure.
+class AnimatedFrameCache final {
+public:
+    static AnimatedFrameCache& GetInstance();
+
+    AnimatedFrameCache() = default;
+    ~AnimatedFrameCache() = default;
+
+    // [key] identifies source and target size of the animated image
+    sk_sp<SkImage> Get(const std::string& key, uint32_t idx);
+    bool Contains(const std::string& key, uint32_t idx) const;
+    void Put(const std::string& key, uint32_t idx, const sk_sp<SkImage>& frame);
+
+    // Reserve a frame for decoding, fails if it's already cached or being decoded by another image.
+    bool BeginDecode(const std::string& key, uint32_t idx);
+    void EndDecode(const std::string& key, uint32_t idx);
+
+    void SetBudget(size_t budget);
+    // evict frames until decoded bytes are not larger than [bytes]
+    void Trim(size_t bytes);
+    void Clear();
+
+    size_t GetUsedBytes() const
+    {
+        std::scoped_lock<std::mutex> lock(mutex_);
+        return usedBytes_;
+    }
+
+private:
+    static constexpr size_t DEFAULT_BUDGET = 32 * 1024 * 1024;
+
+    struct Frame {
+        std::string key;
+        sk_sp<SkImage> image;
+        size_t bytes = 0;
+    };
+
+    static std::string MakeKey(const std::string& key, uint32_t idx)
+    {
+        return key + "#" + std::to_string(idx);
+    }
+
+    void TrimLocked(size_t bytes);
+
+    mutable std::mutex mutex_;
+    // most recently used frame at front
+    std::list<Frame> frames_;
+    std::unordered_map<std::string, std::list<Frame>::iterator> index_;
+    std::unordered_set<std::string> decoding_;
+    size_t usedBytes_ = 0;
+    size_t budget_ = DEFAULT_BUDGET;
+
+    ACE_DISALLOW_COPY_AND_MOVE(AnimatedFrameCache);
+};
+
+} // namespace OHOS::Ace
+
+#endif // FOUNDATION_ACE_FRAMEWORKS_CORE_IMAGE_ANIMATED_FRAME_CACHE_H
@@ -22,6 +22,7 @@
 #include "base/log/log.h"
 #include "base/memory/ace_type.h"
 #include "core/components_ng/render/canvas_image.h"
+#include "core/image/animated_frame_cache.h"
 #include "core/image/image_provider.h"
 
 namespace OHOS::Ace {
@@ -52,9 +53,16 @@ void AnimatedImagePlayer::RenderFrame(const int32_t& index)
                 return;
             }
 
-            sk_sp<SkImage> skImage = player->DecodeFrameImage(index);
-            if (dstWidth > 0 && dstHeight > 0) {
-                skImage = ImageProvider::ApplySizeToSkImage(skImage, dstWidth, dstHeight);
+            // frames are shared with other players of the same source and size
+            auto& frameCache = AnimatedFrameCache::GetInstance();
+            auto cacheKey = player->imageSource_.GetKey() + std::to_string(dstWidth) + "x" + std::to_string(dstHeight);
+            sk_sp<SkImage> skImage = frameCache.Get(cacheKey, index);
+            if (!skImage) {
+                skImage = player->DecodeFrameImage(index);
+                if (dstWidth > 0 && dstHeight > 0) {
+                    skImage = ImageProvider::ApplySizeToSkImage(skImage, dstWidth, dstHeight);
+                }
+                frameCache.Put(cacheKey, index, skImage);
             }
             if (!skImage) {
                 LOGW("animated player cannot get the %{public}d skImage!", index);
@@ -18,6 +18,7 @@
 #include "include/core/SkGraphics.h"
 
 #include "core/components_ng/image_provider/image_object.h"
+#include "core/image/animated_frame_cache.h"
 
 namespace OHOS::Ace {
 
@@ -50,6 +51,8 @@ RefPtr<CachedImageData> FlutterImageCache::GetDataFromCacheFile(const std::strin
 void ImageCache::Purge()
 {
     SkGraphics::PurgeResourceCache();
+    // decoded animation frames can be decoded again when needed
+    AnimatedFrameCache::GetInstance().Clear();
 }
 
 } // namespace OHOS::Ace
\ No newline at end of file
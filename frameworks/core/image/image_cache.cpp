@@ -273,6 +273,22 @@ void ImageCache::WriteCacheFile(const std::string& url, const void* const data,
     ClearCacheFile(removeVector);
 }
 
+void ImageCache::RemoveCacheFile(const std::string& url, const std::string& suffix)
+{
+    std::string cacheNetworkFilePath = GetImageCacheFilePath(url) + suffix;
+    {
+        std::lock_guard<std::mutex> lock(cacheFileInfoMutex_);
+        auto iter = std::find_if(cacheFileInfo_.begin(), cacheFileInfo_.end(),
+            [&cacheNetworkFilePath](const FileInfo& fileInfo) { return fileInfo.filePath == cacheNetworkFilePath; });
+        if (iter == cacheFileInfo_.end()) {
+            return;
+        }
+        cacheFileSize_ -= static_cast<int32_t>(iter->fileSize);
+        cacheFileInfo_.erase(iter);
+    }
+    ClearCacheFile({ cacheNetworkFilePath });
+}
+
 void ImageCache::ClearCacheFile(const std::vector<std::string>& removeFiles)
 {
     LOGD("begin to clear %{public}zu files: ", removeFiles.size());
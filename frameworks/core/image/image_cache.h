@@ -104,6 +104,8 @@ public:
     static void SetCacheFileInfo();
     static void WriteCacheFile(
         const std::string& url, const void* data, size_t size, const std::string& suffix = std::string());
+    // Removes the cache file of [url], e.g. when its data turns out to be invalid.
+    static void RemoveCacheFile(const std::string& url, const std::string& suffix = std::string());
 
     void SetCapacity(size_t capacity)
     {
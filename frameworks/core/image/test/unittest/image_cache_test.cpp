@@ -15,12 +15,30 @@
 
 #include "core/image/test/unittest/image_cache_test.h"
 
+#include <unistd.h>
+
 #include "gtest/gtest.h"
+#include "include/core/SkData.h"
 
 using namespace testing;
 using namespace testing::ext;
 
 namespace OHOS::Ace {
+namespace {
+constexpr int32_t FRAME_SIZE = 10;
+const std::string FRAME_KEY = "sticker.gif10x10";
+
+sk_sp<SkImage> CreateFrame(int32_t width = FRAME_SIZE, int32_t height = FRAME_SIZE)
+{
+    auto info = SkImageInfo::MakeN32Premul(width, height);
+    return SkImage::MakeRasterData(info, SkData::MakeUninitialized(info.computeMinByteSize()), info.minRowBytes());
+}
+
+size_t GetFrameBytes()
+{
+    return SkImageInfo::MakeN32Premul(FRAME_SIZE, FRAME_SIZE).computeMinByteSize();
+}
+} // namespace
 
 class ImageCacheTest : public testing::Test {
 public:
@@ -296,4 +314,152 @@ HWTEST_F(ImageCacheTest, FileCache004, TestSize.Level1)
     ASSERT_LE(ImageCache::cacheFileSize_, FILE_SIZE);
 }
 
+/**
+ * @tc.name: FileCache005
+ * @tc.desc: remove a cache file, e.g. of invalid data, from cacheFilePath and the file info.
+ * @tc.type: FUNC
+ */
+HWTEST_F(ImageCacheTest, FileCache005, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. write a cache file with a suffix.
+     */
+    ImageCache::SetCacheFileLimit(FILE_SIZE * TEST_COUNT);
+    std::vector<uint8_t> fontData = { 1, 2, 3, 4 };
+    std::string url = "http:/testfilecache005/font";
+    ImageCache::WriteCacheFile(url, fontData.data(), fontData.size(), ".font");
+    auto filePath = ImageCache::GetImageCacheFilePath(url) + ".font";
+    ASSERT_TRUE(ImageCache::GetFromCacheFile(filePath));
+    auto cacheFileSize = ImageCache::cacheFileSize_;
+
+    /**
+     * @tc.steps: step2. call RemoveCacheFile().
+     * @tc.expected: the file info and the size of the file are removed, and the file is deleted.
+     */
+    ImageCache::RemoveCacheFile(url, ".font");
+    ASSERT_FALSE(ImageCache::GetFromCacheFile(filePath));
+    ASSERT_EQ(ImageCache::cacheFileSize_, cacheFileSize - static_cast<int32_t>(fontData.size()));
+    ASSERT_NE(access(filePath.c_str(), F_OK), 0);
+}
+
+/**
+ * @tc.name: AnimatedFrameCache001
+ * @tc.desc: decoded frames are evicted in LRU order when the budget is exceeded.
+ * @tc.type: FUNC
+ */
+HWTEST_F(ImageCacheTest, AnimatedFrameCache001, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. cache three frames in a budget of three frames, then get the first one.
+     */
+    AnimatedFrameCache cache;
+    cache.SetBudget(GetFrameBytes() * 3);
+    for (uint32_t idx = 0; idx < 3; ++idx) {
+        cache.Put(FRAME_KEY, idx, CreateFrame());
+    }
+    ASSERT_EQ(cache.GetUsedBytes(), GetFrameBytes() * 3);
+    ASSERT_NE(cache.Get(FRAME_KEY, 0), nullptr);
+    ASSERT_EQ(cache.Get(FRAME_KEY, 3), nullptr);
+
+    /**
+     * @tc.steps: step2. cache two more frames.
+     * @tc.expected: the least recently used frames 1 and 2 are evicted, frame 0 is kept.
+     */
+    cache.Put(FRAME_KEY, 3, CreateFrame());
+    ASSERT_FALSE(cache.Contains(FRAME_KEY, 1));
+    ASSERT_TRUE(cache.Contains(FRAME_KEY, 2));
+    cache.Put(FRAME_KEY, 4, CreateFrame());
+    ASSERT_FALSE(cache.Contains(FRAME_KEY, 2));
+    ASSERT_TRUE(cache.Contains(FRAME_KEY, 0));
+    ASSERT_TRUE(cache.Contains(FRAME_KEY, 3));
+    ASSERT_TRUE(cache.Contains(FRAME_KEY, 4));
+    ASSERT_EQ(cache.frames_.front().key, FRAME_KEY + "#4");
+    ASSERT_EQ(cache.frames_.back().key, FRAME_KEY + "#0");
+    ASSERT_EQ(cache.GetUsedBytes(), GetFrameBytes() * 3);
+}
+
+/**
+ * @tc.name: AnimatedFrameCache002
+ * @tc.desc: decoded bytes of the cached frames never exceed the budget.
+ * @tc.type: FUNC
+ */
+HWTEST_F(ImageCacheTest, AnimatedFrameCache002, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. cache three frames, then put one of them again.
+     * @tc.expected: the frame replaced is counted once.
+     */
+    AnimatedFrameCache cache;
+    cache.SetBudget(GetFrameBytes() * 3);
+    for (uint32_t idx = 0; idx < 3; ++idx) {
+        cache.Put(FRAME_KEY, idx, CreateFrame());
+    }
+    cache.Put(FRAME_KEY, 0, CreateFrame());
+    ASSERT_EQ(cache.GetUsedBytes(), GetFrameBytes() * 3);
+    ASSERT_EQ(cache.frames_.size(), 3);
+
+    /**
+     * @tc.steps: step2. shrink the budget to two frames.
+     * @tc.expected: the least recently used frame 1 is evicted.
+     */
+    cache.SetBudget(GetFrameBytes() * 2);
+    ASSERT_EQ(cache.GetUsedBytes(), GetFrameBytes() * 2);
+    ASSERT_FALSE(cache.Contains(FRAME_KEY, 1));
+
+    /**
+     * @tc.steps: step3. put a frame larger than the budget.
+     * @tc.expected: it isn't cached and no frame is evicted for it.
+     */
+    cache.Put(FRAME_KEY, 5, CreateFrame(FRAME_SIZE * 2, FRAME_SIZE * 2));
+    ASSERT_FALSE(cache.Contains(FRAME_KEY, 5));
+    ASSERT_EQ(cache.GetUsedBytes(), GetFrameBytes() * 2);
+
+    /**
+     * @tc.steps: step4. trim the cache to one frame, then to nothing.
+     */
+    cache.Trim(GetFrameBytes());
+    ASSERT_EQ(cache.GetUsedBytes(), GetFrameBytes());
+    ASSERT_TRUE(cache.Contains(FRAME_KEY, 0));
+    cache.Trim(0);
+    ASSERT_EQ(cache.GetUsedBytes(), 0);
+    ASSERT_TRUE(cache.frames_.empty() && cache.index_.empty());
+}
+
+/**
+ * @tc.name: AnimatedFrameCache003
+ * @tc.desc: frames are reserved for decoding once, and Clear drops every cached frame.
+ * @tc.type: FUNC
+ */
+HWTEST_F(ImageCacheTest, AnimatedFrameCache003, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. reserve a frame for decoding twice.
+     * @tc.expected: only the first reservation succeeds until the decoding ends.
+     */
+    AnimatedFrameCache cache;
+    ASSERT_TRUE(cache.BeginDecode(FRAME_KEY, 0));
+    ASSERT_FALSE(cache.BeginDecode(FRAME_KEY, 0));
+    ASSERT_TRUE(cache.BeginDecode(FRAME_KEY, 1));
+    cache.Put(FRAME_KEY, 0, CreateFrame());
+    cache.EndDecode(FRAME_KEY, 0);
+
+    /**
+     * @tc.steps: step2. reserve the decoded frame again.
+     * @tc.expected: it fails because the frame is cached.
+     */
+    ASSERT_FALSE(cache.BeginDecode(FRAME_KEY, 0));
+
+    /**
+     * @tc.steps: step3. clear the cache.
+     * @tc.expected: the cached frames are dropped, the frame still being decoded stays reserved.
+     */
+    cache.Clear();
+    ASSERT_EQ(cache.GetUsedBytes(), 0);
+    ASSERT_EQ(cache.Get(FRAME_KEY, 0), nullptr);
+    ASSERT_TRUE(cache.BeginDecode(FRAME_KEY, 0));
+    ASSERT_FALSE(cache.BeginDecode(FRAME_KEY, 1));
+    cache.EndDecode(FRAME_KEY, 1);
+    ASSERT_TRUE(cache.BeginDecode(FRAME_KEY, 1));
+}
+
 } // namespace OHOS::Ace
\ No newline at end of file
@@ -18,6 +18,7 @@
 
 #define private public
 #define protected public
+#include "core/image/animated_frame_cache.h"
 #include "core/image/flutter_image_cache.h"
 
 namespace OHOS::Ace {
@@ -15,6 +15,9 @@
 
 #include "core/pipeline/base/component_group_element.h"
 
+#include <algorithm>
+#include <unordered_map>
+
 #include "base/log/log.h"
 #include "base/utils/macros.h"
 #include "base/utils/utils.h"
@@ -24,6 +27,33 @@
 #include "core/pipeline/base/multi_composed_component.h"
 
 namespace OHOS::Ace {
+namespace {
+
+const ComposeId EMPTY_KEY;
+
+// Ids of composed components (dom node id of js frontend, view id of declarative frontend) stay the same across
+// updates, so they are used as keys of children. Other children are matched by position.
+const ComposeId& GetChildKey(const RefPtr<Element>& child)
+{
+    auto composedChild = AceType::DynamicCast<ComposedElement>(child);
+    return composedChild ? composedChild->GetId() : EMPTY_KEY;
+}
+
+const ComposeId& GetChildKey(const RefPtr<Component>& component)
+{
+    auto composedComponent = AceType::DynamicCast<ComposedComponent>(component);
+    return composedComponent ? composedComponent->GetId() : EMPTY_KEY;
+}
+
+bool HasKeyedComponent(
+    std::list<RefPtr<Component>>::const_iterator begin, std::list<RefPtr<Component>>::const_iterator end)
+{
+    return std::any_of(begin, end, [](const RefPtr<Component>& component) {
+        return !GetChildKey(component).empty();
+    });
+}
+
+} // namespace
 
 RefPtr<Element> ComponentGroupElement::Create()
 {
@@ -58,10 +88,15 @@ void ComponentGroupElement::UpdateChildren(const std::list<RefPtr<Component>>& n
     auto itChildEnd = children_.end();
     auto itComponent = newComponents.begin();
     auto itComponentEnd = newComponents.end();
+    int32_t slot = 0;
 
     while (itChild != itChildEnd && itComponent != itComponentEnd) {
         const auto& child = *itChild;
         const auto& component = *itComponent;
+        const auto& key = GetChildKey(component);
+        if (!key.empty() && key != GetChildKey(child)) {
+            break;
+        }
         if (child->NeedUpdateWithComponent(component)) {
             if (!child->CanUpdate(component)) {
                 break;
@@ -70,6 +105,13 @@ void ComponentGroupElement::UpdateChildren(const std::list<RefPtr<Component>>& n
         }
         ++itChild;
         ++itComponent;
+        ++slot;
+    }
+
+    if (itChild != itChildEnd && itComponent != itComponentEnd && HasKeyedComponent(itComponent, itComponentEnd)) {
+        std::vector<RefPtr<Element>> oldChildren(itChild, itChildEnd);
+        UpdateChildrenWithKey(oldChildren, { itComponent, itComponentEnd }, slot, false);
+        return;
     }
 
     // children_ will be modified during UpdateChild.(some items will be removed from children_)
@@ -106,8 +148,19 @@ void ComponentGroupElement::UpdateChildrenForDeclarative(const std::list<RefPtr<
     }
 
     // For declarative frontend, the component tree is very stable,
-    // so size of children MUST be matched between elements and components
-    if (children_.size() != newComponents.size()) {
+    // so size of children MUST be matched between elements and components, unless children are keyed.
+    bool isSizeMatched = children_.size() == newComponents.size();
+    bool isKeyMatched = isSizeMatched && std::equal(newComponents.begin(), newComponents.end(), children_.begin(),
+        [](const RefPtr<Component>& component, const RefPtr<Element>& child) {
+            const auto& key = GetChildKey(component);
+            return key.empty() || key == GetChildKey(child);
+        });
+    if (!isKeyMatched && HasKeyedComponent(newComponents.begin(), newComponents.end())) {
+        std::vector<RefPtr<Element>> oldChildren(children_.begin(), children_.end());
+        UpdateChildrenWithKey(oldChildren, { newComponents.begin(), newComponents.end() }, 0, true);
+        return;
+    }
+    if (!isSizeMatched) {
         LOGW("Size of old children and new components are mismatched");
         return;
     }
@@ -118,4 +171,80 @@ void ComponentGroupElement::UpdateChildrenForDeclarative(const std::list<RefPtr<
     }
 }
 
+void ComponentGroupElement::UpdateChildrenWithKey(const std::vector<RefPtr<Element>>& oldChildren,
+    const std::vector<RefPtr<Component>>& newComponents, int32_t startSlot, bool isDeclarative)
+{
+    std::unordered_map<ComposeId, size_t> keyedChildren;
+    std::vector<size_t> unkeyedChildren;
+    for (size_t i = 0; i < oldChildren.size(); ++i) {
+        const auto& key = GetChildKey(oldChildren[i]);
+        if (key.empty()) {
+            unkeyedChildren.emplace_back(i);
+        } else {
+            keyedChildren.emplace(key, i);
+        }
+    }
+
+    std::vector<bool> isReused(oldChildren.size(), false);
+    std::vector<RefPtr<Element>> matchedChildren(newComponents.size());
+    size_t unkeyedIndex = 0;
+    for (size_t i = 0; i < newComponents.size(); ++i) {
+        const auto& component = newComponents[i];
+        const auto& key = GetChildKey(component);
+        auto oldIndex = oldChildren.size();
+        if (!key.empty()) {
+            auto iter = keyedChildren.find(key);
+            if (iter != keyedChildren.end()) {
+                oldIndex = iter->second;
+                keyedChildren.erase(iter);
+            }
+        } else if (unkeyedIndex < unkeyedChildren.size()) {
+            oldIndex = unkeyedChildren[unkeyedIndex++];
+        }
+        if (oldIndex < oldChildren.size() && oldChildren[oldIndex]->CanUpdate(component)) {
+            matchedChildren[i] = oldChildren[oldIndex];
+            isReused[oldIndex] = true;
+        }
+    }
+
+    // Remove children which are not reused first, so they don't take the slots of the new children.
+    for (size_t i = 0; i < oldChildren.size(); ++i) {
+        if (!isReused[i]) {
+            UpdateChild(oldChildren[i], nullptr);
+        }
+    }
+
+    int32_t slot = startSlot;
+    int32_t renderSlot = 0;
+    auto itChild = children_.begin();
+    for (int32_t i = 0; i < startSlot && itChild != children_.end(); ++i) {
+        renderSlot += (*(itChild++))->CountRenderNode();
+    }
+    for (size_t i = 0; i < newComponents.size(); ++i) {
+        const auto& child = matchedChildren[i];
+        const auto& component = newComponents[i];
+        RefPtr<Element> newChild;
+        if (isDeclarative) {
+            newChild = UpdateChildWithSlot(child, component, slot, renderSlot);
+        } else {
+            newChild = child;
+            if (!child || child->NeedUpdateWithComponent(component)) {
+                newChild = UpdateChild(child, component);
+            }
+            // Children of js frontend are updated without slot, move the element and its render nodes to the new
+            // position after updating.
+            if (newChild) {
+                ChangeChildSlot(newChild, slot);
+                ChangeChildRenderSlot(newChild, renderSlot, true);
+            }
+        }
+        if (newChild) {
+            ++slot;
+            renderSlot += newChild->CountRenderNode();
+        }
+    }
+    LOGD("update children with key, old: %{public}zu, new: %{public}zu, reused: %{public}zu", oldChildren.size(),
+        newComponents.size(), static_cast<size_t>(std::count(isReused.begin(), isReused.end(), true)));
+}
+
 } // namespace OHOS::Ace
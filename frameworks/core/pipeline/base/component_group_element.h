@@ -18,6 +18,7 @@
 
 #include "core/pipeline/base/render_element.h"
 #include <map>
+#include <vector>
 
 namespace OHOS::Ace {
 
@@ -35,6 +36,13 @@ public:
 protected:
     void UpdateChildren(const std::list<RefPtr<Component>>& newComponents);
     void UpdateChildrenForDeclarative(const std::list<RefPtr<Component>>& newComponents);
+
+private:
+    // Match [oldChildren] and [newComponents] by the id of composed components, so elements are reused and moved
+    // instead of rebuilt when children are inserted, removed or reordered. Children without id are matched by
+    // position. [startSlot] is the slot of the first old child.
+    void UpdateChildrenWithKey(const std::vector<RefPtr<Element>>& oldChildren,
+        const std::vector<RefPtr<Component>>& newComponents, int32_t startSlot, bool isDeclarative);
 };
 
 } // namespace OHOS::Ace
@@ -19,6 +19,7 @@
 #include <cinttypes>
 #include <cstdint>
 #include <memory>
+#include <mutex>
 
 #ifdef ENABLE_ROSEN_BACKEND
 #include "render_service_client/core/transaction/rs_transaction.h"
@@ -34,6 +35,8 @@
 #include "base/log/dump_log.h"
 #include "base/log/event_report.h"
 #include "base/log/frame_report.h"
+#include "base/log/frame_timing.h"
+#include "base/log/frame_trace.h"
 #include "base/memory/ace_type.h"
 #include "base/memory/referenced.h"
 #include "base/ressched/ressched_report.h"
@@ -43,6 +46,7 @@
 #include "core/animation/scheduler.h"
 #include "core/common/ace_application_info.h"
 #include "core/common/container.h"
+#include "core/common/font_manager.h"
 #include "core/common/layout_inspector.h"
 #include "core/common/text_field_manager.h"
 #include "core/common/thread_checker.h"
@@ -61,6 +65,7 @@
 #include "core/components_ng/pattern/overlay/overlay_manager.h"
 #include "core/components_ng/pattern/root/root_pattern.h"
 #include "core/components_ng/pattern/stage/stage_pattern.h"
+#include "core/components_ng/pattern/text/paragraph_cache.h"
 #include "core/components_ng/pattern/text_field/text_field_manager.h"
 #include "core/components_ng/property/calc_length.h"
 #include "core/components_v2/inspector/inspector_constants.h"
@@ -190,14 +195,25 @@ void PipelineContext::FlushVsync(uint64_t nanoTimestamp, uint32_t frameCount)
 {
     CHECK_RUN_ON(UI);
     ACE_FUNCTION_TRACE();
+    ACE_FRAME_TRACE("FlushVsync");
     auto recvTime = GetSysTimestamp();
     static const std::string abilityName = AceApplicationInfo::GetInstance().GetProcessName().empty()
                                                ? AceApplicationInfo::GetInstance().GetPackageName()
                                                : AceApplicationInfo::GetInstance().GetProcessName();
     window_->RecordFrameTime(nanoTimestamp, abilityName);
-    FlushAnimation(GetTimeFromExternalTimer());
-    FlushTouchEvents();
-    FlushBuild();
+    frameTiming_.BeginFrame(nanoTimestamp, GetFrameBudget());
+    {
+        FramePhaseScope scope(&frameTiming_, FramePhase::ANIMATION);
+        FlushAnimation(GetTimeFromExternalTimer());
+    }
+    {
+        FramePhaseScope scope(&frameTiming_, FramePhase::TOUCH);
+        FlushTouchEvents();
+    }
+    {
+        FramePhaseScope scope(&frameTiming_, FramePhase::BUILD);
+        FlushBuild();
+    }
     if (isFormRender_ && drawDelegate_ && rootNode_) {
         auto renderContext = AceType::DynamicCast<NG::RenderContext>(rootNode_->GetRenderContext());
         drawDelegate_->DrawRSFrame(renderContext);
@@ -210,19 +226,30 @@ void PipelineContext::FlushVsync(uint64_t nanoTimestamp, uint32_t frameCount)
     }
 
     taskScheduler_.StartRecordFrameInfo(GetCurrentFrameInfo(recvTime, nanoTimestamp));
+    taskScheduler_.StartRecordFrameTiming(&frameTiming_);
     taskScheduler_.FlushTask();
+    taskScheduler_.FinishRecordFrameTiming();
     taskScheduler_.FinishRecordFrameInfo();
     TryCallNextFrameLayoutCallback();
-    bool hasAnimation = window_->FlushCustomAnimation(nanoTimestamp);
+    bool hasAnimation = false;
+    {
+        FramePhaseScope scope(&frameTiming_, FramePhase::ANIMATION);
+        hasAnimation = window_->FlushCustomAnimation(nanoTimestamp);
+    }
     if (hasAnimation) {
         RequestFrame();
     }
-    FlushMessages();
+    {
+        FramePhaseScope scope(&frameTiming_, FramePhase::MESSAGE);
+        FlushMessages();
+    }
     if (!isFormRender_ && onShow_ && onFocus_) {
+        FramePhaseScope scope(&frameTiming_, FramePhase::FOCUS);
         FlushFocus();
     }
     HandleOnAreaChangeEvent();
     HandleVisibleAreaChangeEvent();
+    frameTiming_.EndFrame();
     // Keep the call sent at the end of the function
     ResSchedReport::GetInstance().LoadPageEvent(ResDefine::LOAD_PAGE_COMPLETE_EVENT);
 }
@@ -231,6 +258,7 @@ void PipelineContext::FlushAnimation(uint64_t nanoTimestamp)
 {
     CHECK_RUN_ON(UI);
     ACE_FUNCTION_TRACE();
+    ACE_FRAME_TRACE("FlushAnimation");
     if (scheduleTasks_.empty()) {
         return;
     }
@@ -255,6 +283,7 @@ void PipelineContext::FlushAnimation(uint64_t nanoTimestamp)
 void PipelineContext::FlushMessages()
 {
     ACE_FUNCTION_TRACE();
+    ACE_FRAME_TRACE("FlushMessages");
     window_->FlushTasks();
 }
 
@@ -313,6 +342,7 @@ void PipelineContext::FlushPipelineWithoutAnimation()
 
 void PipelineContext::FlushBuild()
 {
+    ACE_FRAME_TRACE("FlushBuild");
     isRebuildFinished_ = false;
     FlushDirtyNodeUpdate();
     isRebuildFinished_ = true;
@@ -347,6 +377,13 @@ void PipelineContext::RegisterRootEvent()
 void PipelineContext::SetupRootElement()
 {
     CHECK_RUN_ON(UI);
+    // paragraphs cached before are shaped with fallback fonts or without the weight scale.
+    static std::once_flag onceFlag;
+    std::call_once(onceFlag, []() {
+        FontManager::SetOnFontLoaded(
+            [](const std::string& familyName) { ParagraphCache::GetInstance().ClearFontFamily(familyName); });
+        FontManager::SetOnFontVaried([]() { ParagraphCache::GetInstance().Clear(); });
+    });
     rootNode_ = FrameNode::CreateFrameNodeWithTree(
         V2::ROOT_ETS_TAG, ElementRegister::GetInstance()->MakeUniqueId(), MakeRefPtr<RootPattern>());
     rootNode_->SetHostRootId(GetInstanceId());
@@ -940,6 +977,17 @@ bool PipelineContext::OnDumpInfo(const std::vector<std::string>& params) const
     } else if (params[0] == "-threadstuck" && params.size() >= 3) {
     } else if (params[0] == "-pipeline") {
         DumpPipelineInfo();
+    } else if (params[0] == "-frametiming") {
+        frameTiming_.Dump();
+    } else if (params[0] == "-frametrace") {
+        // write recorded frame trace events to the file if given, or print them.
+        if (params.size() > 1) {
+            DumpLog::GetInstance().Print(
+                FrameTrace::DumpChromeTrace(params[1]) ? "frame trace is written to " + params[1]
+                                                       : "failed to write frame trace to " + params[1]);
+        } else {
+            DumpLog::GetInstance().Print(FrameTrace::DumpChromeTrace());
+        }
     } else {
         return false;
     }
@@ -960,6 +1008,14 @@ FrameInfo* PipelineContext::GetCurrentFrameInfo(uint64_t recvTime, uint64_t time
     return &dumpFrameInfos_.back();
 }
 
+int64_t PipelineContext::GetFrameBudget() const
+{
+    constexpr double NANOSECONDS_PER_SECOND = 1000000000.0;
+    auto refreshRate = window_ ? window_->GetRefreshRate() : 0.0f;
+    // the default budget of frame timing is used if the refresh rate is unknown.
+    return refreshRate > 0.0f ? static_cast<int64_t>(NANOSECONDS_PER_SECOND / refreshRate) : 0;
+}
+
 void PipelineContext::DumpPipelineInfo() const
 {
     DumpLog::GetInstance().Print("PipelineInfo:");
@@ -989,6 +1045,7 @@ void PipelineContext::FlushTouchEvents()
 {
     CHECK_RUN_ON(UI);
     CHECK_NULL_VOID(rootNode_);
+    ACE_FRAME_TRACE("FlushTouchEvents");
     {
         eventManager_->FlushTouchEventsBegin(touchEvents_);
         std::unordered_set<int32_t> moveEventIds;
@@ -1554,6 +1611,12 @@ void PipelineContext::NotifyMemoryLevel(int32_t level)
         }
         ++iter;
     }
+    if (stageManager_) {
+        // hidden pages keep their trees and rebuild what they release when shown again.
+        stageManager_->HibernateHiddenPages();
+    }
+    // paragraphs of hibernated and destroyed text nodes are only held by the cache.
+    ParagraphCache::GetInstance().TrimUnused();
 }
 void PipelineContext::AddPredictTask(PredictTask&& task)
 {
@@ -23,6 +23,7 @@
 
 #include "base/geometry/ng/rect_t.h"
 #include "base/log/frame_info.h"
+#include "base/log/frame_timing.h"
 #include "base/memory/referenced.h"
 #include "core/common/frontend.h"
 #include "core/components_ng/base/frame_node.h"
@@ -193,6 +194,12 @@ public:
 
     const RefPtr<FullScreenManager>& GetFullScreenManager();
 
+    // phase durations, slowest nodes and missed vsyncs of frames, queried by "-frametiming" as well.
+    const FrameTiming& GetFrameTiming() const
+    {
+        return frameTiming_;
+    }
+
     const RefPtr<StageManager>& GetStageManager();
 
     const RefPtr<OverlayManager>& GetOverlayManager();
@@ -365,6 +372,9 @@ private:
 
     FrameInfo* GetCurrentFrameInfo(uint64_t recvTime, uint64_t timeStamp);
 
+    // vsync period in nanoseconds, 0 if the refresh rate is unknown.
+    int64_t GetFrameBudget() const;
+
     template<typename T>
     struct NodeCompare {
         bool operator()(const T& nodeLeft, const T& nodeRight) const
@@ -429,6 +439,7 @@ private:
     std::unordered_map<int32_t, std::string> restoreNodeInfo_;
 
     std::list<FrameInfo> dumpFrameInfos_;
+    FrameTiming frameTiming_;
 
     ACE_DISALLOW_COPY_AND_MOVE(PipelineContext);
 };
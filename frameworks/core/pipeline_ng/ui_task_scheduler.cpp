@@ -17,6 +17,7 @@
 
 #include "base/log/ace_performance_check.h"
 #include "base/log/frame_report.h"
+#include "base/log/frame_trace.h"
 #include "base/memory/referenced.h"
 #include "base/utils/time_util.h"
 #include "base/utils/utils.h"
@@ -91,16 +92,20 @@ void UITaskScheduler::FlushLayoutTask(bool forceUseMainThread)
         if (!node || node->IsInDestroying()) {
             continue;
         }
-        time = GetSysTimestamp();
+        auto start = GetSysTimestamp();
         auto task = node->CreateLayoutTask(forceUseMainThread);
         if (task) {
             if (forceUseMainThread || (task->GetTaskThreadType() == MAIN_TASK)) {
                 (*task)();
-                time = GetSysTimestamp() - time;
+                time = GetSysTimestamp() - start;
+                FrameTrace::Record("LayoutTask", start, time, node->GetId());
                 scoped.InsertNodeTimeout(time, node->GetRow(), node->GetCol(), node->GetTag());
                 if (frameInfo_ != nullptr) {
                     frameInfo_->AddTaskInfo(node->GetTag(), node->GetId(), time, FrameInfo::TaskType::LAYOUT);
                 }
+                if (frameTiming_ != nullptr) {
+                    frameTiming_->AddNodeDuration(FramePhase::LAYOUT, node->GetId(), node->GetTag(), time);
+                }
             } else {
                 LOGW("need to use multithread feature");
             }
@@ -126,15 +131,19 @@ void UITaskScheduler::FlushRenderTask(bool forceUseMainThread)
             if (node->IsInDestroying()) {
                 continue;
             }
-            time = GetSysTimestamp();
+            auto start = GetSysTimestamp();
             auto task = node->CreateRenderTask(forceUseMainThread);
             if (task) {
                 if (forceUseMainThread || (task->GetTaskThreadType() == MAIN_TASK)) {
                     (*task)();
-                    time = GetSysTimestamp() - time;
+                    time = GetSysTimestamp() - start;
+                    FrameTrace::Record("RenderTask", start, time, node->GetId());
                     if (frameInfo_ != nullptr) {
                         frameInfo_->AddTaskInfo(node->GetTag(), node->GetId(), time, FrameInfo::TaskType::RENDER);
                     }
+                    if (frameTiming_ != nullptr) {
+                        frameTiming_->AddNodeDuration(FramePhase::RENDER, node->GetId(), node->GetTag(), time);
+                    }
                 } else {
                     LOGW("need to use multithread feature");
                 }
@@ -182,16 +191,20 @@ void UITaskScheduler::FlushTask()
 {
     CHECK_RUN_ON(UI);
     ACE_SCOPED_TRACE("UITaskScheduler::FlushTask");
-    GeometryTransition::OnLayout(true);
-    FlushLayoutTask();
-    GeometryTransition::OnLayout(false);
-    if (NeedAdditionalLayout()) {
+    {
+        FramePhaseScope scope(frameTiming_, FramePhase::LAYOUT);
+        GeometryTransition::OnLayout(true);
         FlushLayoutTask();
+        GeometryTransition::OnLayout(false);
+        if (NeedAdditionalLayout()) {
+            FlushLayoutTask();
+        }
+        if (!afterLayoutTasks_.empty()) {
+            FlushAfterLayoutTask();
+        }
+        ElementRegister::GetInstance()->ClearPendingRemoveNodes();
     }
-    if (!afterLayoutTasks_.empty()) {
-        FlushAfterLayoutTask();
-    }
-    ElementRegister::GetInstance()->ClearPendingRemoveNodes();
+    FramePhaseScope scope(frameTiming_, FramePhase::RENDER);
     FlushRenderTask();
 }
 
@@ -23,6 +23,7 @@
 #include <unordered_map>
 
 #include "base/log/frame_info.h"
+#include "base/log/frame_timing.h"
 #include "base/memory/referenced.h"
 #include "base/utils/macros.h"
 
@@ -103,6 +104,16 @@ public:
         frameInfo_ = nullptr;
     }
 
+    void StartRecordFrameTiming(FrameTiming* frameTiming)
+    {
+        frameTiming_ = frameTiming;
+    }
+
+    void FinishRecordFrameTiming()
+    {
+        frameTiming_ = nullptr;
+    }
+
 private:
     bool NeedAdditionalLayout();
 
@@ -134,6 +145,7 @@ private:
     uint32_t currentPageId_ = 0;
 
     FrameInfo* frameInfo_ = nullptr;
+    FrameTiming* frameTiming_ = nullptr;
 
     ACE_DISALLOW_COPY_AND_MOVE(UITaskScheduler);
 };
@@ -51,6 +51,28 @@ const int32_t INVALID_COL_POS = 6;
 
 const uint32_t ROW_NUM = 5;
 const uint32_t COLUMN_NUM = 5;
+
+const double TRANSLATE_X = 10.0;
+const double TRANSLATE_Y = 20.0;
+const double ROTATE_ANGLE = 90.0;
+const double RECT_SIZE = 4.0;
+const size_t POINT_COUNT = 5;
+
+// The row-by-column product, as the reference of the vectorized one.
+Matrix4 MultiplyByDefinition(const Matrix4& lhs, const Matrix4& rhs)
+{
+    Matrix4 result;
+    for (int32_t row = 0; row < Matrix4::DIMENSION; ++row) {
+        for (int32_t col = 0; col < Matrix4::DIMENSION; ++col) {
+            double value = 0.0;
+            for (int32_t k = 0; k < Matrix4::DIMENSION; ++k) {
+                value += lhs.Get(row, k) * rhs.Get(k, col);
+            }
+            result.Set(row, col, value);
+        }
+    }
+    return result;
+}
 } // namespace
 
 class Matrix4Test : public testing::Test {};
@@ -448,4 +470,82 @@ HWTEST_F(Matrix4Test, Matrix4Test008, TestSize.Level1)
     Matrix4 matrix4Obj6 = matrix4Obj4 * matrix4Obj5;
     EXPECT_EQ(matrix4Obj6, matrix4Obj2);
 }
+
+/**
+ * @tc.name: Matrix4Test009
+ * @tc.desc: Test the product and MapScalars of matrices without symmetry.
+ * @tc.type: FUNC
+ */
+HWTEST_F(Matrix4Test, Matrix4Test009, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. multiply two matrices with distinct entries.
+     * @tc.expected: step1. the product equals the row-by-column product.
+     */
+    Matrix4 lhs(1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0, 10.0, 11.0, 12.0, 13.0, 14.0, 15.0, 16.0);
+    Matrix4 rhs(-1.0, 0.5, 2.0, 0.0, 3.0, -2.0, 1.0, 4.0, 0.0, 1.5, -3.0, 2.0, 1.0, 0.0, 0.25, -1.0);
+    EXPECT_EQ(lhs * rhs, MultiplyByDefinition(lhs, rhs));
+    EXPECT_EQ(rhs * lhs, MultiplyByDefinition(rhs, lhs));
+    EXPECT_EQ(lhs * lhs, MultiplyByDefinition(lhs, lhs));
+
+    /**
+     * @tc.steps: step2. map a vector in place and to another array.
+     * @tc.expected: step2. both results equal the product of the matrix and the vector.
+     */
+    const double vec[VALID_DIMENSION] = { 1.0, -2.0, 3.0, 0.5 };
+    double src[VALID_DIMENSION] = { 1.0, -2.0, 3.0, 0.5 };
+    double dst[VALID_DIMENSION] = { 0.0 };
+    lhs.MapScalars(src, dst);
+    lhs.MapScalars(src, VALID_DIMENSION);
+    for (int32_t row = 0; row < VALID_DIMENSION; ++row) {
+        double expected = 0.0;
+        for (int32_t col = 0; col < VALID_DIMENSION; ++col) {
+            expected += lhs.Get(row, col) * vec[col];
+        }
+        EXPECT_DOUBLE_EQ(dst[row], expected);
+        EXPECT_DOUBLE_EQ(src[row], expected);
+    }
+}
+
+/**
+ * @tc.name: Matrix4Test010
+ * @tc.desc: Test MapPoints and MapRect of the class Matrix4.
+ * @tc.type: FUNC
+ */
+HWTEST_F(Matrix4Test, Matrix4Test010, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. map points in batch, in place and to another array.
+     * @tc.expected: step1. every point equals the one mapped by operator*, source types are kept.
+     */
+    Matrix4 matrix = Matrix4::CreateTranslate(TRANSLATE_X, TRANSLATE_Y, DEFAULT_DOUBLE0) *
+                     Matrix4::CreateRotate(ROTATE_ANGLE, DEFAULT_DOUBLE0, DEFAULT_DOUBLE0, DEFAULT_DOUBLE1);
+    Point src[POINT_COUNT];
+    for (size_t i = 0; i < POINT_COUNT; ++i) {
+        src[i] = Point(static_cast<double>(i), DEFAULT_DOUBLE2 * i, SourceType::TOUCH);
+    }
+    Point dst[POINT_COUNT];
+    matrix.MapPoints(src, dst, POINT_COUNT);
+    for (size_t i = 0; i < POINT_COUNT; ++i) {
+        auto expected = matrix * src[i];
+        EXPECT_DOUBLE_EQ(dst[i].GetX(), expected.GetX());
+        EXPECT_DOUBLE_EQ(dst[i].GetY(), expected.GetY());
+        EXPECT_EQ(dst[i].GetSourceType(), SourceType::TOUCH);
+    }
+    matrix.MapPoints(src, src, POINT_COUNT);
+    for (size_t i = 0; i < POINT_COUNT; ++i) {
+        EXPECT_DOUBLE_EQ(src[i].GetX(), dst[i].GetX());
+        EXPECT_DOUBLE_EQ(src[i].GetY(), dst[i].GetY());
+    }
+
+    /**
+     * @tc.steps: step2. map a rect by the rotation and translation.
+     * @tc.expected: step2. the result is the bounding rect of the rotated corners.
+     */
+    auto rect = matrix.MapRect(Rect(DEFAULT_DOUBLE0, DEFAULT_DOUBLE0, RECT_SIZE, DEFAULT_DOUBLE2));
+    EXPECT_NEAR(rect.Left(), TRANSLATE_X - DEFAULT_DOUBLE2, 1e-4);
+    EXPECT_NEAR(rect.Top(), TRANSLATE_Y, 1e-4);
+    EXPECT_NEAR(rect.Width(), DEFAULT_DOUBLE2, 1e-4);
+    EXPECT_NEAR(rect.Height(), RECT_SIZE, 1e-4);
+}
 } // namespace OHOS::Ace
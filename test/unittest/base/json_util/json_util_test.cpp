@@ -14,6 +14,8 @@
  */
 
 #include <memory>
+#include <thread>
+#include <vector>
 
 #include "gtest/gtest.h"
 
@@ -28,6 +30,10 @@ namespace {
 const std::string TEST_STRING = "Ace Unittest";
 const std::string TEST_KEY = "JsonObjectTypeTest";
 const std::string TEST_FALSE_KEY = "FalseKey";
+constexpr int32_t TEST_LARGE_COUNT = 40;
+constexpr int32_t TEST_INDEX = 33;
+constexpr int32_t TEST_NESTING_LIMIT = 1000;
+constexpr int32_t TEST_THREAD_COUNT = 4;
 } // namespace
 
 class JsonUtilTest : public testing::Test {};
@@ -362,4 +368,209 @@ HWTEST_F(JsonUtilTest, JsonUtilTest013, TestSize.Level1)
     EXPECT_FALSE(illegalValue->IsValid());
     EXPECT_TRUE(illegalValue->IsNull());
 }
-} // namespace OHOS::Ace
\ No newline at end of file
+
+/**
+ * @tc.name: JsonUtilTest014
+ * @tc.desc: Check key lookup of large objects after put, replace and delete
+ * @tc.type: FUNC
+ */
+HWTEST_F(JsonUtilTest, JsonUtilTest014, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. put many keys and keys equal ignoring case into an object.
+     * @tc.expected: step1. keys are found ignoring case, the first one of equal keys is returned.
+     */
+    auto object = JsonUtil::Create(true);
+    for (int32_t i = 0; i < TEST_LARGE_COUNT; ++i) {
+        object->Put(("Key" + std::to_string(i)).c_str(), i);
+    }
+    object->Put("dup", 1);
+    object->Put("DUP", 2);
+    for (int32_t i = 0; i < TEST_LARGE_COUNT; ++i) {
+        EXPECT_EQ(object->GetInt("key" + std::to_string(i), -1), i);
+    }
+    EXPECT_EQ(object->GetInt("Dup"), 1);
+    EXPECT_FALSE(object->Contains("key" + std::to_string(TEST_LARGE_COUNT)));
+
+    /**
+     * @tc.steps: step2. replace and delete the first key of equal keys.
+     * @tc.expected: step2. the replacement takes the key, the next equal key is found after deleting it.
+     */
+    EXPECT_TRUE(object->Replace("Dup", TEST_STRING.c_str()));
+    EXPECT_EQ(object->GetString("dup"), TEST_STRING);
+    EXPECT_EQ(object->GetValue("DUP")->GetKey(), "Dup");
+    EXPECT_TRUE(object->Delete("dup"));
+    EXPECT_EQ(object->GetInt("dup"), 2);
+    EXPECT_TRUE(object->Delete("dup"));
+    EXPECT_FALSE(object->Contains("dup"));
+    EXPECT_FALSE(object->Replace("dup", true));
+    EXPECT_EQ(object->GetArraySize(), TEST_LARGE_COUNT);
+}
+
+/**
+ * @tc.name: JsonUtilTest015
+ * @tc.desc: Check items of large arrays and copies of values
+ * @tc.type: FUNC
+ */
+HWTEST_F(JsonUtilTest, JsonUtilTest015, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. put values of an object into an array.
+     * @tc.expected: step1. values are copied with their keys and found by index.
+     */
+    auto object = JsonUtil::Create(true);
+    auto array = JsonUtil::CreateArray(true);
+    for (int32_t i = 0; i < TEST_LARGE_COUNT; ++i) {
+        object->Put(("key" + std::to_string(i)).c_str(), i);
+        array->Put(object->GetValue("key" + std::to_string(i)));
+    }
+    EXPECT_EQ(array->GetArraySize(), TEST_LARGE_COUNT);
+    EXPECT_EQ(array->GetArrayItem(TEST_INDEX)->GetInt(), TEST_INDEX);
+    EXPECT_EQ(array->GetArrayItem(TEST_INDEX)->GetKey(), "key" + std::to_string(TEST_INDEX));
+    EXPECT_FALSE(array->GetArrayItem(TEST_LARGE_COUNT)->IsValid());
+    EXPECT_FALSE(array->GetArrayItem(-1)->IsValid());
+
+    /**
+     * @tc.steps: step2. put the object into itself and change the original value.
+     * @tc.expected: step2. the copy keeps the old value.
+     */
+    EXPECT_TRUE(object->Put(TEST_KEY.c_str(), object));
+    EXPECT_TRUE(object->Replace("key0", TEST_LARGE_COUNT));
+    EXPECT_EQ(object->GetValue(TEST_KEY)->GetInt("key0", -1), 0);
+    EXPECT_EQ(object->GetValue(TEST_KEY)->GetArraySize(), TEST_LARGE_COUNT);
+    EXPECT_EQ(object->GetInt("key0"), TEST_LARGE_COUNT);
+}
+
+/**
+ * @tc.name: JsonUtilTest016
+ * @tc.desc: Check serialization of escaped strings and numbers
+ * @tc.type: FUNC
+ */
+HWTEST_F(JsonUtilTest, JsonUtilTest016, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. parse a json with escaped strings and numbers, then serialize it.
+     * @tc.expected: step1. strings are escaped again, numbers are printed in the shortest exact form.
+     */
+    std::string testJson = "{\"s\": \"a\\\"b\\\\c\\/\\n\\u0001\\u00e9\\ud83d\\ude00\", "
+                           "\"n\": [1, -0.1, 2.5e10, 3000000000, 1e-7]}";
+    auto value = JsonUtil::ParseJsonString(testJson);
+    ASSERT_TRUE(value);
+    EXPECT_TRUE(value->IsValid());
+    EXPECT_EQ(value->GetString("s"), "a\"b\\c/\n\x01\xC3\xA9\xF0\x9F\x98\x80");
+    EXPECT_EQ(value->ToString(),
+        "{\"s\":\"a\\\"b\\\\c/\\n\\u0001\xC3\xA9\xF0\x9F\x98\x80\",\"n\":[1,-0.1,25000000000,3000000000,1e-07]}");
+    EXPECT_EQ(value->GetValue("n")->ToString(), "[1,-0.1,25000000000,3000000000,1e-07]");
+}
+
+/**
+ * @tc.name: JsonUtilTest017
+ * @tc.desc: Check json util function for invalid json
+ * @tc.type: FUNC
+ */
+HWTEST_F(JsonUtilTest, JsonUtilTest017, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. parse invalid json strings.
+     * @tc.expected: step1. the values are invalid and the end points at the error.
+     */
+    const char* parseEnd = nullptr;
+    std::string testJson = "[1, 2,]";
+    EXPECT_FALSE(JsonUtil::ParseJsonString(testJson, &parseEnd)->IsValid());
+    EXPECT_EQ(parseEnd, testJson.c_str() + testJson.size() - 1);
+    EXPECT_FALSE(JsonUtil::ParseJsonString("{\"a\" 1}")->IsValid());
+    EXPECT_FALSE(JsonUtil::ParseJsonString("[\"\\udc00\"]")->IsValid());
+    EXPECT_FALSE(JsonUtil::ParseJsonString("[1] 2")->IsValid());
+
+    /**
+     * @tc.steps: step2. parse arrays nested as deep as the limit and deeper.
+     * @tc.expected: step2. only the one within the limit is valid.
+     */
+    testJson = std::string(TEST_NESTING_LIMIT, '[') + std::string(TEST_NESTING_LIMIT, ']');
+    EXPECT_TRUE(JsonUtil::ParseJsonString(testJson)->IsValid());
+    testJson = std::string(TEST_NESTING_LIMIT + 1, '[') + std::string(TEST_NESTING_LIMIT + 1, ']');
+    EXPECT_FALSE(JsonUtil::ParseJsonString(testJson)->IsValid());
+}
+
+/**
+ * @tc.name: JsonUtilTest018
+ * @tc.desc: Check lookups of a shared parsed tree from several threads
+ * @tc.type: FUNC
+ */
+HWTEST_F(JsonUtilTest, JsonUtilTest018, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. parse a large object which has a large array.
+     */
+    std::string testJson = "{";
+    for (int32_t i = 0; i < TEST_LARGE_COUNT; ++i) {
+        testJson += "\"key" + std::to_string(i) + "\":" + std::to_string(i) + ",";
+    }
+    testJson += "\"array\":[";
+    for (int32_t i = 0; i < TEST_LARGE_COUNT; ++i) {
+        testJson += std::to_string(i) + (i + 1 < TEST_LARGE_COUNT ? "," : "]}");
+    }
+    auto value = JsonUtil::ParseJsonString(testJson);
+    ASSERT_TRUE(value);
+    ASSERT_TRUE(value->IsValid());
+
+    /**
+     * @tc.steps: step2. look up keys and items of the tree from several threads at the same time.
+     * @tc.expected: step2. every thread finds every key and item.
+     */
+    std::vector<int32_t> foundCounts(TEST_THREAD_COUNT, 0);
+    std::vector<std::thread> threads;
+    for (int32_t t = 0; t < TEST_THREAD_COUNT; ++t) {
+        threads.emplace_back([&value, &foundCounts, t]() {
+            auto array = value->GetValue("array");
+            for (int32_t i = 0; i < TEST_LARGE_COUNT; ++i) {
+                if (value->GetInt("KEY" + std::to_string(i), -1) == i && array->GetArrayItem(i)->GetInt() == i) {
+                    ++foundCounts[t];
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    for (auto foundCount : foundCounts) {
+        EXPECT_EQ(foundCount, TEST_LARGE_COUNT);
+    }
+
+    /**
+     * @tc.steps: step3. delete keys of the object and put them again.
+     * @tc.expected: step3. deleted keys aren't found, keys put again are found with their new values.
+     */
+    EXPECT_TRUE(value->Delete("key0"));
+    EXPECT_TRUE(value->Delete("key1"));
+    EXPECT_FALSE(value->Contains("key0"));
+    EXPECT_EQ(value->GetInt("key2", -1), 2);
+    value->Put("key0", TEST_LARGE_COUNT);
+    EXPECT_EQ(value->GetInt("key0", -1), TEST_LARGE_COUNT);
+    EXPECT_EQ(value->GetValue("array")->GetArrayItem(TEST_INDEX)->GetInt(), TEST_INDEX);
+}
+
+/**
+ * @tc.name: JsonUtilTest019
+ * @tc.desc: Check values created without being a root
+ * @tc.type: FUNC
+ */
+HWTEST_F(JsonUtilTest, JsonUtilTest019, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. put values created without being a root into a root, then destroy them.
+     * @tc.expected: step1. the root keeps copies of them.
+     */
+    auto root = JsonUtil::Create(true);
+    {
+        auto object = JsonUtil::Create(false);
+        object->Put(TEST_KEY.c_str(), TEST_STRING.c_str());
+        auto array = JsonUtil::CreateArray(false);
+        array->Put(object);
+        root->Put(TEST_KEY.c_str(), array);
+    }
+    EXPECT_EQ(root->GetValue(TEST_KEY)->GetArraySize(), 1);
+    EXPECT_EQ(root->GetValue(TEST_KEY)->GetArrayItem(0)->GetString(TEST_KEY), TEST_STRING);
+    EXPECT_EQ(root->ToString(), "{\"" + TEST_KEY + "\":[{\"" + TEST_KEY + "\":\"" + TEST_STRING + "\"}]}");
+}
+} // namespace OHOS::Ace
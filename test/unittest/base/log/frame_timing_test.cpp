@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <memory>
+#include <sstream>
+#include <string>
+
+#include "gtest/gtest.h"
+
+#include "base/log/dump_log.h"
+#include "base/log/frame_timing.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS::Ace {
+namespace {
+constexpr uint64_t TEST_VSYNC_TIME = 100;
+constexpr int64_t LARGE_BUDGET = 1000000000000;
+constexpr int64_t TINY_BUDGET = 1;
+constexpr int64_t LAYOUT_DURATION = 300;
+constexpr int64_t RENDER_DURATION = 100;
+constexpr int32_t FIRST_NODE_ID = 1;
+constexpr int32_t SECOND_NODE_ID = 2;
+constexpr int32_t THIRD_NODE_ID = 3;
+constexpr int32_t FOURTH_NODE_ID = 4;
+} // namespace
+
+class FrameTimingTest : public testing::Test {};
+
+/**
+ * @tc.name: FrameTimingTest001
+ * @tc.desc: Check phase durations and slowest nodes of a frame are recorded
+ * @tc.type: FUNC
+ */
+HWTEST_F(FrameTimingTest, FrameTimingTest001, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. report phases and nodes out of a frame.
+     * @tc.expected: step1. they are ignored.
+     */
+    FrameTiming frameTiming;
+    frameTiming.AddPhaseDuration(FramePhase::LAYOUT, LAYOUT_DURATION);
+    frameTiming.AddNodeDuration(FramePhase::LAYOUT, FIRST_NODE_ID, "Column", LAYOUT_DURATION);
+    EXPECT_EQ(frameTiming.GetStats().frameCount, 0);
+
+    /**
+     * @tc.steps: step2. report phases and more nodes than kept in a frame within budget.
+     * @tc.expected: step2. phases are summed, the slowest nodes are kept in order and the frame is not janky.
+     */
+    frameTiming.BeginFrame(TEST_VSYNC_TIME, LARGE_BUDGET);
+    frameTiming.AddPhaseDuration(FramePhase::LAYOUT, LAYOUT_DURATION);
+    frameTiming.AddPhaseDuration(FramePhase::LAYOUT, LAYOUT_DURATION);
+    frameTiming.AddPhaseDuration(FramePhase::RENDER, RENDER_DURATION);
+    frameTiming.AddNodeDuration(FramePhase::LAYOUT, FIRST_NODE_ID, "Column", 10);
+    frameTiming.AddNodeDuration(FramePhase::LAYOUT, SECOND_NODE_ID, "Text", 30);
+    frameTiming.AddNodeDuration(FramePhase::LAYOUT, THIRD_NODE_ID, "Image", 5);
+    frameTiming.AddNodeDuration(FramePhase::LAYOUT, FOURTH_NODE_ID, "List", 20);
+    {
+        FramePhaseScope scope(&frameTiming, FramePhase::BUILD);
+    }
+    frameTiming.EndFrame();
+    const auto& frame = frameTiming.GetLastFrame();
+    EXPECT_EQ(frame.vsyncTime, TEST_VSYNC_TIME);
+    EXPECT_EQ(frame.phaseDurations[static_cast<size_t>(FramePhase::LAYOUT)], LAYOUT_DURATION * 2);
+    EXPECT_EQ(frame.phaseDurations[static_cast<size_t>(FramePhase::RENDER)], RENDER_DURATION);
+    EXPECT_EQ(frame.GetWorstPhase(), FramePhase::LAYOUT);
+    const auto& nodes = frame.topNodes[static_cast<size_t>(FramePhase::LAYOUT)];
+    EXPECT_EQ(nodes[0].nodeId, SECOND_NODE_ID);
+    EXPECT_EQ(nodes[0].tag, "Text");
+    EXPECT_EQ(nodes[1].nodeId, FOURTH_NODE_ID);
+    EXPECT_EQ(nodes[2].nodeId, FIRST_NODE_ID);
+    EXPECT_EQ(frame.topNodes[static_cast<size_t>(FramePhase::RENDER)][0].nodeId, -1);
+    EXPECT_EQ(frame.missedVsyncs, 0);
+    EXPECT_EQ(frameTiming.GetStats().frameCount, 1);
+    EXPECT_EQ(frameTiming.GetStats().jankCount, 0);
+    EXPECT_EQ(frameTiming.GetStats().missedVsyncHistogram[0], 1);
+    EXPECT_TRUE(frameTiming.GetJankFrames().empty());
+}
+
+/**
+ * @tc.name: FrameTimingTest002
+ * @tc.desc: Check janky frames are counted and attributed to their worst phases
+ * @tc.type: FUNC
+ */
+HWTEST_F(FrameTimingTest, FrameTimingTest002, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. record more janky frames than kept, which miss every vsync of a tiny budget.
+     * @tc.expected: step1. frames are counted in the last bucket and attributed to the render phase.
+     */
+    FrameTiming frameTiming;
+    for (size_t i = 0; i < JANK_FRAME_RECORD_COUNT + 1; ++i) {
+        frameTiming.BeginFrame(TEST_VSYNC_TIME + i, TINY_BUDGET);
+        frameTiming.AddPhaseDuration(FramePhase::LAYOUT, RENDER_DURATION);
+        frameTiming.AddPhaseDuration(FramePhase::RENDER, LAYOUT_DURATION);
+        frameTiming.AddNodeDuration(FramePhase::RENDER, FIRST_NODE_ID, "Column", LAYOUT_DURATION);
+        frameTiming.EndFrame();
+    }
+    const auto& stats = frameTiming.GetStats();
+    EXPECT_EQ(stats.frameCount, JANK_FRAME_RECORD_COUNT + 1);
+    EXPECT_EQ(stats.jankCount, JANK_FRAME_RECORD_COUNT + 1);
+    EXPECT_EQ(stats.missedVsyncHistogram[MISSED_VSYNC_HISTOGRAM_SIZE - 1], JANK_FRAME_RECORD_COUNT + 1);
+    EXPECT_EQ(stats.phases[static_cast<size_t>(FramePhase::RENDER)].jankCount, JANK_FRAME_RECORD_COUNT + 1);
+    EXPECT_EQ(stats.phases[static_cast<size_t>(FramePhase::LAYOUT)].jankCount, 0);
+    EXPECT_EQ(stats.phases[static_cast<size_t>(FramePhase::RENDER)].maxDuration, LAYOUT_DURATION);
+
+    /**
+     * @tc.steps: step2. get janky frames.
+     * @tc.expected: step2. the latest ones are kept, the oldest first.
+     */
+    auto jankFrames = frameTiming.GetJankFrames();
+    ASSERT_EQ(jankFrames.size(), JANK_FRAME_RECORD_COUNT);
+    EXPECT_EQ(jankFrames.front().vsyncTime, TEST_VSYNC_TIME + 1);
+    EXPECT_EQ(jankFrames.back().vsyncTime, TEST_VSYNC_TIME + JANK_FRAME_RECORD_COUNT);
+
+    /**
+     * @tc.steps: step3. dump frame timing.
+     * @tc.expected: step3. the histogram, phases and janky frames are dumped.
+     */
+    auto stream = std::make_unique<std::ostringstream>();
+    auto* output = stream.get();
+    DumpLog::GetInstance().SetDumpFile(std::move(stream));
+    frameTiming.Dump();
+    auto dump = output->str();
+    DumpLog::GetInstance().Reset();
+    auto jankCount = std::to_string(JANK_FRAME_RECORD_COUNT + 1);
+    EXPECT_NE(dump.find("JankCount: " + jankCount), std::string::npos);
+    EXPECT_NE(dump.find(std::to_string(MISSED_VSYNC_HISTOGRAM_SIZE - 1) + "+:" + jankCount), std::string::npos);
+    EXPECT_NE(dump.find("worstPhase: Render"), std::string::npos);
+    EXPECT_NE(dump.find("Column(1): 0.000ms"), std::string::npos);
+
+    /**
+     * @tc.steps: step4. reset frame timing.
+     * @tc.expected: step4. nothing is kept.
+     */
+    frameTiming.Reset();
+    EXPECT_EQ(frameTiming.GetStats().frameCount, 0);
+    EXPECT_TRUE(frameTiming.GetJankFrames().empty());
+}
+} // namespace OHOS::Ace
@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstring>
+#include <string>
+#include <thread>
+
+#include "gtest/gtest.h"
+
+#include "base/log/frame_trace.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS::Ace {
+namespace {
+constexpr int32_t TEST_NODE_ID = 7;
+constexpr int64_t TEST_START = 5;
+constexpr int64_t TEST_DURATION = 1234567;
+constexpr size_t OVERFLOW_COUNT = FrameTrace::CAPACITY + 100;
+} // namespace
+
+class FrameTraceTest : public testing::Test {
+public:
+    void SetUp() override
+    {
+        FrameTrace::SetEnabled(true);
+        FrameTrace::Clear();
+    }
+};
+
+/**
+ * @tc.name: FrameTraceTest001
+ * @tc.desc: Check events of scoped frame trace are recorded
+ * @tc.type: FUNC
+ */
+HWTEST_F(FrameTraceTest, FrameTraceTest001, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. record a scoped event with node id.
+     * @tc.expected: step1. the event is collected with its static name and node id.
+     */
+    {
+        ACE_FRAME_TRACE("FrameTraceTest001", TEST_NODE_ID);
+    }
+    auto events = FrameTrace::Collect();
+    ASSERT_EQ(events.size(), 1);
+    EXPECT_STREQ(events[0].name, "FrameTraceTest001");
+    EXPECT_EQ(events[0].nodeId, TEST_NODE_ID);
+    EXPECT_GE(events[0].duration, 0);
+
+    /**
+     * @tc.steps: step2. disable frame trace and record an event.
+     * @tc.expected: step2. the event is not recorded.
+     */
+    FrameTrace::SetEnabled(false);
+    {
+        ACE_FRAME_TRACE("FrameTraceTest001");
+    }
+    EXPECT_EQ(FrameTrace::Collect().size(), 1);
+}
+
+/**
+ * @tc.name: FrameTraceTest002
+ * @tc.desc: Check ring buffers keep the latest events of every thread
+ * @tc.type: FUNC
+ */
+HWTEST_F(FrameTraceTest, FrameTraceTest002, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. record more events than the capacity in another thread.
+     * @tc.expected: step1. the latest events are kept, ordered by start time.
+     */
+    std::thread thread([]() {
+        for (size_t i = 0; i < OVERFLOW_COUNT; ++i) {
+            FrameTrace::Record("FrameTraceTest002", static_cast<int64_t>(i), 1);
+        }
+    });
+    thread.join();
+    auto events = FrameTrace::Collect();
+    ASSERT_FALSE(events.empty());
+    EXPECT_LE(events.size(), FrameTrace::CAPACITY);
+    EXPECT_EQ(events.back().start, static_cast<int64_t>(OVERFLOW_COUNT - 1));
+    EXPECT_GE(events.front().start, static_cast<int64_t>(OVERFLOW_COUNT - FrameTrace::CAPACITY));
+
+    /**
+     * @tc.steps: step2. clear frame trace.
+     * @tc.expected: step2. no event is collected.
+     */
+    FrameTrace::Clear();
+    EXPECT_TRUE(FrameTrace::Collect().empty());
+}
+
+/**
+ * @tc.name: FrameTraceTest003
+ * @tc.desc: Check events are dumped as chrome trace json
+ * @tc.type: FUNC
+ */
+HWTEST_F(FrameTraceTest, FrameTraceTest003, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. record an event and dump chrome trace.
+     * @tc.expected: step1. the event is dumped as a complete event in microseconds.
+     */
+    FrameTrace::Record("FrameTraceTest003", TEST_START, TEST_DURATION, TEST_NODE_ID);
+    auto trace = FrameTrace::DumpChromeTrace();
+    EXPECT_NE(trace.find("\"traceEvents\""), std::string::npos);
+    EXPECT_NE(trace.find("{\"name\":\"FrameTraceTest003\",\"ph\":\"X\""), std::string::npos);
+    EXPECT_NE(trace.find("\"ts\":0.005,\"dur\":1234.567,\"args\":{\"nodeId\":7}"), std::string::npos);
+}
+
+/**
+ * @tc.name: FrameTraceTest004
+ * @tc.desc: Check buffers of exited threads are taken by new threads and keep their events
+ * @tc.type: FUNC
+ */
+HWTEST_F(FrameTraceTest, FrameTraceTest004, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. record an event in a thread which exits, then in another thread.
+     * @tc.expected: step1. both events are collected with different thread indexes.
+     */
+    std::thread first([]() { FrameTrace::Record("FrameTraceTest004", TEST_START, 1); });
+    first.join();
+    std::thread second([]() { FrameTrace::Record("FrameTraceTest004", TEST_START + 1, 1); });
+    second.join();
+    auto events = FrameTrace::Collect();
+    ASSERT_EQ(events.size(), 2);
+    EXPECT_EQ(events[0].start, TEST_START);
+    EXPECT_EQ(events[1].start, TEST_START + 1);
+    EXPECT_NE(events[0].threadIndex, events[1].threadIndex);
+
+    /**
+     * @tc.steps: step2. collect events while another thread is recording.
+     * @tc.expected: step2. only completely written events are collected.
+     */
+    std::thread writer([]() {
+        for (size_t i = 0; i < OVERFLOW_COUNT; ++i) {
+            FrameTrace::Record("FrameTraceTest004", static_cast<int64_t>(i), TEST_DURATION);
+        }
+    });
+    auto concurrentEvents = FrameTrace::Collect();
+    writer.join();
+    for (const auto& event : concurrentEvents) {
+        EXPECT_STREQ(event.name, "FrameTraceTest004");
+    }
+}
+} // namespace OHOS::Ace
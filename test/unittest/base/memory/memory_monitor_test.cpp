@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "base/memory/ace_type.h"
+#include "base/memory/memory_monitor.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS::Ace {
+namespace {
+constexpr int32_t TEST_PAGE_ID = 10001;
+constexpr size_t TEST_PAGE_DEPTH = 20;
+constexpr size_t LEAK_OBJECT_COUNT = 4;
+
+// named as the base class of frame nodes, so it's accounted as a frame node.
+class FrameNode : public AceType {
+    DECLARE_ACE_TYPE(FrameNode, AceType);
+};
+
+class TestPageNode : public FrameNode {
+    DECLARE_ACE_TYPE(TestPageNode, FrameNode);
+};
+
+class TestLeakObject : public AceType {
+    DECLARE_ACE_TYPE(TestLeakObject, AceType);
+};
+
+template<class T>
+void Claim(T* object)
+{
+    MemoryMonitor::GetInstance().Add(object);
+    MemoryMonitor::GetInstance().Update(object, sizeof(T), T::TypeName(), object);
+}
+
+MemoryTypeStats GetTypeStats(const std::string& typeName)
+{
+    auto stats = MemoryMonitor::GetInstance().GetTypeStats();
+    auto iter = std::find_if(stats.begin(), stats.end(),
+        [&typeName](const MemoryTypeStats& typeStats) { return typeStats.typeName == typeName; });
+    return iter == stats.end() ? MemoryTypeStats() : *iter;
+}
+} // namespace
+
+class MemoryMonitorTest : public testing::Test {};
+
+/**
+ * @tc.name: MemoryMonitorTest001
+ * @tc.desc: Check live objects are accounted to their types and pages
+ * @tc.type: FUNC
+ */
+HWTEST_F(MemoryMonitorTest, MemoryMonitorTest001, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. claim nodes for a page.
+     * @tc.expected: step1. nodes are accounted to their types and to the frame nodes of the page.
+     */
+    auto& monitor = MemoryMonitor::GetInstance();
+    monitor.SetCurrentPage(TEST_PAGE_ID);
+    auto first = std::make_unique<TestPageNode>();
+    auto second = std::make_unique<TestPageNode>();
+    Claim(first.get());
+    Claim(second.get());
+    auto typeStats = GetTypeStats("TestPageNode");
+    EXPECT_EQ(typeStats.count, 2);
+    EXPECT_EQ(typeStats.total, sizeof(TestPageNode) * 2);
+    EXPECT_EQ(typeStats.peakCount, 2);
+    auto pageStats = monitor.GetPageStats(TEST_PAGE_ID);
+    EXPECT_EQ(pageStats[static_cast<size_t>(MemoryCategory::FRAME_NODE)].count, 2);
+    EXPECT_EQ(pageStats[static_cast<size_t>(MemoryCategory::PARAGRAPH)].count, 0);
+
+    /**
+     * @tc.steps: step2. release the nodes.
+     * @tc.expected: step2. live counts decrease, the peak is kept and the page is dropped.
+     */
+    monitor.Remove(first.get());
+    monitor.Remove(second.get());
+    typeStats = GetTypeStats("TestPageNode");
+    EXPECT_EQ(typeStats.count, 0);
+    EXPECT_EQ(typeStats.total, 0);
+    EXPECT_EQ(typeStats.peakCount, 2);
+    EXPECT_EQ(monitor.GetPageStats(TEST_PAGE_ID)[static_cast<size_t>(MemoryCategory::FRAME_NODE)].count, 0);
+}
+
+/**
+ * @tc.name: MemoryMonitorTest002
+ * @tc.desc: Check types growing across page transitions are leak suspects
+ * @tc.type: FUNC
+ */
+HWTEST_F(MemoryMonitorTest, MemoryMonitorTest002, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. push pages onto the same depth, leaking an object every time.
+     * @tc.expected: step1. the type becomes a leak suspect after growing on several pushes.
+     */
+    auto& monitor = MemoryMonitor::GetInstance();
+    std::vector<std::unique_ptr<TestLeakObject>> objects;
+    monitor.OnPageTransition(TEST_PAGE_DEPTH);
+    for (size_t i = 0; i < LEAK_OBJECT_COUNT; ++i) {
+        objects.emplace_back(std::make_unique<TestLeakObject>());
+        Claim(objects.back().get());
+        monitor.OnPageTransition(TEST_PAGE_DEPTH);
+    }
+    EXPECT_TRUE(GetTypeStats("TestLeakObject").isLeakSuspect);
+    auto suspects = monitor.GetLeakSuspects();
+    EXPECT_NE(std::find(suspects.begin(), suspects.end(), "TestLeakObject"), suspects.end());
+
+    /**
+     * @tc.steps: step2. release the objects and push a page onto the same depth.
+     * @tc.expected: step2. the type is not a leak suspect any more.
+     */
+    for (const auto& object : objects) {
+        monitor.Remove(object.get());
+    }
+    monitor.OnPageTransition(TEST_PAGE_DEPTH);
+    EXPECT_FALSE(GetTypeStats("TestLeakObject").isLeakSuspect);
+}
+} // namespace OHOS::Ace
@@ -25,6 +25,7 @@
 #include "base/utils/base_id.h"
 #include "base/utils/date_util.h"
 #include "base/log/log.h"
+#include "base/utils/linear_map.h"
 #include "base/utils/utils.h"
 #include "base/utils/resource_configuration.h"
 #include "base/utils/string_expression.h"
@@ -841,4 +842,48 @@ HWTEST_F(BaseUtilsTest, BaseUtilsTest042, TestSize.Level1)
     ASSERT_EQ(StringUtils::EndWith(startWithValue, prefixString), true);
     ASSERT_EQ(StringUtils::EndWith(startWithValue, prefixString), true);
 }
+
+/**
+ * @tc.name: BaseUtilsTest043
+ * @tc.desc: Find keys of a linear map by its hash index
+ * @tc.type: FUNC
+ */
+HWTEST_F(BaseUtilsTest, BaseUtilsTest043, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. build the index of an unsorted map with duplicated keys.
+     * @tc.expected: step1. the first one of duplicated keys and the same results as binary search are found.
+     */
+    const LinearMapNode<int32_t> unsortedMap[] = {
+        { "width", 0 },
+        { "height", 1 },
+        { "color", 2 },
+        { "width", 3 },
+    };
+    LinearMapIndex<int32_t> unsortedIndex(unsortedMap, ArraySize(unsortedMap));
+    EXPECT_EQ(unsortedIndex.Find("width"), 0);
+    EXPECT_EQ(unsortedIndex.Find("color"), 2);
+    EXPECT_EQ(unsortedIndex.Find("colo"), -1);
+    EXPECT_EQ(unsortedIndex.Find(""), -1);
+
+    const LinearMapNode<int32_t> sortedMap[] = {
+        { "alignSelf", 0 },
+        { "backgroundColor", 1 },
+        { "display", 2 },
+        { "opacity", 3 },
+        { "visibility", 4 },
+    };
+    LinearMapIndex<int32_t> sortedIndex(sortedMap, ArraySize(sortedMap));
+    for (const auto& node : sortedMap) {
+        EXPECT_EQ(sortedIndex.Find(node.key), BinarySearchFindIndex(sortedMap, ArraySize(sortedMap), node.key));
+    }
+    EXPECT_EQ(sortedIndex.Find("zIndex"), -1);
+
+    /**
+     * @tc.steps: step2. build the index of an empty map.
+     * @tc.expected: step2. nothing is found.
+     */
+    LinearMapIndex<int32_t> emptyIndex(sortedMap, 0);
+    EXPECT_EQ(emptyIndex.Find("display"), -1);
+}
 } // namespace OHOS::Ace
@@ -0,0 +1,191 @@
+/*
+ * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#define private public
+#define protected public
+#include "base/network/download_manager.h"
+#include "core/common/font_loader.h"
+#include "core/image/image_cache.h"
+#undef private
+#undef protected
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS::Ace {
+namespace {
+const std::string FAMILY_NAME = "TestFamily";
+const std::string FONT_URL = "https://www.example.com/test_font.ttf";
+const std::string CACHE_FILE_PATH = "/data/local/tmp";
+const std::vector<uint8_t> VALID_FONT_DATA = { 0x00, 0x01, 0x00, 0x00 };
+const std::vector<uint8_t> INVALID_FONT_DATA = { 0xFF };
+
+int32_t g_downloadCount = 0;
+std::vector<uint8_t> g_downloadData;
+
+class TestDownloadManager final : public DownloadManager {
+public:
+    bool Download(const std::string& /*url*/, std::vector<uint8_t>& dataOut) override
+    {
+        ++g_downloadCount;
+        dataOut = g_downloadData;
+        return !dataOut.empty();
+    }
+};
+
+class TestFontLoader final : public FontLoader {
+    DECLARE_ACE_TYPE(TestFontLoader, FontLoader);
+
+public:
+    TestFontLoader() : FontLoader(FAMILY_NAME, FONT_URL) {}
+    ~TestFontLoader() override = default;
+
+    void AddFont(const RefPtr<PipelineBase>& /*context*/) override {}
+};
+
+bool IsValidFont(const std::vector<uint8_t>& fontData)
+{
+    return fontData == VALID_FONT_DATA;
+}
+} // namespace
+
+DownloadManager& DownloadManager::GetInstance()
+{
+    static TestDownloadManager instance;
+    return instance;
+}
+
+class FontLoaderTest : public testing::Test {
+public:
+    static void SetUpTestCase()
+    {
+        ImageCache::SetImageCacheFilePath(CACHE_FILE_PATH);
+        ImageCache::SetCacheFileInfo();
+    }
+
+    void SetUp() override
+    {
+        FontLoader::RemoveCacheFile(FONT_URL);
+        g_downloadCount = 0;
+        g_downloadData = VALID_FONT_DATA;
+    }
+
+    void TearDown() override
+    {
+        FontLoader::RemoveCacheFile(FONT_URL);
+    }
+};
+
+/**
+ * @tc.name: FontLoaderTest001
+ * @tc.desc: Test a downloaded font is cached and read from the cache file afterwards.
+ * @tc.type: FUNC
+ */
+HWTEST_F(FontLoaderTest, FontLoaderTest001, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. load a font which is not cached.
+     * @tc.expected: the font is downloaded and written to the cache file.
+     */
+    std::vector<uint8_t> fontData;
+    EXPECT_TRUE(FontLoader::LoadNetworkFontData(FONT_URL, fontData, IsValidFont));
+    EXPECT_EQ(fontData, VALID_FONT_DATA);
+    EXPECT_EQ(g_downloadCount, 1);
+
+    /**
+     * @tc.steps: step2. load the font again.
+     * @tc.expected: the font is read from the cache file without downloading.
+     */
+    std::vector<uint8_t> cachedFontData;
+    EXPECT_TRUE(FontLoader::LoadNetworkFontData(FONT_URL, cachedFontData, IsValidFont));
+    EXPECT_EQ(cachedFontData, VALID_FONT_DATA);
+    EXPECT_EQ(g_downloadCount, 1);
+}
+
+/**
+ * @tc.name: FontLoaderTest002
+ * @tc.desc: Test an invalid cache file is removed and the font is downloaded again.
+ * @tc.type: FUNC
+ */
+HWTEST_F(FontLoaderTest, FontLoaderTest002, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. write invalid data to the cache file and load the font.
+     * @tc.expected: the font is downloaded again and the cache file is replaced.
+     */
+    FontLoader::WriteCacheFile(FONT_URL, INVALID_FONT_DATA);
+    std::vector<uint8_t> fontData;
+    EXPECT_TRUE(FontLoader::ReadCacheFile(FONT_URL, fontData));
+    EXPECT_EQ(fontData, INVALID_FONT_DATA);
+    fontData.clear();
+    EXPECT_TRUE(FontLoader::LoadNetworkFontData(FONT_URL, fontData, IsValidFont));
+    EXPECT_EQ(fontData, VALID_FONT_DATA);
+    EXPECT_EQ(g_downloadCount, 1);
+    std::vector<uint8_t> cachedFontData;
+    EXPECT_TRUE(FontLoader::ReadCacheFile(FONT_URL, cachedFontData));
+    EXPECT_EQ(cachedFontData, VALID_FONT_DATA);
+
+    /**
+     * @tc.steps: step2. remove the cache file and download invalid data.
+     * @tc.expected: loading fails and the invalid data is not cached.
+     */
+    FontLoader::RemoveCacheFile(FONT_URL);
+    g_downloadData = INVALID_FONT_DATA;
+    fontData.clear();
+    EXPECT_FALSE(FontLoader::LoadNetworkFontData(FONT_URL, fontData, IsValidFont));
+    EXPECT_EQ(g_downloadCount, 2);
+    EXPECT_FALSE(FontLoader::ReadCacheFile(FONT_URL, cachedFontData));
+}
+
+/**
+ * @tc.name: FontLoaderTest003
+ * @tc.desc: Test callbacks of nodes are called once when the font is loaded.
+ * @tc.type: FUNC
+ */
+HWTEST_F(FontLoaderTest, FontLoaderTest003, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. register callbacks and notify the font is loaded.
+     * @tc.expected: every callback is called once and removed.
+     */
+    auto fontLoader = AceType::MakeRefPtr<TestFontLoader>();
+    int32_t loadedCount = 0;
+    int32_t variationCount = 0;
+    fontLoader->SetOnLoaded(WeakPtr<RenderNode>(), [&loadedCount]() { ++loadedCount; });
+    fontLoader->SetOnLoadedNG(WeakPtr<NG::UINode>(), [&loadedCount]() { ++loadedCount; });
+    fontLoader->SetVariationChanged([&variationCount]() { ++variationCount; });
+    fontLoader->NotifyLoaded();
+    EXPECT_EQ(loadedCount, 2);
+    EXPECT_EQ(variationCount, 1);
+    EXPECT_TRUE(fontLoader->callbacks_.empty());
+    EXPECT_TRUE(fontLoader->callbacksNG_.empty());
+
+    /**
+     * @tc.steps: step2. register callbacks after the font is loaded.
+     * @tc.expected: NG nodes are laid out with the font already and not registered, render nodes are called at once.
+     */
+    fontLoader->SetOnLoadedNG(WeakPtr<NG::UINode>(), [&loadedCount]() { ++loadedCount; });
+    EXPECT_TRUE(fontLoader->callbacksNG_.empty());
+    fontLoader->SetOnLoaded(WeakPtr<RenderNode>(), [&loadedCount]() { ++loadedCount; });
+    EXPECT_EQ(loadedCount, 3);
+    EXPECT_TRUE(fontLoader->callbacks_.empty());
+}
+} // namespace OHOS::Ace
@@ -40,6 +40,7 @@
 #include "core/components_ng/gestures/swipe_gesture.h"
 #include "core/components_ng/gestures/tap_gesture.h"
 #include "core/components_ng/layout/layout_property.h"
+#include "core/gestures/velocity_tracker.h"
 
 using namespace testing;
 using namespace testing::ext;
@@ -62,6 +63,52 @@ constexpr double SPECIAL_VALUE_RANGE_CASE2 = -181.0;
 constexpr double SWIPE_SPEED = 10.0;
 constexpr double VERTICAL_ANGLE = 90.0;
 constexpr double HORIZONTAL_ANGLE = 180.0;
+
+// A fling sampled at 120Hz: y = FLING_VELOCITY * t - FLING_DECELERATION * t^2, released at the last sample.
+constexpr double FLING_VELOCITY = 3000.0;
+constexpr double FLING_DECELERATION = 4000.0;
+constexpr double INPUT_INTERVAL = 1.0 / 120.0;
+constexpr size_t TRACE_SIZE = 30;
+constexpr double VELOCITY_TOLERANCE = 0.01;
+// the relative error each estimator is allowed on the decelerating fling.
+constexpr double FLING_TOLERANCE = 0.1;
+// sampling jitter of the input timestamps, in fractions of INPUT_INTERVAL.
+constexpr double TIME_JITTERS[] = { 0.0, 0.08, -0.05, 0.1, -0.1, 0.03 };
+
+struct TracePoint {
+    double time = 0.0;
+    double x = 0.0;
+    double y = 0.0;
+};
+
+TimeStamp ToTimeStamp(const TimeStamp& base, double seconds)
+{
+    return base + std::chrono::duration_cast<TimeStamp::duration>(std::chrono::duration<double>(seconds));
+}
+
+// Replay a recorded trace through the tracker, and return the main axis velocity at its last point.
+double ReplayTrace(VelocityTracker& tracker, const TracePoint* trace, size_t size)
+{
+    tracker.Reset();
+    auto base = TimeStamp();
+    for (size_t i = 0; i < size; ++i) {
+        TouchEvent event;
+        event.x = static_cast<float>(trace[i].x);
+        event.y = static_cast<float>(trace[i].y);
+        event.time = ToTimeStamp(base, trace[i].time);
+        tracker.UpdateTouchPoint(event, i + 1 == size);
+    }
+    return tracker.GetMainAxisVelocity();
+}
+
+void RecordFling(TracePoint* trace, size_t size)
+{
+    constexpr size_t jitterCount = sizeof(TIME_JITTERS) / sizeof(TIME_JITTERS[0]);
+    for (size_t i = 0; i < size; ++i) {
+        double time = (i + TIME_JITTERS[i % jitterCount]) * INPUT_INTERVAL;
+        trace[i] = { time, 0.0, FLING_VELOCITY * time - FLING_DECELERATION * time * time };
+    }
+}
 } // namespace
 
 class GesturesTestNg : public testing::Test {};
@@ -5330,6 +5377,70 @@ HWTEST_F(GesturesTestNg, GestureRefereeTest014, TestSize.Level1)
     EXPECT_EQ(result, false);
 }
 
+/**
+ * @tc.name: GestureRefereeTest015
+ * @tc.desc: Test GestureReferee scope pool, sole recognizer fast path and statistics
+ */
+HWTEST_F(GesturesTestNg, GestureRefereeTest015, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. open a scope with a single clickRecognizer.
+     */
+    GestureReferee gestureReferee;
+    RefPtr<ClickRecognizer> clickRecognizerPtr = AceType::MakeRefPtr<ClickRecognizer>(FINGER_NUMBER, COUNT);
+    TouchTestResult touchTestResult;
+    touchTestResult.push_back(clickRecognizerPtr);
+    auto downTime = std::chrono::high_resolution_clock::now() - std::chrono::milliseconds(10);
+    gestureReferee.AddGestureToScope(0, touchTestResult, downTime);
+    EXPECT_EQ(gestureReferee.GetStatistics().openedScopes, 1);
+    EXPECT_EQ(gestureReferee.GetStatistics().reusedScopes, 0);
+
+    /**
+     * @tc.steps: step2. accept the clickRecognizer.
+     * @tc.expected: step2. it is accepted on the fast path and the latency is timed from the touch down event.
+     */
+    gestureReferee.HandleAcceptDisposal(clickRecognizerPtr);
+    EXPECT_EQ(clickRecognizerPtr->refereeState_, RefereeState::SUCCEED);
+    EXPECT_TRUE(gestureReferee.HasGestureAccepted(0));
+    EXPECT_EQ(gestureReferee.GetStatistics().fastPathAccepts, 1);
+    EXPECT_EQ(gestureReferee.GetStatistics().acceptedScopes, 1);
+    EXPECT_GE(gestureReferee.GetStatistics().totalAcceptLatency, 10000);
+
+    /**
+     * @tc.steps: step3. close the scope and open another one.
+     * @tc.expected: step3. the closed scope is reused and does not keep its state.
+     */
+    gestureReferee.CleanGestureScope(0);
+    EXPECT_EQ(gestureReferee.gestureScopes_.size(), 0);
+    EXPECT_EQ(gestureReferee.scopePool_.size(), 1);
+    RefPtr<ClickRecognizer> otherRecognizerPtr = AceType::MakeRefPtr<ClickRecognizer>(FINGER_NUMBER, COUNT);
+    touchTestResult.push_back(otherRecognizerPtr);
+    gestureReferee.AddGestureToScope(1, touchTestResult);
+    EXPECT_EQ(gestureReferee.scopePool_.size(), 0);
+    EXPECT_EQ(gestureReferee.GetStatistics().reusedScopes, 1);
+    EXPECT_FALSE(gestureReferee.HasGestureAccepted(1));
+    EXPECT_EQ(gestureReferee.gestureScopes_[1]->recognizers_.size(), 2);
+
+    /**
+     * @tc.steps: step4. accept one of the two recognizers.
+     * @tc.expected: step4. the arena is used and the other recognizer is rejected.
+     */
+    clickRecognizerPtr->refereeState_ = RefereeState::READY;
+    gestureReferee.HandleAcceptDisposal(clickRecognizerPtr);
+    EXPECT_EQ(gestureReferee.GetStatistics().fastPathAccepts, 1);
+    EXPECT_EQ(gestureReferee.GetStatistics().acceptedScopes, 2);
+    EXPECT_EQ(otherRecognizerPtr->refereeState_, RefereeState::FAIL);
+
+    /**
+     * @tc.steps: step5. clean all scopes and reset the statistics.
+     */
+    gestureReferee.CleanAll();
+    EXPECT_EQ(gestureReferee.gestureScopes_.size(), 0);
+    EXPECT_EQ(gestureReferee.scopePool_.size(), 1);
+    gestureReferee.ResetStatistics();
+    EXPECT_EQ(gestureReferee.GetStatistics().openedScopes, 0);
+}
+
 /**
  * @tc.name: LongPressGestureTest001
  * @tc.desc: Test LongPressGesture CreateRecognizer function
@@ -5460,4 +5571,101 @@ HWTEST_F(GesturesTestNg, TapGestureTest001, TestSize.Level1)
     EXPECT_EQ(tapRecognizer->GetPriority(), GesturePriority::Low);
     EXPECT_EQ(tapRecognizer->GetPriorityMask(), GestureMask::Normal);
 }
+
+/**
+ * @tc.name: VelocityTrackerTest001
+ * @tc.desc: Test VelocityTracker on uniform motion with every estimator
+ * @tc.type: FUNC
+ */
+HWTEST_F(GesturesTestNg, VelocityTrackerTest001, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. record a uniform motion longer than the history of the tracker.
+     */
+    TracePoint trace[TRACE_SIZE];
+    for (size_t i = 0; i < TRACE_SIZE; ++i) {
+        trace[i] = { i * INPUT_INTERVAL, 0.0, FLING_VELOCITY * i * INPUT_INTERVAL };
+    }
+
+    /**
+     * @tc.steps: step2. replay it with every estimator.
+     * @tc.expected: step2. every estimator returns the velocity of the motion.
+     */
+    for (auto type : { VelocityEstimatorType::LEAST_SQUARES, VelocityEstimatorType::IMPULSE,
+             VelocityEstimatorType::WEIGHTED_RECENT }) {
+        VelocityTracker tracker(Axis::VERTICAL, type);
+        EXPECT_NEAR(ReplayTrace(tracker, trace, TRACE_SIZE), FLING_VELOCITY, FLING_VELOCITY * VELOCITY_TOLERANCE);
+        EXPECT_EQ(tracker.GetTrackCount(), VelocityTracker::HISTORY_SIZE);
+    }
+}
+
+/**
+ * @tc.name: VelocityTrackerTest002
+ * @tc.desc: Test VelocityTracker on a recorded decelerating fling with jittered timestamps
+ * @tc.type: FUNC
+ */
+HWTEST_F(GesturesTestNg, VelocityTrackerTest002, TestSize.Level1)
+{
+    TracePoint trace[TRACE_SIZE];
+    RecordFling(trace, TRACE_SIZE);
+    double expected = FLING_VELOCITY - 2 * FLING_DECELERATION * trace[TRACE_SIZE - 1].time;
+
+    /**
+     * @tc.steps: step1. replay the fling with the least square estimator.
+     * @tc.expected: step1. the quadratic fit returns the velocity at the release.
+     */
+    VelocityTracker tracker(Axis::VERTICAL);
+    EXPECT_EQ(tracker.GetEstimatorType(), VelocityEstimatorType::LEAST_SQUARES);
+    EXPECT_NEAR(ReplayTrace(tracker, trace, TRACE_SIZE), expected, std::abs(expected) * VELOCITY_TOLERANCE);
+
+    /**
+     * @tc.steps: step2. replay the fling with the other estimators on a short window.
+     * @tc.expected: step2. they trail the deceleration within the tolerance.
+     */
+    for (auto type : { VelocityEstimatorType::IMPULSE, VelocityEstimatorType::WEIGHTED_RECENT }) {
+        tracker.SetEstimatorType(type);
+        tracker.SetWindowSize(3);
+        EXPECT_NEAR(ReplayTrace(tracker, trace, TRACE_SIZE), expected, std::abs(expected) * FLING_TOLERANCE);
+    }
+}
+
+/**
+ * @tc.name: VelocityTrackerTest003
+ * @tc.desc: Test the window size and horizon of VelocityTracker
+ * @tc.type: FUNC
+ */
+HWTEST_F(GesturesTestNg, VelocityTrackerTest003, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. set window sizes out of range.
+     * @tc.expected: step1. the window size is clamped into [2, HISTORY_SIZE].
+     */
+    VelocityTracker tracker(Axis::HORIZONTAL);
+    EXPECT_EQ(tracker.GetWindowSize(), VelocityTracker::DEFAULT_WINDOW_SIZE);
+    tracker.SetWindowSize(0);
+    EXPECT_EQ(tracker.GetWindowSize(), 2);
+    tracker.SetWindowSize(VelocityTracker::HISTORY_SIZE + 1);
+    EXPECT_EQ(tracker.GetWindowSize(), VelocityTracker::HISTORY_SIZE);
+
+    /**
+     * @tc.steps: step2. move, then pause longer than the horizon and move again.
+     * @tc.expected: step2. only one point is in the horizon, so the velocity is zero.
+     */
+    TracePoint trace[] = { { 0.0, 0.0, 0.0 }, { INPUT_INTERVAL, 10.0, 0.0 }, { 2 * INPUT_INTERVAL, 20.0, 0.0 },
+        { 2 * INPUT_INTERVAL + 2 * VelocityTracker::DEFAULT_HORIZON, 30.0, 0.0 } };
+    EXPECT_EQ(ReplayTrace(tracker, trace, 4), 0.0);
+
+    /**
+     * @tc.steps: step3. widen the horizon over the pause.
+     * @tc.expected: step3. the points before the pause are used again.
+     */
+    tracker.SetHorizon(1.0);
+    EXPECT_NE(ReplayTrace(tracker, trace, 4), 0.0);
+
+    /**
+     * @tc.steps: step4. replay a single point.
+     * @tc.expected: step4. the velocity is zero.
+     */
+    EXPECT_EQ(ReplayTrace(tracker, trace, 1), 0.0);
+}
 } // namespace OHOS::Ace::NG
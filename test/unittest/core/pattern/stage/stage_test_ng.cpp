@@ -45,6 +45,46 @@ constexpr int32_t CHECK_BOX_ID_FIRST = 4;
 constexpr int32_t CHECK_BOX_ID_SECOND = 5;
 constexpr int32_t CHECK_BOX_ID_THIRD = 6;
 constexpr int32_t CHECK_BOX_ID_FOURTH = 6;
+constexpr size_t HIBERNATION_SIZE = 1024;
+
+class HibernationTestPattern : public Pattern {
+    DECLARE_ACE_TYPE(HibernationTestPattern, Pattern);
+
+public:
+    HibernationTestPattern() = default;
+    ~HibernationTestPattern() override = default;
+
+    size_t GetHibernationSize() const override
+    {
+        return isHibernated_ ? 0 : HIBERNATION_SIZE;
+    }
+
+    void OnHibernate() override
+    {
+        isHibernated_ = true;
+        ++hibernateCount_;
+    }
+
+    void OnRehydrate() override
+    {
+        isHibernated_ = false;
+        ++rehydrateCount_;
+    }
+
+    bool isHibernated_ = false;
+    int32_t hibernateCount_ = 0;
+    int32_t rehydrateCount_ = 0;
+};
+
+RefPtr<FrameNode> CreateHibernationPage(int32_t pageId, RefPtr<HibernationTestPattern>& pattern)
+{
+    auto page =
+        FrameNode::CreateFrameNode("page", pageId, AceType::MakeRefPtr<PagePattern>(AceType::MakeRefPtr<PageInfo>()));
+    pattern = AceType::MakeRefPtr<HibernationTestPattern>();
+    auto child = FrameNode::CreateFrameNode(FRAME_NODE_TAG, ElementRegister::GetInstance()->MakeUniqueId(), pattern);
+    page->AddChild(child);
+    return page;
+}
 } // namespace
 
 class StageTestNg : public testing::Test {
@@ -287,4 +327,76 @@ HWTEST_F(StageTestNg, StageManagerTest001, TestSize.Level1)
     size = stageNode->GetChildren().size();
     EXPECT_EQ(size, 1);
 }
-} // namespace OHOS::Ace::NG
\ No newline at end of file
+
+/**
+ * @tc.name: StageManagerTest002
+ * @tc.desc: Test the hidden pages beyond the hibernation budget are hibernated and rehydrated when shown.
+ * @tc.type: FUNC
+ */
+HWTEST_F(StageTestNg, StageManagerTest002, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. Create a StageManager whose budget holds one hidden page, and three pages.
+     */
+    auto stageNode = FrameNode::CreateFrameNode(FRAME_NODE_TAG, 0, AceType::MakeRefPtr<StagePattern>());
+    StageManager stageManager(stageNode);
+    stageManager.SetHibernationBudget(HIBERNATION_SIZE);
+    RefPtr<HibernationTestPattern> firstPattern;
+    RefPtr<HibernationTestPattern> secondPattern;
+    RefPtr<HibernationTestPattern> thirdPattern;
+    auto firstNode = CreateHibernationPage(ElementRegister::GetInstance()->MakeUniqueId(), firstPattern);
+    auto secondNode = CreateHibernationPage(ElementRegister::GetInstance()->MakeUniqueId(), secondPattern);
+    auto thirdNode = CreateHibernationPage(ElementRegister::GetInstance()->MakeUniqueId(), thirdPattern);
+
+    /**
+     * @tc.steps: step2. Push the three pages.
+     * @tc.expected: step2. The first page hidden is hibernated, the second one fits in the budget.
+     */
+    stageManager.PushPage(firstNode, true, false);
+    stageManager.PushPage(secondNode, true, false);
+    EXPECT_EQ(stageManager.GetHiddenPagesSize(), HIBERNATION_SIZE);
+    EXPECT_FALSE(stageManager.IsPageHibernated(firstNode));
+    stageManager.PushPage(thirdNode, true, false);
+    EXPECT_TRUE(stageManager.IsPageHibernated(firstNode));
+    EXPECT_FALSE(stageManager.IsPageHibernated(secondNode));
+    EXPECT_EQ(firstPattern->hibernateCount_, 1);
+    EXPECT_EQ(secondPattern->hibernateCount_, 0);
+    EXPECT_EQ(stageManager.GetHiddenPagesSize(), HIBERNATION_SIZE);
+
+    /**
+     * @tc.steps: step3. Pop back to the second page, which is not hibernated.
+     * @tc.expected: step3. The tree of the second page is shown as it is.
+     */
+    stageManager.PopPage(true, false);
+    EXPECT_EQ(stageManager.GetLastPage(), secondNode);
+    EXPECT_EQ(secondPattern->rehydrateCount_, 0);
+    EXPECT_EQ(stageManager.GetHiddenPagesSize(), 0);
+
+    /**
+     * @tc.steps: step4. Hibernate hidden pages on memory pressure, then pop back to the first page.
+     * @tc.expected: step4. The first page is rehydrated once, the pages are kept in the stage.
+     */
+    stageManager.HibernateHiddenPages();
+    EXPECT_EQ(firstPattern->hibernateCount_, 1);
+    stageManager.PopPage(true, false);
+    EXPECT_EQ(stageManager.GetLastPage(), firstNode);
+    EXPECT_EQ(firstPattern->rehydrateCount_, 1);
+    EXPECT_FALSE(firstPattern->isHibernated_);
+    EXPECT_FALSE(stageManager.IsPageHibernated(firstNode));
+    EXPECT_EQ(firstNode->GetChildren().size(), 1);
+
+    /**
+     * @tc.steps: step5. Push another page and hibernate on memory pressure, then clean the stack.
+     * @tc.expected: step5. The cleaned page is forgotten.
+     */
+    RefPtr<HibernationTestPattern> fourthPattern;
+    auto fourthNode = CreateHibernationPage(ElementRegister::GetInstance()->MakeUniqueId(), fourthPattern);
+    stageManager.PushPage(fourthNode, true, false);
+    stageManager.HibernateHiddenPages();
+    EXPECT_EQ(firstPattern->hibernateCount_, 2);
+    EXPECT_TRUE(stageManager.IsPageHibernated(firstNode));
+    stageManager.CleanPageStack();
+    EXPECT_FALSE(stageManager.IsPageHibernated(firstNode));
+    EXPECT_TRUE(stageManager.hiddenPages_.empty());
+}
+} // namespace OHOS::Ace::NG